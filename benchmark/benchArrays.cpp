@@ -0,0 +1,145 @@
+/*  Arrays of Vector3, Quaternion and Xfo (array of structures) against
+    Vector3Array, QuaternionArray and XfoArray (structure of arrays).
+    The vector rotation is also compared with the batch rotateVectors functions and with
+    the two quaternion products Quaternion::rotateVector used before. */
+
+#include "gmXfoArray.h"
+#include "gmBatch.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 100000;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector()
+    {
+        return Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+    }
+
+    Quaternion randomQuaternion()
+    {
+        return Quaternion(randomVector().normalize(), randomRange(-PI, PI));
+    }
+
+    // Quaternion::rotateVector before the cross product form
+    Vector3 rotateVectorTwoProducts(const Quaternion& quat, const Vector3& vec)
+    {
+        Quaternion vq(vec.x, vec.y, vec.z, 0.0);
+        Quaternion pq = quat.conjugate() * (vq * quat);
+        return Vector3(pq.x, pq.y, pq.z);
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Vector3> vectors(COUNT), otherVectors(COUNT), outVectors(COUNT);
+    std::vector<Quaternion> quats(COUNT), otherQuats(COUNT), outQuats(COUNT);
+    std::vector<Xfo> xfos(COUNT), otherXfos(COUNT), outXfos(COUNT);
+    std::vector<double> dots(COUNT);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        vectors[i] = randomVector();
+        otherVectors[i] = randomVector();
+        quats[i] = randomQuaternion();
+        otherQuats[i] = randomQuaternion();
+        double scale = randomRange(0.5, 2.0);
+        xfos[i] = Xfo(quats[i], randomVector(), Vector3(scale, scale, scale));
+        otherXfos[i] = Xfo(otherQuats[i], randomVector(), Vector3(1.0, 1.0, 1.0));
+    }
+
+    Vector3Array vectorArray(vectors), otherVectorArray(otherVectors), outVectorArray(COUNT);
+    QuaternionArray quatArray(quats), otherQuatArray(otherQuats), outQuatArray(COUNT);
+    XfoArray xfoArray(xfos), otherXfoArray(otherXfos), outXfoArray(COUNT);
+
+    std::vector<gmbench::Result> results;
+
+    results.push_back(gmbench::run("Vector3::normalize loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outVectors[i] = vectors[i].normalize();
+    }, COUNT));
+    results.push_back(gmbench::run("Vector3Array::normalizeInPlace", [&](size_t) {
+        outVectorArray = vectorArray;
+        outVectorArray.normalizeInPlace();
+    }, COUNT));
+    results.push_back(gmbench::run("Vector3::dot loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            dots[i] = vectors[i].dot(otherVectors[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("Vector3Array::dot", [&](size_t) {
+        vectorArray.dot(otherVectorArray, &dots[0]);
+    }, COUNT));
+    results.push_back(gmbench::run("Vector3::cross loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outVectors[i] = vectors[i].cross(otherVectors[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("Vector3Array::cross", [&](size_t) {
+        vectorArray.cross(otherVectorArray, outVectorArray);
+    }, COUNT));
+    results.push_back(gmbench::run("Quaternion::operator* loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outQuats[i] = quats[i] * otherQuats[i];
+    }, COUNT));
+    results.push_back(gmbench::run("QuaternionArray::multiply", [&](size_t) {
+        quatArray.multiply(otherQuatArray, outQuatArray);
+    }, COUNT));
+    results.push_back(gmbench::run("Quaternion::slerp loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outQuats[i] = quats[i].slerp(otherQuats[i], 0.3);
+    }, COUNT));
+    results.push_back(gmbench::run("QuaternionArray::slerp", [&](size_t) {
+        quatArray.slerp(otherQuatArray, 0.3, outQuatArray);
+    }, COUNT));
+    results.push_back(gmbench::run("Quaternion::rotateVector loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outVectors[i] = quats[i].rotateVector(vectors[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("Quaternion::rotateVector loop, two products", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outVectors[i] = rotateVectorTwoProducts(quats[i], vectors[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("QuaternionArray::rotateVector", [&](size_t) {
+        quatArray.rotateVector(vectorArray, outVectorArray);
+    }, COUNT));
+    results.push_back(gmbench::run("rotateVectors, packed quaternions", [&](size_t) {
+        rotateVectors(quats[0].data(), vectors[0].data(), outVectors[0].data(), COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("Quaternion::rotateVector loop, one quaternion", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outVectors[i] = quats[0].rotateVector(vectors[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("rotateVectors, one quaternion", [&](size_t) {
+        rotateVectors(quats[0], vectors[0].data(), outVectors[0].data(), COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("Xfo::operator* loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outXfos[i] = xfos[i] * otherXfos[i];
+    }, COUNT));
+    results.push_back(gmbench::run("Xfo::compose loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            xfos[i].compose(otherXfos[i], outXfos[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("composeXfos", [&](size_t) {
+        composeXfos(&otherXfos[0], &xfos[0], &outXfos[0], COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("XfoArray::multiply", [&](size_t) {
+        xfoArray.multiply(otherXfoArray, outXfoArray);
+    }, COUNT));
+    results.push_back(gmbench::run("XfoArray::fromXfos + toXfos", [&](size_t) {
+        outXfoArray.fromXfos(xfos);
+        outXfoArray.toXfos(&outXfos[0]);
+    }, COUNT));
+
+    gmbench::report("100k elements, time per element", results);
+    return 0;
+}
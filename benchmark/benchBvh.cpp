@@ -0,0 +1,171 @@
+/*  TriangleBvh on a bumpy sphere of 320000 triangles.
+
+    The build is timed on 1 thread and on all the gmath::parallel threads, in milliseconds, then the refit
+    after the points moved. The queries are ray casts from around the mesh towards its center (most hit)
+    and closest points from random positions near its surface, like controls snapped to it: a loop of
+    single queries, then the batch
+    queries on 1 thread and on all of them, against a brute force loop over every triangle.
+    The numbers are per query, the ops/s column gives the queries per second. */
+
+#include "gmBvh.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    // a grid of SEGMENTS x SEGMENTS quads, two triangles each
+    const size_t SEGMENTS = 400;
+    const size_t QUERIES = 10000;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector(double size)
+    {
+        return Vector3(randomRange(-size, size), randomRange(-size, size), randomRange(-size, size));
+    }
+
+    void bumpySphere(std::vector<Vector3>& points, std::vector<unsigned int>& indices, double phase)
+    {
+        points.clear();
+        indices.clear();
+        for (size_t i=0; i<=SEGMENTS; i++)
+        {
+            for (size_t j=0; j<=SEGMENTS; j++)
+            {
+                double theta = PI * double(i) / double(SEGMENTS);
+                double phi = 2.0 * PI * double(j) / double(SEGMENTS);
+                double radius = 1.0 + 0.1 * sin(7.0*theta + phase) * cos(5.0*phi);
+                points.push_back(Vector3(radius * sin(theta) * cos(phi), radius * cos(theta), radius * sin(theta) * sin(phi)));
+            }
+        }
+        for (size_t i=0; i<SEGMENTS; i++)
+        {
+            for (size_t j=0; j<SEGMENTS; j++)
+            {
+                unsigned int a = (unsigned int)(i*(SEGMENTS+1) + j), b = a+1;
+                unsigned int c = a + (unsigned int)(SEGMENTS+1), d = c+1;
+                unsigned int quad[6] = { a, c, b, b, c, d };
+                indices.insert(indices.end(), quad, quad+6);
+            }
+        }
+    }
+
+    /** The first hit by testing every triangle, what a BVH saves. */
+    double bruteForceRaycast(const std::vector<Vector3>& points, const std::vector<unsigned int>& indices,
+                             const Vector3& origin, const Vector3& direction)
+    {
+        double best = DBL_MAX;
+        for (size_t t=0; t<indices.size(); t+=3)
+        {
+            const Vector3& a = points[indices[t]];
+            Vector3 edge1 = points[indices[t+1]] - a, edge2 = points[indices[t+2]] - a;
+            Vector3 p = direction.cross(edge2);
+            double det = edge1.dot(p);
+            if (det == 0.0)
+                continue;
+            Vector3 s = origin - a, q = s.cross(edge1);
+            double u = s.dot(p) / det, v = direction.dot(q) / det, distance = edge2.dot(q) / det;
+            if (u >= 0.0 && v >= 0.0 && u + v <= 1.0 && distance >= 0.0 && distance < best)
+                best = distance;
+        }
+        return best;
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Vector3> points, moved;
+    std::vector<unsigned int> indices, movedIndices;
+    bumpySphere(points, indices, 0.0);
+    bumpySphere(moved, movedIndices, 0.5);
+
+    std::vector<Vector3> origins(QUERIES), directions(QUERIES), positions(QUERIES);
+    for (size_t i=0; i<QUERIES; i++)
+    {
+        origins[i] = randomVector(1.0).normalize() * 3.0;
+        directions[i] = randomVector(0.5) - origins[i];
+        positions[i] = randomVector(1.0).normalize() * randomRange(0.8, 1.3);
+    }
+    std::vector<BvhRayHit> hits(QUERIES);
+    std::vector<BvhClosestPoint> closest(QUERIES);
+
+    size_t threads = parallel::getThreadCount();
+    char name[64];
+    TriangleBvh bvh;
+
+    printf("%u triangles\n\n", (unsigned int)(indices.size() / 3));
+    std::vector<gmbench::Result> results;
+    parallel::setThreadCount(1);
+    results.push_back(gmbench::run("build, 1 thread", [&](size_t) {
+        bvh.build(points, indices);
+        gmbench::doNotOptimize(bvh.getNodes()[0]);
+    }));
+    parallel::setThreadCount(threads);
+    snprintf(name, sizeof(name), "build, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        bvh.build(points, indices);
+        gmbench::doNotOptimize(bvh.getNodes()[0]);
+    }));
+    results.push_back(gmbench::run("refit", [&](size_t i) {
+        bvh.refit(i % 2 ? points : moved);
+        gmbench::doNotOptimize(bvh.getNodes()[0]);
+    }));
+    printf("%-48s %14s\n", "benchmark", "ms");
+    for (size_t i=0; i<results.size(); i++)
+        printf("%-48s %14.3f\n", results[i].name.c_str(), results[i].nsPerOp * 1e-6);
+    printf("%u nodes\n\n", (unsigned int)bvh.getNodeCount());
+
+    bvh.build(points, indices);
+    results.clear();
+
+    // a few queries are enough for the brute force loops
+    const size_t BRUTE_QUERIES = 16;
+    results.push_back(gmbench::run("raycast, brute force", [&](size_t) {
+        for (size_t i=0; i<BRUTE_QUERIES; i++)
+            gmbench::doNotOptimize(bruteForceRaycast(points, indices, origins[i], directions[i]));
+    }, BRUTE_QUERIES));
+    results.push_back(gmbench::run("raycast, single queries", [&](size_t) {
+        for (size_t i=0; i<QUERIES; i++)
+            bvh.raycast(origins[i], directions[i], hits[i]);
+        gmbench::doNotOptimize(hits[0]);
+    }, QUERIES));
+    results.push_back(gmbench::run("closestPoint, single queries", [&](size_t) {
+        for (size_t i=0; i<QUERIES; i++)
+            bvh.closestPoint(positions[i], closest[i]);
+        gmbench::doNotOptimize(closest[0]);
+    }, QUERIES));
+
+    parallel::setThreadCount(1);
+    results.push_back(gmbench::run("raycast batch, 1 thread", [&](size_t) {
+        bvh.raycast(&origins[0], &directions[0], &hits[0], QUERIES);
+        gmbench::doNotOptimize(hits[0]);
+    }, QUERIES));
+    results.push_back(gmbench::run("closestPoints batch, 1 thread", [&](size_t) {
+        bvh.closestPoints(&positions[0], &closest[0], QUERIES);
+        gmbench::doNotOptimize(closest[0]);
+    }, QUERIES));
+
+    parallel::setThreadCount(threads);
+    snprintf(name, sizeof(name), "raycast batch, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        bvh.raycast(&origins[0], &directions[0], &hits[0], QUERIES);
+        gmbench::doNotOptimize(hits[0]);
+    }, QUERIES));
+    snprintf(name, sizeof(name), "closestPoints batch, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        bvh.closestPoints(&positions[0], &closest[0], QUERIES);
+        gmbench::doNotOptimize(closest[0]);
+    }, QUERIES));
+
+    gmbench::report("TriangleBvh queries (ns per query)", results);
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*  Decomposition of matrices into Xfos and removal of the drift of rotation matrices.
+
+    The error table prints how far each method leaves a drifting rotation from orthonormal and
+    how much it moves it. The timings are per matrix over arrays of COUNT matrices: a loop of the
+    per object methods as the reference, then the batch functions on every instruction set. */
+
+#include "gmBatch.h"
+#include "gmSimd.h"
+#include "gmBenchmark.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 4096;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Quaternion randomRotation()
+    {
+        Vector3 axis(randomRange(-1.0, 1.0), randomRange(-1.0, 1.0), randomRange(-1.0, 1.0));
+        return Quaternion(axis.normalize(), randomRange(-PI, PI));
+    }
+
+    /** A rotation matrix after noise of the given size on every element, like a long chain of products. */
+    Matrix3 drifted(double noise)
+    {
+        Matrix3 mat(randomRotation());
+        double* m = mat.data();
+        for (int i=0; i<9; i++)
+            m[i] += randomRange(-noise, noise);
+        return mat;
+    }
+
+    double orthonormalError(const Matrix3& mat)
+    {
+        Matrix3 product = mat * mat.transpose();
+        const double* m = product.data();
+        double error = 0.0;
+        for (int i=0; i<9; i++)
+            error = fmax(error, fabs(m[i] - (i % 4 == 0 ? 1.0 : 0.0)));
+        return error;
+    }
+
+    double distance(const Matrix3& a, const Matrix3& b)
+    {
+        double sum = 0.0;
+        for (int i=0; i<9; i++)
+            sum += (a.data()[i] - b.data()[i]) * (a.data()[i] - b.data()[i]);
+        return sqrt(sum);
+    }
+
+    void errorTable()
+    {
+        const size_t SAMPLES = 100000;
+        const double NOISES[] = { 1.0e-6, 1.0e-3, 1.0e-1 };
+
+        printf("Orthonormalization of drifting rotations\n");
+        printf("%-16s %-14s %20s %20s\n", "noise", "method", "max | M Mt - I |", "mean distance moved");
+        for (size_t n=0; n<3; n++)
+        {
+            srand(1);
+            std::vector<Matrix3> in(SAMPLES), out(SAMPLES);
+            for (size_t i=0; i<SAMPLES; i++)
+                in[i] = drifted(NOISES[n]);
+
+            const OrthonormalizeMethod methods[] = { OrthonormalizeMethod::GRAM_SCHMIDT, OrthonormalizeMethod::POLAR };
+            const char* names[] = { "GRAM_SCHMIDT", "POLAR" };
+            for (int m=0; m<2; m++)
+            {
+                orthonormalizeMatrices(in.data(), out.data(), SAMPLES, methods[m]);
+                double maxError = 0.0, moved = 0.0;
+                for (size_t i=0; i<SAMPLES; i++)
+                {
+                    maxError = fmax(maxError, orthonormalError(out[i]));
+                    moved += distance(in[i], out[i]);
+                }
+                printf("%-16g %-14s %20.3e %20.3e\n", NOISES[n], names[m], maxError, moved / double(SAMPLES));
+            }
+        }
+        printf("\n");
+    }
+}
+
+int main()
+{
+    errorTable();
+
+    srand(2);
+    std::vector<Matrix4> matrices(COUNT);
+    std::vector<Matrix3> rotations(COUNT), outRotations(COUNT);
+    std::vector<Xfo> xfos(COUNT);
+    std::vector<double> shears(COUNT*3);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        Vector3 tr(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+        Vector3 sc(randomRange(0.5, 2.0), randomRange(0.5, 2.0), randomRange(0.5, 2.0));
+        matrices[i] = Xfo(randomRotation(), tr, sc).toMatrix4();
+        rotations[i] = drifted(1.0e-6);
+    }
+
+    std::vector<gmbench::Result> results;
+    results.push_back(gmbench::run("Matrix4 getScale + setScale + toQuaternion", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+        {
+            Matrix4 mat = matrices[i];
+            Xfo& xfo = xfos[i];
+            xfo.sc = mat.getScale();
+            xfo.tr = mat.getPosition();
+            mat.setScale(Vector3(1.0, 1.0, 1.0));
+            xfo.ori = mat.toQuaternion();
+        }
+        gmbench::doNotOptimize(xfos[0]);
+    }, COUNT));
+    results.push_back(gmbench::run("Matrix3::orthogonal", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outRotations[i] = rotations[i].orthogonal();
+        gmbench::doNotOptimize(outRotations[0]);
+    }, COUNT));
+    gmbench::report("Per matrix loops (ns per matrix)", results);
+    printf("\n");
+
+    simd::InstructionSet best = simd::detectInstructionSet();
+    for (int set=0; set<=static_cast<int>(best); set++)
+    {
+        simd::setInstructionSet(static_cast<simd::InstructionSet>(set));
+
+        results.clear();
+        results.push_back(gmbench::run("decomposeMatrices", [&](size_t) {
+            decomposeMatrices(matrices.data(), xfos.data(), COUNT);
+            gmbench::doNotOptimize(xfos[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("decomposeMatrices with shears", [&](size_t) {
+            decomposeMatrices(matrices.data(), xfos.data(), COUNT, shears.data());
+            gmbench::doNotOptimize(xfos[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("orthonormalizeMatrices GRAM_SCHMIDT", [&](size_t) {
+            orthonormalizeMatrices(rotations.data(), outRotations.data(), COUNT, OrthonormalizeMethod::GRAM_SCHMIDT);
+            gmbench::doNotOptimize(outRotations[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("orthonormalizeMatrices POLAR", [&](size_t) {
+            orthonormalizeMatrices(rotations.data(), outRotations.data(), COUNT, OrthonormalizeMethod::POLAR);
+            gmbench::doNotOptimize(outRotations[0]);
+        }, COUNT));
+
+        std::string title = std::string("Batch decomposition, ") + simd::instructionSetName(simd::getInstructionSet()) + " (ns per matrix)";
+        gmbench::report(title.c_str(), results);
+        printf("\n");
+    }
+    simd::setInstructionSet(best);
+
+    return 0;
+}
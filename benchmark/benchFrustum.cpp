@@ -0,0 +1,112 @@
+/*  Frustum culling of the controls and proxies of a large scene, 1000000 spheres and 1000000 boxes
+    spread around a camera that sees about a third of them.
+
+    The reference is the loop a viewport writes by hand, Frustum::overlapsSphere and Frustum::overlaps
+    on each object, to the same bit mask. Then the batch functions on 1 thread and on all the
+    gmath::parallel threads, on every instruction set, in ns per object. */
+
+#include "gmFrustum.h"
+#include "gmSimd.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t OBJECTS = 1000000;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector(double size)
+    {
+        return Vector3(randomRange(-size, size), randomRange(-size, size), randomRange(-size, size));
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Vector3> centers(OBJECTS);
+    std::vector<double> radii(OBJECTS);
+    std::vector<AABB> boxes(OBJECTS);
+    for (size_t i=0; i<OBJECTS; i++)
+    {
+        centers[i] = randomVector(100.0);
+        radii[i] = randomRange(0.1, 1.0);
+        Vector3 halfSize(randomRange(0.1, 1.0), randomRange(0.1, 1.0), randomRange(0.1, 1.0));
+        boxes[i] = AABB(centers[i] - halfSize, centers[i] + halfSize);
+    }
+
+    Matrix4 camera = Matrix4::createLookAt(Vector3(0.0, 20.0, 100.0), Vector3(0.0, 0.0, 0.0), Vector3(0.0, 21.0, 100.0),
+                                           Axis::NEGZ, Axis::POSY);
+    Frustum frustum(camera.inverse() * Matrix4::createPerspective(0.8, 16.0/9.0, 0.1, 200.0));
+    std::vector<unsigned char> visible((OBJECTS + 7) / 8);
+
+    std::vector<gmbench::Result> results;
+    results.push_back(gmbench::run("overlapsSphere loop", [&](size_t) {
+        for (size_t i=0; i<OBJECTS; i++)
+        {
+            if (i % 8 == 0)
+                visible[i/8] = 0;
+            if (frustum.overlapsSphere(centers[i], radii[i]))
+                visible[i/8] |= (unsigned char)(1 << (i % 8));
+        }
+        gmbench::doNotOptimize(visible[0]);
+    }, OBJECTS));
+    results.push_back(gmbench::run("overlaps AABB loop", [&](size_t) {
+        for (size_t i=0; i<OBJECTS; i++)
+        {
+            if (i % 8 == 0)
+                visible[i/8] = 0;
+            if (frustum.overlaps(boxes[i]))
+                visible[i/8] |= (unsigned char)(1 << (i % 8));
+        }
+        gmbench::doNotOptimize(visible[0]);
+    }, OBJECTS));
+    gmbench::report("Per object loop, 1000000 objects (ns per object)", results);
+    printf("\n");
+
+    size_t threads = parallel::getThreadCount();
+    char name[64];
+    simd::InstructionSet best = simd::detectInstructionSet();
+    for (int set=0; set<=static_cast<int>(best); set++)
+    {
+        simd::setInstructionSet(static_cast<simd::InstructionSet>(set));
+        results.clear();
+
+        parallel::setThreadCount(1);
+        results.push_back(gmbench::run("cullSpheres, 1 thread", [&](size_t) {
+            gmbench::doNotOptimize(frustum.cullSpheres(centers, radii, visible));
+        }, OBJECTS));
+        results.push_back(gmbench::run("cullBoxes, 1 thread", [&](size_t) {
+            gmbench::doNotOptimize(frustum.cullBoxes(boxes, visible));
+        }, OBJECTS));
+
+        parallel::setThreadCount(threads);
+        snprintf(name, sizeof(name), "cullSpheres, %u threads", (unsigned int)threads);
+        results.push_back(gmbench::run(name, [&](size_t) {
+            gmbench::doNotOptimize(frustum.cullSpheres(centers, radii, visible));
+        }, OBJECTS));
+        snprintf(name, sizeof(name), "cullBoxes, %u threads", (unsigned int)threads);
+        results.push_back(gmbench::run(name, [&](size_t) {
+            gmbench::doNotOptimize(frustum.cullBoxes(boxes, visible));
+        }, OBJECTS));
+
+        std::string title = std::string("Frustum culling, 1000000 objects, ") + simd::instructionSetName(simd::getInstructionSet()) + " (ns per object)";
+        gmbench::report(title.c_str(), results);
+        printf("\n");
+    }
+    simd::setInstructionSet(best);
+
+    printf("%u of %u spheres and %u of %u boxes are visible\n",
+           (unsigned int)frustum.cullSpheres(centers, radii, visible), (unsigned int)OBJECTS,
+           (unsigned int)frustum.cullBoxes(boxes, visible), (unsigned int)OBJECTS);
+
+    return 0;
+}
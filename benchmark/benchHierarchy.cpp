@@ -0,0 +1,121 @@
+/*  Global transforms of a crowd: 100 characters of 100 joints, 10000 transforms in total.
+
+    The naive version walks up the parents of every joint, TransformHierarchy::computeGlobals
+    evaluates each joint once, level by level, on 1 thread and on all the gmath::parallel threads.
+    XfoCache then moves one control (the start of an arm) and only updates the joints under it.
+    The numbers are per call, for the whole crowd. */
+
+#include "gmTransformCache.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t CHARACTERS = 100;
+    const size_t JOINTS = 100;
+    const size_t COUNT = CHARACTERS * JOINTS;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector()
+    {
+        return Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+    }
+
+    /** A spine of 10 joints with 3 chains of 30 joints (two arms and a tail, let's say) under it. */
+    int characterParent(size_t joint)
+    {
+        if (joint == 0)
+            return -1;
+        if (joint < 10)
+            return int(joint - 1);
+        size_t chain = (joint - 10) % 30;
+        return chain == 0 ? 9 : int(joint - 1);
+    }
+
+    template <typename T>
+    T naiveGlobal(const std::vector<int>& parents, const std::vector<T>& locals, size_t index)
+    {
+        T global = locals[index];
+        for (int parent=parents[index]; parent>=0; parent=parents[parent])
+            global = global * locals[parent];
+        return global;
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<int> parents(COUNT);
+    for (size_t c=0; c<CHARACTERS; c++)
+    {
+        for (size_t j=0; j<JOINTS; j++)
+        {
+            int parent = characterParent(j);
+            parents[c*JOINTS + j] = parent < 0 ? -1 : int(c*JOINTS) + parent;
+        }
+    }
+    TransformHierarchy hierarchy(parents);
+
+    std::vector<Xfo> locals(COUNT), globals(COUNT);
+    std::vector<Matrix4> localMatrices(COUNT), globalMatrices(COUNT);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        locals[i] = Xfo(Quaternion(randomVector().normalize(), randomRange(-0.5, 0.5)), randomVector(), Vector3(1.0, 1.0, 1.0));
+        localMatrices[i] = locals[i].toMatrix4();
+    }
+
+    size_t threads = parallel::getThreadCount();
+    std::vector<gmbench::Result> results;
+
+    results.push_back(gmbench::run("Xfo naive parent walk", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            globals[i] = naiveGlobal(parents, locals, i);
+    }));
+    results.push_back(gmbench::run("Matrix4 naive parent walk", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            globalMatrices[i] = naiveGlobal(parents, localMatrices, i);
+    }));
+
+    parallel::setThreadCount(1);
+    results.push_back(gmbench::run("Xfo computeGlobals, 1 thread", [&](size_t) {
+        hierarchy.computeGlobals(locals, globals);
+    }));
+    results.push_back(gmbench::run("Matrix4 computeGlobals, 1 thread", [&](size_t) {
+        hierarchy.computeGlobals(localMatrices, globalMatrices);
+    }));
+
+    parallel::setThreadCount(threads);
+    char name[64];
+    snprintf(name, sizeof(name), "Xfo computeGlobals, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        hierarchy.computeGlobals(locals, globals);
+    }));
+    snprintf(name, sizeof(name), "Matrix4 computeGlobals, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        hierarchy.computeGlobals(localMatrices, globalMatrices);
+    }));
+
+    XfoCache cache(hierarchy);
+    cache.setLocals(locals);
+    results.push_back(gmbench::run("XfoCache full update (globals and inverses)", [&](size_t) {
+        cache.markAllDirty();
+        cache.update();
+    }));
+    results.push_back(gmbench::run("XfoCache update after moving one arm", [&](size_t i) {
+        cache.setLocal((i % CHARACTERS) * JOINTS + 10, locals[i % COUNT]);
+        cache.update();
+    }));
+    printf("XfoCache recomputed %llu joints for one arm\n\n", (unsigned long long)cache.getLastRecomputedCount());
+
+    gmbench::report("Global transforms of 10000 joints (ns per call)", results);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*  Per operation cost of the small arithmetic.
+
+    The same file is built twice by "./waf bench":
+    benchInline links against gmath-static, so every operation is a function call,
+    benchInlineHeaderOnly is built with GMATH_HEADER_ONLY and lets the compiler inline them. */
+
+#include "gmVector3.h"
+#include "gmMatrix4.h"
+#include "gmQuaternion.h"
+#include "gmXfo.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 1024;
+    const size_t MASK = COUNT-1;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector()
+    {
+        return Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+    }
+
+    Quaternion randomQuaternion()
+    {
+        return Quaternion(randomVector().normalize(), randomRange(-PI, PI));
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Vector3> vectors(COUNT), outVectors(COUNT);
+    std::vector<Quaternion> quats(COUNT), outQuats(COUNT);
+    std::vector<Matrix4> matrices(COUNT), outMatrices(COUNT);
+    std::vector<Xfo> xfos(COUNT), outXfos(COUNT);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        vectors[i] = randomVector();
+        quats[i] = randomQuaternion();
+        xfos[i] = Xfo(quats[i], randomVector(), Vector3(1.0, 1.0, 1.0));
+        matrices[i] = xfos[i].toMatrix4();
+    }
+
+    std::vector<gmbench::Result> results;
+
+    results.push_back(gmbench::run("Vector3::operator+", [&](size_t i) {
+        outVectors[i&MASK] = vectors[i&MASK] + vectors[(i+1)&MASK];
+    }));
+    results.push_back(gmbench::run("Vector3::operator*(double)", [&](size_t i) {
+        outVectors[i&MASK] = vectors[i&MASK] * 0.5;
+    }));
+    results.push_back(gmbench::run("Vector3::dot", [&](size_t i) {
+        double d = vectors[i&MASK].dot(vectors[(i+1)&MASK]);
+        gmbench::doNotOptimize(d);
+    }));
+    results.push_back(gmbench::run("Vector3::cross", [&](size_t i) {
+        outVectors[i&MASK] = vectors[i&MASK].cross(vectors[(i+1)&MASK]);
+    }));
+    results.push_back(gmbench::run("Vector3::normalize", [&](size_t i) {
+        outVectors[i&MASK] = vectors[i&MASK].normalize();
+    }));
+    results.push_back(gmbench::run("Vector3::operator*(Matrix4)", [&](size_t i) {
+        outVectors[i&MASK] = vectors[i&MASK] * matrices[(i+1)&MASK];
+    }));
+    results.push_back(gmbench::run("Matrix4::operator*(Matrix4)", [&](size_t i) {
+        outMatrices[i&MASK] = matrices[i&MASK] * matrices[(i+1)&MASK];
+    }));
+    results.push_back(gmbench::run("Matrix4::inverse", [&](size_t i) {
+        outMatrices[i&MASK] = matrices[i&MASK].inverse();
+    }));
+    results.push_back(gmbench::run("Quaternion::operator*", [&](size_t i) {
+        outQuats[i&MASK] = quats[i&MASK] * quats[(i+1)&MASK];
+    }));
+    results.push_back(gmbench::run("Quaternion::rotateVector", [&](size_t i) {
+        outVectors[i&MASK] = quats[i&MASK].rotateVector(vectors[(i+1)&MASK]);
+    }));
+    results.push_back(gmbench::run("Xfo::operator*", [&](size_t i) {
+        outXfos[i&MASK] = xfos[i&MASK] * xfos[(i+1)&MASK];
+    }));
+    results.push_back(gmbench::run("Xfo::transformVector", [&](size_t i) {
+        outVectors[i&MASK] = xfos[i&MASK].transformVector(vectors[(i+1)&MASK]);
+    }));
+
+    #ifdef GMATH_HEADER_ONLY
+        gmbench::report("GMath per operation cost (GMATH_HEADER_ONLY)", results);
+    #else
+        gmbench::report("GMath per operation cost (gmath-static)", results);
+    #endif
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*  Lines and rays against planes over arrays, like the contacts of the feet of a crowd with the ground.
+    The segments join the positions of a foot on two consecutive frames, about a third of them cross
+    the ground. The timings are per segment: a loop of intersectLinePlane as the reference, then the
+    batch functions against one plane and against a plane per segment on every instruction set, for
+    SMALL segments that stay in the cache and LARGE ones that come from memory. */
+
+#include "gmBatch.h"
+#include "gmSimd.h"
+#include "gmBenchmark.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t SMALL = 4096;
+    const size_t LARGE = 1000000;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    struct Segments
+    {
+        std::vector<double> p0, p1, directions, normals, points, out;
+        std::vector<unsigned char> types;
+
+        explicit Segments(size_t count)
+            : p0(count*3), p1(count*3), directions(count*3), normals(count*3), points(count*3), out(count*3), types(count)
+        {
+            for (size_t i=0; i<count; i++)
+            {
+                // a foot a little above or under the ground, moving forward and up or down
+                double x = randomRange(-50.0, 50.0), y = randomRange(-0.05, 0.1), z = randomRange(-50.0, 50.0);
+                double* a = &p0[i*3];
+                double* b = &p1[i*3];
+                a[0] = x;                          a[1] = y;                          a[2] = z;
+                b[0] = x + randomRange(0.0, 0.05); b[1] = y + randomRange(-0.05, 0.05); b[2] = z + randomRange(0.0, 0.05);
+                for (int c=0; c<3; c++)
+                    directions[i*3+c] = b[c] - a[c];
+
+                // uneven ground: a slightly tilted plane under every foot
+                Vector3 normal = Vector3(randomRange(-0.1, 0.1), 1.0, randomRange(-0.1, 0.1)).normalize();
+                normals[i*3] = normal.x;
+                normals[i*3+1] = normal.y;
+                normals[i*3+2] = normal.z;
+                points[i*3] = x;
+                points[i*3+1] = randomRange(-0.01, 0.01);
+                points[i*3+2] = z;
+            }
+        }
+
+        size_t size() const
+        {
+            return types.size();
+        }
+    };
+
+    void run(Segments& s, const char* size)
+    {
+        const Vector3 normal(0.0, 1.0, 0.0), point(0.0, 0.0, 0.0);
+        const size_t count = s.size();
+
+        std::vector<gmbench::Result> results;
+        results.push_back(gmbench::run("intersectLinePlane loop, segments", [&](size_t) {
+            size_t hits = 0;
+            for (size_t i=0; i<count; i++)
+            {
+                Vector3 a(s.p0[i*3], s.p0[i*3+1], s.p0[i*3+2]), b(s.p1[i*3], s.p1[i*3+1], s.p1[i*3+2]), hit;
+                IntersectionType type = intersectLinePlane(hit, a, b, normal, point, false);
+                s.types[i] = (unsigned char)type;
+                if (type == IntersectionType::INTERSECTION)
+                {
+                    s.out[i*3] = hit.x;
+                    s.out[i*3+1] = hit.y;
+                    s.out[i*3+2] = hit.z;
+                    hits++;
+                }
+            }
+            gmbench::doNotOptimize(hits);
+        }, count));
+        gmbench::report((std::string("Per segment loop, ") + size + " (ns per segment)").c_str(), results);
+        printf("\n");
+
+        simd::InstructionSet best = simd::detectInstructionSet();
+        for (int set=0; set<=static_cast<int>(best); set++)
+        {
+            simd::setInstructionSet(static_cast<simd::InstructionSet>(set));
+            results.clear();
+            results.push_back(gmbench::run("intersectLinesPlane, segments", [&](size_t) {
+                gmbench::doNotOptimize(intersectLinesPlane(&s.p0[0], &s.p1[0], normal, point, &s.out[0], &s.types[0], count, false));
+            }, count));
+            results.push_back(gmbench::run("intersectLinesPlanes, segments", [&](size_t) {
+                gmbench::doNotOptimize(intersectLinesPlanes(&s.p0[0], &s.p1[0], &s.normals[0], &s.points[0], &s.out[0], &s.types[0], count, false));
+            }, count));
+            results.push_back(gmbench::run("intersectRaysPlane", [&](size_t) {
+                gmbench::doNotOptimize(intersectRaysPlane(&s.p0[0], &s.directions[0], normal, point, &s.out[0], &s.types[0], count));
+            }, count));
+            results.push_back(gmbench::run("intersectRaysPlanes", [&](size_t) {
+                gmbench::doNotOptimize(intersectRaysPlanes(&s.p0[0], &s.directions[0], &s.normals[0], &s.points[0], &s.out[0], &s.types[0], count));
+            }, count));
+            std::string title = std::string("Batch intersections, ") + size + ", " + simd::instructionSetName(simd::getInstructionSet()) + " (ns per segment)";
+            gmbench::report(title.c_str(), results);
+            printf("\n");
+        }
+        simd::setInstructionSet(best);
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    Segments small(SMALL);
+    run(small, "4096 segments");
+
+    Segments large(LARGE);
+    run(large, "1000000 segments");
+
+    size_t hits = intersectLinesPlane(&large.p0[0], &large.p1[0], Vector3(0.0, 1.0, 0.0), Vector3(0.0, 0.0, 0.0),
+                                      &large.out[0], &large.types[0], LARGE, false);
+    printf("%u of %u segments cross the ground\n", (unsigned int)hits, (unsigned int)LARGE);
+
+    return 0;
+}
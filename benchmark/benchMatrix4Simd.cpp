@@ -0,0 +1,63 @@
+/*  Matrix4 multiply, inverse and transpose with every instruction set supported by this CPU. */
+
+#include "gmMatrix4.h"
+#include "gmQuaternion.h"
+#include "gmSimd.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 1024;
+    const size_t MASK = COUNT-1;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Matrix4> matrices(COUNT), outMatrices(COUNT);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        Quaternion q(Vector3(randomRange(-1.0, 1.0), randomRange(-1.0, 1.0), 1.0).normalize(), randomRange(-PI, PI));
+        matrices[i] = Matrix4(q, Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0)));
+    }
+
+    simd::InstructionSet best = simd::detectInstructionSet();
+    for (int set=0; set<=static_cast<int>(best); set++)
+    {
+        simd::setInstructionSet(static_cast<simd::InstructionSet>(set));
+
+        std::vector<gmbench::Result> results;
+        results.push_back(gmbench::run("Matrix4::operator*(Matrix4)", [&](size_t i) {
+            outMatrices[i&MASK] = matrices[i&MASK] * matrices[(i+1)&MASK];
+        }));
+        results.push_back(gmbench::run("Matrix4::inverse", [&](size_t i) {
+            outMatrices[i&MASK] = matrices[i&MASK].inverse();
+        }));
+        results.push_back(gmbench::run("Matrix4::transposeInPlace", [&](size_t i) {
+            outMatrices[i&MASK].transposeInPlace();
+        }));
+
+        results.push_back(gmbench::run("simd::multiply4x4", [&](size_t i) {
+            simd::multiply4x4(matrices[i&MASK].data(), matrices[(i+1)&MASK].data(), outMatrices[i&MASK].data());
+        }));
+        results.push_back(gmbench::run("simd::inverse4x4", [&](size_t i) {
+            simd::inverse4x4(matrices[i&MASK].data(), outMatrices[i&MASK].data());
+        }));
+
+        std::string title = std::string("Matrix4 kernels, ") + simd::instructionSetName(simd::getInstructionSet());
+        gmbench::report(title.c_str(), results);
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,944 @@
+/*  Cost of every public operation of Vector3, Matrix3, Matrix4, Quaternion, Xfo, Euler
+    and of the useful functions, one call at a time on data that fits in the L1 cache.
+    Left out: the Maya conversions and Xfo get/set Local/GlobalXfo (only in the Maya build),
+    data() and the overloads of set and the constructors taking arrays.
+
+        benchOperations [--filter=text] [--min-time=secs] [--json=path]
+
+    bytes/op counts the arguments read and the result written by one call.
+    The JSON file can be kept to compare two releases (or two commits). */
+
+#include "gmUsefulFunctions.h"
+#include "gmSimd.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+using gmbench::bytesOf;
+
+namespace
+{
+    const size_t COUNT = 1024;
+    const size_t MASK = COUNT-1;
+
+    /** Two different elements of the pools for the iteration i. */
+    inline size_t A(size_t i) { return i & MASK; }
+    inline size_t B(size_t i) { return (i+1) & MASK; }
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector()
+    {
+        return Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+    }
+
+    Quaternion randomQuaternion()
+    {
+        return Quaternion(randomVector().normalize(), randomRange(-PI, PI));
+    }
+
+    struct Data
+    {
+        std::vector<double> scalars, outScalars;
+        std::vector<Vector3> vectors, otherVectors, outVectors, outVectors2;
+        std::vector<Euler> eulers, outEulers;
+        std::vector<Matrix3> matrices3, outMatrices3;
+        std::vector<Matrix3> symmetrics3;
+        std::vector<Matrix4> matrices4, outMatrices4;
+        std::vector<Quaternion> quats, otherQuats, outQuats;
+        std::vector<Xfo> xfos, otherXfos, outXfos;
+        std::vector<IntersectionType> outIntersections;
+
+        Data()
+            : scalars(COUNT), outScalars(COUNT),
+              vectors(COUNT), otherVectors(COUNT), outVectors(COUNT), outVectors2(COUNT),
+              eulers(COUNT), outEulers(COUNT),
+              matrices3(COUNT), outMatrices3(COUNT), symmetrics3(COUNT), matrices4(COUNT), outMatrices4(COUNT),
+              quats(COUNT), otherQuats(COUNT), outQuats(COUNT),
+              xfos(COUNT), otherXfos(COUNT), outXfos(COUNT), outIntersections(COUNT)
+        {
+            for (size_t i=0; i<COUNT; i++)
+            {
+                scalars[i] = randomRange(0.1, 1.0);
+                vectors[i] = randomVector();
+                otherVectors[i] = randomVector();
+                eulers[i] = Euler(randomRange(-PI, PI), randomRange(-PI, PI), randomRange(-PI, PI));
+                quats[i] = randomQuaternion();
+                otherQuats[i] = randomQuaternion();
+                double scale = randomRange(0.5, 2.0);
+                xfos[i] = Xfo(quats[i], randomVector(), Vector3(scale, scale, scale));
+                otherXfos[i] = Xfo(otherQuats[i], randomVector(), Vector3(1.0, 1.0, 1.0));
+                matrices3[i] = quats[i].toMatrix3();
+                symmetrics3[i] = matrices3[i] + matrices3[i].transpose() * randomRange(0.5, 2.0);
+                matrices4[i] = xfos[i].toMatrix4();
+            }
+        }
+    };
+
+    void benchVector3(gmbench::Suite& suite, Data& d)
+    {
+        typedef Vector3 V;
+        size_t unary = bytesOf<V, V>();
+        size_t binary = bytesOf<V, V, V>();
+        size_t scalar = bytesOf<V, double, V>();
+
+        suite.add("Vector3::Vector3(x, y, z)", bytesOf<double, double, double, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = V(d.scalars[A(i)], d.scalars[B(i)], 1.0);
+        });
+        suite.add("Vector3::Vector3(const double*)", unary, [&](size_t i) {
+            d.outVectors[A(i)] = V(d.vectors[A(i)].data());
+        });
+        suite.add("Vector3::operator[]", bytesOf<V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)][int(i % 3)];
+        });
+        suite.add("Vector3::operator+", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] + d.otherVectors[B(i)];
+        });
+        suite.add("Vector3::operator-", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] - d.otherVectors[B(i)];
+        });
+        suite.add("Vector3::operator-()", unary, [&](size_t i) {
+            d.outVectors[A(i)] = -d.vectors[A(i)];
+        });
+        suite.add("Vector3::operator*(double)", scalar, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] * d.scalars[B(i)];
+        });
+        suite.add("Vector3::operator*(Vector3)", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] * d.otherVectors[B(i)];
+        });
+        suite.add("Vector3::operator*(Matrix3)", bytesOf<V, Matrix3, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] * d.matrices3[B(i)];
+        });
+        suite.add("Vector3::operator*(Matrix4)", bytesOf<V, Matrix4, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] * d.matrices4[B(i)];
+        });
+        suite.add("Vector3::operator/(double)", scalar, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] / d.scalars[B(i)];
+        });
+        suite.add("Vector3::operator/(Vector3)", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)] / d.otherVectors[B(i)];
+        });
+        suite.add("Vector3::operator+=", binary, [&](size_t i) {
+            d.outVectors[A(i)] += d.vectors[B(i)];
+        });
+        suite.add("Vector3::operator-=", binary, [&](size_t i) {
+            d.outVectors[A(i)] -= d.vectors[B(i)];
+        });
+        suite.add("Vector3::operator*=(double)", scalar, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)] *= d.scalars[B(i)];
+        });
+        suite.add("Vector3::operator*=(Matrix4)", bytesOf<V, Matrix4, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)] *= d.matrices4[B(i)];
+        });
+        suite.add("Vector3::operator/=(double)", scalar, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)] /= d.scalars[B(i)];
+        });
+        suite.add("Vector3::operator==", bytesOf<V, V, bool>(), [&](size_t i) {
+            bool equal = d.vectors[A(i)] == d.otherVectors[B(i)];
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("Vector3::set", bytesOf<double, double, double, V>(), [&](size_t i) {
+            d.outVectors[A(i)].set(d.scalars[A(i)], d.scalars[B(i)], 1.0);
+        });
+        suite.add("Vector3::cross", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].cross(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::crossInPlace", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].crossInPlace(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::crossNormalize", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].crossNormalize(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::crossNormalizeInPlace", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].crossNormalizeInPlace(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::dot", bytesOf<V, V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)].dot(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::length", bytesOf<V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)].length();
+        });
+        suite.add("Vector3::squaredLength", bytesOf<V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)].squaredLength();
+        });
+        suite.add("Vector3::distance", bytesOf<V, V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)].distance(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::squaredDistance", bytesOf<V, V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)].squaredDistance(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::normalize", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].normalize();
+        });
+        suite.add("Vector3::normalizeInPlace", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].normalizeInPlace();
+        });
+        suite.add("Vector3::inverse", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].inverse();
+        });
+        suite.add("Vector3::inverseInPlace", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].inverseInPlace();
+        });
+        suite.add("Vector3::negate", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].negate();
+        });
+        suite.add("Vector3::negateInPlace", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].negateInPlace();
+        });
+        suite.add("Vector3::angle", bytesOf<V, V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.vectors[A(i)].angle(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::reflect", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].reflect(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::reflectInPlace", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].reflectInPlace(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::refract", bytesOf<V, V, double, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].refract(d.otherVectors[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Vector3::refractInPlace", bytesOf<V, V, double, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].refractInPlace(d.otherVectors[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Vector3::mirror(Vector3)", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].mirror(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::mirror(CartesianPlane)", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].mirror(CartesianPlane::YZ);
+        });
+        suite.add("Vector3::mirrorInPlace(Vector3)", binary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].mirrorInPlace(d.otherVectors[B(i)]);
+        });
+        suite.add("Vector3::mirrorInPlace(CartesianPlane)", unary, [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].mirrorInPlace(CartesianPlane::YZ);
+        });
+        suite.add("Vector3::linearInterpolate", bytesOf<V, V, double, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)].linearInterpolate(d.otherVectors[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Vector3::linearInterpolateInPlace", bytesOf<V, V, double, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.vectors[A(i)];
+            d.outVectors[A(i)].linearInterpolateInPlace(d.otherVectors[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Vector3::toString", sizeof(V), [&](size_t i) {
+            std::string text = d.vectors[A(i)].toString();
+            gmbench::doNotOptimize(text);
+        });
+    }
+
+    void benchMatrix3(gmbench::Suite& suite, Data& d)
+    {
+        typedef Matrix3 M;
+        size_t unary = bytesOf<M, M>();
+        size_t binary = bytesOf<M, M, M>();
+
+        suite.add("Matrix3::Matrix3(Quaternion)", bytesOf<Quaternion, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = M(d.quats[A(i)]);
+        });
+        suite.add("Matrix3::Matrix3(axisX, axisY, axisZ)", bytesOf<Vector3, Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = M(d.vectors[A(i)], d.otherVectors[A(i)], d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::operator()", bytesOf<M, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.matrices3[A(i)](int(i % 3), int((i/3) % 3));
+        });
+        suite.add("Matrix3::operator-()", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = -d.matrices3[A(i)];
+        });
+        suite.add("Matrix3::operator+(Matrix3)", binary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)] + d.matrices3[B(i)];
+        });
+        suite.add("Matrix3::operator-(Matrix3)", binary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)] - d.matrices3[B(i)];
+        });
+        suite.add("Matrix3::operator+(double)", bytesOf<M, double, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)] + d.scalars[B(i)];
+        });
+        suite.add("Matrix3::operator*(double)", bytesOf<M, double, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)] * d.scalars[B(i)];
+        });
+        suite.add("Matrix3::operator/(double)", bytesOf<M, double, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)] / d.scalars[B(i)];
+        });
+        suite.add("Matrix3::operator*(Matrix3)", binary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)] * d.matrices3[B(i)];
+        });
+        suite.add("Matrix3::operator*=(Matrix3)", binary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)];
+            d.outMatrices3[A(i)] *= d.matrices3[B(i)];
+        });
+        suite.add("Matrix3::operator+=(Matrix3)", binary, [&](size_t i) {
+            d.outMatrices3[A(i)] += d.matrices3[B(i)];
+        });
+        suite.add("Matrix3::operator==", bytesOf<M, M, bool>(), [&](size_t i) {
+            bool equal = d.matrices3[A(i)] == d.matrices3[B(i)];
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("Matrix3::setToIdentity", sizeof(M), [&](size_t i) {
+            d.outMatrices3[A(i)].setToIdentity();
+        });
+        suite.add("Matrix3::getRow", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices3[A(i)].getRow(unsigned(i % 3));
+        });
+        suite.add("Matrix3::setRow", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].setRow(unsigned(i % 3), d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::getAxisX", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices3[A(i)].getAxisX();
+        });
+        suite.add("Matrix3::setAxisX", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].setAxisX(d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::getAxisY", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices3[A(i)].getAxisY();
+        });
+        suite.add("Matrix3::setAxisY", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].setAxisY(d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::getAxisZ", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices3[A(i)].getAxisZ();
+        });
+        suite.add("Matrix3::setAxisZ", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].setAxisZ(d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::setScale", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)];
+            d.outMatrices3[A(i)].setScale(d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::addScale", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)];
+            d.outMatrices3[A(i)].addScale(d.vectors[B(i)]);
+        });
+        suite.add("Matrix3::getScale", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices3[A(i)].getScale();
+        });
+        suite.add("Matrix3::fromQuaternion", bytesOf<Quaternion, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].fromQuaternion(d.quats[B(i)]);
+        });
+        suite.add("Matrix3::toQuaternion", bytesOf<M, Quaternion>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.matrices3[A(i)].toQuaternion();
+        });
+        suite.add("Matrix3::fromEuler", bytesOf<Euler, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].fromEuler(d.eulers[B(i)], RotationOrder::XYZ);
+        });
+        suite.add("Matrix3::toEuler", bytesOf<M, Euler>(), [&](size_t i) {
+            d.outEulers[A(i)] = d.matrices3[A(i)].toEuler(RotationOrder::XYZ);
+        });
+        suite.add("Matrix3::transpose", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)].transpose();
+        });
+        suite.add("Matrix3::transposeInPlace", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)];
+            d.outMatrices3[A(i)].transposeInPlace();
+        });
+        suite.add("Matrix3::determinant", bytesOf<M, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.matrices3[A(i)].determinant();
+        });
+        suite.add("Matrix3::inverse", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)].inverse();
+        });
+        suite.add("Matrix3::inverseInPlace", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)];
+            d.outMatrices3[A(i)].inverseInPlace();
+        });
+        suite.add("Matrix3::orthogonal", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)].orthogonal();
+        });
+        suite.add("Matrix3::orthogonalInPlace", unary, [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices3[A(i)];
+            d.outMatrices3[A(i)].orthogonalInPlace();
+        });
+        suite.add("Matrix3::symmetricEigen", bytesOf<M, Vector3, M>(), [&](size_t i) {
+            d.symmetrics3[A(i)].symmetricEigen(d.outVectors[A(i)], d.outMatrices3[A(i)]);
+        });
+        suite.add("Matrix3::fromVectorToVector", bytesOf<Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].fromVectorToVector(d.vectors[A(i)].normalize(), d.otherVectors[B(i)].normalize());
+        });
+        suite.add("Matrix3::fromAxisAngle", bytesOf<Vector3, double, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].fromAxisAngle(d.vectors[A(i)], d.scalars[B(i)]);
+        });
+        suite.add("Matrix3::lookAt", bytesOf<Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)].lookAt(d.vectors[A(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("Matrix3::createLookAt", bytesOf<Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = M::createLookAt(d.vectors[A(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("Matrix3::toString", sizeof(M), [&](size_t i) {
+            std::string text = d.matrices3[A(i)].toString();
+            gmbench::doNotOptimize(text);
+        });
+    }
+
+    void benchMatrix4(gmbench::Suite& suite, Data& d)
+    {
+        typedef Matrix4 M;
+        size_t unary = bytesOf<M, M>();
+        size_t binary = bytesOf<M, M, M>();
+
+        suite.add("Matrix4::Matrix4(Quaternion, Vector3)", bytesOf<Quaternion, Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = M(d.quats[A(i)], d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::operator()", bytesOf<M, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.matrices4[A(i)](int(i % 4), int((i/4) % 4));
+        });
+        suite.add("Matrix4::operator+(Matrix4)", binary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)] + d.matrices4[B(i)];
+        });
+        suite.add("Matrix4::operator-(Matrix4)", binary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)] - d.matrices4[B(i)];
+        });
+        suite.add("Matrix4::operator+(double)", bytesOf<M, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)] + d.scalars[B(i)];
+        });
+        suite.add("Matrix4::operator*(double)", bytesOf<M, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)] * d.scalars[B(i)];
+        });
+        suite.add("Matrix4::operator/(double)", bytesOf<M, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)] / d.scalars[B(i)];
+        });
+        suite.add("Matrix4::operator*(Matrix4)", binary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)] * d.matrices4[B(i)];
+        });
+        suite.add("Matrix4::operator*=(Matrix4)", binary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)] *= d.matrices4[B(i)];
+        });
+        suite.add("Matrix4::operator+=(Matrix4)", binary, [&](size_t i) {
+            d.outMatrices4[A(i)] += d.matrices4[B(i)];
+        });
+        suite.add("Matrix4::operator==", bytesOf<M, M, bool>(), [&](size_t i) {
+            bool equal = d.matrices4[A(i)] == d.matrices4[B(i)];
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("Matrix4::setToIdentity", sizeof(M), [&](size_t i) {
+            d.outMatrices4[A(i)].setToIdentity();
+        });
+        suite.add("Matrix4::getRow", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].getRow(unsigned(i % 4));
+        });
+        suite.add("Matrix4::setRow", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setRow(unsigned(i % 4), d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::getAxisX", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].getAxisX();
+        });
+        suite.add("Matrix4::setAxisX", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setAxisX(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::getAxisY", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].getAxisY();
+        });
+        suite.add("Matrix4::setAxisY", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setAxisY(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::getAxisZ", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].getAxisZ();
+        });
+        suite.add("Matrix4::setAxisZ", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setAxisZ(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::getPosition", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].getPosition();
+        });
+        suite.add("Matrix4::setPosition", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setPosition(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::addPosition", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].addPosition(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::translate", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].translate(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::setRotation(Matrix3)", bytesOf<Matrix3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setRotation(d.matrices3[B(i)]);
+        });
+        suite.add("Matrix4::setRotation(Quaternion)", bytesOf<Quaternion, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setRotation(d.quats[B(i)]);
+        });
+        suite.add("Matrix4::setRotation(Euler)", bytesOf<Euler, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setRotation(d.eulers[B(i)], RotationOrder::XYZ);
+        });
+        suite.add("Matrix4::setScale", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].setScale(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::addScale", bytesOf<Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].addScale(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::getScale", bytesOf<M, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].getScale();
+        });
+        suite.add("Matrix4::toMatrix3", bytesOf<M, Matrix3>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.matrices4[A(i)].toMatrix3();
+        });
+        suite.add("Matrix4::toQuaternion", bytesOf<M, Quaternion>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.matrices4[A(i)].toQuaternion();
+        });
+        suite.add("Matrix4::toEuler", bytesOf<M, Euler>(), [&](size_t i) {
+            d.outEulers[A(i)] = d.matrices4[A(i)].toEuler(RotationOrder::XYZ);
+        });
+        suite.add("Matrix4::fromMatrix3", bytesOf<Matrix3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].fromMatrix3(d.matrices3[B(i)]);
+        });
+        suite.add("Matrix4::fromQuaternion", bytesOf<Quaternion, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].fromQuaternion(d.quats[B(i)]);
+        });
+        suite.add("Matrix4::fromEuler", bytesOf<Euler, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].fromEuler(d.eulers[B(i)], RotationOrder::XYZ);
+        });
+        suite.add("Matrix4::rotateVector", bytesOf<M, Vector3, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.matrices4[A(i)].rotateVector(d.vectors[B(i)]);
+        });
+        suite.add("Matrix4::transpose", unary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)].transpose();
+        });
+        suite.add("Matrix4::transposeInPlace", unary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].transposeInPlace();
+        });
+        suite.add("Matrix4::determinant", bytesOf<M, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.matrices4[A(i)].determinant();
+        });
+        suite.add("Matrix4::inverse", unary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)].inverse();
+        });
+        suite.add("Matrix4::inverseInPlace", unary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].inverseInPlace();
+        });
+        suite.add("Matrix4::orthogonal", unary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)].orthogonal();
+        });
+        suite.add("Matrix4::orthogonalInPlace", unary, [&](size_t i) {
+            d.outMatrices4[A(i)] = d.matrices4[A(i)];
+            d.outMatrices4[A(i)].orthogonalInPlace();
+        });
+        suite.add("Matrix4::fromVectorToVector", bytesOf<Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].fromVectorToVector(d.vectors[A(i)].normalize(), d.otherVectors[B(i)].normalize());
+        });
+        suite.add("Matrix4::lookAt", bytesOf<Vector3, Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].lookAt(d.vectors[A(i)], d.otherVectors[B(i)], d.otherVectors[A(i)]);
+        });
+        suite.add("Matrix4::createLookAt", bytesOf<Vector3, Vector3, Vector3, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = M::createLookAt(d.vectors[A(i)], d.otherVectors[B(i)], d.otherVectors[A(i)]);
+        });
+        suite.add("Matrix4::setPerspective(fovY)", bytesOf<double, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setPerspective(d.scalars[A(i)], d.scalars[B(i)] + 1.0, 0.1, 100.0);
+        });
+        suite.add("Matrix4::setPerspective(left, right, bottom, top)", bytesOf<double, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setPerspective(-d.scalars[A(i)], d.scalars[A(i)], -d.scalars[B(i)], d.scalars[B(i)], 0.1, 100.0);
+        });
+        suite.add("Matrix4::setOrthographic", bytesOf<double, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].setOrthographic(-d.scalars[A(i)], d.scalars[A(i)], -d.scalars[B(i)], d.scalars[B(i)], 0.1, 100.0);
+        });
+        suite.add("Matrix4::createPerspective(fovY)", bytesOf<double, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = M::createPerspective(d.scalars[A(i)], d.scalars[B(i)] + 1.0, 0.1, 100.0);
+        });
+        suite.add("Matrix4::createPerspective(left, right, bottom, top)", bytesOf<double, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = M::createPerspective(-d.scalars[A(i)], d.scalars[A(i)], -d.scalars[B(i)], d.scalars[B(i)], 0.1, 100.0);
+        });
+        suite.add("Matrix4::createOrthographic", bytesOf<double, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = M::createOrthographic(-d.scalars[A(i)], d.scalars[A(i)], -d.scalars[B(i)], d.scalars[B(i)], 0.1, 100.0);
+        });
+        suite.add("Matrix4::fromAxisAngle", bytesOf<Vector3, double, M>(), [&](size_t i) {
+            d.outMatrices4[A(i)].fromAxisAngle(d.vectors[A(i)], d.scalars[B(i)]);
+        });
+        suite.add("Matrix4::toString", sizeof(M), [&](size_t i) {
+            std::string text = d.matrices4[A(i)].toString();
+            gmbench::doNotOptimize(text);
+        });
+    }
+
+    void benchQuaternion(gmbench::Suite& suite, Data& d)
+    {
+        typedef Quaternion Q;
+        size_t unary = bytesOf<Q, Q>();
+        size_t binary = bytesOf<Q, Q, Q>();
+
+        suite.add("Quaternion::Quaternion(axis, angle)", bytesOf<Vector3, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = Q(d.vectors[A(i)], d.scalars[B(i)]);
+        });
+        suite.add("Quaternion::Quaternion(angleX, angleY, angleZ)", bytesOf<double, double, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = Q(d.scalars[A(i)], d.scalars[B(i)], 0.5);
+        });
+        suite.add("Quaternion::Quaternion(Matrix3)", bytesOf<Matrix3, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = Q(d.matrices3[A(i)]);
+        });
+        suite.add("Quaternion::operator-()", unary, [&](size_t i) {
+            d.outQuats[A(i)] = -d.quats[A(i)];
+        });
+        suite.add("Quaternion::operator+", binary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)] + d.otherQuats[B(i)];
+        });
+        suite.add("Quaternion::operator-", binary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)] - d.otherQuats[B(i)];
+        });
+        suite.add("Quaternion::operator*(Quaternion)", binary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)] * d.otherQuats[B(i)];
+        });
+        suite.add("Quaternion::operator*(double)", bytesOf<Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)] * d.scalars[B(i)];
+        });
+        suite.add("Quaternion::operator/(double)", bytesOf<Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)] / d.scalars[B(i)];
+        });
+        suite.add("Quaternion::operator*=(Quaternion)", binary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)] *= d.otherQuats[B(i)];
+        });
+        suite.add("Quaternion::operator==", bytesOf<Q, Q, bool>(), [&](size_t i) {
+            bool equal = d.quats[A(i)] == d.otherQuats[B(i)];
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("Quaternion::set", bytesOf<double, double, double, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)].set(d.scalars[A(i)], d.scalars[B(i)], 0.5, 1.0);
+        });
+        suite.add("Quaternion::setToIdentity", sizeof(Q), [&](size_t i) {
+            d.outQuats[A(i)].setToIdentity();
+        });
+        suite.add("Quaternion::getAxisX", bytesOf<Q, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.quats[A(i)].getAxisX();
+        });
+        suite.add("Quaternion::getAxisY", bytesOf<Q, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.quats[A(i)].getAxisY();
+        });
+        suite.add("Quaternion::getAxisZ", bytesOf<Q, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.quats[A(i)].getAxisZ();
+        });
+        suite.add("Quaternion::getAxis", bytesOf<Q, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.quats[A(i)].getAxis(Axis::NEGZ);
+        });
+        suite.add("Quaternion::fromMatrix3", bytesOf<Matrix3, Q>(), [&](size_t i) {
+            d.outQuats[A(i)].fromMatrix3(d.matrices3[B(i)]);
+        });
+        suite.add("Quaternion::fromMatrix4", bytesOf<Matrix4, Q>(), [&](size_t i) {
+            d.outQuats[A(i)].fromMatrix4(d.matrices4[B(i)]);
+        });
+        suite.add("Quaternion::toMatrix3", bytesOf<Q, Matrix3>(), [&](size_t i) {
+            d.outMatrices3[A(i)] = d.quats[A(i)].toMatrix3();
+        });
+        suite.add("Quaternion::toMatrix4", bytesOf<Q, Matrix4>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.quats[A(i)].toMatrix4();
+        });
+        suite.add("Quaternion::setMatrix4(scale, pos)", bytesOf<Q, Vector3, Vector3, Matrix4>(), [&](size_t i) {
+            d.quats[A(i)].setMatrix4(d.outMatrices4[A(i)], d.vectors[A(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("Quaternion::fromAxisAngle", bytesOf<Vector3, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)].fromAxisAngle(d.vectors[A(i)], d.scalars[B(i)]);
+        });
+        suite.add("Quaternion::toAxisAngle", bytesOf<Q, Vector3, double>(), [&](size_t i) {
+            d.quats[A(i)].toAxisAngle(d.outVectors[A(i)], d.outScalars[A(i)]);
+        });
+        suite.add("Quaternion::fromEuler", bytesOf<Euler, Q>(), [&](size_t i) {
+            d.outQuats[A(i)].fromEuler(d.eulers[B(i)], RotationOrder::XYZ);
+        });
+        suite.add("Quaternion::toEuler", bytesOf<Q, Euler>(), [&](size_t i) {
+            d.outEulers[A(i)] = d.quats[A(i)].toEuler(RotationOrder::XYZ);
+        });
+        suite.add("Quaternion::length", bytesOf<Q, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.quats[A(i)].length();
+        });
+        suite.add("Quaternion::squaredLength", bytesOf<Q, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.quats[A(i)].squaredLength();
+        });
+        suite.add("Quaternion::unit", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].unit();
+        });
+        suite.add("Quaternion::unitInPlace", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].unitInPlace();
+        });
+        suite.add("Quaternion::normalize", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].normalize();
+        });
+        suite.add("Quaternion::normalizeInPlace", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].normalizeInPlace();
+        });
+        suite.add("Quaternion::inverse", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].inverse();
+        });
+        suite.add("Quaternion::inverseInPlace", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].inverseInPlace();
+        });
+        suite.add("Quaternion::conjugate", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].conjugate();
+        });
+        suite.add("Quaternion::conjugateInPlace", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].conjugateInPlace();
+        });
+        suite.add("Quaternion::exp", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].exp();
+        });
+        suite.add("Quaternion::log", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].log();
+        });
+        suite.add("Quaternion::rotateVector", bytesOf<Q, Vector3, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.quats[A(i)].rotateVector(d.vectors[B(i)]);
+        });
+        suite.add("Quaternion::dot", bytesOf<Q, Q, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.quats[A(i)].dot(d.otherQuats[B(i)]);
+        });
+        suite.add("Quaternion::matchHemisphere", binary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].matchHemisphere(d.otherQuats[B(i)]);
+        });
+        suite.add("Quaternion::mirror(CartesianPlane)", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].mirror(CartesianPlane::ZY);
+        });
+        suite.add("Quaternion::mirror(Vector3)", bytesOf<Q, Vector3, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].mirror(d.vectors[B(i)].normalize());
+        });
+        suite.add("Quaternion::mirrorInPlace(CartesianPlane)", unary, [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].mirrorInPlace(CartesianPlane::ZY);
+        });
+        suite.add("Quaternion::mirrorInPlace(Vector3)", bytesOf<Q, Vector3, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)];
+            d.outQuats[A(i)].mirrorInPlace(d.vectors[B(i)].normalize());
+        });
+        suite.add("Quaternion::slerp", bytesOf<Q, Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].slerp(d.otherQuats[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Quaternion::slerpInPlace", bytesOf<Q, Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)].slerpInPlace(d.quats[A(i)], d.otherQuats[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Quaternion::nlerp", bytesOf<Q, Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].nlerp(d.otherQuats[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Quaternion::correctedNlerp", bytesOf<Q, Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].correctedNlerp(d.otherQuats[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Quaternion::polynomialSlerp", bytesOf<Q, Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].polynomialSlerp(d.otherQuats[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Quaternion::interpolate", bytesOf<Q, Q, double, Q>(), [&](size_t i) {
+            d.outQuats[A(i)] = d.quats[A(i)].interpolate(d.otherQuats[B(i)], d.scalars[A(i)], SlerpMethod::POLYNOMIAL_FAST);
+        });
+        suite.add("Quaternion::toString", sizeof(Q), [&](size_t i) {
+            std::string text = d.quats[A(i)].toString();
+            gmbench::doNotOptimize(text);
+        });
+    }
+
+    void benchXfo(gmbench::Suite& suite, Data& d)
+    {
+        typedef Xfo X;
+        size_t unary = bytesOf<X, X>();
+        size_t binary = bytesOf<X, X, X>();
+
+        suite.add("Xfo::Xfo(Quaternion, Vector3, Vector3)", bytesOf<Quaternion, Vector3, Vector3, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = X(d.quats[A(i)], d.vectors[B(i)], d.otherVectors[A(i)]);
+        });
+        suite.add("Xfo::Xfo(Matrix4)", bytesOf<Matrix4, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = X(d.matrices4[A(i)]);
+        });
+        suite.add("Xfo::operator*", binary, [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)] * d.otherXfos[B(i)];
+        });
+        suite.add("Xfo::operator*=", binary, [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)];
+            d.outXfos[A(i)] *= d.otherXfos[B(i)];
+        });
+        suite.add("Xfo::compose", binary, [&](size_t i) {
+            d.xfos[A(i)].compose(d.otherXfos[B(i)], d.outXfos[A(i)]);
+        });
+        suite.add("Xfo::operator==", bytesOf<X, X, bool>(), [&](size_t i) {
+            bool equal = d.xfos[A(i)] == d.otherXfos[B(i)];
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("Xfo::setToIdentity", sizeof(X), [&](size_t i) {
+            d.outXfos[A(i)].setToIdentity();
+        });
+        suite.add("Xfo::hasUniformScale", bytesOf<X, bool>(), [&](size_t i) {
+            bool uniform = d.xfos[A(i)].hasUniformScale();
+            gmbench::doNotOptimize(uniform);
+        });
+        suite.add("Xfo::fromMatrix4", bytesOf<Matrix4, X>(), [&](size_t i) {
+            d.outXfos[A(i)].fromMatrix4(d.matrices4[B(i)]);
+        });
+        suite.add("Xfo::toMatrix4", bytesOf<X, Matrix4>(), [&](size_t i) {
+            d.outMatrices4[A(i)] = d.xfos[A(i)].toMatrix4();
+        });
+        suite.add("Xfo::transformVector", bytesOf<X, Vector3, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.xfos[A(i)].transformVector(d.vectors[B(i)]);
+        });
+        suite.add("Xfo::inverse", unary, [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)].inverse();
+        });
+        suite.add("Xfo::inverseInPlace", unary, [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)];
+            d.outXfos[A(i)].inverseInPlace();
+        });
+        suite.add("Xfo::inverseTransformVector", bytesOf<X, Vector3, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.xfos[A(i)].inverseTransformVector(d.vectors[B(i)]);
+        });
+        suite.add("Xfo::slerp", bytesOf<X, X, double, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)].slerp(d.otherXfos[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Xfo::slerpInPlace", bytesOf<X, X, double, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)];
+            d.outXfos[A(i)].slerpInPlace(d.otherXfos[B(i)], d.scalars[A(i)]);
+        });
+        suite.add("Xfo::interpolate", bytesOf<X, X, double, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)].interpolate(d.otherXfos[B(i)], d.scalars[A(i)], SlerpMethod::POLYNOMIAL_FAST);
+        });
+        suite.add("Xfo::distanceTo", bytesOf<X, X, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = d.xfos[A(i)].distanceTo(d.otherXfos[B(i)]);
+        });
+        suite.add("Xfo::mirror(center, normal)", bytesOf<X, Vector3, Vector3, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)].mirror(d.vectors[A(i)], d.otherVectors[B(i)].normalize());
+        });
+        suite.add("Xfo::mirror(CartesianPlane)", unary, [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)].mirror(CartesianPlane::YZ);
+        });
+        suite.add("Xfo::mirrorInPlace(center, normal)", bytesOf<X, Vector3, Vector3, X>(), [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)];
+            d.outXfos[A(i)].mirrorInPlace(d.vectors[A(i)], d.otherVectors[B(i)].normalize());
+        });
+        suite.add("Xfo::mirrorInPlace(CartesianPlane)", unary, [&](size_t i) {
+            d.outXfos[A(i)] = d.xfos[A(i)];
+            d.outXfos[A(i)].mirrorInPlace(CartesianPlane::YZ);
+        });
+        suite.add("Xfo::toString", sizeof(X), [&](size_t i) {
+            std::string text = d.xfos[A(i)].toString();
+            gmbench::doNotOptimize(text);
+        });
+    }
+
+    void benchEuler(gmbench::Suite& suite, Data& d)
+    {
+        typedef Euler E;
+
+        suite.add("Euler::Euler(x, y, z)", bytesOf<double, double, double, E>(), [&](size_t i) {
+            d.outEulers[A(i)] = E(d.scalars[A(i)], d.scalars[B(i)], 0.5);
+        });
+        suite.add("Euler::Euler(Vector3)", bytesOf<Vector3, E>(), [&](size_t i) {
+            d.outEulers[A(i)] = E(d.vectors[A(i)]);
+        });
+        suite.add("Euler::operator==", bytesOf<E, E, bool>(), [&](size_t i) {
+            bool equal = d.eulers[A(i)] == d.eulers[B(i)];
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("Euler::set", bytesOf<double, double, double, E>(), [&](size_t i) {
+            d.outEulers[A(i)].set(d.scalars[A(i)], d.scalars[B(i)], 0.5);
+        });
+        suite.add("Euler::setUnit", sizeof(E), [&](size_t i) {
+            d.outEulers[A(i)].setUnit(i & 1 ? Unit::degrees : Unit::radians);
+        });
+        suite.add("Euler::getUnit", sizeof(E), [&](size_t i) {
+            Unit unit = d.eulers[A(i)].getUnit();
+            gmbench::doNotOptimize(unit);
+        });
+        suite.add("Euler::toDegrees", bytesOf<E, E>(), [&](size_t i) {
+            d.outEulers[A(i)] = d.eulers[A(i)].toDegrees();
+        });
+        suite.add("Euler::toRadians", bytesOf<E, E>(), [&](size_t i) {
+            d.outEulers[A(i)] = d.eulers[A(i)].toRadians();
+        });
+        suite.add("Euler::toVector", bytesOf<E, Vector3>(), [&](size_t i) {
+            d.outVectors[A(i)] = d.eulers[A(i)].toVector();
+        });
+        suite.add("Euler::toString", sizeof(E), [&](size_t i) {
+            std::string text = d.eulers[A(i)].toString();
+            gmbench::doNotOptimize(text);
+        });
+    }
+
+    void benchUsefulFunctions(gmbench::Suite& suite, Data& d)
+    {
+        typedef Vector3 V;
+
+        suite.add("almostEqual(Vector3)", bytesOf<V, V, bool>(), [&](size_t i) {
+            bool equal = almostEqual(d.vectors[A(i)], d.otherVectors[B(i)], 1e-6);
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("almostEqual(Matrix4)", bytesOf<Matrix4, Matrix4, bool>(), [&](size_t i) {
+            bool equal = almostEqual(d.matrices4[A(i)], d.matrices4[B(i)], 1e-6);
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("almostEqual(Xfo)", bytesOf<Xfo, Xfo, bool>(), [&](size_t i) {
+            bool equal = almostEqual(d.xfos[A(i)], d.otherXfos[B(i)], 1e-6);
+            gmbench::doNotOptimize(equal);
+        });
+        suite.add("aim(Matrix3)", bytesOf<V, V, Matrix3>(), [&](size_t i) {
+            aim(d.outMatrices3[A(i)], d.vectors[A(i)], d.otherVectors[B(i)], Axis::POSX, Axis::POSY);
+        });
+        suite.add("aim(Quaternion)", bytesOf<V, V, Quaternion>(), [&](size_t i) {
+            aim(d.outQuats[A(i)], d.vectors[A(i)], d.otherVectors[B(i)], Axis::POSX, Axis::POSY);
+        });
+        suite.add("aim(Xfo)", bytesOf<V, V, Xfo>(), [&](size_t i) {
+            aim(d.outXfos[A(i)], d.vectors[A(i)], d.otherVectors[B(i)], Axis::POSX, Axis::POSY);
+        });
+        suite.add("fastAim(Matrix3)", bytesOf<V, V, Matrix3>(), [&](size_t i) {
+            fastAim(d.outMatrices3[A(i)], d.vectors[A(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("fastAim(Quaternion)", bytesOf<V, V, Quaternion>(), [&](size_t i) {
+            fastAim(d.outQuats[A(i)], d.vectors[A(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("fastAim(Xfo)", bytesOf<V, V, Xfo>(), [&](size_t i) {
+            fastAim(d.outXfos[A(i)], d.vectors[A(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("distanceToPlane", bytesOf<V, V, V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = distanceToPlane(d.vectors[A(i)], d.otherVectors[B(i)], d.vectors[B(i)]);
+        });
+        suite.add("distanceToLine", bytesOf<V, V, V, double>(), [&](size_t i) {
+            d.outScalars[A(i)] = distanceToLine(d.vectors[A(i)], d.otherVectors[B(i)], d.vectors[B(i)]);
+        });
+        suite.add("closestPointToLine", bytesOf<V, V, V, V>(), [&](size_t i) {
+            d.outVectors[A(i)] = closestPointToLine(d.vectors[A(i)], d.otherVectors[B(i)], d.vectors[B(i)]);
+        });
+        suite.add("intersectLinePlane", bytesOf<V, V, V, V, V, IntersectionType>(), [&](size_t i) {
+            d.outIntersections[A(i)] = intersectLinePlane(d.outVectors[A(i)], d.vectors[A(i)], d.otherVectors[B(i)],
+                                                          d.otherVectors[A(i)], d.vectors[B(i)]);
+        });
+        suite.add("intersectPlanePlane", bytesOf<V, V, V, V, V, V, IntersectionType>(), [&](size_t i) {
+            d.outIntersections[A(i)] = intersectPlanePlane(d.outVectors[A(i)], d.outVectors2[A(i)], d.vectors[A(i)],
+                                                           d.otherVectors[A(i)], d.vectors[B(i)], d.otherVectors[B(i)]);
+        });
+        suite.add("intersectCirclePlane", bytesOf<V, V, V, double, V, V, V, IntersectionType>(), [&](size_t i) {
+            d.outIntersections[A(i)] = intersectCirclePlane(d.outVectors[A(i)], d.outVectors2[A(i)], d.vectors[A(i)],
+                                                            d.otherVectors[A(i)].normalize(), 5.0,
+                                                            d.otherVectors[B(i)].normalize(), d.vectors[B(i)]);
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    srand(1);
+
+    gmbench::Suite suite("GMath operations (gmath-static)", argc, argv);
+    suite.addContext("library_version", "2.0");
+    suite.addContext("instruction_set", simd::instructionSetName(simd::getInstructionSet()));
+
+    Data data;
+    benchVector3(suite, data);
+    benchMatrix3(suite, data);
+    benchMatrix4(suite, data);
+    benchQuaternion(suite, data);
+    benchXfo(suite, data);
+    benchEuler(suite, data);
+    benchUsefulFunctions(suite, data);
+
+    return suite.finish();
+}
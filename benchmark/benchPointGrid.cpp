@@ -0,0 +1,199 @@
+/*  PointGrid on the points of a symmetric surface, 10000 to 1000000 of them.
+
+    For each size the build is timed on 1 thread and on all the gmath::parallel threads, in ns per point,
+    then the batch queries from positions near the points (each one a point moved by up to 0.01, like a
+    control snapped to them), in ns per query: the 8 nearest points, the points within a radius of about
+    2 cells, and the nearest point by a brute force loop over every point, what the grid saves. buildSymmetryMap is timed last, in ns per point.
+    With a grid the times per point and per query stay about the same as the points grow, the brute
+    force grows with them.
+    A flat cloud follows, 200000 points of a 0.01 wide square at z = 0 like a planar mesh: the same
+    times as the surface, the grid measured in 2 dimensions. */
+
+#include "gmPointGrid.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t QUERIES = 10000;
+    const size_t NEAREST = 8;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector(double size)
+    {
+        return Vector3(randomRange(-size, size), randomRange(-size, size), randomRange(-size, size));
+    }
+
+    /** count points on a bumpy sphere, symmetric through the YZ plane: half of them and their mirror. */
+    void symmetricSurface(std::vector<Vector3>& points, size_t count)
+    {
+        points.resize(count);
+        for (size_t i=0; i+1<count; i+=2)
+        {
+            Vector3 direction = randomVector(1.0).normalize();
+            double radius = 1.0 + 0.1 * sin(7.0 * direction.y) * cos(5.0 * direction.z);
+            points[i] = direction * radius;
+            points[i+1] = Vector3(-points[i].x, points[i].y, points[i].z);
+        }
+        if (count % 2)
+            points[count-1] = Vector3(0.0, 1.0, 0.0);
+    }
+
+    /** count points of a square of width size at z = 0, symmetric through the YZ plane. */
+    void symmetricPlane(std::vector<Vector3>& points, size_t count, double size)
+    {
+        points.resize(count);
+        for (size_t i=0; i+1<count; i+=2)
+        {
+            points[i] = Vector3(randomRange(0.0, 0.5*size), randomRange(-0.5*size, 0.5*size), 0.0);
+            points[i+1] = Vector3(-points[i].x, points[i].y, 0.0);
+        }
+        if (count % 2)
+            points[count-1] = Vector3(0.0, 0.0, 0.0);
+    }
+
+    /** The nearest point by testing every point. */
+    size_t bruteForceNearest(const std::vector<Vector3>& points, const Vector3& point)
+    {
+        size_t best = PointGrid::NONE;
+        double bestDistance = DBL_MAX;
+        for (size_t i=0; i<points.size(); i++)
+        {
+            double distance = (points[i] - point).squaredLength();
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                best = i;
+            }
+        }
+        return best;
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Vector3> positions(QUERIES);
+    std::vector<size_t> nearest(QUERIES * NEAREST), offsets, found;
+    std::vector<double> distances(QUERIES * NEAREST);
+
+    size_t threads = parallel::getThreadCount();
+    char name[64];
+    const size_t SIZES[] = { 10000, 100000, 1000000 };
+
+    for (size_t s=0; s<sizeof(SIZES)/sizeof(SIZES[0]); s++)
+    {
+        size_t count = SIZES[s];
+        std::vector<Vector3> points;
+        symmetricSurface(points, count);
+        for (size_t i=0; i<QUERIES; i++)
+            positions[i] = points[size_t(rand()) % count] + randomVector(0.01);
+
+        PointGrid grid;
+        std::vector<gmbench::Result> results;
+        parallel::setThreadCount(1);
+        results.push_back(gmbench::run("build, 1 thread", [&](size_t) {
+            grid.build(points);
+            gmbench::doNotOptimize(grid.getCellSize());
+        }, count));
+        parallel::setThreadCount(threads);
+        snprintf(name, sizeof(name), "build, %u threads", (unsigned int)threads);
+        results.push_back(gmbench::run(name, [&](size_t) {
+            grid.build(points);
+            gmbench::doNotOptimize(grid.getCellSize());
+        }, count));
+
+        grid.build(points);
+        double radius = 2.0 * grid.getCellSize();
+
+        // a few queries are enough for the brute force loop
+        const size_t BRUTE_QUERIES = 16;
+        results.push_back(gmbench::run("nearest, brute force", [&](size_t) {
+            for (size_t i=0; i<BRUTE_QUERIES; i++)
+                gmbench::doNotOptimize(bruteForceNearest(points, positions[i]));
+        }, BRUTE_QUERIES));
+        results.push_back(gmbench::run("nearest, single queries", [&](size_t) {
+            for (size_t i=0; i<QUERIES; i++)
+                nearest[i] = grid.findNearest(positions[i]);
+            gmbench::doNotOptimize(nearest[0]);
+        }, QUERIES));
+
+        parallel::setThreadCount(1);
+        results.push_back(gmbench::run("8 nearest batch, 1 thread", [&](size_t) {
+            grid.findNearest(&positions[0], QUERIES, NEAREST, &nearest[0], &distances[0]);
+            gmbench::doNotOptimize(nearest[0]);
+        }, QUERIES));
+        results.push_back(gmbench::run("radius batch, 1 thread", [&](size_t) {
+            grid.findInRadius(&positions[0], QUERIES, radius, offsets, found);
+            gmbench::doNotOptimize(offsets[0]);
+        }, QUERIES));
+        results.push_back(gmbench::run("buildSymmetryMap, 1 thread", [&](size_t) {
+            gmbench::doNotOptimize(buildSymmetryMap(points, CartesianPlane::YZ, 1e-6).size());
+        }, count));
+
+        parallel::setThreadCount(threads);
+        snprintf(name, sizeof(name), "8 nearest batch, %u threads", (unsigned int)threads);
+        results.push_back(gmbench::run(name, [&](size_t) {
+            grid.findNearest(&positions[0], QUERIES, NEAREST, &nearest[0], &distances[0]);
+            gmbench::doNotOptimize(nearest[0]);
+        }, QUERIES));
+        snprintf(name, sizeof(name), "radius batch, %u threads", (unsigned int)threads);
+        results.push_back(gmbench::run(name, [&](size_t) {
+            grid.findInRadius(&positions[0], QUERIES, radius, offsets, found);
+            gmbench::doNotOptimize(offsets[0]);
+        }, QUERIES));
+        snprintf(name, sizeof(name), "buildSymmetryMap, %u threads", (unsigned int)threads);
+        results.push_back(gmbench::run(name, [&](size_t) {
+            gmbench::doNotOptimize(buildSymmetryMap(points, CartesianPlane::YZ, 1e-6).size());
+        }, count));
+
+        snprintf(name, sizeof(name), "PointGrid, %u points (ns per point or per query)", (unsigned int)count);
+        gmbench::report(name, results);
+        printf("%u points found per radius query\n\n", (unsigned int)(found.size() / QUERIES));
+    }
+
+    {
+        const size_t count = 200000;
+        const double size = 0.01;
+        std::vector<Vector3> points;
+        symmetricPlane(points, count, size);
+        for (size_t i=0; i<QUERIES; i++)
+        {
+            positions[i] = points[size_t(rand()) % count] + randomVector(0.01 * size);
+            positions[i].z = 0.0;
+        }
+
+        PointGrid grid;
+        std::vector<gmbench::Result> results;
+        results.push_back(gmbench::run("build", [&](size_t) {
+            grid.build(points);
+            gmbench::doNotOptimize(grid.getCellSize());
+        }, count));
+        results.push_back(gmbench::run("nearest, single queries", [&](size_t) {
+            for (size_t i=0; i<QUERIES; i++)
+                nearest[i] = grid.findNearest(positions[i]);
+            gmbench::doNotOptimize(nearest[0]);
+        }, QUERIES));
+        results.push_back(gmbench::run("8 nearest batch", [&](size_t) {
+            grid.findNearest(&positions[0], QUERIES, NEAREST, &nearest[0], &distances[0]);
+            gmbench::doNotOptimize(nearest[0]);
+        }, QUERIES));
+        results.push_back(gmbench::run("buildSymmetryMap", [&](size_t) {
+            gmbench::doNotOptimize(buildSymmetryMap(points, CartesianPlane::YZ, 1e-9).size());
+        }, count));
+
+        snprintf(name, sizeof(name), "PointGrid, %u points of a plane (ns per point or per query)", (unsigned int)count);
+        gmbench::report(name, results);
+        printf("cell size %g\n\n", grid.getCellSize());
+    }
+
+    return 0;
+}
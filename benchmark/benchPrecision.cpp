@@ -0,0 +1,106 @@
+/*  The hot operations in single and double precision.
+    Every benchmark works on arrays of COUNT elements, so the float version
+    also shows the gain of moving half the bytes.
+    A check follows with a float Xfo whose scale factors are 1 ulp apart: it must still count as
+    uniformly scaled and invert. */
+
+#include "gmXfo.h"
+#include "gmBenchmark.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 100000;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    template <typename real>
+    void runAll(const char* suffix, std::vector<gmbench::Result>& results)
+    {
+        typedef Vector3T<real> V3;
+        typedef QuaternionT<real> Q;
+        typedef Matrix4T<real> M4;
+        typedef XfoT<real> X;
+
+        srand(1);
+        std::vector<V3> vectors(COUNT), outVectors(COUNT);
+        std::vector<Q> quats(COUNT), outQuats(COUNT);
+        std::vector<M4> matrices(COUNT), outMatrices(COUNT);
+        std::vector<X> xfos(COUNT), outXfos(COUNT);
+        for (size_t i=0; i<COUNT; i++)
+        {
+            vectors[i] = V3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+            quats[i] = Q(V3(randomRange(-1.0, 1.0), randomRange(-1.0, 1.0), 1.0).normalize(), randomRange(-PI, PI));
+            xfos[i] = X(quats[i], vectors[i], V3(1.0, 1.0, 1.0));
+            matrices[i] = xfos[i].toMatrix4();
+        }
+
+        std::string s(suffix);
+        results.push_back(gmbench::run("Vector3::cross" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outVectors[i] = vectors[i].cross(vectors[COUNT-1-i]);
+        }, COUNT));
+        results.push_back(gmbench::run("Vector3::normalize" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outVectors[i] = vectors[i].normalize();
+        }, COUNT));
+        results.push_back(gmbench::run("Vector3 * Matrix4" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outVectors[i] = vectors[i] * matrices[i];
+        }, COUNT));
+        results.push_back(gmbench::run("Matrix4 * Matrix4" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outMatrices[i] = matrices[i] * matrices[COUNT-1-i];
+        }, COUNT));
+        results.push_back(gmbench::run("Matrix4::inverse" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outMatrices[i] = matrices[i].inverse();
+        }, COUNT));
+        results.push_back(gmbench::run("Matrix4::transpose" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outMatrices[i] = matrices[i].transpose();
+        }, COUNT));
+        results.push_back(gmbench::run("Quaternion * Quaternion" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outQuats[i] = quats[i] * quats[COUNT-1-i];
+        }, COUNT));
+        results.push_back(gmbench::run("Quaternion::rotateVector" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outVectors[i] = quats[i].rotateVector(vectors[i]);
+        }, COUNT));
+        results.push_back(gmbench::run("Xfo * Xfo" + s, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outXfos[i] = xfos[i] * xfos[COUNT-1-i];
+        }, COUNT));
+    }
+}
+
+int main()
+{
+    std::vector<gmbench::Result> results;
+    runAll<double>(" (double)", results);
+    runAll<float>(" (float)", results);
+
+    gmbench::report("100k elements, time per element", results);
+
+    Xfof noisy(Quaternionf(), Vector3f(), Vector3f(1.0f, nextafterf(1.0f, 2.0f), 1.0f));
+    bool inverted = true;
+    try
+    {
+        noisy.inverse();
+    }
+    catch (const GMathError&)
+    {
+        inverted = false;
+    }
+    printf("float scale 1 ulp apart: hasUniformScale %s, inverse %s\n",
+           noisy.hasUniformScale() ? "true" : "false", inverted ? "ok" : "throws");
+    return 0;
+}
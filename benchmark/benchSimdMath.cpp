@@ -0,0 +1,212 @@
+/*  Accuracy and speed of the simd math functions.
+
+    The error table compares every function with its long double libm version, in ULP of the
+    double closest to the exact result. The timings are per value over arrays of COUNT values,
+    with a plain libm loop as the reference, then for every instruction set supported by this CPU.
+    The batch Euler conversions built on them are timed last. */
+
+#include "gmBatch.h"
+#include "gmSimd.h"
+#include "gmBenchmark.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 4096;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    double ulpError(double value, long double exact)
+    {
+        double rounded = double(exact);
+        double ulp = nextafter(fabs(rounded), INFINITY) - fabs(rounded);
+        return double(fabsl(value - exact) / ulp);
+    }
+
+    void fill(std::vector<double>& values, double low, double high)
+    {
+        for (size_t i=0; i<values.size(); i++)
+            values[i] = randomRange(low, high);
+    }
+
+    void errorTable()
+    {
+        const size_t SAMPLES = 1000000;
+        std::vector<double> x(SAMPLES), y(SAMPLES), out(SAMPLES), out2(SAMPLES);
+
+        printf("Error against long double libm (ULP)\n");
+        printf("%-32s %12s\n", "function", "max error");
+
+        const double RANGES[] = { 4.0, 1.0e3, 1.0e6 };
+        for (size_t r=0; r<3; r++)
+        {
+            srand(1);
+            fill(x, -RANGES[r], RANGES[r]);
+            simd::batchSinCos(x.data(), out.data(), out2.data(), SAMPLES);
+            double maxSin = 0.0, maxCos = 0.0;
+            for (size_t i=0; i<SAMPLES; i++)
+            {
+                maxSin = fmax(maxSin, ulpError(out[i], sinl(x[i])));
+                maxCos = fmax(maxCos, ulpError(out2[i], cosl(x[i])));
+            }
+            printf("batchSinCos sin |x| < %-10g %12.2f\n", RANGES[r], maxSin);
+            printf("batchSinCos cos |x| < %-10g %12.2f\n", RANGES[r], maxCos);
+        }
+
+        srand(2);
+        for (size_t i=0; i<SAMPLES; i++)
+        {
+            y[i] = randomRange(-1.0, 1.0) * pow(10.0, double(rand() % 7 - 3));
+            x[i] = randomRange(-1.0, 1.0) * pow(10.0, double(rand() % 7 - 3));
+        }
+        simd::batchAtan2(y.data(), x.data(), out.data(), SAMPLES);
+        double maxAtan2 = 0.0;
+        for (size_t i=0; i<SAMPLES; i++)
+            maxAtan2 = fmax(maxAtan2, ulpError(out[i], atan2l(y[i], x[i])));
+        printf("%-32s %12.2f\n", "batchAtan2", maxAtan2);
+
+        fill(x, -1.0, 1.0);
+        simd::batchAsin(x.data(), out.data(), SAMPLES);
+        simd::batchAcos(x.data(), out2.data(), SAMPLES);
+        double maxAsin = 0.0, maxAcos = 0.0;
+        for (size_t i=0; i<SAMPLES; i++)
+        {
+            maxAsin = fmax(maxAsin, ulpError(out[i], asinl(x[i])));
+            maxAcos = fmax(maxAcos, ulpError(out2[i], acosl(x[i])));
+        }
+        printf("%-32s %12.2f\n", "batchAsin", maxAsin);
+        printf("%-32s %12.2f\n", "batchAcos", maxAcos);
+
+        fill(x, 1.0e-3, 1.0e3);
+        simd::batchRsqrt(x.data(), out.data(), SAMPLES);
+        double maxRsqrt = 0.0;
+        for (size_t i=0; i<SAMPLES; i++)
+            maxRsqrt = fmax(maxRsqrt, ulpError(out[i], 1.0L / sqrtl(x[i])));
+        printf("%-32s %12.2f\n", "batchRsqrt", maxRsqrt);
+        printf("\n");
+    }
+}
+
+int main()
+{
+    errorTable();
+
+    srand(3);
+    std::vector<double> angles(COUNT), y(COUNT), x(COUNT), unit(COUNT), positive(COUNT);
+    std::vector<double> out(COUNT), out2(COUNT);
+    fill(angles, -PI, PI);
+    fill(y, -1.0, 1.0);
+    fill(x, -1.0, 1.0);
+    fill(unit, -1.0, 1.0);
+    fill(positive, 1.0e-3, 1.0e3);
+
+    std::vector<gmbench::Result> results;
+    results.push_back(gmbench::run("libm sin + cos", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+        {
+            out[i] = sin(angles[i]);
+            out2[i] = cos(angles[i]);
+        }
+        gmbench::doNotOptimize(out[0]);
+    }, COUNT));
+    results.push_back(gmbench::run("libm atan2", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            out[i] = atan2(y[i], x[i]);
+        gmbench::doNotOptimize(out[0]);
+    }, COUNT));
+    results.push_back(gmbench::run("libm asin", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            out[i] = ::asin(unit[i]);
+        gmbench::doNotOptimize(out[0]);
+    }, COUNT));
+    results.push_back(gmbench::run("libm acos", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            out[i] = ::acos(unit[i]);
+        gmbench::doNotOptimize(out[0]);
+    }, COUNT));
+    results.push_back(gmbench::run("libm 1 / sqrt", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            out[i] = 1.0 / sqrt(positive[i]);
+        gmbench::doNotOptimize(out[0]);
+    }, COUNT));
+    gmbench::report("libm loops (ns per value)", results);
+    printf("\n");
+
+    simd::InstructionSet best = simd::detectInstructionSet();
+    for (int set=0; set<=static_cast<int>(best); set++)
+    {
+        simd::setInstructionSet(static_cast<simd::InstructionSet>(set));
+
+        results.clear();
+        results.push_back(gmbench::run("simd::batchSinCos", [&](size_t) {
+            simd::batchSinCos(angles.data(), out.data(), out2.data(), COUNT);
+            gmbench::doNotOptimize(out[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("simd::batchAtan2", [&](size_t) {
+            simd::batchAtan2(y.data(), x.data(), out.data(), COUNT);
+            gmbench::doNotOptimize(out[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("simd::batchAsin", [&](size_t) {
+            simd::batchAsin(unit.data(), out.data(), COUNT);
+            gmbench::doNotOptimize(out[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("simd::batchAcos", [&](size_t) {
+            simd::batchAcos(unit.data(), out.data(), COUNT);
+            gmbench::doNotOptimize(out[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("simd::batchRsqrt", [&](size_t) {
+            simd::batchRsqrt(positive.data(), out.data(), COUNT);
+            gmbench::doNotOptimize(out[0]);
+        }, COUNT));
+
+        std::string title = std::string("simd math functions, ") + simd::instructionSetName(simd::getInstructionSet()) + " (ns per value)";
+        gmbench::report(title.c_str(), results);
+        printf("\n");
+    }
+    simd::setInstructionSet(best);
+
+    // COUNT / 3 rotations, as packed triplets
+    const size_t ROTATIONS = COUNT / 3;
+    std::vector<double> quats(ROTATIONS*4), eulers(ROTATIONS*3);
+    results.clear();
+    results.push_back(gmbench::run("Quaternion::fromEuler ZXY", [&](size_t) {
+        for (size_t i=0; i<ROTATIONS; i++)
+        {
+            Quaternion q;
+            q.fromEuler(angles[i*3], angles[i*3+1], angles[i*3+2], RotationOrder::ZXY);
+            quats[i*4] = q.x;
+            quats[i*4+1] = q.y;
+            quats[i*4+2] = q.z;
+            quats[i*4+3] = q.w;
+        }
+        gmbench::doNotOptimize(quats[0]);
+    }, ROTATIONS));
+    results.push_back(gmbench::run("eulersToQuaternions ZXY", [&](size_t) {
+        eulersToQuaternions(angles.data(), quats.data(), ROTATIONS, RotationOrder::ZXY);
+        gmbench::doNotOptimize(quats[0]);
+    }, ROTATIONS));
+    results.push_back(gmbench::run("Quaternion::toEuler ZXY", [&](size_t) {
+        for (size_t i=0; i<ROTATIONS; i++)
+        {
+            Euler e = Quaternion(quats[i*4], quats[i*4+1], quats[i*4+2], quats[i*4+3]).toEuler(RotationOrder::ZXY);
+            eulers[i*3] = e.x;
+            eulers[i*3+1] = e.y;
+            eulers[i*3+2] = e.z;
+        }
+        gmbench::doNotOptimize(eulers[0]);
+    }, ROTATIONS));
+    results.push_back(gmbench::run("quaternionsToEulers ZXY", [&](size_t) {
+        quaternionsToEulers(quats.data(), eulers.data(), ROTATIONS, RotationOrder::ZXY);
+        gmbench::doNotOptimize(eulers[0]);
+    }, ROTATIONS));
+    gmbench::report("Euler conversions (ns per rotation)", results);
+
+    return 0;
+}
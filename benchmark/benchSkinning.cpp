@@ -0,0 +1,189 @@
+/*  Linear blend skinning of a 100000 vertices mesh by a 100 joints skeleton, 4 influences per vertex.
+
+    The naive version is the loop every tool writes: for every vertex, the sum of point * bindInverse * global
+    weighted by the influences. LinearBlendSkinner multiplies the palette once per frame in setPose and
+    blends the matrices in the simd kernel, on 1 thread and on all the gmath::parallel threads, then with
+    the normals. DualQuaternionSkinner does the same with dual quaternions.
+    The numbers are per vertex, the ops/s column gives the vertices per second.
+    A check follows with a non-uniform scale on every joint and one influence per vertex: the skinned
+    normals of both skinners must stay perpendicular to the skinned tangents, and agree. */
+
+#include "gmSkinning.h"
+#include "gmBenchmark.h"
+
+#include <algorithm>
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t VERTICES = 100000;
+    const size_t JOINTS = 100;
+    const size_t INFLUENCES = 4;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomVector()
+    {
+        return Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+    }
+
+    Xfo randomXfo()
+    {
+        return Xfo(Quaternion(randomVector().normalize(), randomRange(-PI, PI)), randomVector(), Vector3(1.0, 1.0, 1.0));
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Matrix4> bindInverses(JOINTS);
+    std::vector<Xfo> pose(JOINTS);
+    for (size_t j=0; j<JOINTS; j++)
+    {
+        bindInverses[j] = randomXfo().toMatrix4().inverse();
+        pose[j] = randomXfo();
+    }
+
+    std::vector<size_t> offsets(VERTICES+1);
+    std::vector<unsigned int> joints(VERTICES*INFLUENCES);
+    std::vector<double> weights(VERTICES*INFLUENCES);
+    for (size_t v=0; v<=VERTICES; v++)
+        offsets[v] = v*INFLUENCES;
+    for (size_t i=0; i<joints.size(); i++)
+    {
+        joints[i] = (unsigned int)(rand() % JOINTS);
+        weights[i] = randomRange(0.1, 1.0);
+    }
+
+    LinearBlendSkinner skinner(bindInverses, offsets, joints, weights);
+    skinner.normalizeWeights();
+    DualQuaternionSkinner dqSkinner(bindInverses, offsets, joints, weights);
+    dqSkinner.normalizeWeights();
+    const std::vector<double>& normalized = skinner.getWeights();
+
+    std::vector<double> points(VERTICES*3), normals(VERTICES*3), outPoints(VERTICES*3), outNormals(VERTICES*3);
+    for (size_t v=0; v<VERTICES; v++)
+    {
+        Vector3 point = randomVector(), normal = randomVector().normalize();
+        for (int c=0; c<3; c++)
+        {
+            points[v*3+c] = point[c];
+            normals[v*3+c] = normal[c];
+        }
+    }
+
+    size_t threads = parallel::getThreadCount();
+    std::vector<gmbench::Result> results;
+
+    results.push_back(gmbench::run("naive loop, Vector3 * Matrix4 per influence", [&](size_t) {
+        std::vector<Matrix4> globals(JOINTS);
+        for (size_t j=0; j<JOINTS; j++)
+            globals[j] = pose[j].toMatrix4();
+        for (size_t v=0; v<VERTICES; v++)
+        {
+            Vector3 point(points[v*3], points[v*3+1], points[v*3+2]), skinned(0.0, 0.0, 0.0);
+            for (size_t i=offsets[v]; i<offsets[v+1]; i++)
+                skinned += (point * bindInverses[joints[i]] * globals[joints[i]]) * normalized[i];
+            for (int c=0; c<3; c++)
+                outPoints[v*3+c] = skinned[c];
+        }
+        gmbench::doNotOptimize(outPoints[0]);
+    }, VERTICES));
+
+    parallel::setThreadCount(1);
+    results.push_back(gmbench::run("LinearBlendSkinner points, 1 thread", [&](size_t) {
+        skinner.setPose(pose);
+        skinner.skin(&points[0], &outPoints[0]);
+        gmbench::doNotOptimize(outPoints[0]);
+    }, VERTICES));
+    results.push_back(gmbench::run("LinearBlendSkinner points and normals, 1 thread", [&](size_t) {
+        skinner.setPose(pose);
+        skinner.skin(&points[0], &outPoints[0], &normals[0], &outNormals[0]);
+        gmbench::doNotOptimize(outNormals[0]);
+    }, VERTICES));
+
+    results.push_back(gmbench::run("DualQuaternionSkinner points, 1 thread", [&](size_t) {
+        dqSkinner.setPose(pose);
+        dqSkinner.skin(&points[0], &outPoints[0]);
+        gmbench::doNotOptimize(outPoints[0]);
+    }, VERTICES));
+    results.push_back(gmbench::run("DualQuaternionSkinner points and normals, 1 thread", [&](size_t) {
+        dqSkinner.setPose(pose);
+        dqSkinner.skin(&points[0], &outPoints[0], &normals[0], &outNormals[0]);
+        gmbench::doNotOptimize(outNormals[0]);
+    }, VERTICES));
+
+    parallel::setThreadCount(threads);
+    char name[64];
+    snprintf(name, sizeof(name), "LinearBlendSkinner points, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        skinner.setPose(pose);
+        skinner.skin(&points[0], &outPoints[0]);
+        gmbench::doNotOptimize(outPoints[0]);
+    }, VERTICES));
+    snprintf(name, sizeof(name), "LinearBlendSkinner points and normals, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        skinner.setPose(pose);
+        skinner.skin(&points[0], &outPoints[0], &normals[0], &outNormals[0]);
+        gmbench::doNotOptimize(outNormals[0]);
+    }, VERTICES));
+    snprintf(name, sizeof(name), "DualQuaternionSkinner points, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        dqSkinner.setPose(pose);
+        dqSkinner.skin(&points[0], &outPoints[0]);
+        gmbench::doNotOptimize(outPoints[0]);
+    }, VERTICES));
+    snprintf(name, sizeof(name), "DualQuaternionSkinner points and normals, %u threads", (unsigned int)threads);
+    results.push_back(gmbench::run(name, [&](size_t) {
+        dqSkinner.setPose(pose);
+        dqSkinner.skin(&points[0], &outPoints[0], &normals[0], &outNormals[0]);
+        gmbench::doNotOptimize(outNormals[0]);
+    }, VERTICES));
+
+    gmbench::report("Skinning of 100000 vertices (ns per vertex, ops/s is vertices per second)", results);
+
+    // the check: the bind pose at the origin, so both skinners take the whole rotation and scale
+    const size_t CHECKED = 10000;
+    std::vector<Matrix4> identities(JOINTS, Matrix4::IDENTITY);
+    std::vector<Xfo> scaledPose(JOINTS);
+    for (size_t j=0; j<JOINTS; j++)
+        scaledPose[j] = Xfo(pose[j].ori, pose[j].tr, Vector3(randomRange(0.2, 5.0), randomRange(0.2, 5.0), randomRange(0.2, 5.0)));
+    std::vector<size_t> rigidOffsets(CHECKED+1);
+    std::vector<unsigned int> rigidJoints(CHECKED);
+    std::vector<double> rigidWeights(CHECKED, 1.0);
+    for (size_t v=0; v<=CHECKED; v++)
+        rigidOffsets[v] = v;
+    for (size_t v=0; v<CHECKED; v++)
+        rigidJoints[v] = (unsigned int)(v % JOINTS);
+
+    LinearBlendSkinner rigid(identities, rigidOffsets, rigidJoints, rigidWeights);
+    DualQuaternionSkinner dqRigid(identities, rigidOffsets, rigidJoints, rigidWeights);
+    rigid.setPose(scaledPose);
+    dqRigid.setPose(scaledPose);
+    std::vector<double> dqPoints(CHECKED*3), dqNormals(CHECKED*3);
+    rigid.skin(&points[0], &outPoints[0], &normals[0], &outNormals[0]);
+    dqRigid.skin(&points[0], &dqPoints[0], &normals[0], &dqNormals[0]);
+
+    double maxDot = 0.0, maxDifference = 0.0;
+    for (size_t v=0; v<CHECKED; v++)
+    {
+        Vector3 point(points[v*3], points[v*3+1], points[v*3+2]), normal(normals[v*3], normals[v*3+1], normals[v*3+2]);
+        Vector3 tangent = normal.cross(randomVector()).normalize();
+        Matrix4 palette = rigid.getPaletteMatrix(rigidJoints[v]);
+        Vector3 skinnedTangent = ((point + tangent) * palette - point * palette).normalize();
+        Vector3 skinned(outNormals[v*3], outNormals[v*3+1], outNormals[v*3+2]);
+        Vector3 dqSkinned(dqNormals[v*3], dqNormals[v*3+1], dqNormals[v*3+2]);
+        maxDot = std::max(maxDot, fabs(skinned.dot(skinnedTangent)));
+        maxDifference = std::max(maxDifference, (skinned - dqSkinned).length());
+    }
+    printf("non-uniform scale: max |normal . tangent| %.3e, max |linear blend - dual quaternion normal| %.3e\n",
+           maxDot, maxDifference);
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*  Accuracy and speed of the SlerpMethod approximations.
+
+    The error table compares every method with Quaternion::slerp, the rotations between the two
+    quaternions go from 0 to 180 degrees and t from 0 to 1. The angle error is the rotation angle
+    between the result and the exact slerp, in radians, the length error is | length - 1 |.
+    The timings are per quaternion (or per Xfo) over arrays of COUNT elements. */
+
+#include "gmXfoArray.h"
+#include "gmBenchmark.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 10000;
+
+    struct Method
+    {
+        SlerpMethod method;
+        const char* name;
+    };
+
+    const Method METHODS[] = {
+        { SlerpMethod::EXACT, "EXACT" },
+        { SlerpMethod::POLYNOMIAL, "POLYNOMIAL" },
+        { SlerpMethod::POLYNOMIAL_FAST, "POLYNOMIAL_FAST" },
+        { SlerpMethod::CORRECTED_NLERP, "CORRECTED_NLERP" },
+        { SlerpMethod::NLERP, "NLERP" }
+    };
+    const size_t METHOD_COUNT = sizeof(METHODS) / sizeof(METHODS[0]);
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+
+    Vector3 randomAxis()
+    {
+        return Vector3(randomRange(-1.0, 1.0), randomRange(-1.0, 1.0), randomRange(-1.0, 1.0)).normalize();
+    }
+
+    /** The angle of the rotation taking exact to q, q doesn't need to be normalized. */
+    double angleBetween(const Quaternion& exact, const Quaternion& q)
+    {
+        Quaternion delta = exact.conjugate() * q;
+        double sine = sqrt(delta.x*delta.x + delta.y*delta.y + delta.z*delta.z);
+        return 2.0 * atan2(sine, fabs(delta.w));
+    }
+
+    void errorTable()
+    {
+        const int ANGLES = 3600;
+        const int STEPS = 64;
+
+        printf("Error against Quaternion::slerp, rotations from 0 to 180 degrees\n");
+        printf("%-20s %20s %20s %20s\n", "method", "max angle error", "max length error", "worst rotation (deg)");
+        for (size_t m=1; m<METHOD_COUNT; m++)
+        {
+            srand(1);
+            double maxAngle = 0.0, maxLength = 0.0, worst = 0.0;
+            for (int a=0; a<=ANGLES; a++)
+            {
+                double rotation = PI * double(a) / double(ANGLES);
+                Quaternion q1(randomAxis(), randomRange(-PI, PI));
+                Quaternion q2 = q1 * Quaternion(randomAxis(), rotation);
+                // the far hemisphere too, every method must take the shortest path
+                if (a % 2)
+                    q2 = -q2;
+
+                for (int s=0; s<=STEPS; s++)
+                {
+                    double t = double(s) / double(STEPS);
+                    Quaternion exact = q1.slerp(q2, t);
+                    Quaternion q = q1.interpolate(q2, t, METHODS[m].method);
+
+                    double angle = angleBetween(exact, q);
+                    if (angle > maxAngle)
+                    {
+                        maxAngle = angle;
+                        worst = rotation * 180.0 / PI;
+                    }
+                    double length = fabs(q.length() - 1.0);
+                    maxLength = length > maxLength ? length : maxLength;
+                }
+            }
+            printf("%-20s %20.3e %20.3e %20.1f\n", METHODS[m].name, maxAngle, maxLength, worst);
+        }
+        printf("\n");
+    }
+}
+
+int main()
+{
+    errorTable();
+
+    srand(2);
+    std::vector<Quaternion> from(COUNT), to(COUNT), outQuats(COUNT);
+    std::vector<Xfo> fromXfos(COUNT), toXfos(COUNT), outXfos(COUNT);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        from[i] = Quaternion(randomAxis(), randomRange(-PI, PI));
+        to[i] = Quaternion(randomAxis(), randomRange(-PI, PI));
+        Vector3 tr(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+        fromXfos[i] = Xfo(from[i], tr, Vector3(1.0, 1.0, 1.0));
+        toXfos[i] = Xfo(to[i], -tr, Vector3(2.0, 2.0, 2.0));
+    }
+    QuaternionArray fromArray(from), toArray(to), outArray;
+    XfoArray fromXfoArray(fromXfos), toXfoArray(toXfos), outXfoArray;
+
+    std::vector<gmbench::Result> results;
+    for (size_t m=0; m<METHOD_COUNT; m++)
+    {
+        SlerpMethod method = METHODS[m].method;
+        std::string name = METHODS[m].name;
+        double t = 0.3;
+
+        results.push_back(gmbench::run("Quaternion::interpolate " + name, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outQuats[i] = from[i].interpolate(to[i], t, method);
+            gmbench::doNotOptimize(outQuats[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("QuaternionArray::slerp " + name, [&](size_t) {
+            fromArray.slerp(toArray, t, outArray, method);
+            gmbench::doNotOptimize(outArray.x()[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("Xfo::interpolate " + name, [&](size_t) {
+            for (size_t i=0; i<COUNT; i++)
+                outXfos[i] = fromXfos[i].interpolate(toXfos[i], t, method);
+            gmbench::doNotOptimize(outXfos[0]);
+        }, COUNT));
+        results.push_back(gmbench::run("XfoArray::slerp " + name, [&](size_t) {
+            fromXfoArray.slerp(toXfoArray, t, outXfoArray, method);
+            gmbench::doNotOptimize(outXfoArray.tr.x()[0]);
+        }, COUNT));
+    }
+
+    gmbench::report("Slerp methods (ns per quaternion or Xfo)", results);
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*  Transforming a point cloud one point at a time against the batch functions,
+    then mapping it back into the space of the transform with and without a cached inverse. */
+
+#include "gmBatch.h"
+#include "gmInverseCachedTransform.h"
+#include "gmQuaternion.h"
+#include "gmBenchmark.h"
+
+#include <stdlib.h>
+
+using namespace gmath;
+
+namespace
+{
+    const size_t COUNT = 500000;
+
+    double randomRange(double low, double high)
+    {
+        return low + (high-low) * (double(rand()) / double(RAND_MAX));
+    }
+}
+
+int main()
+{
+    srand(1);
+
+    std::vector<Vector3> points(COUNT), outPoints(COUNT);
+    std::vector<double> xyz(COUNT*3), outXyz(COUNT*3);
+    std::vector<double> x(COUNT), y(COUNT), z(COUNT), outX(COUNT), outY(COUNT), outZ(COUNT);
+    for (size_t i=0; i<COUNT; i++)
+    {
+        points[i] = Vector3(randomRange(-10.0, 10.0), randomRange(-10.0, 10.0), randomRange(-10.0, 10.0));
+        xyz[i*3] = x[i] = points[i].x;
+        xyz[i*3+1] = y[i] = points[i].y;
+        xyz[i*3+2] = z[i] = points[i].z;
+    }
+
+    Xfo xfo(Quaternion(Vector3(1.0, 2.0, 3.0).normalize(), 0.7), Vector3(1.0, -2.0, 3.0), Vector3(1.5, 1.5, 1.5));
+    Matrix4 mat = xfo.toMatrix4();
+
+    std::vector<gmbench::Result> results;
+
+    results.push_back(gmbench::run("Vector3 * Matrix4 loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outPoints[i] = points[i] * mat;
+    }, COUNT));
+    results.push_back(gmbench::run("transformPoints(Matrix4, xyz)", [&](size_t) {
+        transformPoints(mat, &xyz[0], &outXyz[0], COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("transformPoints(Matrix4, x, y, z)", [&](size_t) {
+        transformPoints(mat, &x[0], &y[0], &z[0], &outX[0], &outY[0], &outZ[0], COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("Xfo::transformVector loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outPoints[i] = xfo.transformVector(points[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("transformPoints(Xfo, xyz)", [&](size_t) {
+        transformPoints(xfo, &xyz[0], &outXyz[0], COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("transformPoints(Xfo, x, y, z)", [&](size_t) {
+        transformPoints(xfo, &x[0], &y[0], &z[0], &outX[0], &outY[0], &outZ[0], COUNT);
+    }, COUNT));
+
+    InverseCachedXfo cachedXfo(xfo);
+    InverseCachedMatrix4 cachedMat(mat);
+    results.push_back(gmbench::run("Xfo::inverseTransformVector loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outPoints[i] = xfo.inverseTransformVector(points[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("InverseCachedXfo::inverseTransformVector loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outPoints[i] = cachedXfo.inverseTransformVector(points[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("InverseCachedXfo::inverseTransformPoints(xyz)", [&](size_t) {
+        cachedXfo.inverseTransformPoints(&xyz[0], &outXyz[0], COUNT);
+    }, COUNT));
+    results.push_back(gmbench::run("Vector3 * Matrix4::inverse loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outPoints[i] = points[i] * mat.inverse();
+    }, COUNT));
+    results.push_back(gmbench::run("InverseCachedMatrix4::inverseTransformVector loop", [&](size_t) {
+        for (size_t i=0; i<COUNT; i++)
+            outPoints[i] = cachedMat.inverseTransformVector(points[i]);
+    }, COUNT));
+    results.push_back(gmbench::run("InverseCachedMatrix4::inverseTransformPoints(x, y, z)", [&](size_t) {
+        cachedMat.inverseTransformPoints(&x[0], &y[0], &z[0], &outX[0], &outY[0], &outZ[0], COUNT);
+    }, COUNT));
+
+    gmbench::report("Transforming 500k points, time per point", results);
+    return 0;
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*  Minimal timing harness shared by the GMath benchmarks.
+    A benchmark is a callable taking the iteration index. It is run in growing
+    batches until a batch lasts at least minSeconds, that batch gives the timing.
+    When a call processes several items (a batch function), itemsPerCall makes
+    the reported time per item instead of per call.
+    bytesPerOp is the memory an operation reads and writes (its arguments and its result),
+    it is informative only and 0 when not given. */
+namespace gmbench
+{
+    /** Stops the optimiser from discarding a value computed by the code being measured. */
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+    #else
+        static volatile const void* sink;
+        sink = &value;
+    #endif
+    }
+
+    struct Result
+    {
+        std::string name;
+        size_t iterations;
+        double nsPerOp;
+        size_t bytesPerOp;
+
+        double opsPerSecond() const
+        {
+            return nsPerOp > 0.0 ? 1e9 / nsPerOp : 0.0;
+        }
+    };
+
+    /** Sum of the sizes of the types, for bytesPerOp: bytesOf<Vector3, Vector3, Vector3>() for a + b = c. */
+    template <typename T>
+    inline size_t bytesOf()
+    {
+        return sizeof(T);
+    }
+
+    template <typename T, typename Next, typename... Others>
+    inline size_t bytesOf()
+    {
+        return sizeof(T) + bytesOf<Next, Others...>();
+    }
+
+    template <typename Func>
+    Result run(const std::string& name, Func func, size_t itemsPerCall=1, double minSeconds=0.25)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        size_t iterations = 1;
+        double elapsed = 0.0;
+        while (true)
+        {
+            Clock::time_point start = Clock::now();
+            for (size_t i=0; i<iterations; i++)
+            {
+                func(i);
+            }
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+            if (elapsed >= minSeconds)
+                break;
+
+            // aim a bit past minSeconds, but never grow more than 10x at a time
+            double growth = elapsed > 0.0 ? 1.5 * minSeconds / elapsed : 10.0;
+            growth = growth < 2.0 ? 2.0 : (growth > 10.0 ? 10.0 : growth);
+            iterations = size_t(double(iterations) * growth);
+        }
+
+        Result result;
+        result.name = name;
+        result.iterations = iterations * itemsPerCall;
+        result.nsPerOp = elapsed * 1e9 / double(iterations * itemsPerCall);
+        result.bytesPerOp = 0;
+        return result;
+    }
+
+    inline void report(const char* title, const std::vector<Result>& results)
+    {
+        printf("%s\n", title);
+        printf("%-48s %14s %14s %16s %10s\n", "benchmark", "iterations", "ns/op", "ops/s", "bytes/op");
+        for (size_t i=0; i<results.size(); i++)
+        {
+            printf("%-48s %14llu %14.3f %16.0f %10llu\n", results[i].name.c_str(),
+                   (unsigned long long)results[i].iterations, results[i].nsPerOp,
+                   results[i].opsPerSecond(), (unsigned long long)results[i].bytesPerOp);
+        }
+    }
+
+    inline std::string jsonEscape(const std::string& text)
+    {
+        std::string out;
+        for (size_t i=0; i<text.size(); i++)
+        {
+            char c = text[i];
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    /** Write the results as JSON, the layout follows the one of Google Benchmark
+        ("context" then a "benchmarks" list) so the usual comparison scripts can read it.
+        Returns false if the file can't be written. */
+    inline bool writeJson(const char* path, const char* title, const std::vector<Result>& results,
+                          const std::vector< std::pair<std::string, std::string> >& context=std::vector< std::pair<std::string, std::string> >())
+    {
+        FILE* file = fopen(path, "w");
+        if (!file)
+            return false;
+
+        char date[64];
+        time_t now = time(NULL);
+        strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+        fprintf(file, "{\n  \"context\": {\n");
+        fprintf(file, "    \"title\": \"%s\",\n", jsonEscape(title).c_str());
+        for (size_t i=0; i<context.size(); i++)
+            fprintf(file, "    \"%s\": \"%s\",\n", jsonEscape(context[i].first).c_str(), jsonEscape(context[i].second).c_str());
+        fprintf(file, "    \"date\": \"%s\"\n  },\n  \"benchmarks\": [\n", date);
+        for (size_t i=0; i<results.size(); i++)
+        {
+            fprintf(file, "    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.4f, \"ops_per_second\": %.1f, \"bytes_per_op\": %llu}%s\n",
+                    jsonEscape(results[i].name).c_str(), (unsigned long long)results[i].iterations, results[i].nsPerOp,
+                    results[i].opsPerSecond(), (unsigned long long)results[i].bytesPerOp, i+1 < results.size() ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        fclose(file);
+        return true;
+    }
+
+    /** A list of benchmarks driven by the command line:
+            --filter=text     only run the benchmarks whose name contains text
+            --min-time=secs   minimum duration of the timed batch of each benchmark
+            --json=path       also write the results to path as JSON */
+    class Suite
+    {
+    private:
+        std::string _title;
+        std::string _filter;
+        std::string _jsonPath;
+        double _minSeconds;
+        std::vector< std::pair<std::string, std::string> > _context;
+        std::vector<Result> _results;
+
+    public:
+        Suite(const std::string& title, int argc, char** argv, double minSeconds=0.05)
+            : _title(title), _minSeconds(minSeconds)
+        {
+            for (int i=1; i<argc; i++)
+            {
+                std::string arg = argv[i];
+                if (arg.compare(0, 9, "--filter=") == 0)
+                    _filter = arg.substr(9);
+                else if (arg.compare(0, 11, "--min-time=") == 0)
+                    _minSeconds = atof(arg.substr(11).c_str());
+                else if (arg.compare(0, 7, "--json=") == 0)
+                    _jsonPath = arg.substr(7);
+                else
+                    fprintf(stderr, "unknown option %s (use --filter=text, --min-time=secs, --json=path)\n", arg.c_str());
+            }
+        }
+
+        /** Extra key, value pairs of the JSON context. */
+        void addContext(const std::string& key, const std::string& value)
+        {
+            _context.push_back(std::make_pair(key, value));
+        }
+
+        template <typename Func>
+        void add(const std::string& name, size_t bytesPerOp, Func func)
+        {
+            if (!_filter.empty() && name.find(_filter) == std::string::npos)
+                return;
+            Result result = run(name, func, 1, _minSeconds);
+            result.bytesPerOp = bytesPerOp;
+            _results.push_back(result);
+        }
+
+        /** Print the table and write the JSON file if asked, returns the exit code of the program. */
+        int finish()
+        {
+            report(_title.c_str(), _results);
+            if (!_jsonPath.empty())
+            {
+                if (!writeJson(_jsonPath.c_str(), _title.c_str(), _results, _context))
+                {
+                    fprintf(stderr, "cannot write %s\n", _jsonPath.c_str());
+                    return 1;
+                }
+                printf("results written to %s\n", _jsonPath.c_str());
+            }
+            return 0;
+        }
+    };
+}
@@ -0,0 +1,103 @@
+%module gmath
+%{
+#include "gmVector3.h"
+#include "gmVector4.h"
+#include "gmEuler.h"
+#include "gmQuaternion.h"
+#include "gmMatrix3.h"
+#include "gmMatrix4.h"
+
+namespace gmath
+{
+namespace python
+{
+    /*  Buffer protocol of the value classes.
+
+        memoryview(obj) or numpy.asarray(obj) gives a writable float64 view on the values
+        of obj, without copies: writing to the view changes obj and the view keeps obj alive.
+        Vector3, Euler: shape (3,), Vector4, Quaternion: (4,), Matrix3: (3, 3), Matrix4: (4, 4).
+        Euler values are in the unit of the Euler (Euler.getUnit()). */
+
+    /** Fill view for the size doubles at values, shape is {size} for ndim 1 or {rows, cols} for ndim 2. */
+    inline int fillBuffer(PyObject* exporter, double* values, int ndim, Py_ssize_t* shape, Py_ssize_t* strides,
+                          Py_buffer* view, int flags)
+    {
+        Py_ssize_t size = ndim == 1 ? shape[0] : shape[0] * shape[1];
+
+        view->obj = exporter;
+        Py_INCREF(exporter);
+        view->buf = values;
+        view->len = size * Py_ssize_t(sizeof(double));
+        view->readonly = 0;
+        view->itemsize = sizeof(double);
+        view->format = (flags & PyBUF_FORMAT) ? (char*)"d" : NULL;
+        view->ndim = ndim;
+        view->shape = (flags & PyBUF_ND) == PyBUF_ND ? shape : NULL;
+        view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? strides : NULL;
+        view->suboffsets = NULL;
+        view->internal = NULL;
+        return 0;
+    }
+
+    /** bf_getbuffer of the class T, its values are ROWS x COLS doubles (ROWS is 1 for the vectors). */
+    template <typename T, Py_ssize_t ROWS, Py_ssize_t COLS>
+    int getBuffer(PyObject* exporter, Py_buffer* view, int flags, const char* typeName)
+    {
+        static Py_ssize_t shape[2] = {ROWS > 1 ? ROWS : COLS, COLS};
+        static Py_ssize_t strides[2] = {ROWS > 1 ? COLS * Py_ssize_t(sizeof(double)) : Py_ssize_t(sizeof(double)),
+                                        Py_ssize_t(sizeof(double))};
+        static swig_type_info* type = SWIG_TypeQuery(typeName);
+
+        void* object = 0;
+        if (!type || !SWIG_IsOK(SWIG_ConvertPtr(exporter, &object, type, 0)) || !object)
+        {
+            view->obj = NULL;
+            PyErr_SetString(PyExc_BufferError, "gmath: cannot get the buffer of this object");
+            return -1;
+        }
+        return fillBuffer(exporter, static_cast<T*>(object)->data(), ROWS > 1 ? 2 : 1, shape, strides, view, flags);
+    }
+}
+}
+
+static int gmath_Vector3_getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    return gmath::python::getBuffer<gmath::Vector3, 1, 3>(exporter, view, flags, "gmath::Vector3T< double > *");
+}
+
+static int gmath_Vector4_getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    return gmath::python::getBuffer<gmath::Vector4, 1, 4>(exporter, view, flags, "gmath::Vector4T< double > *");
+}
+
+static int gmath_Euler_getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    return gmath::python::getBuffer<gmath::Euler, 1, 3>(exporter, view, flags, "gmath::EulerT< double > *");
+}
+
+static int gmath_Quaternion_getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    return gmath::python::getBuffer<gmath::Quaternion, 1, 4>(exporter, view, flags, "gmath::QuaternionT< double > *");
+}
+
+static int gmath_Matrix3_getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    return gmath::python::getBuffer<gmath::Matrix3, 3, 3>(exporter, view, flags, "gmath::Matrix3T< double > *");
+}
+
+static int gmath_Matrix4_getbuffer(PyObject* exporter, Py_buffer* view, int flags)
+{
+    return gmath::python::getBuffer<gmath::Matrix4, 4, 4>(exporter, view, flags, "gmath::Matrix4T< double > *");
+}
+%}
+
+// the buffer slot only exists on the builtin types (-builtin, the default build),
+// the Maya build (-modern proxy classes) doesn't expose it
+namespace gmath {
+    %feature("python:bf_getbuffer") Vector3T<double> "gmath_Vector3_getbuffer";
+    %feature("python:bf_getbuffer") Vector4T<double> "gmath_Vector4_getbuffer";
+    %feature("python:bf_getbuffer") EulerT<double> "gmath_Euler_getbuffer";
+    %feature("python:bf_getbuffer") QuaternionT<double> "gmath_Quaternion_getbuffer";
+    %feature("python:bf_getbuffer") Matrix3T<double> "gmath_Matrix3_getbuffer";
+    %feature("python:bf_getbuffer") Matrix4T<double> "gmath_Matrix4_getbuffer";
+}
@@ -0,0 +1,368 @@
+%module gmath
+%{
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "gmBatch.h"
+#include "gmEuler.h"
+#include "gmMatrix4.h"
+#include "gmQuaternion.h"
+#include "gmXfo.h"
+
+namespace gmath
+{
+namespace bulk
+{
+    /*  Bulk functions working on Python buffers (NumPy arrays, memoryviews, array.array...).
+
+        Every element is a row of float64: (N,3) for vectors and Euler angles (radians),
+        (N,4) for quaternions (x, y, z, w) and (N,4,4) for row major matrices.
+        The rows can be strided (a NumPy slice), the values inside a row must be contiguous.
+        Nothing is copied in or out, the C++ loop reads and writes the buffers directly
+        and the GIL is released while it runs.
+
+        out is optional: when given it must have the right shape and it can be one of the inputs,
+        otherwise a new (N,...) float64 memoryview is returned, numpy.asarray wraps it without copying. */
+
+    // thrown when a Python exception is already set, the wrapper only has to return NULL
+    class PythonError : public std::exception
+    {
+    };
+
+    class Buffer
+    {
+    private:
+        Py_buffer _view;
+
+    public:
+        Buffer(PyObject* object, bool writable, const char* name)
+        {
+            int flags = PyBUF_STRIDES | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+            if (PyObject_GetBuffer(object, &_view, flags) != 0)
+                throw PythonError();
+
+            const char* format = _view.format ? _view.format : "B";
+            if (format[0] == '@' || format[0] == '=')
+                format++;
+            #if PY_LITTLE_ENDIAN
+                if (format[0] == '<')
+                    format++;
+            #endif
+            if (_view.itemsize != sizeof(double) || strcmp(format, "d") != 0)
+            {
+                PyBuffer_Release(&_view);
+                throw std::invalid_argument(std::string(name) + " must be a float64 array");
+            }
+        }
+
+        ~Buffer()
+        {
+            PyBuffer_Release(&_view);
+        }
+
+        size_t rows() const
+        {
+            return _view.ndim > 0 ? size_t(_view.shape[0]) : 0;
+        }
+
+        /** Check the shape is (rows, cols) or (rows, cols, depth), with contiguous rows. */
+        void checkShape(const char* name, Py_ssize_t cols, Py_ssize_t depth=0) const
+        {
+            int ndim = depth > 0 ? 3 : 2;
+            bool valid = _view.ndim == ndim && _view.shape[1] == cols && (ndim == 2 || _view.shape[2] == depth);
+            if (!valid)
+            {
+                std::string shape = depth > 0 ? "(N, 4, 4)" : "(N, " + std::to_string(cols) + ")";
+                throw std::invalid_argument(std::string(name) + " must have shape " + shape);
+            }
+
+            Py_ssize_t inner = depth > 0 ? depth : cols;
+            if (_view.strides[ndim-1] != Py_ssize_t(sizeof(double)) ||
+                (ndim == 3 && _view.strides[1] != Py_ssize_t(inner * sizeof(double))) ||
+                _view.strides[0] % Py_ssize_t(sizeof(double)) != 0)
+                throw std::invalid_argument(std::string(name) + " rows must be contiguous float64 values");
+        }
+
+        void checkRows(const char* name, size_t count) const
+        {
+            if (rows() != count)
+                throw std::invalid_argument(std::string(name) + " must have " + std::to_string(count) + " rows");
+        }
+
+        /** Distance between two rows, in doubles, it can be 0 or negative for NumPy broadcasts and reversed views. */
+        Py_ssize_t rowStride() const
+        {
+            return _view.strides[0] / Py_ssize_t(sizeof(double));
+        }
+
+        double* row(size_t i) const
+        {
+            return (double*)((char*)_view.buf + Py_ssize_t(i) * _view.strides[0]);
+        }
+    };
+
+    /** Release the GIL for the lifetime of the object. The buffers must be released after it, with the GIL. */
+    class AllowThreads
+    {
+    private:
+        PyThreadState* _state;
+
+    public:
+        AllowThreads() : _state(PyEval_SaveThread()) {}
+        ~AllowThreads() { PyEval_RestoreThread(_state); }
+    };
+
+    /** out if given (new reference), otherwise a new float64 memoryview of shape (rows, cols[, depth]). */
+    PyObject* outputArray(PyObject* out, size_t rows, Py_ssize_t cols, Py_ssize_t depth=0)
+    {
+        if (out && out != Py_None)
+        {
+            Py_INCREF(out);
+            return out;
+        }
+
+    #if PY_VERSION_HEX >= 0x03030000
+        // memoryview can't cast to a shape with a zero in it, so an empty result is a slice of a one row view
+        Py_ssize_t allocated = rows > 0 ? Py_ssize_t(rows) : 1;
+        Py_ssize_t bytes = allocated * cols * (depth > 0 ? depth : 1) * Py_ssize_t(sizeof(double));
+        PyObject* storage = PyByteArray_FromStringAndSize(NULL, bytes);
+        if (!storage)
+            throw PythonError();
+        memset(PyByteArray_AS_STRING(storage), 0, size_t(bytes));
+
+        PyObject* bytesView = PyMemoryView_FromObject(storage);
+        Py_DECREF(storage);
+        if (!bytesView)
+            throw PythonError();
+
+        PyObject* view = depth > 0 ? PyObject_CallMethod(bytesView, "cast", "s(nnn)", "d", allocated, cols, depth)
+                                   : PyObject_CallMethod(bytesView, "cast", "s(nn)", "d", allocated, cols);
+        Py_DECREF(bytesView);
+        if (!view)
+            throw PythonError();
+
+        if (rows == 0)
+        {
+            PyObject* empty = PySequence_GetSlice(view, 0, 0);
+            Py_DECREF(view);
+            if (!empty)
+                throw PythonError();
+            view = empty;
+        }
+        return view;
+    #else
+        throw std::invalid_argument("the out array is required with this version of Python");
+    #endif
+    }
+
+    /*  The common shape of the functions: check the inputs, get (or make) the output,
+        run func(out) without the GIL, return the output. */
+    template <typename Func>
+    PyObject* run(size_t rows, PyObject* out, Py_ssize_t cols, Py_ssize_t depth, Func func)
+    {
+        PyObject* result = outputArray(out, rows, cols, depth);
+        try
+        {
+            Buffer outBuffer(result, true, "out");
+            outBuffer.checkShape("out", cols, depth);
+            outBuffer.checkRows("out", rows);
+            {
+                AllowThreads allowThreads;
+                func(outBuffer);
+            }
+        }
+        catch (...)
+        {
+            Py_DECREF(result);
+            throw;
+        }
+        return result;
+    }
+
+    inline void store(double* row, const double* values, size_t count)
+    {
+        memcpy(row, values, count * sizeof(double));
+    }
+
+    /*------ Points ------*/
+
+    PyObject* transformPoints(const Matrix4& mat, PyObject* points, PyObject* out=NULL)
+    {
+        Buffer in(points, false, "points");
+        in.checkShape("points", 3);
+        return run(in.rows(), out, 3, 0, [&](Buffer& result) {
+            if (in.rowStride() >= 3 && in.rowStride() == result.rowStride())
+            {
+                gmath::transformPoints(mat, in.row(0), result.row(0), in.rows(), size_t(in.rowStride()));
+                return;
+            }
+            for (size_t i=0; i<in.rows(); i++)
+                store(result.row(i), (Vector3(in.row(i)) * mat).data(), 3);
+        });
+    }
+
+    PyObject* transformPoints(const Xfo& xfo, PyObject* points, PyObject* out=NULL)
+    {
+        return transformPoints(xfo.toMatrix4(), points, out);
+    }
+
+    /*------ Quaternions ------*/
+
+    PyObject* rotateVectors(PyObject* quaternions, PyObject* vectors, PyObject* out=NULL)
+    {
+        Buffer quats(quaternions, false, "quaternions");
+        quats.checkShape("quaternions", 4);
+        Buffer vecs(vectors, false, "vectors");
+        vecs.checkShape("vectors", 3);
+        vecs.checkRows("vectors", quats.rows());
+        return run(quats.rows(), out, 3, 0, [&](Buffer& result) {
+            for (size_t i=0; i<quats.rows(); i++)
+                store(result.row(i), Quaternion(quats.row(i)).rotateVector(Vector3(vecs.row(i))).data(), 3);
+        });
+    }
+
+    PyObject* multiplyQuaternions(PyObject* a, PyObject* b, PyObject* out=NULL)
+    {
+        Buffer left(a, false, "a");
+        left.checkShape("a", 4);
+        Buffer right(b, false, "b");
+        right.checkShape("b", 4);
+        right.checkRows("b", left.rows());
+        return run(left.rows(), out, 4, 0, [&](Buffer& result) {
+            for (size_t i=0; i<left.rows(); i++)
+                store(result.row(i), (Quaternion(left.row(i)) * Quaternion(right.row(i))).data(), 4);
+        });
+    }
+
+    PyObject* normalizeQuaternions(PyObject* quaternions, PyObject* out=NULL)
+    {
+        Buffer quats(quaternions, false, "quaternions");
+        quats.checkShape("quaternions", 4);
+        return run(quats.rows(), out, 4, 0, [&](Buffer& result) {
+            for (size_t i=0; i<quats.rows(); i++)
+                store(result.row(i), Quaternion(quats.row(i)).normalize().data(), 4);
+        });
+    }
+
+    PyObject* slerpQuaternions(PyObject* a, PyObject* b, double t, PyObject* out=NULL)
+    {
+        Buffer left(a, false, "a");
+        left.checkShape("a", 4);
+        Buffer right(b, false, "b");
+        right.checkShape("b", 4);
+        right.checkRows("b", left.rows());
+        return run(left.rows(), out, 4, 0, [&](Buffer& result) {
+            for (size_t i=0; i<left.rows(); i++)
+                store(result.row(i), Quaternion(left.row(i)).slerp(Quaternion(right.row(i)), t).data(), 4);
+        });
+    }
+
+    /*------ Matrices ------*/
+
+    PyObject* multiplyMatrices(PyObject* a, PyObject* b, PyObject* out=NULL)
+    {
+        Buffer left(a, false, "a");
+        left.checkShape("a", 4, 4);
+        Buffer right(b, false, "b");
+        right.checkShape("b", 4, 4);
+        right.checkRows("b", left.rows());
+        return run(left.rows(), out, 4, 4, [&](Buffer& result) {
+            for (size_t i=0; i<left.rows(); i++)
+                store(result.row(i), (Matrix4(left.row(i)) * Matrix4(right.row(i))).data(), 16);
+        });
+    }
+
+    PyObject* inverseMatrices(PyObject* matrices, PyObject* out=NULL)
+    {
+        Buffer mats(matrices, false, "matrices");
+        mats.checkShape("matrices", 4, 4);
+        return run(mats.rows(), out, 4, 4, [&](Buffer& result) {
+            for (size_t i=0; i<mats.rows(); i++)
+                store(result.row(i), Matrix4(mats.row(i)).inverse().data(), 16);
+        });
+    }
+
+    /*------ Conversions ------*/
+
+    PyObject* quaternionsToMatrices(PyObject* quaternions, PyObject* out=NULL)
+    {
+        Buffer quats(quaternions, false, "quaternions");
+        quats.checkShape("quaternions", 4);
+        return run(quats.rows(), out, 4, 4, [&](Buffer& result) {
+            for (size_t i=0; i<quats.rows(); i++)
+                store(result.row(i), Quaternion(quats.row(i)).toMatrix4().data(), 16);
+        });
+    }
+
+    PyObject* matricesToQuaternions(PyObject* matrices, PyObject* out=NULL)
+    {
+        Buffer mats(matrices, false, "matrices");
+        mats.checkShape("matrices", 4, 4);
+        return run(mats.rows(), out, 4, 0, [&](Buffer& result) {
+            for (size_t i=0; i<mats.rows(); i++)
+                store(result.row(i), Matrix4(mats.row(i)).toQuaternion().data(), 4);
+        });
+    }
+
+    PyObject* eulersToQuaternions(PyObject* eulers, RotationOrder order=RotationOrder::XYZ, PyObject* out=NULL)
+    {
+        Buffer angles(eulers, false, "eulers");
+        angles.checkShape("eulers", 3);
+        return run(angles.rows(), out, 4, 0, [&](Buffer& result) {
+            Quaternion quat;
+            for (size_t i=0; i<angles.rows(); i++)
+            {
+                const double* row = angles.row(i);
+                quat.fromEuler(row[0], row[1], row[2], order);
+                store(result.row(i), quat.data(), 4);
+            }
+        });
+    }
+
+    PyObject* quaternionsToEulers(PyObject* quaternions, RotationOrder order=RotationOrder::XYZ, PyObject* out=NULL)
+    {
+        Buffer quats(quaternions, false, "quaternions");
+        quats.checkShape("quaternions", 4);
+        return run(quats.rows(), out, 3, 0, [&](Buffer& result) {
+            for (size_t i=0; i<quats.rows(); i++)
+                store(result.row(i), Quaternion(quats.row(i)).toEuler(order).toRadians().data(), 3);
+        });
+    }
+}
+}
+%}
+
+// the bulk functions raise ValueError for a wrong shape or type of array
+%exception {
+    try {
+        $action
+    } catch (const gmath::bulk::PythonError&) {
+        SWIG_fail;
+    } catch (const std::invalid_argument& e) {
+        SWIG_exception(SWIG_ValueError, e.what());
+    } catch (const std::exception& e) {
+        SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+}
+
+namespace gmath {
+namespace bulk {
+    PyObject* transformPoints(const Matrix4& mat, PyObject* points, PyObject* out=NULL);
+    PyObject* transformPoints(const Xfo& xfo, PyObject* points, PyObject* out=NULL);
+
+    PyObject* rotateVectors(PyObject* quaternions, PyObject* vectors, PyObject* out=NULL);
+    PyObject* multiplyQuaternions(PyObject* a, PyObject* b, PyObject* out=NULL);
+    PyObject* normalizeQuaternions(PyObject* quaternions, PyObject* out=NULL);
+    PyObject* slerpQuaternions(PyObject* a, PyObject* b, double t, PyObject* out=NULL);
+
+    PyObject* multiplyMatrices(PyObject* a, PyObject* b, PyObject* out=NULL);
+    PyObject* inverseMatrices(PyObject* matrices, PyObject* out=NULL);
+
+    PyObject* quaternionsToMatrices(PyObject* quaternions, PyObject* out=NULL);
+    PyObject* matricesToQuaternions(PyObject* matrices, PyObject* out=NULL);
+    PyObject* eulersToQuaternions(PyObject* eulers, RotationOrder order=RotationOrder::XYZ, PyObject* out=NULL);
+    PyObject* quaternionsToEulers(PyObject* quaternions, RotationOrder order=RotationOrder::XYZ, PyObject* out=NULL);
+}
+}
+
+%exception;
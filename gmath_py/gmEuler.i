@@ -5,7 +5,7 @@
 
 
 namespace gmath {
-    class Euler;
+    template <typename real> class EulerT;
     %typemap(out) double* data %{
         $result = PyTuple_New(3); // use however you know the size here
         for (int i = 0; i < 3; ++i) {
@@ -26,7 +26,7 @@ namespace gmath {
 // extending Euler
 namespace gmath{
 
-    %extend Euler{
+    %extend EulerT<double> {
 
         const double& __getitem__(int i) {
             return (*$self)[i];
@@ -70,3 +70,7 @@ namespace gmath{
     }
 }
 
+namespace gmath {
+    %template(Euler) EulerT<double>;
+}
+
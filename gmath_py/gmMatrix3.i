@@ -5,7 +5,7 @@
 
 
 namespace gmath {
-    class Matrix3;
+    template <typename real> class Matrix3T;
     %typemap(out) double* data %{
         $result = PyTuple_New(9); // use however you know the size here
         for (int i = 0; i < 9; ++i) {
@@ -14,14 +14,14 @@ namespace gmath {
     %}
 }
 
-%ignore gmath::Matrix3::operator()(int,int);
+%ignore gmath::Matrix3T<double>::operator()(int,int);
 
 %include "gmMatrix3.h"
 
 // extending Matrix3
 namespace gmath{
 
-    %extend Matrix3{
+    %extend Matrix3T<double> {
         const double& __getitem__(int i) {
             return (*$self)[i];
         }
@@ -52,3 +52,7 @@ namespace gmath{
     }
 }
 
+namespace gmath {
+    %template(Matrix3) Matrix3T<double>;
+}
+
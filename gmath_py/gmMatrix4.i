@@ -6,7 +6,7 @@
 
 
 namespace gmath {
-    class Matrix4;
+    template <typename real> class Matrix4T;
     %typemap(out) double* data %{
         $result = PyTuple_New(16); // use however you know the size here
         for (int i = 0; i < 16; ++i) {
@@ -15,13 +15,13 @@ namespace gmath {
     %}
 }
 
-%ignore gmath::Matrix4::operator()(int,int);
+%ignore gmath::Matrix4T<double>::operator()(int,int);
 
 #ifdef CMAYA
     // ignore these c++ functions and re-implement them in python
     // this bypass essentially 2 problems:the compatibility problem between swig and whatever maya's return in python.
-    %ignore gmath::Matrix4::fromMayaMatrix;
-    %ignore gmath::Matrix4::toMayaMatrix;
+    %ignore gmath::Matrix4T<double>::fromMayaMatrix;
+    %ignore gmath::Matrix4T<double>::toMayaMatrix;
 
     // let's inject some code in these function to handle pymel objects
 
@@ -57,7 +57,7 @@ namespace gmath {
 // extending Matrix4
 namespace gmath {
 
-    %extend Matrix4 {
+    %extend Matrix4T<double> {
 
         const double& __getitem__(int i) {
             return (*$self)[i];
@@ -176,3 +176,8 @@ namespace gmath {
 
 }
      
+
+namespace gmath {
+    %template(Matrix4) Matrix4T<double>;
+}
+
@@ -4,7 +4,7 @@
 %}
 
 namespace gmath {
-    class Quaternion;
+    template <typename real> class QuaternionT;
     %typemap(out) double* data %{
         $result = PyTuple_New(4); // use however you know the size here
         for (int i = 0; i < 4; ++i) {
@@ -25,7 +25,7 @@ namespace gmath {
 // extending Quaternion
 namespace gmath{
 
-    %extend Quaternion{
+    %extend QuaternionT<double> {
         const double& __getitem__(int i) {
             return (*$self)[i];
         }
@@ -65,3 +65,7 @@ namespace gmath{
     }
 }
 
+namespace gmath {
+    %template(Quaternion) QuaternionT<double>;
+}
+
@@ -98,6 +98,7 @@ namespace std {
 
 
 %include "gmRoot.h"
+%include "gmBuffer.i"
 %include "gmVector3.i"
 %include "gmVector4.i"
 %include "gmEuler.i"
@@ -106,4 +107,5 @@ namespace std {
 %include "gmMatrix4.i"
 %include "gmXfo.i"
 %include "gmUsefulFunctions.i"
+%include "gmBulk.i"
 
@@ -5,7 +5,7 @@
 
 
 namespace gmath {
-    class Vector3;
+    template <typename real> class Vector3T;
     %typemap(out) double* data %{
         $result = PyTuple_New(3); // use however you know the size here
         for (int i = 0; i < 3; ++i) {
@@ -26,7 +26,7 @@ namespace gmath {
 // extending Vector3
 namespace gmath{
     
-    %extend Vector3{
+    %extend Vector3T<double> {
 
         const double& __getitem__(int i) {
             return (*$self)[i];
@@ -67,3 +67,7 @@ namespace gmath{
     }
 }
 
+namespace gmath {
+    %template(Vector3) Vector3T<double>;
+}
+
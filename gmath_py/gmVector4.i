@@ -4,7 +4,7 @@
 %}
 
 namespace gmath {
-    class Vector4;
+    template <typename real> class Vector4T;
     %typemap(out) double* data %{
         $result = PyTuple_New(4); // use however you know the size here
         for (int i = 0; i < 4; ++i) {
@@ -25,7 +25,7 @@ namespace gmath {
 // extending Vector4
 namespace gmath{
 
-    %extend Vector4{
+    %extend Vector4T<double> {
         const double& __getitem__(int i) {
             return (*$self)[i];
         }
@@ -65,3 +65,7 @@ namespace gmath{
     }
 }
 
+namespace gmath {
+    %template(Vector4) Vector4T<double>;
+}
+
@@ -12,8 +12,8 @@
     // only if gmath is build against  maya
     // ignore the c++ functions and re-implement them in python
     // this bypass the compatibility problem between swig and whatever maya's return in python.
-    %ignore gmath::Xfo::fromMayaMatrix;
-    %ignore gmath::Xfo::toMayaMatrix;
+    %ignore gmath::XfoT<double>::fromMayaMatrix;
+    %ignore gmath::XfoT<double>::toMayaMatrix;
 
     // let's inject some code in these function to handle pymel objects
 
@@ -43,15 +43,15 @@
 #endif
 
 // see below why
-// %ignore gmath::Xfo::tr;
-// %ignore gmath::Xfo::ori;
-// %ignore gmath::Xfo::sc;
+// %ignore gmath::XfoT<double>::tr;
+// %ignore gmath::XfoT<double>::ori;
+// %ignore gmath::XfoT<double>::sc;
 
 %include "gmXfo.h"
 
 // extending Xfo
 namespace gmath{
-    %extend Xfo {
+    %extend XfoT<double> {
         std::string __str__() { // this is convenient in python
             return $self->toString();
         }
@@ -112,4 +112,9 @@ namespace gmath{
 
     #endif
 
-}
\ No newline at end of file
+}
+
+namespace gmath {
+    %template(Xfo) XfoT<double>;
+}
+
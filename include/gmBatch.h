@@ -0,0 +1,130 @@
+#pragma once
+#define GMATH_BATCH_BEGIN
+
+#include "gmRoot.h"
+#include "gmVector3.h"
+#include "gmMatrix3.h"
+#include "gmMatrix4.h"
+#include "gmQuaternion.h"
+#include "gmXfo.h"
+#include "gmUsefulFunctions.h"
+
+namespace gmath
+{
+    /*  Batch functions.
+
+        They process whole arrays of values in one call instead of one object per call.
+        The data is always owned by the caller: nothing is allocated and the output
+        buffers must be big enough to hold the results.
+        Unless stated otherwise an output buffer can be the input buffer. */
+
+    /*------ Points ------*/
+
+    /** Transform count points stored as x, y, z triplets, like Vector3 * Matrix4 for every point.
+        stride is the distance, in doubles, between two consecutive points: 3 for packed xyz buffers,
+        4 for xyzw buffers and so on. The extra components are not touched. */
+    void transformPoints(const Matrix4& mat, const double* in, double* out, size_t count, size_t stride=3);
+
+    /** Transform count points stored in separate x, y, z arrays. */
+    void transformPoints(const Matrix4& mat,
+                         const double* inX, const double* inY, const double* inZ,
+                         double* outX, double* outY, double* outZ, size_t count);
+
+    /** Transform count points by the Xfo, like Xfo::transformVector for every point.
+        The Xfo is converted to a matrix once, so the result can differ from
+        Xfo::transformVector by a few ULP. */
+    void transformPoints(const Xfo& xfo, const double* in, double* out, size_t count, size_t stride=3);
+
+    void transformPoints(const Xfo& xfo,
+                         const double* inX, const double* inY, const double* inZ,
+                         double* outX, double* outY, double* outZ, size_t count);
+
+    /*------ Vectors ------*/
+
+    /** Rotate count vectors by the same quaternion, like Quaternion::rotateVector for every vector.
+        The quaternion is converted to a matrix once, so the result can differ from
+        Quaternion::rotateVector by a few ULP. stride works as in transformPoints. */
+    void rotateVectors(const Quaternion& quat, const double* in, double* out, size_t count, size_t stride=3);
+
+    void rotateVectors(const Quaternion& quat,
+                       const double* inX, const double* inY, const double* inZ,
+                       double* outX, double* outY, double* outZ, size_t count);
+
+    /** Rotate every vector by its own quaternion, out[i] = quats[i].rotateVector(in[i]) with exactly the same result.
+        quats holds count x, y, z, w quadruplets, in and out count packed x, y, z triplets. */
+    void rotateVectors(const double* quats, const double* in, double* out, size_t count);
+
+    /*------ Transforms ------*/
+
+    /** out[i] = locals[i] * parents[i], the global transforms of children from the ones of their parents,
+        with exactly the result of Xfo::compose. It never throws: a local Xfo with non-uniform scaling is
+        composed like Xfo::compose does and its index is reported.
+        failures, when not NULL, receives the indices of those Xfos in increasing order and must have room
+        for count indices. Returns the number of failures, 0 when every Xfo was composed exactly. */
+    size_t composeXfos(const Xfo* parents, const Xfo* locals, Xfo* out, size_t count, size_t* failures=NULL) noexcept;
+
+    /*------ Decomposition ------*/
+
+    /** Decompose count affine matrices into Xfos in one vectorized pass, Xfo::toMatrix4 of the result gives the matrix
+        back when there's no shear (Xfo::fromMatrix4 needs rows of length 1 for the rotation).
+        The rows are orthonormalized from x to z (Gram-Schmidt): the rotation comes from the orthonormal rows,
+        the scale is their length and what is left is a shear, which an Xfo can't hold.
+        shears, when not NULL, receives it as count packed (xy, xz, yz) triplets, see simd::decomposeAffine,
+        they are 0 for the matrix of an Xfo. A matrix with a negative determinant gets a negative scale on
+        the three axes. The fourth column is ignored and a singular matrix gives NaN. */
+    void decomposeMatrices(const Matrix4* matrices, Xfo* out, size_t count, double* shears=NULL);
+
+    /** Remove the drift of count rotation matrices accumulated by repeated products, the rows of out are orthonormal.
+        Any scale is removed too. See OrthonormalizeMethod, POLAR expects matrices close to a rotation and
+        gives a reflection for a negative determinant. */
+    void orthonormalizeMatrices(const Matrix3* in, Matrix3* out, size_t count,
+                                OrthonormalizeMethod method=OrthonormalizeMethod::GRAM_SCHMIDT);
+
+    /** The 3x3 part of the matrices, the translation and the fourth column are kept. */
+    void orthonormalizeMatrices(const Matrix4* in, Matrix4* out, size_t count,
+                                OrthonormalizeMethod method=OrthonormalizeMethod::GRAM_SCHMIDT);
+
+    /*------ Intersections ------*/
+
+    /*  intersectLinePlane for whole arrays, for cutting planes and contacts over dense animation data.
+        The points and the directions are packed x, y, z triplets, so are the normals and the points of the planes
+        when there is one per line. types receives an IntersectionType per line as a byte, IntersectionType(types[i]),
+        and out the point of the lines of type INTERSECTION, the points of the others are left untouched,
+        so out can be an input. They never throw and return the number of INTERSECTION.
+        The simd kernels don't branch on the values, see simd::intersectLinesPlanes. */
+
+    /** The lines through p0[i] and p1[i] against one plane, exactly the results of intersectLinePlane. */
+    size_t intersectLinesPlane(const double* p0, const double* p1, const Vector3& planeNormal, const Vector3& planePoint,
+                               double* out, unsigned char* types, size_t count, bool infiniteLine=true) noexcept;
+
+    /** The line through p0[i] and p1[i] against the plane of planeNormals[i] and planePoints[i]. */
+    size_t intersectLinesPlanes(const double* p0, const double* p1, const double* planeNormals, const double* planePoints,
+                                double* out, unsigned char* types, size_t count, bool infiniteLine=true) noexcept;
+
+    /** The rays origins[i] + directions[i] * t, t >= 0, against one plane: a ray pointing away from the plane is
+        NO_INTERSECTION, the point is origins[i] + directions[i] * t. */
+    size_t intersectRaysPlane(const double* origins, const double* directions, const Vector3& planeNormal, const Vector3& planePoint,
+                              double* out, unsigned char* types, size_t count) noexcept;
+
+    size_t intersectRaysPlanes(const double* origins, const double* directions, const double* planeNormals, const double* planePoints,
+                               double* out, unsigned char* types, size_t count) noexcept;
+
+    /*------ Euler angles ------*/
+
+    /*  Conversions of whole animation curves. The Euler angles are packed x, y, z triplets in radians,
+        the quaternions x, y, z, w quadruplets and the matrices 9 doubles, row major like Matrix3::data().
+        The rotation order is resolved once per call and the sines, cosines and arc tangents come from
+        simd::batchSinCos and simd::batchAtan2, the results can differ from the fromEuler and toEuler
+        methods of Quaternion and Matrix3 by a few ULP. The output can't be the input.
+        In gimbal lock the angle of the last axis of the order is 0. */
+
+    void eulersToQuaternions(const double* eulers, double* quats, size_t count, RotationOrder order=RotationOrder::XYZ);
+    void quaternionsToEulers(const double* quats, double* eulers, size_t count, RotationOrder order=RotationOrder::XYZ);
+    void eulersToMatrices(const double* eulers, double* matrices, size_t count, RotationOrder order=RotationOrder::XYZ);
+    void matricesToEulers(const double* matrices, double* eulers, size_t count, RotationOrder order=RotationOrder::XYZ);
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_BATCH_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,443 @@
+namespace gmath
+{
+    namespace detail
+    {
+        // The affine matrix equivalent to Xfo::transformVector: rotation rows scaled by sc, then tr.
+        GMATH_INLINE Matrix4 xfoToAffine(const Xfo& xfo)
+        {
+            Matrix4 mat(xfo.ori, xfo.tr);
+            double* m = mat.data();
+            for (int i=0; i<3; i++)
+            {
+                m[i]   *= xfo.sc.x;
+                m[4+i] *= xfo.sc.y;
+                m[8+i] *= xfo.sc.z;
+            }
+            return mat;
+        }
+    }
+
+    /*------ Points ------*/
+
+    GMATH_INLINE void transformPoints(const Matrix4& mat, const double* in, double* out, size_t count, size_t stride)
+    {
+        if (stride < 3)
+            throw GMathError("transformPoints: stride must be at least 3");
+
+        simd::transformPoints4x4(mat.data(), in, out, count, stride);
+    }
+
+    GMATH_INLINE void transformPoints(const Matrix4& mat,
+                                      const double* inX, const double* inY, const double* inZ,
+                                      double* outX, double* outY, double* outZ, size_t count)
+    {
+        simd::transformPoints4x4(mat.data(), inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    GMATH_INLINE void transformPoints(const Xfo& xfo, const double* in, double* out, size_t count, size_t stride)
+    {
+        transformPoints(detail::xfoToAffine(xfo), in, out, count, stride);
+    }
+
+    GMATH_INLINE void transformPoints(const Xfo& xfo,
+                                      const double* inX, const double* inY, const double* inZ,
+                                      double* outX, double* outY, double* outZ, size_t count)
+    {
+        transformPoints(detail::xfoToAffine(xfo), inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    /*------ Vectors ------*/
+
+    GMATH_INLINE void rotateVectors(const Quaternion& quat, const double* in, double* out, size_t count, size_t stride)
+    {
+        transformPoints(quat.toMatrix4(), in, out, count, stride);
+    }
+
+    GMATH_INLINE void rotateVectors(const Quaternion& quat,
+                                    const double* inX, const double* inY, const double* inZ,
+                                    double* outX, double* outY, double* outZ, size_t count)
+    {
+        transformPoints(quat.toMatrix4(), inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    GMATH_INLINE void rotateVectors(const double* quats, const double* in, double* out, size_t count)
+    {
+        // Copy blocks small enough for the stack to component arrays for the SIMD kernel,
+        // a whole block is read before it is written, so out can be in.
+        const size_t BLOCK = 256;
+        double qx[BLOCK], qy[BLOCK], qz[BLOCK], qw[BLOCK];
+        double vx[BLOCK], vy[BLOCK], vz[BLOCK];
+        simd::QuaternionSoa q = { qx, qy, qz, qw };
+        simd::Vector3Soa v = { vx, vy, vz };
+
+        for (size_t begin=0; begin<count; begin+=BLOCK)
+        {
+            size_t n = count-begin < BLOCK ? count-begin : BLOCK;
+            const double* blockQuats = quats + begin*4;
+            const double* blockIn = in + begin*3;
+            double* blockOut = out + begin*3;
+
+            for (size_t i=0; i<n; i++)
+            {
+                qx[i] = blockQuats[i*4];
+                qy[i] = blockQuats[i*4+1];
+                qz[i] = blockQuats[i*4+2];
+                qw[i] = blockQuats[i*4+3];
+                vx[i] = blockIn[i*3];
+                vy[i] = blockIn[i*3+1];
+                vz[i] = blockIn[i*3+2];
+            }
+
+            simd::rotateVectors(q, v, v, n);
+
+            for (size_t i=0; i<n; i++)
+            {
+                blockOut[i*3] = vx[i];
+                blockOut[i*3+1] = vy[i];
+                blockOut[i*3+2] = vz[i];
+            }
+        }
+    }
+
+    /*------ Transforms ------*/
+
+    GMATH_INLINE size_t composeXfos(const Xfo* parents, const Xfo* locals, Xfo* out, size_t count, size_t* failures) noexcept
+    {
+        // Component arrays of a block for the SIMD kernels, a whole block is read before it is written,
+        // so out can be parents or locals.
+        const size_t BLOCK = 128;
+        double lx[BLOCK], ly[BLOCK], lz[BLOCK], lw[BLOCK];
+        double px[BLOCK], py[BLOCK], pz[BLOCK], pw[BLOCK];
+        double tx[BLOCK], ty[BLOCK], tz[BLOCK];
+        simd::QuaternionSoa localOri = { lx, ly, lz, lw };
+        simd::QuaternionSoa parentOri = { px, py, pz, pw };
+        simd::Vector3Soa tr = { tx, ty, tz };
+
+        size_t failureCount = 0;
+        for (size_t begin=0; begin<count; begin+=BLOCK)
+        {
+            size_t n = count-begin < BLOCK ? count-begin : BLOCK;
+            const Xfo* blockParents = parents + begin;
+            const Xfo* blockLocals = locals + begin;
+            Xfo* blockOut = out + begin;
+
+            for (size_t i=0; i<n; i++)
+            {
+                const Xfo& local = blockLocals[i];
+                const Xfo& parent = blockParents[i];
+                if (!local.hasUniformScale())
+                {
+                    if (failures)
+                        failures[failureCount] = begin+i;
+                    failureCount++;
+                }
+
+                lx[i] = local.ori.x;
+                ly[i] = local.ori.y;
+                lz[i] = local.ori.z;
+                lw[i] = local.ori.w;
+                px[i] = parent.ori.x;
+                py[i] = parent.ori.y;
+                pz[i] = parent.ori.z;
+                pw[i] = parent.ori.w;
+                tx[i] = local.tr.x * parent.sc.x;
+                ty[i] = local.tr.y * parent.sc.y;
+                tz[i] = local.tr.z * parent.sc.z;
+            }
+
+            // tr = parent.tr + parent.ori.rotateVector(local.tr * parent.sc)
+            simd::rotateVectors(parentOri, tr, tr, n);
+            // ori = (local.ori * parent.ori).normalize()
+            simd::multiplyQuaternions(localOri, parentOri, localOri, n);
+            simd::normalizeQuaternions(localOri, n);
+
+            for (size_t i=0; i<n; i++)
+            {
+                // the scales and the parent translation are read before the Xfo is written
+                Vector3 sc = blockLocals[i].sc * blockParents[i].sc;
+                Vector3 parentTr = blockParents[i].tr;
+
+                Xfo& result = blockOut[i];
+                result.tr.set(parentTr.x + tx[i], parentTr.y + ty[i], parentTr.z + tz[i]);
+                result.ori.set(lx[i], ly[i], lz[i], lw[i]);
+                result.sc = sc;
+            }
+        }
+        return failureCount;
+    }
+
+    /*------ Decomposition ------*/
+
+    namespace detail
+    {
+        // The rows of a block of 3x3 matrices, the stride is 3 for Matrix3 and 4 for Matrix4.
+        struct RowsBlock
+        {
+            static const size_t SIZE = 128;
+            double values[9][SIZE];
+            simd::Matrix3Soa rows;
+
+            RowsBlock()
+            {
+                simd::Matrix3Soa soa = { { values[0], values[1], values[2] },
+                                         { values[3], values[4], values[5] },
+                                         { values[6], values[7], values[8] } };
+                rows = soa;
+            }
+
+            void load(const double* m, size_t stride, size_t i)
+            {
+                for (size_t r=0; r<3; r++)
+                    for (size_t c=0; c<3; c++)
+                        values[r*3+c][i] = m[r*stride+c];
+            }
+
+            void store(double* m, size_t stride, size_t i) const
+            {
+                for (size_t r=0; r<3; r++)
+                    for (size_t c=0; c<3; c++)
+                        m[r*stride+c] = values[r*3+c][i];
+            }
+        };
+
+        GMATH_INLINE void orthonormalizeRows(const simd::Matrix3Soa& rows, size_t count, OrthonormalizeMethod method)
+        {
+            if (method == OrthonormalizeMethod::POLAR)
+                simd::orthonormalizePolar(rows, count);
+            else
+                simd::orthonormalizeGramSchmidt(rows, count);
+        }
+    }
+
+    GMATH_INLINE void decomposeMatrices(const Matrix4* matrices, Xfo* out, size_t count, double* shears)
+    {
+        const size_t BLOCK = detail::RowsBlock::SIZE;
+        detail::RowsBlock block;
+        double qx[BLOCK], qy[BLOCK], qz[BLOCK], qw[BLOCK];
+        double sx[BLOCK], sy[BLOCK], sz[BLOCK];
+        double hx[BLOCK], hy[BLOCK], hz[BLOCK];
+        simd::QuaternionSoa ori = { qx, qy, qz, qw };
+        simd::Vector3Soa sc = { sx, sy, sz };
+        simd::Vector3Soa shear = { hx, hy, hz };
+
+        for (size_t begin=0; begin<count; begin+=BLOCK)
+        {
+            size_t n = count-begin < BLOCK ? count-begin : BLOCK;
+            for (size_t i=0; i<n; i++)
+                block.load(matrices[begin+i].data(), 4, i);
+
+            simd::decomposeAffine(block.rows, ori, sc, shear, n);
+
+            for (size_t i=0; i<n; i++)
+            {
+                const double* m = matrices[begin+i].data();
+                Xfo& result = out[begin+i];
+                result.ori.set(qx[i], qy[i], qz[i], qw[i]);
+                result.tr.set(m[12], m[13], m[14]);
+                result.sc.set(sx[i], sy[i], sz[i]);
+            }
+            if (shears)
+            {
+                double* blockShears = shears + begin*3;
+                for (size_t i=0; i<n; i++)
+                {
+                    blockShears[i*3] = hx[i];
+                    blockShears[i*3+1] = hy[i];
+                    blockShears[i*3+2] = hz[i];
+                }
+            }
+        }
+    }
+
+    GMATH_INLINE void orthonormalizeMatrices(const Matrix3* in, Matrix3* out, size_t count, OrthonormalizeMethod method)
+    {
+        const size_t BLOCK = detail::RowsBlock::SIZE;
+        detail::RowsBlock block;
+        for (size_t begin=0; begin<count; begin+=BLOCK)
+        {
+            size_t n = count-begin < BLOCK ? count-begin : BLOCK;
+            for (size_t i=0; i<n; i++)
+                block.load(in[begin+i].data(), 3, i);
+            detail::orthonormalizeRows(block.rows, n, method);
+            for (size_t i=0; i<n; i++)
+                block.store(out[begin+i].data(), 3, i);
+        }
+    }
+
+    GMATH_INLINE void orthonormalizeMatrices(const Matrix4* in, Matrix4* out, size_t count, OrthonormalizeMethod method)
+    {
+        const size_t BLOCK = detail::RowsBlock::SIZE;
+        detail::RowsBlock block;
+        for (size_t begin=0; begin<count; begin+=BLOCK)
+        {
+            size_t n = count-begin < BLOCK ? count-begin : BLOCK;
+            for (size_t i=0; i<n; i++)
+                block.load(in[begin+i].data(), 4, i);
+            detail::orthonormalizeRows(block.rows, n, method);
+            for (size_t i=0; i<n; i++)
+            {
+                if (out != in)
+                    out[begin+i] = in[begin+i];
+                block.store(out[begin+i].data(), 4, i);
+            }
+        }
+    }
+
+    /*------ Intersections ------*/
+
+    GMATH_INLINE size_t intersectLinesPlane(const double* p0, const double* p1, const Vector3& planeNormal, const Vector3& planePoint,
+                                            double* out, unsigned char* types, size_t count, bool infiniteLine) noexcept
+    {
+        return simd::intersectLinesPlanes(p0, p1, planeNormal.data(), planePoint.data(), 0, out, types, count, infiniteLine);
+    }
+
+    GMATH_INLINE size_t intersectLinesPlanes(const double* p0, const double* p1, const double* planeNormals, const double* planePoints,
+                                             double* out, unsigned char* types, size_t count, bool infiniteLine) noexcept
+    {
+        return simd::intersectLinesPlanes(p0, p1, planeNormals, planePoints, 3, out, types, count, infiniteLine);
+    }
+
+    GMATH_INLINE size_t intersectRaysPlane(const double* origins, const double* directions, const Vector3& planeNormal, const Vector3& planePoint,
+                                           double* out, unsigned char* types, size_t count) noexcept
+    {
+        return simd::intersectRaysPlanes(origins, directions, planeNormal.data(), planePoint.data(), 0, out, types, count);
+    }
+
+    GMATH_INLINE size_t intersectRaysPlanes(const double* origins, const double* directions, const double* planeNormals, const double* planePoints,
+                                            double* out, unsigned char* types, size_t count) noexcept
+    {
+        return simd::intersectRaysPlanes(origins, directions, planeNormals, planePoints, 3, out, types, count);
+    }
+
+    /*------ Euler angles ------*/
+
+    namespace detail
+    {
+        // The sines, cosines and arc tangents of a block of EULER_BLOCK rotations are computed
+        // together by the simd math functions, the buffers fit on the stack.
+        const size_t EULER_BLOCK = 256;
+
+        template <RotationOrder ORDER>
+        struct EulersToQuaternions
+        {
+            static void run(const double* eulers, double* quats, size_t count)
+            {
+                double halves[EULER_BLOCK*3], sines[EULER_BLOCK*3], cosines[EULER_BLOCK*3];
+                for (size_t begin=0; begin<count; begin+=EULER_BLOCK)
+                {
+                    size_t n = count-begin < EULER_BLOCK ? count-begin : EULER_BLOCK;
+                    for (size_t i=0; i<n*3; i++)
+                        halves[i] = eulers[begin*3+i] * 0.5;
+                    simd::batchSinCos(halves, sines, cosines, n*3);
+
+                    for (size_t i=0; i<n; i++)
+                        quaternionFromSinCos<ORDER>(cosines + i*3, sines + i*3, quats + (begin+i)*4);
+                }
+            }
+        };
+
+        template <RotationOrder ORDER>
+        struct EulersToMatrices
+        {
+            static void run(const double* eulers, double* matrices, size_t count)
+            {
+                double sines[EULER_BLOCK*3], cosines[EULER_BLOCK*3];
+                for (size_t begin=0; begin<count; begin+=EULER_BLOCK)
+                {
+                    size_t n = count-begin < EULER_BLOCK ? count-begin : EULER_BLOCK;
+                    simd::batchSinCos(eulers + begin*3, sines, cosines, n*3);
+
+                    for (size_t i=0; i<n; i++)
+                        matrix3FromSinCos<ORDER>(cosines + i*3, sines + i*3, matrices + (begin+i)*9);
+                }
+            }
+        };
+
+        // ROTATION is QuaternionRotation<double> or MatrixRotation<double, 3>, SIZE the doubles of a rotation.
+        template <RotationOrder ORDER, typename ROTATION, size_t SIZE>
+        GMATH_INLINE void rotationsToEulers(const double* rotations, double* eulers, size_t count)
+        {
+            const double parity = double(EulerAxes<ORDER>::PARITY);
+
+            double y[EULER_BLOCK*3], x[EULER_BLOCK*3];
+            for (size_t begin=0; begin<count; begin+=EULER_BLOCK)
+            {
+                size_t n = count-begin < EULER_BLOCK ? count-begin : EULER_BLOCK;
+                for (size_t i=0; i<n; i++)
+                {
+                    ROTATION rotation = { rotations + (begin+i)*SIZE };
+                    eulerAtan2Arguments<ORDER>(rotation, y + i*3, x + i*3);
+                }
+
+                double* angles = eulers + begin*3;
+                simd::batchAtan2(y, x, angles, n*3);
+                for (size_t i=0; i<n*3; i++)
+                    angles[i] *= parity;
+            }
+        }
+
+        template <RotationOrder ORDER>
+        struct QuaternionsToEulers
+        {
+            static void run(const double* quats, double* eulers, size_t count)
+            {
+                rotationsToEulers<ORDER, QuaternionRotation<double>, 4>(quats, eulers, count);
+            }
+        };
+
+        template <RotationOrder ORDER>
+        struct MatricesToEulers
+        {
+            static void run(const double* matrices, double* eulers, size_t count)
+            {
+                rotationsToEulers<ORDER, MatrixRotation<double, 3>, 9>(matrices, eulers, count);
+            }
+        };
+
+        // Call KERNEL<order>::run, with the order as a template argument.
+        template <template <RotationOrder> class KERNEL>
+        GMATH_INLINE void runForOrder(RotationOrder order, const double* in, double* out, size_t count)
+        {
+            switch (order)
+            {
+            case RotationOrder::XZY :
+                KERNEL<RotationOrder::XZY>::run(in, out, count);
+                break;
+            case RotationOrder::YXZ :
+                KERNEL<RotationOrder::YXZ>::run(in, out, count);
+                break;
+            case RotationOrder::YZX :
+                KERNEL<RotationOrder::YZX>::run(in, out, count);
+                break;
+            case RotationOrder::ZXY :
+                KERNEL<RotationOrder::ZXY>::run(in, out, count);
+                break;
+            case RotationOrder::ZYX :
+                KERNEL<RotationOrder::ZYX>::run(in, out, count);
+                break;
+            default:
+                KERNEL<RotationOrder::XYZ>::run(in, out, count);
+            }
+        }
+    }
+
+    GMATH_INLINE void eulersToQuaternions(const double* eulers, double* quats, size_t count, RotationOrder order)
+    {
+        detail::runForOrder<detail::EulersToQuaternions>(order, eulers, quats, count);
+    }
+
+    GMATH_INLINE void quaternionsToEulers(const double* quats, double* eulers, size_t count, RotationOrder order)
+    {
+        detail::runForOrder<detail::QuaternionsToEulers>(order, quats, eulers, count);
+    }
+
+    GMATH_INLINE void eulersToMatrices(const double* eulers, double* matrices, size_t count, RotationOrder order)
+    {
+        detail::runForOrder<detail::EulersToMatrices>(order, eulers, matrices, count);
+    }
+
+    GMATH_INLINE void matricesToEulers(const double* matrices, double* eulers, size_t count, RotationOrder order)
+    {
+        detail::runForOrder<detail::MatricesToEulers>(order, matrices, eulers, count);
+    }
+}
@@ -0,0 +1,156 @@
+#pragma once
+#define GMATH_BOUNDS_BEGIN
+
+#include <string>
+#include <vector>
+#include "gmRoot.h"
+#include "gmParallel.h"
+#include "gmVector3.h"
+#include "gmMatrix3.h"
+#include "gmMatrix4.h"
+#include "gmXfo.h"
+
+namespace gmath
+{
+    /**
+    Axis aligned bounding box, the points p with min <= p <= max.
+
+    The default box is empty: min is +INFINITY and max -INFINITY, so merging a point or a box into
+    it gives that point or that box. fromPoints bounds large point arrays in one pass, transformed
+    on the way or not, on the simd kernels and the gmath::parallel threads.
+    */
+    class AABB
+    {
+    public:
+        /*------ properties ------*/
+        Vector3 min;
+        Vector3 max;
+
+        /** Points per chunk of work given to a thread by fromPoints. */
+        static const size_t PARALLEL_GRAIN = 65536;
+
+        /*------ constructors ------*/
+        AABB();
+        AABB(const Vector3& min, const Vector3& max);
+
+        /*------ comparisons ------*/
+        /** Within gmath::EPSILON like Vector3, all the empty boxes are equal. */
+        bool operator == (const AABB& other) const;
+        bool operator != (const AABB& other) const;
+
+        /*------ methods ------*/
+        void setEmpty();
+        /** True when min is above max on an axis, a box of a single point is not empty. */
+        bool isEmpty() const;
+
+        Vector3 getCenter() const;
+        Vector3 getSize() const;
+        Vector3 getHalfSize() const;
+        double getVolume() const;
+        double getSurfaceArea() const;
+        /** The 8 corners, corner i takes max on the axes of the bits of i (1 for x, 2 for y, 4 for z). */
+        void getCorners(Vector3* corners) const;
+
+        /** The point is in the box or on its faces. */
+        bool contains(const Vector3& point) const;
+        bool contains(const AABB& other) const;
+        /** The boxes share at least a point, touching faces count. */
+        bool overlaps(const AABB& other) const;
+
+        AABB merge(const Vector3& point) const;
+        AABB& mergeInPlace(const Vector3& point);
+        AABB merge(const AABB& other) const;
+        AABB& mergeInPlace(const AABB& other);
+
+        /** The box bounding this box transformed by mat (Arvo's method, from the 3x3 part and the translation),
+            the smallest one for an affine matrix. The points of the box are not needed. */
+        AABB transform(const Matrix4& mat) const;
+        AABB& transformInPlace(const Matrix4& mat);
+        /** As above with Xfo::toMatrix4. */
+        AABB transform(const Xfo& xfo) const;
+        AABB& transformInPlace(const Xfo& xfo);
+
+        /** The box of count points, x, y, z triplets stride doubles apart. NaN coordinates are ignored,
+            no point gives an empty box. */
+        static AABB fromPoints(const double* points, size_t count, size_t stride=3);
+        static AABB fromPoints(const std::vector<Vector3>& points);
+
+        /** The box of the points transformed by mat like Vector3 * Matrix4, without writing them. */
+        static AABB fromPoints(const Matrix4& mat, const double* points, size_t count, size_t stride=3);
+        static AABB fromPoints(const Matrix4& mat, const std::vector<Vector3>& points);
+
+        /** As above with Xfo::toMatrix4, the points can differ from Xfo::transformVector by a few ULP. */
+        static AABB fromPoints(const Xfo& xfo, const double* points, size_t count, size_t stride=3);
+        static AABB fromPoints(const Xfo& xfo, const std::vector<Vector3>& points);
+
+        std::string toString() const;
+    };
+
+    /**
+    Oriented bounding box, the points center + x * axes.getAxisX() + y * axes.getAxisY() + z * axes.getAxisZ()
+    with |x| <= halfSize.x, |y| <= halfSize.y and |z| <= halfSize.z.
+
+    axes is a rotation matrix, its rows are the axes of the box. The default box is empty: its half size is -1.
+    fromPoints fits a box to points along their principal axes, the eigenvectors of their covariance matrix.
+    */
+    class OBB
+    {
+    public:
+        /*------ properties ------*/
+        Vector3 center;
+        Matrix3 axes;
+        Vector3 halfSize;
+
+        /** Points per chunk of work given to a thread by fromPoints. */
+        static const size_t PARALLEL_GRAIN = 65536;
+
+        /*------ constructors ------*/
+        OBB();
+        OBB(const Vector3& center, const Matrix3& axes, const Vector3& halfSize);
+        explicit OBB(const AABB& box);
+
+        /*------ comparisons ------*/
+        bool operator == (const OBB& other) const;
+        bool operator != (const OBB& other) const;
+
+        /*------ methods ------*/
+        void setEmpty();
+        /** True when a half size is negative. */
+        bool isEmpty() const;
+
+        double getVolume() const;
+        double getSurfaceArea() const;
+        /** The 8 corners, corner i is on the positive side of the axes of the bits of i (1 for x, 2 for y, 4 for z). */
+        void getCorners(Vector3* corners) const;
+        /** The smallest axis aligned box around this box. */
+        AABB getBounds() const;
+
+        bool contains(const Vector3& point) const;
+        /** The boxes share at least a point, by the separating axis test of Gottschalk et al. over 15 axes. */
+        bool overlaps(const OBB& other) const;
+        bool overlaps(const AABB& other) const;
+
+        /** The box around this box transformed by mat. The axes are the transformed axes made orthonormal
+            from x to z, the same box for a rotation, a translation and a uniform scale, a bigger one with shear
+            or with a non uniform scale that isn't along the axes. Throws GMathError if mat is singular. */
+        OBB transform(const Matrix4& mat) const;
+        OBB& transformInPlace(const Matrix4& mat);
+        OBB transform(const Xfo& xfo) const;
+        OBB& transformInPlace(const Xfo& xfo);
+
+        /** The box of count points along their principal axes, the axes by decreasing spread: the first
+            axis is the direction in which the points spread the most. Two passes over the points, both
+            parallel: the covariance matrix, then the bounds in the frame of its eigenvectors.
+            The points are x, y, z triplets stride doubles apart, a point with a NaN or infinite coordinate
+            is skipped, no finite point gives an empty box. */
+        static OBB fromPoints(const double* points, size_t count, size_t stride=3);
+        static OBB fromPoints(const std::vector<Vector3>& points);
+
+        std::string toString() const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_BOUNDS_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,527 @@
+namespace gmath
+{
+    namespace detail
+    {
+        // added to the absolute cosines of the separating axis test, so two nearly parallel edges
+        // don't make a cross product axis out of rounding errors
+        const double OBB_PARALLEL_EPSILON = 1.0e-12;
+
+        // the test of simd::momentsPoints, x - x is NaN for an infinite or NaN x
+        GMATH_INLINE bool isFinitePoint(const double* p)
+        {
+            return p[0] - p[0] == 0.0 && p[1] - p[1] == 0.0 && p[2] - p[2] == 0.0;
+        }
+
+        // The bounds of fixed blocks of points, merged in order.
+        GMATH_INLINE AABB boundPoints(const double* m, const double* points, size_t count, size_t stride)
+        {
+            AABB box;
+            const size_t grain = AABB::PARALLEL_GRAIN;
+            size_t blockCount = (count + grain - 1) / grain;
+            if (blockCount <= 1)
+            {
+                simd::boundPoints(m, points, count, stride, box.min.data(), box.max.data());
+                return box;
+            }
+
+            std::vector<AABB> blocks(blockCount);
+            parallel::parallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+                for (size_t b=begin; b<end; b++)
+                {
+                    size_t first = b*grain;
+                    size_t n = count-first < grain ? count-first : grain;
+                    simd::boundPoints(m, points + first*stride, n, stride, blocks[b].min.data(), blocks[b].max.data());
+                }
+            });
+            for (size_t b=0; b<blockCount; b++)
+                box.mergeInPlace(blocks[b]);
+            return box;
+        }
+    }
+
+    /*------ AABB ------*/
+
+    /*------ constructors ------*/
+
+    GMATH_INLINE AABB::AABB()
+    {
+        setEmpty();
+    }
+
+    GMATH_INLINE AABB::AABB(const Vector3& min, const Vector3& max)
+        : min(min), max(max)
+    {
+    }
+
+    /*------ comparisons ------*/
+
+    GMATH_INLINE bool AABB::operator == (const AABB& other) const
+    {
+        return (isEmpty() && other.isEmpty()) || (min == other.min && max == other.max);
+    }
+
+    GMATH_INLINE bool AABB::operator != (const AABB& other) const
+    {
+        return !(*this == other);
+    }
+
+    /*------ methods ------*/
+
+    GMATH_INLINE void AABB::setEmpty()
+    {
+        min = Vector3(INFINITY, INFINITY, INFINITY);
+        max = Vector3(-INFINITY, -INFINITY, -INFINITY);
+    }
+
+    GMATH_INLINE bool AABB::isEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    GMATH_INLINE Vector3 AABB::getCenter() const
+    {
+        return (min + max) * 0.5;
+    }
+
+    GMATH_INLINE Vector3 AABB::getSize() const
+    {
+        return isEmpty() ? Vector3(0.0, 0.0, 0.0) : max - min;
+    }
+
+    GMATH_INLINE Vector3 AABB::getHalfSize() const
+    {
+        return getSize() * 0.5;
+    }
+
+    GMATH_INLINE double AABB::getVolume() const
+    {
+        Vector3 size = getSize();
+        return size.x * size.y * size.z;
+    }
+
+    GMATH_INLINE double AABB::getSurfaceArea() const
+    {
+        Vector3 size = getSize();
+        return 2.0 * (size.x*size.y + size.y*size.z + size.z*size.x);
+    }
+
+    GMATH_INLINE void AABB::getCorners(Vector3* corners) const
+    {
+        for (int i=0; i<8; i++)
+            corners[i] = Vector3(i & 1 ? max.x : min.x, i & 2 ? max.y : min.y, i & 4 ? max.z : min.z);
+    }
+
+    GMATH_INLINE bool AABB::contains(const Vector3& point) const
+    {
+        return point.x >= min.x && point.x <= max.x &&
+               point.y >= min.y && point.y <= max.y &&
+               point.z >= min.z && point.z <= max.z;
+    }
+
+    GMATH_INLINE bool AABB::contains(const AABB& other) const
+    {
+        return other.isEmpty() || (contains(other.min) && contains(other.max));
+    }
+
+    GMATH_INLINE bool AABB::overlaps(const AABB& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x &&
+               min.y <= other.max.y && max.y >= other.min.y &&
+               min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    GMATH_INLINE AABB AABB::merge(const Vector3& point) const
+    {
+        AABB result(*this);
+        return result.mergeInPlace(point);
+    }
+
+    GMATH_INLINE AABB& AABB::mergeInPlace(const Vector3& point)
+    {
+        for (int c=0; c<3; c++)
+        {
+            min[c] = point[c] < min[c] ? point[c] : min[c];
+            max[c] = point[c] > max[c] ? point[c] : max[c];
+        }
+        return *this;
+    }
+
+    GMATH_INLINE AABB AABB::merge(const AABB& other) const
+    {
+        AABB result(*this);
+        return result.mergeInPlace(other);
+    }
+
+    GMATH_INLINE AABB& AABB::mergeInPlace(const AABB& other)
+    {
+        for (int c=0; c<3; c++)
+        {
+            min[c] = other.min[c] < min[c] ? other.min[c] : min[c];
+            max[c] = other.max[c] > max[c] ? other.max[c] : max[c];
+        }
+        return *this;
+    }
+
+    GMATH_INLINE AABB AABB::transform(const Matrix4& mat) const
+    {
+        AABB result(*this);
+        return result.transformInPlace(mat);
+    }
+
+    GMATH_INLINE AABB& AABB::transformInPlace(const Matrix4& mat)
+    {
+        if (isEmpty())
+            return *this;
+
+        // Arvo, Transforming Axis-Aligned Bounding Boxes, Graphics Gems 1990:
+        // each element of the matrix moves the bounds by the smallest and the largest of its products
+        const double* m = mat.data();
+        Vector3 low, high;
+        for (int c=0; c<3; c++)
+        {
+            low[c] = high[c] = m[12+c];
+            for (int r=0; r<3; r++)
+            {
+                double a = m[r*4+c] * min[r], b = m[r*4+c] * max[r];
+                low[c] += a < b ? a : b;
+                high[c] += a < b ? b : a;
+            }
+        }
+        min = low;
+        max = high;
+        return *this;
+    }
+
+    GMATH_INLINE AABB AABB::transform(const Xfo& xfo) const
+    {
+        return transform(xfo.toMatrix4());
+    }
+
+    GMATH_INLINE AABB& AABB::transformInPlace(const Xfo& xfo)
+    {
+        return transformInPlace(xfo.toMatrix4());
+    }
+
+    GMATH_INLINE AABB AABB::fromPoints(const double* points, size_t count, size_t stride)
+    {
+        return detail::boundPoints(NULL, points, count, stride);
+    }
+
+    GMATH_INLINE AABB AABB::fromPoints(const std::vector<Vector3>& points)
+    {
+        return detail::boundPoints(NULL, points.empty() ? NULL : points[0].data(), points.size(), 3);
+    }
+
+    GMATH_INLINE AABB AABB::fromPoints(const Matrix4& mat, const double* points, size_t count, size_t stride)
+    {
+        return detail::boundPoints(mat.data(), points, count, stride);
+    }
+
+    GMATH_INLINE AABB AABB::fromPoints(const Matrix4& mat, const std::vector<Vector3>& points)
+    {
+        return detail::boundPoints(mat.data(), points.empty() ? NULL : points[0].data(), points.size(), 3);
+    }
+
+    GMATH_INLINE AABB AABB::fromPoints(const Xfo& xfo, const double* points, size_t count, size_t stride)
+    {
+        return fromPoints(xfo.toMatrix4(), points, count, stride);
+    }
+
+    GMATH_INLINE AABB AABB::fromPoints(const Xfo& xfo, const std::vector<Vector3>& points)
+    {
+        return fromPoints(xfo.toMatrix4(), points);
+    }
+
+    GMATH_INLINE std::string AABB::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::AABB(min:" << min.x << ", " << min.y << ", " << min.z << std::endl;
+        oss << "            max:" << max.x << ", " << max.y << ", " << max.z << ");";
+
+        return oss.str();
+    }
+
+    /*------ OBB ------*/
+
+    /*------ constructors ------*/
+
+    GMATH_INLINE OBB::OBB()
+    {
+        setEmpty();
+    }
+
+    GMATH_INLINE OBB::OBB(const Vector3& center, const Matrix3& axes, const Vector3& halfSize)
+        : center(center), axes(axes), halfSize(halfSize)
+    {
+    }
+
+    GMATH_INLINE OBB::OBB(const AABB& box)
+    {
+        if (box.isEmpty())
+            setEmpty();
+        else
+        {
+            center = box.getCenter();
+            axes.setToIdentity();
+            halfSize = box.getHalfSize();
+        }
+    }
+
+    /*------ comparisons ------*/
+
+    GMATH_INLINE bool OBB::operator == (const OBB& other) const
+    {
+        return center == other.center && axes == other.axes && halfSize == other.halfSize;
+    }
+
+    GMATH_INLINE bool OBB::operator != (const OBB& other) const
+    {
+        return !(*this == other);
+    }
+
+    /*------ methods ------*/
+
+    GMATH_INLINE void OBB::setEmpty()
+    {
+        center = Vector3(0.0, 0.0, 0.0);
+        axes.setToIdentity();
+        halfSize = Vector3(-1.0, -1.0, -1.0);
+    }
+
+    GMATH_INLINE bool OBB::isEmpty() const
+    {
+        return halfSize.x < 0.0 || halfSize.y < 0.0 || halfSize.z < 0.0;
+    }
+
+    GMATH_INLINE double OBB::getVolume() const
+    {
+        return isEmpty() ? 0.0 : 8.0 * halfSize.x * halfSize.y * halfSize.z;
+    }
+
+    GMATH_INLINE double OBB::getSurfaceArea() const
+    {
+        return isEmpty() ? 0.0 : 8.0 * (halfSize.x*halfSize.y + halfSize.y*halfSize.z + halfSize.z*halfSize.x);
+    }
+
+    GMATH_INLINE void OBB::getCorners(Vector3* corners) const
+    {
+        Vector3 x = axes.getAxisX() * halfSize.x, y = axes.getAxisY() * halfSize.y, z = axes.getAxisZ() * halfSize.z;
+        for (int i=0; i<8; i++)
+            corners[i] = center + (i & 1 ? x : -x) + (i & 2 ? y : -y) + (i & 4 ? z : -z);
+    }
+
+    GMATH_INLINE AABB OBB::getBounds() const
+    {
+        if (isEmpty())
+            return AABB();
+
+        Vector3 extent;
+        for (int c=0; c<3; c++)
+            extent[c] = fabs(axes(0, c)) * halfSize.x + fabs(axes(1, c)) * halfSize.y + fabs(axes(2, c)) * halfSize.z;
+        return AABB(center - extent, center + extent);
+    }
+
+    GMATH_INLINE bool OBB::contains(const Vector3& point) const
+    {
+        Vector3 d = point - center;
+        return fabs(d.dot(axes.getAxisX())) <= halfSize.x &&
+               fabs(d.dot(axes.getAxisY())) <= halfSize.y &&
+               fabs(d.dot(axes.getAxisZ())) <= halfSize.z;
+    }
+
+    GMATH_INLINE bool OBB::overlaps(const OBB& other) const
+    {
+        if (isEmpty() || other.isEmpty())
+            return false;
+
+        // Gottschalk, Lin, Manocha, OBBTree: A Hierarchical Structure for Rapid Interference Detection, 1996,
+        // as written by Ericson, Real-Time Collision Detection, 4.4.1: the other box in the frame of this one
+        const double a[3] = { halfSize.x, halfSize.y, halfSize.z };
+        const double b[3] = { other.halfSize.x, other.halfSize.y, other.halfSize.z };
+        double r[3][3], absR[3][3], t[3];
+        Vector3 d = other.center - center;
+        for (int i=0; i<3; i++)
+        {
+            Vector3 axis = axes.getRow(i);
+            for (int j=0; j<3; j++)
+            {
+                r[i][j] = axis.dot(other.axes.getRow(j));
+                absR[i][j] = fabs(r[i][j]) + detail::OBB_PARALLEL_EPSILON;
+            }
+            t[i] = d.dot(axis);
+        }
+
+        // the axes of this box, then the ones of the other
+        for (int i=0; i<3; i++)
+        {
+            if (fabs(t[i]) > a[i] + (b[0]*absR[i][0] + b[1]*absR[i][1] + b[2]*absR[i][2]))
+                return false;
+        }
+        for (int j=0; j<3; j++)
+        {
+            double distance = fabs(t[0]*r[0][j] + t[1]*r[1][j] + t[2]*r[2][j]);
+            if (distance > (a[0]*absR[0][j] + a[1]*absR[1][j] + a[2]*absR[2][j]) + b[j])
+                return false;
+        }
+
+        // the cross products of an axis of each
+        for (int i=0; i<3; i++)
+        {
+            int i1 = (i+1) % 3, i2 = (i+2) % 3;
+            for (int j=0; j<3; j++)
+            {
+                int j1 = (j+1) % 3, j2 = (j+2) % 3;
+                double ra = a[i1]*absR[i2][j] + a[i2]*absR[i1][j];
+                double rb = b[j1]*absR[i][j2] + b[j2]*absR[i][j1];
+                if (fabs(t[i2]*r[i1][j] - t[i1]*r[i2][j]) > ra + rb)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    GMATH_INLINE bool OBB::overlaps(const AABB& other) const
+    {
+        return overlaps(OBB(other));
+    }
+
+    GMATH_INLINE OBB OBB::transform(const Matrix4& mat) const
+    {
+        OBB result(*this);
+        return result.transformInPlace(mat);
+    }
+
+    GMATH_INLINE OBB& OBB::transformInPlace(const Matrix4& mat)
+    {
+        const double* m = mat.data();
+        Matrix3 linear(m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9], m[10]);
+        Matrix3 transformed = axes * linear;
+        double determinant = transformed.determinant();
+        if (!(determinant != 0.0))
+            throw GMathError("OBB.transform: the matrix is singular");
+        if (isEmpty())
+            return *this;
+
+        Matrix3 newAxes = transformed.orthogonal();
+        if (determinant < 0.0)
+            newAxes.setAxisZ(-newAxes.getAxisZ());
+
+        // the half size along a new axis is the sum of the projections of the transformed half edges
+        Vector3 edges[3] = { transformed.getAxisX() * halfSize.x, transformed.getAxisY() * halfSize.y,
+                             transformed.getAxisZ() * halfSize.z };
+        for (int j=0; j<3; j++)
+        {
+            Vector3 axis = newAxes.getRow(j);
+            halfSize[j] = fabs(edges[0].dot(axis)) + fabs(edges[1].dot(axis)) + fabs(edges[2].dot(axis));
+        }
+        center = center * mat;
+        axes = newAxes;
+        return *this;
+    }
+
+    GMATH_INLINE OBB OBB::transform(const Xfo& xfo) const
+    {
+        return transform(xfo.toMatrix4());
+    }
+
+    GMATH_INLINE OBB& OBB::transformInPlace(const Xfo& xfo)
+    {
+        return transformInPlace(xfo.toMatrix4());
+    }
+
+    GMATH_INLINE OBB OBB::fromPoints(const double* points, size_t count, size_t stride)
+    {
+        // the moments of fixed blocks, added in order so the box doesn't depend on the number of threads,
+        // around the first finite point to keep their precision far from the origin
+        size_t firstFinite = 0;
+        while (firstFinite < count && !detail::isFinitePoint(points + firstFinite*stride))
+            firstFinite++;
+        if (firstFinite == count)
+            return OBB();
+        const double* shift = points + firstFinite*stride;
+        const size_t grain = PARALLEL_GRAIN;
+        size_t blockCount = (count + grain - 1) / grain;
+        std::vector<double> blockSums(blockCount*12, 0.0);
+        std::vector<size_t> blockCounts(blockCount);
+        parallel::parallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+            for (size_t b=begin; b<end; b++)
+            {
+                size_t first = b*grain;
+                size_t n = count-first < grain ? count-first : grain;
+                blockCounts[b] = simd::momentsPoints(points + first*stride, n, stride, shift, &blockSums[b*12]);
+            }
+        });
+        double sums[12] = { 0.0 };
+        size_t finiteCount = 0;
+        for (size_t b=0; b<blockCount; b++)
+        {
+            for (int k=0; k<12; k++)
+                sums[k] += blockSums[b*12+k];
+            finiteCount += blockCounts[b];
+        }
+
+        // a point with a NaN or infinite coordinate would also stretch the bounds of the second pass,
+        // the rare arrays that have some are fitted again without them
+        if (finiteCount < count)
+        {
+            std::vector<double> finite;
+            finite.reserve(finiteCount*3);
+            for (size_t i=0; i<count; i++)
+            {
+                const double* p = points + i*stride;
+                if (detail::isFinitePoint(p))
+                    finite.insert(finite.end(), p, p+3);
+            }
+            return fromPoints(&finite[0], finiteCount, 3);
+        }
+
+        double invCount = 1.0 / double(count);
+        double mean[3] = { sums[0] * invCount, sums[1] * invCount, sums[2] * invCount };
+        Matrix3 covariance;
+        for (int r=0; r<3; r++)
+        {
+            for (int c=0; c<3; c++)
+                covariance(r, c) = sums[3+r*3+c] * invCount - mean[r] * mean[c];
+        }
+        Vector3 variances;
+        OBB result;
+        covariance.symmetricEigen(variances, result.axes);
+
+        // the points in the frame of the axes, centered on their mean: the column c of the matrix is the axis c
+        Vector3 origin(shift[0] + mean[0], shift[1] + mean[1], shift[2] + mean[2]);
+        Matrix4 frame;
+        double* m = frame.data();
+        for (int c=0; c<3; c++)
+        {
+            Vector3 axis = result.axes.getRow(c);
+            for (int r=0; r<3; r++)
+                m[r*4+c] = axis[r];
+            m[12+c] = -origin.dot(axis);
+            m[c*4+3] = 0.0;
+        }
+        m[15] = 1.0;
+        AABB local = detail::boundPoints(m, points, count, stride);
+
+        Vector3 localCenter = local.getCenter();
+        result.center = origin + localCenter * result.axes;
+        result.halfSize = local.getHalfSize();
+        return result;
+    }
+
+    GMATH_INLINE OBB OBB::fromPoints(const std::vector<Vector3>& points)
+    {
+        return fromPoints(points.empty() ? NULL : points[0].data(), points.size(), 3);
+    }
+
+    GMATH_INLINE std::string OBB::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::OBB(center  :" << center.x << ", " << center.y << ", " << center.z << std::endl;
+        oss << "           axisX   :" << axes(0, 0) << ", " << axes(0, 1) << ", " << axes(0, 2) << std::endl;
+        oss << "           axisY   :" << axes(1, 0) << ", " << axes(1, 1) << ", " << axes(1, 2) << std::endl;
+        oss << "           axisZ   :" << axes(2, 0) << ", " << axes(2, 1) << ", " << axes(2, 2) << std::endl;
+        oss << "           halfSize:" << halfSize.x << ", " << halfSize.y << ", " << halfSize.z << ");";
+
+        return oss.str();
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+#define GMATH_BVH_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmParallel.h"
+#include "gmVector3.h"
+
+namespace gmath
+{
+    /** The first triangle hit by a ray, see TriangleBvh::raycast. */
+    struct BvhRayHit
+    {
+        /** Index of the triangle in the mesh, TriangleBvh::NONE when nothing was hit. */
+        size_t triangle;
+        /** Distance along the ray in lengths of its direction: point = origin + direction * distance. */
+        double distance;
+        /** Barycentric coordinates of the point: point = (1-u-v) * p0 + u * p1 + v * p2. */
+        double u, v;
+        Vector3 point;
+    };
+
+    /** The closest point of the mesh, see TriangleBvh::closestPoint. */
+    struct BvhClosestPoint
+    {
+        /** Index of the triangle in the mesh, TriangleBvh::NONE when nothing was within range. */
+        size_t triangle;
+        double distance;
+        /** Barycentric coordinates of the point: point = (1-u-v) * p0 + u * p1 + v * p2. */
+        double u, v;
+        Vector3 point;
+    };
+
+    /**
+    Bounding volume hierarchy of a triangle mesh, for ray casts and closest point queries.
+
+    The tree is built with the surface area heuristic over 16 bins per axis. The nodes are stored
+    in one array, the two children of a node next to each other, and the triangles are copied in
+    the order of the leaves, so a query reads memory mostly forward. The top of the tree is split
+    serially, then the subtrees are built in parallel on the gmath::parallel threads: the tree is
+    the same whatever the number of threads.
+
+    The mesh is a list of points and three indices per triangle. The BVH keeps its own copy of the
+    triangles, build again after a change of topology, refit after the points moved (a refit tree
+    answers the same but slower as the points move further from the pose it was built on).
+    The queries are const and can be made from several threads at once.
+    */
+    class TriangleBvh
+    {
+    public:
+        /** A node is 64 bytes. An interior node has count 0 and first is its left child, the right
+            child is first+1. A leaf holds the triangles first to first+count-1 of the leaf order. */
+        struct Node
+        {
+            double min[3];
+            double max[3];
+            unsigned int first;
+            unsigned int count;
+            unsigned int padding[2];
+        };
+
+        /** The triangle index of a query that found nothing. */
+        static const size_t NONE = size_t(-1);
+
+        /** Triangles per chunk of work given to a thread while building. */
+        static const size_t PARALLEL_GRAIN = 4096;
+        /** Queries per chunk of work given to a thread by the batch queries. */
+        static const size_t QUERY_GRAIN = 64;
+
+    private:
+        std::vector<Node> _nodes;
+        /** Per triangle in the leaf order: the first point, then the two edges from it, 9 doubles. */
+        std::vector<double> _triangles;
+        /** The index of the triangle in the mesh, per triangle in the leaf order. */
+        std::vector<unsigned int> _order;
+        std::vector<unsigned int> _indices;
+        size_t _pointCount;
+
+        void setTriangles(const Vector3* points);
+        void refitNodes();
+
+    public:
+        /*------ constructors ------*/
+        TriangleBvh();
+
+        /** Throws GMathError if the indices don't match the points, see build. */
+        TriangleBvh(const std::vector<Vector3>& points, const std::vector<unsigned int>& indices);
+
+        /*------ setup ------*/
+
+        /** Build the tree of the triangles (indices[3*i], indices[3*i+1], indices[3*i+2]).
+            Throws GMathError if the size of indices is not a multiple of 3 or if an index is past the end of points. */
+        void build(const std::vector<Vector3>& points, const std::vector<unsigned int>& indices);
+
+        /** Move the points of the mesh and update the bounds of the nodes, the tree stays the same.
+            Throws GMathError if points doesn't have the size of the points given to build. */
+        void refit(const std::vector<Vector3>& points);
+
+        void clear();
+
+        size_t getTriangleCount() const;
+        size_t getNodeCount() const;
+        const std::vector<Node>& getNodes() const;
+
+        /** The bounds of the whole mesh, false if it is empty. */
+        bool getBounds(Vector3& min, Vector3& max) const;
+
+        /*------ queries ------*/
+
+        /** The first triangle hit by the ray origin + direction * t for 0 <= t <= maxDistance, both faces count.
+            Returns false and sets hit.triangle to NONE if no triangle is hit. */
+        bool raycast(const Vector3& origin, const Vector3& direction, BvhRayHit& hit, double maxDistance=DBL_MAX) const;
+
+        /** The point of the mesh closest to point, within maxDistance.
+            Returns false and sets result.triangle to NONE if no triangle is that close. */
+        bool closestPoint(const Vector3& point, BvhClosestPoint& result, double maxDistance=DBL_MAX) const;
+
+        /** count ray casts, in parallel. */
+        void raycast(const Vector3* origins, const Vector3* directions, BvhRayHit* hits, size_t count, double maxDistance=DBL_MAX) const;
+
+        /** count closest point queries, in parallel. */
+        void closestPoints(const Vector3* points, BvhClosestPoint* results, size_t count, double maxDistance=DBL_MAX) const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_BVH_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,781 @@
+#include <algorithm>
+
+namespace gmath
+{
+    namespace detail
+    {
+        // 1 + 2 * gamma(3), the far distance of a slab test is stretched by it so the rounding of the
+        // test never loses a box the ray touches.
+        const double BVH_SLAB_PADDING = 1.0 + 8.0 * DBL_EPSILON;
+        // the queries keep a stack of the nodes to visit, the build stops splitting before it can overflow
+        const size_t BVH_STACK_SIZE = 64;
+        // below this squared sine of the angle between two edges a triangle is searched by its edges
+        const double BVH_THIN_TRIANGLE = 1.0e-10;
+
+        GMATH_INLINE double halfArea(const double* min, const double* max)
+        {
+            double dx = max[0] - min[0], dy = max[1] - min[1], dz = max[2] - min[2];
+            return dx*dy + dy*dz + dz*dx;
+        }
+
+        GMATH_INLINE void growBounds(double* min, double* max, const double* otherMin, const double* otherMax)
+        {
+            for (int a=0; a<3; a++)
+            {
+                min[a] = otherMin[a] < min[a] ? otherMin[a] : min[a];
+                max[a] = otherMax[a] > max[a] ? otherMax[a] : max[a];
+            }
+        }
+
+        GMATH_INLINE void growBounds(double* min, double* max, const Vector3& point)
+        {
+            growBounds(min, max, point.data(), point.data());
+        }
+
+        GMATH_INLINE void resetBounds(double* min, double* max)
+        {
+            for (int a=0; a<3; a++)
+            {
+                min[a] = INFINITY;
+                max[a] = -INFINITY;
+            }
+        }
+
+        /*  Top down SAH build over the triangles order[begin] to order[end-1].
+            A node is split at the bin boundary of the axis with the smallest
+            TRAVERSAL_COST * area + leftCount * leftArea + rightCount * rightArea,
+            or kept as a leaf when that costs more than testing its triangles. */
+        struct BvhBuilder
+        {
+            static const size_t BINS = 16;
+            static const size_t MAX_LEAF = 8;
+            static const size_t MAX_DEPTH = 48;
+
+            /** A subtree left to build once the top of the tree is done. */
+            struct Task
+            {
+                size_t node;
+                size_t begin;
+                size_t end;
+                size_t depth;
+            };
+
+            struct Bin
+            {
+                double min[3];
+                double max[3];
+                size_t count;
+            };
+
+            // per triangle: min xyz then max xyz, and the center of that box
+            const double* bounds;
+            const double* centroids;
+            unsigned int* order;
+
+            static size_t binOf(double value, double origin, double scale)
+            {
+                size_t bin = size_t((value - origin) * scale);
+                return bin < BINS ? bin : BINS-1;
+            }
+
+            void setBounds(TriangleBvh::Node& node, size_t begin, size_t end) const
+            {
+                resetBounds(node.min, node.max);
+                for (size_t i=begin; i<end; i++)
+                {
+                    const double* box = bounds + size_t(order[i])*6;
+                    growBounds(node.min, node.max, box, box+3);
+                }
+            }
+
+            /** The end of the left child, begin to keep the node as a leaf. */
+            size_t split(const TriangleBvh::Node& node, size_t begin, size_t end, size_t depth) const
+            {
+                const double TRAVERSAL_COST = 1.0;
+
+                size_t count = end - begin;
+                if (count <= 2 || depth >= MAX_DEPTH)
+                    return begin;
+
+                double centroidMin[3], centroidMax[3];
+                resetBounds(centroidMin, centroidMax);
+                for (size_t i=begin; i<end; i++)
+                {
+                    const double* centroid = centroids + size_t(order[i])*3;
+                    growBounds(centroidMin, centroidMax, centroid, centroid);
+                }
+
+                int bestAxis = -1;
+                size_t bestBin = 0;
+                double bestCost = INFINITY;
+                for (int axis=0; axis<3; axis++)
+                {
+                    double extent = centroidMax[axis] - centroidMin[axis];
+                    if (!(extent > 0.0))
+                        continue;
+                    double scale = double(BINS) / extent;
+
+                    Bin bins[BINS];
+                    for (size_t b=0; b<BINS; b++)
+                    {
+                        resetBounds(bins[b].min, bins[b].max);
+                        bins[b].count = 0;
+                    }
+                    for (size_t i=begin; i<end; i++)
+                    {
+                        size_t triangle = order[i];
+                        Bin& bin = bins[binOf(centroids[triangle*3+axis], centroidMin[axis], scale)];
+                        growBounds(bin.min, bin.max, bounds + triangle*6, bounds + triangle*6 + 3);
+                        bin.count++;
+                    }
+
+                    // the right side of every boundary, then the left side while sweeping
+                    double rightArea[BINS];
+                    size_t rightCount[BINS];
+                    double min[3], max[3];
+                    resetBounds(min, max);
+                    size_t sum = 0;
+                    for (size_t b=BINS-1; b>0; b--)
+                    {
+                        growBounds(min, max, bins[b].min, bins[b].max);
+                        sum += bins[b].count;
+                        rightArea[b] = sum ? halfArea(min, max) : 0.0;
+                        rightCount[b] = sum;
+                    }
+
+                    resetBounds(min, max);
+                    sum = 0;
+                    for (size_t b=0; b+1<BINS; b++)
+                    {
+                        growBounds(min, max, bins[b].min, bins[b].max);
+                        sum += bins[b].count;
+                        if (!sum || !rightCount[b+1])
+                            continue;
+                        double cost = double(sum) * halfArea(min, max) + double(rightCount[b+1]) * rightArea[b+1];
+                        if (cost < bestCost)
+                        {
+                            bestCost = cost;
+                            bestAxis = axis;
+                            bestBin = b;
+                        }
+                    }
+                }
+
+                // every centroid at the same place, only a big leaf is worth splitting, anywhere
+                if (bestAxis < 0)
+                    return count > MAX_LEAF ? begin + count/2 : begin;
+
+                double area = halfArea(node.min, node.max);
+                if (count <= MAX_LEAF && !(TRAVERSAL_COST*area + bestCost < double(count)*area))
+                    return begin;
+
+                double origin = centroidMin[bestAxis];
+                double scale = double(BINS) / (centroidMax[bestAxis] - origin);
+                const double* axisCentroids = centroids + bestAxis;
+                unsigned int* middle = std::partition(order+begin, order+end, [=](unsigned int triangle) {
+                    return binOf(axisCentroids[size_t(triangle)*3], origin, scale) <= bestBin;
+                });
+                return size_t(middle - order);
+            }
+
+            void build(std::vector<TriangleBvh::Node>& nodes, size_t index, size_t begin, size_t end, size_t depth) const
+            {
+                setBounds(nodes[index], begin, end);
+                size_t middle = split(nodes[index], begin, end, depth);
+                if (middle == begin)
+                {
+                    nodes[index].first = (unsigned int)begin;
+                    nodes[index].count = (unsigned int)(end - begin);
+                    return;
+                }
+
+                size_t left = nodes.size();
+                nodes.resize(left+2);
+                nodes[index].first = (unsigned int)left;
+                nodes[index].count = 0;
+                build(nodes, left, begin, middle, depth+1);
+                build(nodes, left+1, middle, end, depth+1);
+            }
+
+            /** build, down to the subtrees small enough for one thread. */
+            void buildTop(std::vector<TriangleBvh::Node>& nodes, size_t index, size_t begin, size_t end, size_t depth,
+                          std::vector<Task>& tasks) const
+            {
+                if (end - begin <= TriangleBvh::PARALLEL_GRAIN)
+                {
+                    Task task = { index, begin, end, depth };
+                    tasks.push_back(task);
+                    return;
+                }
+
+                setBounds(nodes[index], begin, end);
+                size_t middle = split(nodes[index], begin, end, depth);
+                if (middle == begin)
+                {
+                    nodes[index].first = (unsigned int)begin;
+                    nodes[index].count = (unsigned int)(end - begin);
+                    return;
+                }
+
+                size_t left = nodes.size();
+                nodes.resize(left+2);
+                nodes[index].first = (unsigned int)left;
+                nodes[index].count = 0;
+                buildTop(nodes, left, begin, middle, depth+1, tasks);
+                buildTop(nodes, left+1, middle, end, depth+1, tasks);
+            }
+        };
+
+        /** Distance along the ray to the box, INFINITY if the ray misses it before maxDistance. */
+        GMATH_INLINE double rayBoxDistance(const TriangleBvh::Node& node, const double* origin, const double* invDirection, double maxDistance)
+        {
+            double entry = 0.0, exit = maxDistance;
+            for (int a=0; a<3; a++)
+            {
+                // NaN for a ray in the plane of a side, the comparisons then leave entry and exit alone
+                double t0 = (node.min[a] - origin[a]) * invDirection[a];
+                double t1 = (node.max[a] - origin[a]) * invDirection[a];
+                if (t0 > t1)
+                {
+                    double swap = t0;
+                    t0 = t1;
+                    t1 = swap;
+                }
+                t1 *= BVH_SLAB_PADDING;
+                entry = t0 > entry ? t0 : entry;
+                exit = t1 < exit ? t1 : exit;
+            }
+            return entry <= exit ? entry : INFINITY;
+        }
+
+        GMATH_INLINE double pointBoxDistance2(const TriangleBvh::Node& node, const double* point)
+        {
+            double distance2 = 0.0;
+            for (int a=0; a<3; a++)
+            {
+                double outside = point[a] < node.min[a] ? node.min[a] - point[a] : (point[a] > node.max[a] ? point[a] - node.max[a] : 0.0);
+                distance2 += outside*outside;
+            }
+            return distance2;
+        }
+
+        GMATH_INLINE double dot3(const double* a, const double* b)
+        {
+            return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+        }
+
+        GMATH_INLINE void cross3(const double* a, const double* b, double* out)
+        {
+            out[0] = a[1]*b[2] - a[2]*b[1];
+            out[1] = a[2]*b[0] - a[0]*b[2];
+            out[2] = a[0]*b[1] - a[1]*b[0];
+        }
+
+        /** Moller-Trumbore, both faces, the distance or a negative value if the ray misses the triangle. */
+        GMATH_INLINE double rayTriangle(const double* triangle, const double* origin, const double* direction, double& u, double& v)
+        {
+            const double* a = triangle;
+            const double* edge1 = triangle+3;
+            const double* edge2 = triangle+6;
+
+            double p[3];
+            cross3(direction, edge2, p);
+            double det = dot3(edge1, p);
+            if (det == 0.0)
+                return -1.0;
+            double invDet = 1.0 / det;
+
+            double s[3] = { origin[0] - a[0], origin[1] - a[1], origin[2] - a[2] };
+            u = dot3(s, p) * invDet;
+            if (u < 0.0 || u > 1.0)
+                return -1.0;
+
+            double q[3];
+            cross3(s, edge1, q);
+            v = dot3(direction, q) * invDet;
+            if (v < 0.0 || u + v > 1.0)
+                return -1.0;
+
+            return dot3(edge2, q) * invDet;
+        }
+
+        /** Parameter of the point of the segment start + t * edge closest to offset + start. */
+        GMATH_INLINE double closestOnEdge(const double* edge, const double* offset)
+        {
+            double length2 = dot3(edge, edge);
+            if (!(length2 > 0.0))
+                return 0.0;
+            double t = dot3(edge, offset) / length2;
+            return t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+        }
+
+        GMATH_INLINE double distance2OnTriangle(const double* triangle, const double* point, double u, double v)
+        {
+            double distance2 = 0.0;
+            for (int a=0; a<3; a++)
+            {
+                double delta = triangle[a] + triangle[3+a]*u + triangle[6+a]*v - point[a];
+                distance2 += delta*delta;
+            }
+            return distance2;
+        }
+
+        /** The closest point of a triangle too thin for its Voronoi regions, the closest point of its three edges. */
+        GMATH_INLINE void closestPointOnEdges(const double* triangle, const double* point, double& u, double& v)
+        {
+            const double* a = triangle;
+            const double* ab = triangle+3;
+            const double* ac = triangle+6;
+            double ap[3] = { point[0] - a[0], point[1] - a[1], point[2] - a[2] };
+            double bp[3] = { ap[0] - ab[0], ap[1] - ab[1], ap[2] - ab[2] };
+            double bc[3] = { ac[0] - ab[0], ac[1] - ab[1], ac[2] - ab[2] };
+
+            double t = closestOnEdge(ab, ap);
+            u = t; v = 0.0;
+            double best = distance2OnTriangle(triangle, point, u, v);
+
+            t = closestOnEdge(ac, ap);
+            double distance2 = distance2OnTriangle(triangle, point, 0.0, t);
+            if (distance2 < best)
+            {
+                best = distance2;
+                u = 0.0; v = t;
+            }
+
+            t = closestOnEdge(bc, bp);
+            distance2 = distance2OnTriangle(triangle, point, 1.0 - t, t);
+            if (distance2 < best)
+            {
+                u = 1.0 - t; v = t;
+            }
+        }
+
+        /** The closest point of the triangle by its Voronoi regions (Ericson, Real-Time Collision Detection 5.1.5),
+            as barycentric coordinates. The regions can't be told apart on a nearly degenerate triangle,
+            its edges are searched instead. */
+        GMATH_INLINE void closestPointOnTriangle(const double* triangle, const double* point, double& u, double& v)
+        {
+            const double* a = triangle;
+            const double* ab = triangle+3;
+            const double* ac = triangle+6;
+
+            double normal[3];
+            cross3(ab, ac, normal);
+            if (!(dot3(normal, normal) > BVH_THIN_TRIANGLE * dot3(ab, ab) * dot3(ac, ac)))
+            {
+                closestPointOnEdges(triangle, point, u, v);
+                return;
+            }
+
+            double ap[3] = { point[0] - a[0], point[1] - a[1], point[2] - a[2] };
+            double d1 = dot3(ab, ap);
+            double d2 = dot3(ac, ap);
+            if (d1 <= 0.0 && d2 <= 0.0)
+            {
+                u = 0.0; v = 0.0;
+                return;
+            }
+
+            double bp[3] = { ap[0] - ab[0], ap[1] - ab[1], ap[2] - ab[2] };
+            double d3 = dot3(ab, bp);
+            double d4 = dot3(ac, bp);
+            if (d3 >= 0.0 && d4 <= d3)
+            {
+                u = 1.0; v = 0.0;
+                return;
+            }
+
+            double vc = d1*d4 - d3*d2;
+            if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+            {
+                u = d1 - d3 != 0.0 ? d1 / (d1 - d3) : 0.0;
+                v = 0.0;
+                return;
+            }
+
+            double cp[3] = { ap[0] - ac[0], ap[1] - ac[1], ap[2] - ac[2] };
+            double d5 = dot3(ab, cp);
+            double d6 = dot3(ac, cp);
+            if (d6 >= 0.0 && d5 <= d6)
+            {
+                u = 0.0; v = 1.0;
+                return;
+            }
+
+            double vb = d5*d2 - d1*d6;
+            if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+            {
+                u = 0.0;
+                v = d2 - d6 != 0.0 ? d2 / (d2 - d6) : 0.0;
+                return;
+            }
+
+            double va = d3*d6 - d5*d4;
+            if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+            {
+                double length = (d4 - d3) + (d5 - d6);
+                double w = length != 0.0 ? (d4 - d3) / length : 0.0;
+                u = 1.0 - w;
+                v = w;
+                return;
+            }
+
+            double denominator = va + vb + vc;
+            u = vb / denominator;
+            v = vc / denominator;
+        }
+    }
+
+    /*------ constructors ------*/
+
+    GMATH_INLINE TriangleBvh::TriangleBvh()
+        : _pointCount(0)
+    {
+    }
+
+    GMATH_INLINE TriangleBvh::TriangleBvh(const std::vector<Vector3>& points, const std::vector<unsigned int>& indices)
+        : _pointCount(0)
+    {
+        build(points, indices);
+    }
+
+    /*------ setup ------*/
+
+    GMATH_INLINE void TriangleBvh::build(const std::vector<Vector3>& points, const std::vector<unsigned int>& indices)
+    {
+        if (indices.size() % 3)
+            throw GMathError("TriangleBvh.build: the number of indices must be a multiple of 3");
+        size_t triangleCount = indices.size() / 3;
+        // the node indices are unsigned int and a tree has less than two nodes per triangle
+        if (triangleCount > 0x7FFFFFFF)
+            throw GMathError("TriangleBvh.build: too many triangles");
+        for (size_t i=0; i<indices.size(); i++)
+        {
+            if (indices[i] >= points.size())
+                throw GMathError("TriangleBvh.build: an index is past the end of the points");
+        }
+
+        clear();
+        _indices = indices;
+        _pointCount = points.size();
+        if (!triangleCount)
+            return;
+
+        std::vector<double> bounds(triangleCount*6), centroids(triangleCount*3);
+        parallel::parallelFor(triangleCount, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t t=begin; t<end; t++)
+            {
+                double* min = &bounds[t*6];
+                double* max = min+3;
+                detail::resetBounds(min, max);
+                for (int k=0; k<3; k++)
+                    detail::growBounds(min, max, points[indices[t*3+k]]);
+                for (int a=0; a<3; a++)
+                    centroids[t*3+a] = 0.5*(min[a] + max[a]);
+            }
+        });
+
+        _order.resize(triangleCount);
+        for (size_t t=0; t<triangleCount; t++)
+            _order[t] = (unsigned int)t;
+
+        detail::BvhBuilder builder = { bounds.data(), centroids.data(), _order.data() };
+        std::vector<detail::BvhBuilder::Task> tasks;
+        _nodes.assign(1, Node());
+        builder.buildTop(_nodes, 0, 0, triangleCount, 0, tasks);
+
+        // the subtrees work on separate ranges of _order, each in its own array of nodes
+        std::vector< std::vector<Node> > subtrees(tasks.size());
+        parallel::parallelFor(tasks.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t k=begin; k<end; k++)
+            {
+                subtrees[k].assign(1, Node());
+                builder.build(subtrees[k], 0, tasks[k].begin, tasks[k].end, tasks[k].depth);
+            }
+        });
+
+        // the root of a subtree replaces its task node, the other nodes are appended
+        for (size_t k=0; k<tasks.size(); k++)
+        {
+            const std::vector<Node>& subtree = subtrees[k];
+            unsigned int base = (unsigned int)(_nodes.size() - 1);
+            for (size_t i=0; i<subtree.size(); i++)
+            {
+                Node node = subtree[i];
+                if (!node.count)
+                    node.first += base;
+                if (i)
+                    _nodes.push_back(node);
+                else
+                    _nodes[tasks[k].node] = node;
+            }
+        }
+
+        setTriangles(points.data());
+    }
+
+    GMATH_INLINE void TriangleBvh::setTriangles(const Vector3* points)
+    {
+        _triangles.resize(_order.size()*9);
+        parallel::parallelFor(_order.size(), PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i=begin; i<end; i++)
+            {
+                const unsigned int* triangle = &_indices[size_t(_order[i])*3];
+                const Vector3& a = points[triangle[0]];
+                Vector3 edge1 = points[triangle[1]] - a;
+                Vector3 edge2 = points[triangle[2]] - a;
+
+                double* out = &_triangles[i*9];
+                out[0] = a.x;     out[1] = a.y;     out[2] = a.z;
+                out[3] = edge1.x; out[4] = edge1.y; out[5] = edge1.z;
+                out[6] = edge2.x; out[7] = edge2.y; out[8] = edge2.z;
+            }
+        });
+    }
+
+    GMATH_INLINE void TriangleBvh::refit(const std::vector<Vector3>& points)
+    {
+        if (points.size() != _pointCount)
+            throw GMathError("TriangleBvh.refit: the number of points must not change, build again");
+
+        setTriangles(points.data());
+
+        // the children always come after their parent
+        for (size_t i=_nodes.size(); i-->0; )
+        {
+            Node& node = _nodes[i];
+            detail::resetBounds(node.min, node.max);
+            if (node.count)
+            {
+                for (size_t s=node.first; s<size_t(node.first)+node.count; s++)
+                {
+                    const unsigned int* triangle = &_indices[size_t(_order[s])*3];
+                    for (int k=0; k<3; k++)
+                        detail::growBounds(node.min, node.max, points[triangle[k]]);
+                }
+            }
+            else
+            {
+                for (unsigned int child=node.first; child<node.first+2; child++)
+                    detail::growBounds(node.min, node.max, _nodes[child].min, _nodes[child].max);
+            }
+        }
+    }
+
+    GMATH_INLINE void TriangleBvh::clear()
+    {
+        _nodes.clear();
+        _triangles.clear();
+        _order.clear();
+        _indices.clear();
+        _pointCount = 0;
+    }
+
+    GMATH_INLINE size_t TriangleBvh::getTriangleCount() const
+    {
+        return _order.size();
+    }
+
+    GMATH_INLINE size_t TriangleBvh::getNodeCount() const
+    {
+        return _nodes.size();
+    }
+
+    GMATH_INLINE const std::vector<TriangleBvh::Node>& TriangleBvh::getNodes() const
+    {
+        return _nodes;
+    }
+
+    GMATH_INLINE bool TriangleBvh::getBounds(Vector3& min, Vector3& max) const
+    {
+        if (_nodes.empty())
+            return false;
+        min.set(_nodes[0].min[0], _nodes[0].min[1], _nodes[0].min[2]);
+        max.set(_nodes[0].max[0], _nodes[0].max[1], _nodes[0].max[2]);
+        return true;
+    }
+
+    /*------ queries ------*/
+
+    GMATH_INLINE bool TriangleBvh::raycast(const Vector3& origin, const Vector3& direction, BvhRayHit& hit, double maxDistance) const
+    {
+        struct Entry
+        {
+            size_t node;
+            double distance;
+        };
+
+        hit.triangle = NONE;
+        if (_nodes.empty())
+            return false;
+
+        const double* o = origin.data();
+        const double* d = direction.data();
+        double invDirection[3] = { 1.0 / d[0], 1.0 / d[1], 1.0 / d[2] };
+
+        double best = maxDistance;
+        size_t bestSlot = NONE;
+        double bestU = 0.0, bestV = 0.0;
+
+        Entry stack[detail::BVH_STACK_SIZE];
+        size_t top = 0;
+        double rootDistance = detail::rayBoxDistance(_nodes[0], o, invDirection, best);
+        if (rootDistance > best)
+            return false;
+        stack[top].node = 0;
+        stack[top++].distance = rootDistance;
+
+        while (top)
+        {
+            Entry entry = stack[--top];
+            if (entry.distance > best)
+                continue;
+
+            const Node& node = _nodes[entry.node];
+            if (node.count)
+            {
+                for (size_t s=node.first; s<size_t(node.first)+node.count; s++)
+                {
+                    double u, v;
+                    double distance = detail::rayTriangle(&_triangles[s*9], o, d, u, v);
+                    if (distance >= 0.0 && distance < best)
+                    {
+                        best = distance;
+                        bestSlot = s;
+                        bestU = u;
+                        bestV = v;
+                    }
+                }
+                continue;
+            }
+
+            // the nearest child is visited first
+            size_t nearChild = node.first, farChild = node.first+1;
+            double nearDistance = detail::rayBoxDistance(_nodes[nearChild], o, invDirection, best);
+            double farDistance = detail::rayBoxDistance(_nodes[farChild], o, invDirection, best);
+            if (farDistance < nearDistance)
+            {
+                std::swap(nearChild, farChild);
+                std::swap(nearDistance, farDistance);
+            }
+            if (farDistance <= best)
+            {
+                stack[top].node = farChild;
+                stack[top++].distance = farDistance;
+            }
+            if (nearDistance <= best)
+            {
+                stack[top].node = nearChild;
+                stack[top++].distance = nearDistance;
+            }
+        }
+
+        if (bestSlot == NONE)
+            return false;
+
+        hit.triangle = _order[bestSlot];
+        hit.distance = best;
+        hit.u = bestU;
+        hit.v = bestV;
+        hit.point = origin + direction * best;
+        return true;
+    }
+
+    GMATH_INLINE bool TriangleBvh::closestPoint(const Vector3& point, BvhClosestPoint& result, double maxDistance) const
+    {
+        struct Entry
+        {
+            size_t node;
+            double distance2;
+        };
+
+        result.triangle = NONE;
+        if (_nodes.empty())
+            return false;
+
+        const double* p = point.data();
+        double best2 = maxDistance*maxDistance;
+        size_t bestSlot = NONE;
+        double bestU = 0.0, bestV = 0.0;
+
+        Entry stack[detail::BVH_STACK_SIZE];
+        size_t top = 0;
+        stack[top].node = 0;
+        stack[top++].distance2 = detail::pointBoxDistance2(_nodes[0], p);
+
+        while (top)
+        {
+            Entry entry = stack[--top];
+            if (entry.distance2 >= best2)
+                continue;
+
+            const Node& node = _nodes[entry.node];
+            if (node.count)
+            {
+                for (size_t s=node.first; s<size_t(node.first)+node.count; s++)
+                {
+                    const double* triangle = &_triangles[s*9];
+                    double u, v;
+                    detail::closestPointOnTriangle(triangle, p, u, v);
+                    double distance2 = detail::distance2OnTriangle(triangle, p, u, v);
+                    if (distance2 < best2)
+                    {
+                        best2 = distance2;
+                        bestSlot = s;
+                        bestU = u;
+                        bestV = v;
+                    }
+                }
+                continue;
+            }
+
+            size_t nearChild = node.first, farChild = node.first+1;
+            double nearDistance2 = detail::pointBoxDistance2(_nodes[nearChild], p);
+            double farDistance2 = detail::pointBoxDistance2(_nodes[farChild], p);
+            if (farDistance2 < nearDistance2)
+            {
+                std::swap(nearChild, farChild);
+                std::swap(nearDistance2, farDistance2);
+            }
+            if (farDistance2 < best2)
+            {
+                stack[top].node = farChild;
+                stack[top++].distance2 = farDistance2;
+            }
+            if (nearDistance2 < best2)
+            {
+                stack[top].node = nearChild;
+                stack[top++].distance2 = nearDistance2;
+            }
+        }
+
+        if (bestSlot == NONE)
+            return false;
+
+        const double* triangle = &_triangles[bestSlot*9];
+        result.triangle = _order[bestSlot];
+        result.u = bestU;
+        result.v = bestV;
+        result.point.set(triangle[0] + triangle[3]*bestU + triangle[6]*bestV,
+                         triangle[1] + triangle[4]*bestU + triangle[7]*bestV,
+                         triangle[2] + triangle[5]*bestU + triangle[8]*bestV);
+        result.distance = sqrt(best2);
+        return true;
+    }
+
+    GMATH_INLINE void TriangleBvh::raycast(const Vector3* origins, const Vector3* directions, BvhRayHit* hits, size_t count, double maxDistance) const
+    {
+        parallel::parallelFor(count, QUERY_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i=begin; i<end; i++)
+                raycast(origins[i], directions[i], hits[i], maxDistance);
+        });
+    }
+
+    GMATH_INLINE void TriangleBvh::closestPoints(const Vector3* points, BvhClosestPoint* results, size_t count, double maxDistance) const
+    {
+        parallel::parallelFor(count, QUERY_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i=begin; i<end; i++)
+                closestPoint(points[i], results[i], maxDistance);
+        });
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+#define GMATH_DUALQUATERNION_BEGIN
+
+#include <string>
+#include "gmRoot.h"
+#include "gmVector3.h"
+#include "gmQuaternion.h"
+#include "gmMatrix4.h"
+#include "gmXfo.h"
+
+namespace gmath
+{
+    /** A rigid transform (rotation and translation) as a dual quaternion qr + e qd.
+
+        qr is the rotation and qd = 0.5 * qr * Quaternion(tr, 0) with the GMath quaternion product,
+        so a point is rotated first and translated after, like an Xfo without scale.
+        As for Quaternion and Xfo, a * b applies a first then b.
+
+        Unlike Xfo, dual quaternions can be blended linearly: the normalized weighted sum of rigid
+        transforms is a rigid transform (dual quaternion linear blending, from Kavan, Collins, Zara
+        and O'Sullivan, "Geometric Skinning with Approximate Dual Quaternion Blending", 2008).
+
+        Most methods expect a normalized dual quaternion, see normalize. */
+    template <typename real>
+    class DualQuaternionT
+    {
+    public:
+        /*------ properties ------*/
+        QuaternionT<real> qr;
+        QuaternionT<real> qd;
+
+        /*------ constructors ------*/
+        /** The identity. */
+        DualQuaternionT();
+        DualQuaternionT(const DualQuaternionT& other);
+        /** Conversion from the other precision, for example DualQuaternionf(aDualQuaternion). */
+        template <typename otherReal>
+        explicit DualQuaternionT(const DualQuaternionT<otherReal>& other);
+        DualQuaternionT(const QuaternionT<real>& qr, const QuaternionT<real>& qd);
+        /** The rotation ori (normalized) followed by the translation tr. */
+        DualQuaternionT(const QuaternionT<real>& ori, const Vector3T<real>& tr);
+        /** The rotation and translation of the Xfo, its scale is ignored. */
+        explicit DualQuaternionT(const XfoT<real>& xfo);
+        /** The rotation and translation of the matrix, its scale is ignored. */
+        explicit DualQuaternionT(const Matrix4T<real>& mat);
+
+        /*------ Arithmetic operations ------*/
+        DualQuaternionT operator - () const;
+        DualQuaternionT operator + (const DualQuaternionT& other) const;
+        DualQuaternionT operator - (const DualQuaternionT& other) const;
+        /** This transform followed by other. */
+        DualQuaternionT operator * (const DualQuaternionT& other) const;
+        DualQuaternionT operator * (real scalar) const;
+
+        /*------ Arithmetic updates ------*/
+        DualQuaternionT& operator += (const DualQuaternionT& other);
+        DualQuaternionT& operator -= (const DualQuaternionT& other);
+        DualQuaternionT& operator *= (const DualQuaternionT& other);
+        DualQuaternionT& operator *= (real scalar);
+
+        /*------ Arithmetic comparisons ------*/
+        bool operator == (const DualQuaternionT& other) const;
+        bool operator != (const DualQuaternionT& other) const;
+
+        /*------ Arithmetic assignment ------*/
+        void operator = (const DualQuaternionT& other);
+
+        /*------ methods ------*/
+        void setToIdentity();
+
+        void fromXfo(const XfoT<real>& xfo);
+        /** An Xfo with a scale of 1. */
+        XfoT<real> toXfo() const;
+        void fromMatrix4(const Matrix4T<real>& mat);
+        Matrix4T<real> toMatrix4() const;
+
+        QuaternionT<real> getRotation() const;
+        Vector3T<real> getTranslation() const;
+
+        /** The length of the real part. */
+        real length() const;
+
+        /** Divide by the length of the real part and remove the part of qd along qr,
+            which doesn't change the translation. A zero real part gives zero. */
+        void normalizeInPlace();
+        DualQuaternionT normalize() const;
+
+        /** The conjugate of both quaternions, the inverse of a normalized dual quaternion. */
+        void conjugateInPlace();
+        DualQuaternionT conjugate() const;
+
+        /** The inverse transform of the normalized dual quaternion. */
+        DualQuaternionT inverse() const;
+
+        /** The dot product of the real parts, negative when the rotations are in opposite hemispheres. */
+        real dot(const DualQuaternionT& other) const;
+
+        /** The point rotated then translated. */
+        Vector3T<real> transformVector(const Vector3T<real>& vec) const;
+        Vector3T<real> rotateVector(const Vector3T<real>& vec) const;
+
+        /** Dual quaternion linear blending: the normalized sum of weights[i] * dqs[i], every dual quaternion
+            in the hemisphere of the first one. Returns the identity when count is 0. */
+        static DualQuaternionT blend(const DualQuaternionT* dqs, const real* weights, size_t count);
+
+        std::string toString() const;
+    };
+
+    typedef DualQuaternionT<double> DualQuaternion;
+    typedef DualQuaternionT<float> DualQuaternionf;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class DualQuaternionT<float>;
+        extern template class DualQuaternionT<double>;
+    #endif
+
+    namespace detail
+    {
+        /** The rotation, translation and scale of a matrix without shear, the rotation comes from the normalized rows. */
+        template <typename real>
+        void decomposeRigid(const Matrix4T<real>& mat, QuaternionT<real>& ori, Vector3T<real>& tr, Vector3T<real>& sc);
+    }
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_DUALQUATERNION_END
+    #include "gmInline.h"
+#endif
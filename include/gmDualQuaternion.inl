@@ -0,0 +1,310 @@
+namespace gmath
+{
+    namespace detail
+    {
+        template <typename real>
+        GMATH_INLINE void decomposeRigid(const Matrix4T<real>& mat, QuaternionT<real>& ori, Vector3T<real>& tr, Vector3T<real>& sc)
+        {
+            // Quaternion::fromMatrix4 expects unit rows
+            Matrix4T<real> rotation(mat);
+            rotation.setScale(Vector3T<real>(1.0, 1.0, 1.0));
+            ori = rotation.toQuaternion();
+            ori.normalizeInPlace();
+            tr = mat.getPosition();
+            sc = mat.getScale();
+        }
+
+        // 0.5 * ori * Quaternion(tr, 0)
+        template <typename real>
+        GMATH_INLINE QuaternionT<real> dualPart(const QuaternionT<real>& ori, const Vector3T<real>& tr)
+        {
+            return QuaternionT<real>(
+                real(0.5) * (ori.w*tr.x + (tr.y*ori.z - tr.z*ori.y)),
+                real(0.5) * (ori.w*tr.y + (tr.z*ori.x - tr.x*ori.z)),
+                real(0.5) * (ori.w*tr.z + (tr.x*ori.y - tr.y*ori.x)),
+                real(-0.5) * (tr.x*ori.x + tr.y*ori.y + tr.z*ori.z));
+        }
+    }
+
+    /*------ Constructors ------*/
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT()
+        : qr(0.0, 0.0, 0.0, 1.0), qd(0.0, 0.0, 0.0, 0.0)
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT(const DualQuaternionT<real>& other)
+        : qr(other.qr), qd(other.qd)
+    {
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT(const DualQuaternionT<otherReal>& other)
+        : qr(other.qr), qd(other.qd)
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT(const QuaternionT<real>& qr, const QuaternionT<real>& qd)
+        : qr(qr), qd(qd)
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT(const QuaternionT<real>& ori, const Vector3T<real>& tr)
+        : qr(ori.normalize())
+    {
+        qd = detail::dualPart(qr, tr);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT(const XfoT<real>& xfo)
+    {
+        fromXfo(xfo);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>::DualQuaternionT(const Matrix4T<real>& mat)
+    {
+        fromMatrix4(mat);
+    }
+
+    /*------ Arithmetic operations ------*/
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::operator - () const
+    {
+        return DualQuaternionT<real>(-qr, -qd);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::operator + (const DualQuaternionT<real>& other) const
+    {
+        return DualQuaternionT<real>(qr + other.qr, qd + other.qd);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::operator - (const DualQuaternionT<real>& other) const
+    {
+        return DualQuaternionT<real>(qr - other.qr, qd - other.qd);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::operator * (const DualQuaternionT<real>& other) const
+    {
+        return DualQuaternionT<real>(qr * other.qr, qd * other.qr + qr * other.qd);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::operator * (real scalar) const
+    {
+        return DualQuaternionT<real>(qr * scalar, qd * scalar);
+    }
+
+    /*------ Arithmetic updates ------*/
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>& DualQuaternionT<real>::operator += (const DualQuaternionT<real>& other)
+    {
+        qr += other.qr;
+        qd += other.qd;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>& DualQuaternionT<real>::operator -= (const DualQuaternionT<real>& other)
+    {
+        qr -= other.qr;
+        qd -= other.qd;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>& DualQuaternionT<real>::operator *= (const DualQuaternionT<real>& other)
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real>& DualQuaternionT<real>::operator *= (real scalar)
+    {
+        qr *= scalar;
+        qd *= scalar;
+        return *this;
+    }
+
+    /*------ Arithmetic comparisons ------*/
+
+    template <typename real>
+    GMATH_INLINE bool DualQuaternionT<real>::operator == (const DualQuaternionT<real>& other) const
+    {
+        return qr == other.qr && qd == other.qd;
+    }
+
+    template <typename real>
+    GMATH_INLINE bool DualQuaternionT<real>::operator != (const DualQuaternionT<real>& other) const
+    {
+        return !(*this == other);
+    }
+
+    /*------ Arithmetic assignment ------*/
+
+    template <typename real>
+    GMATH_INLINE void DualQuaternionT<real>::operator = (const DualQuaternionT<real>& other)
+    {
+        qr = other.qr;
+        qd = other.qd;
+    }
+
+    /*------ methods ------*/
+
+    template <typename real>
+    GMATH_INLINE void DualQuaternionT<real>::setToIdentity()
+    {
+        qr.set(0.0, 0.0, 0.0, 1.0);
+        qd.set(0.0, 0.0, 0.0, 0.0);
+    }
+
+    template <typename real>
+    GMATH_INLINE void DualQuaternionT<real>::fromXfo(const XfoT<real>& xfo)
+    {
+        qr = xfo.ori.normalize();
+        qd = detail::dualPart(qr, xfo.tr);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real> DualQuaternionT<real>::toXfo() const
+    {
+        return XfoT<real>(getTranslation(), qr);
+    }
+
+    template <typename real>
+    GMATH_INLINE void DualQuaternionT<real>::fromMatrix4(const Matrix4T<real>& mat)
+    {
+        Vector3T<real> tr, sc;
+        detail::decomposeRigid(mat, qr, tr, sc);
+        qd = detail::dualPart(qr, tr);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> DualQuaternionT<real>::toMatrix4() const
+    {
+        return Matrix4T<real>(qr, getTranslation());
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> DualQuaternionT<real>::getRotation() const
+    {
+        return qr;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> DualQuaternionT<real>::getTranslation() const
+    {
+        // 2 * qr.conjugate() * qd
+        return Vector3T<real>(
+            real(2.0) * ((qr.w*qd.x - qd.w*qr.x) + (qr.y*qd.z - qr.z*qd.y)),
+            real(2.0) * ((qr.w*qd.y - qd.w*qr.y) + (qr.z*qd.x - qr.x*qd.z)),
+            real(2.0) * ((qr.w*qd.z - qd.w*qr.z) + (qr.x*qd.y - qr.y*qd.x)));
+    }
+
+    template <typename real>
+    GMATH_INLINE real DualQuaternionT<real>::length() const
+    {
+        return qr.length();
+    }
+
+    template <typename real>
+    GMATH_INLINE void DualQuaternionT<real>::normalizeInPlace()
+    {
+        real len = qr.length();
+        if (len > gmath::EPSILON)
+        {
+            real invLength = real(1.0) / len;
+            qr *= invLength;
+            qd *= invLength;
+            qd -= qr * qr.dot(qd);
+        }
+        else
+        {
+            qr.set(0.0, 0.0, 0.0, 0.0);
+            qd.set(0.0, 0.0, 0.0, 0.0);
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::normalize() const
+    {
+        DualQuaternionT<real> result(*this);
+        result.normalizeInPlace();
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE void DualQuaternionT<real>::conjugateInPlace()
+    {
+        qr.conjugateInPlace();
+        qd.conjugateInPlace();
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::conjugate() const
+    {
+        return DualQuaternionT<real>(qr.conjugate(), qd.conjugate());
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::inverse() const
+    {
+        return conjugate();
+    }
+
+    template <typename real>
+    GMATH_INLINE real DualQuaternionT<real>::dot(const DualQuaternionT<real>& other) const
+    {
+        return qr.dot(other.qr);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> DualQuaternionT<real>::transformVector(const Vector3T<real>& vec) const
+    {
+        return qr.rotateVector(vec) + getTranslation();
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> DualQuaternionT<real>::rotateVector(const Vector3T<real>& vec) const
+    {
+        return qr.rotateVector(vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE DualQuaternionT<real> DualQuaternionT<real>::blend(const DualQuaternionT<real>* dqs, const real* weights, size_t count)
+    {
+        if (count == 0)
+            return DualQuaternionT<real>();
+
+        DualQuaternionT<real> result = dqs[0] * weights[0];
+        for (size_t i=1; i<count; i++)
+        {
+            // the shortest path: q and -q are the same rotation
+            real weight = dqs[0].dot(dqs[i]) < 0.0 ? -weights[i] : weights[i];
+            result += dqs[i] * weight;
+        }
+        result.normalizeInPlace();
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string DualQuaternionT<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::DualQuaternion(qr:" << qr.x << ", " << qr.y << ", " << qr.z << ", " << qr.w << std::endl;
+        oss << "                      qd:" << qd.x << ", " << qd.y << ", " << qd.z << ", " << qd.w << ");";
+
+        return oss.str();
+    }
+}
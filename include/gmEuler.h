@@ -1,37 +1,45 @@
 #pragma once
+#define GMATH_EULER_BEGIN
 
+#include <limits>
+#include <math.h>
 #include "gmRoot.h"
 #include "gmVector3.h"
 
 namespace gmath
 {
-    class Euler
+    template <typename real>
+    class EulerT
     {
     public:
-        Euler(Unit inUnit=Unit::degrees);
-        Euler(const Euler& other);
-        Euler(const double inX, const double inY, const double inZ, Unit inUnit=Unit::radians);
-        Euler(const Vector3& vec, Unit inUnit=Unit::radians);
-        Euler(const double *values, Unit inUnit=Unit::radians);
-        Euler(const std::vector<double>& values, Unit inUnit=Unit::radians);
+        EulerT(Unit inUnit=Unit::degrees);
+        EulerT(const EulerT& other);
+        EulerT& operator = (const EulerT& other) = default;
+        /** Conversion from the other precision, for example Eulerf(anEuler). */
+        template <typename otherReal>
+        explicit EulerT(const EulerT<otherReal>& other);
+        EulerT(const real inX, const real inY, const real inZ, Unit inUnit=Unit::radians);
+        EulerT(const Vector3T<real>& vec, Unit inUnit=Unit::radians);
+        EulerT(const real *values, Unit inUnit=Unit::radians);
+        EulerT(const std::vector<real>& values, Unit inUnit=Unit::radians);
 
-        double x, y, z;
+        real x, y, z;
 
         /** Pointer access for direct copying. */
-        double* data();
-        const double* data() const;
+        real* data();
+        const real* data() const;
 
         /*------ coordinate access ------*/
-        double operator[] (int i) const;
-        double& operator[] (int i);
+        real operator[] (int i) const;
+        real& operator[] (int i);
 
         /*------ Comparisons ------*/
-        bool operator == (const Euler &other) const; 
-        bool operator != (const Euler &other) const;
+        bool operator == (const EulerT &other) const; 
+        bool operator != (const EulerT &other) const;
 
-        void set(const double inX, const double inY, const double inZ);
-        void set(const double *values);
-        void set(const std::vector<double>& values);
+        void set(const real inX, const real inY, const real inZ);
+        void set(const real *values);
+        void set(const std::vector<real>& values);
 
         Unit getUnit() const;
         /**
@@ -39,14 +47,179 @@ namespace gmath
          */
         void setUnit(Unit inUnit);
 
-        Euler toDegrees() const;
-        Euler toRadians() const;
+        EulerT toDegrees() const;
+        EulerT toRadians() const;
 
-        Vector3 toVector() const;
+        Vector3T<real> toVector() const;
 
         std::string toString() const;
 
     private:
         Unit unit;
     };
-}
\ No newline at end of file
+
+    typedef EulerT<double> Euler;
+    typedef EulerT<float> Eulerf;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class EulerT<float>;
+        extern template class EulerT<double>;
+    #endif
+
+#ifndef SWIG
+    namespace detail
+    {
+        /*  Closed form conversions between Euler angles (x, y, z in radians) and rotations,
+            with the rotation order resolved at compile time. They are used by the fromEuler and
+            toEuler methods and by the batch functions, defined here so the batch loops can inline them.
+
+            FIRST, SECOND and THIRD are the axes in the order they are applied (X, Y then Z for XYZ).
+            PARITY is 1 when they follow the cyclic order X, Y, Z and -1 otherwise, in that case the
+            three axes make a left handed frame, where the usual XYZ formulas hold with negated angles. */
+        template <RotationOrder ORDER> struct EulerAxes;
+        template <> struct EulerAxes<RotationOrder::XYZ> { enum { FIRST=0, SECOND=1, THIRD=2, PARITY=1 }; };
+        template <> struct EulerAxes<RotationOrder::XZY> { enum { FIRST=0, SECOND=2, THIRD=1, PARITY=-1 }; };
+        template <> struct EulerAxes<RotationOrder::YXZ> { enum { FIRST=1, SECOND=0, THIRD=2, PARITY=-1 }; };
+        template <> struct EulerAxes<RotationOrder::YZX> { enum { FIRST=1, SECOND=2, THIRD=0, PARITY=1 }; };
+        template <> struct EulerAxes<RotationOrder::ZXY> { enum { FIRST=2, SECOND=0, THIRD=1, PARITY=1 }; };
+        template <> struct EulerAxes<RotationOrder::ZYX> { enum { FIRST=2, SECOND=1, THIRD=0, PARITY=-1 }; };
+
+        /** quat is x, y, z, w, the rotation of Quaternion::fromEuler.
+            halfCos and halfSin are the cosines and sines of the half angles, x, y, z. */
+        template <RotationOrder ORDER, typename real>
+        inline void quaternionFromSinCos(const real* halfCos, const real* halfSin, real* quat)
+        {
+            typedef EulerAxes<ORDER> A;
+            const real parity = real(A::PARITY);
+
+            real ci = halfCos[A::FIRST],  si = halfSin[A::FIRST];
+            real cj = halfCos[A::SECOND], sj = halfSin[A::SECOND];
+            real ck = halfCos[A::THIRD],  sk = halfSin[A::THIRD];
+
+            // third * (second * first), expanded
+            quat[A::FIRST]  = ck*cj*si - parity*sk*ci*sj;
+            quat[A::SECOND] = ck*ci*sj + parity*sk*cj*si;
+            quat[A::THIRD]  = sk*ci*cj - parity*ck*si*sj;
+            quat[3]         = ci*cj*ck + parity*si*sj*sk;
+        }
+
+        template <RotationOrder ORDER, typename real>
+        inline void eulerToQuaternion(const real* angles, real* quat)
+        {
+            real halfCos[3], halfSin[3];
+            for (int i=0; i<3; i++)
+            {
+                halfCos[i] = cos(angles[i] * real(0.5));
+                halfSin[i] = sin(angles[i] * real(0.5));
+            }
+            quaternionFromSinCos<ORDER>(halfCos, halfSin, quat);
+        }
+
+        /** matrix is 9 reals, row major, the rotation of Matrix3::fromEuler.
+            cosines and sines are the ones of the angles, x, y, z. */
+        template <RotationOrder ORDER, typename real>
+        inline void matrix3FromSinCos(const real* cosines, const real* sines, real* matrix)
+        {
+            typedef EulerAxes<ORDER> A;
+            const int I = A::FIRST, J = A::SECOND, K = A::THIRD;
+            const real parity = real(A::PARITY);
+
+            real ca = cosines[I], sa = parity * sines[I];
+            real cb = cosines[J], sb = parity * sines[J];
+            real cc = cosines[K], sc = parity * sines[K];
+
+            matrix[I*3+I] = cb*cc;
+            matrix[I*3+J] = cb*sc;
+            matrix[I*3+K] = -sb;
+            matrix[J*3+I] = sa*sb*cc - ca*sc;
+            matrix[J*3+J] = sa*sb*sc + ca*cc;
+            matrix[J*3+K] = sa*cb;
+            matrix[K*3+I] = ca*sb*cc + sa*sc;
+            matrix[K*3+J] = ca*sb*sc - sa*cc;
+            matrix[K*3+K] = ca*cb;
+        }
+
+        template <RotationOrder ORDER, typename real>
+        inline void eulerToMatrix3(const real* angles, real* matrix)
+        {
+            real cosines[3], sines[3];
+            for (int i=0; i<3; i++)
+            {
+                cosines[i] = cos(angles[i]);
+                sines[i] = sin(angles[i]);
+            }
+            matrix3FromSinCos<ORDER>(cosines, sines, matrix);
+        }
+
+        /** The rotation part of a row major matrix, STRIDE is 3 for a Matrix3 and 4 for a Matrix4. */
+        template <typename real, int STRIDE>
+        struct MatrixRotation
+        {
+            const real* m;
+            real operator() (int row, int col) const { return m[row*STRIDE+col]; }
+        };
+
+        /** The elements of Quaternion::toMatrix3, computed only when needed. */
+        template <typename real>
+        struct QuaternionRotation
+        {
+            const real* q;
+            real operator() (int row, int col) const
+            {
+                if (row == col)
+                {
+                    int a = (row+1) % 3, b = (row+2) % 3;
+                    return real(1.0) - real(2.0)*q[a]*q[a] - real(2.0)*q[b]*q[b];
+                }
+                int other = 3 - row - col;
+                real sign = (col - row + 3) % 3 == 1 ? real(1.0) : real(-1.0);
+                return real(2.0)*q[row]*q[col] + sign*real(2.0)*q[other]*q[3];
+            }
+        };
+
+        /** The arguments of the atan2 giving the Euler angles of ORDER of a rotation, m(row, col) gives
+            its elements: angle[i] = PARITY * atan2(y[i], x[i]), x, y, z.
+            In gimbal lock (SECOND at +-90 degrees) the angle of THIRD is 0. */
+        template <RotationOrder ORDER, typename real, typename Rotation>
+        inline void eulerAtan2Arguments(const Rotation& m, real* y, real* x)
+        {
+            typedef EulerAxes<ORDER> A;
+            const int I = A::FIRST, J = A::SECOND, K = A::THIRD;
+
+            real cosine = sqrt(m(I, I)*m(I, I) + m(I, J)*m(I, J));
+            y[J] = -m(I, K);
+            x[J] = cosine;
+            if (cosine > real(16.0) * std::numeric_limits<real>::epsilon())
+            {
+                y[I] = m(J, K);
+                x[I] = m(K, K);
+                y[K] = m(I, J);
+                x[K] = m(I, I);
+            }
+            else
+            {
+                y[I] = -m(K, J);
+                x[I] = m(J, J);
+                y[K] = real(0.0);
+                x[K] = real(1.0);
+            }
+        }
+
+        template <RotationOrder ORDER, typename real, typename Rotation>
+        inline void eulerFromRotation(const Rotation& m, real* angles)
+        {
+            const real parity = real(EulerAxes<ORDER>::PARITY);
+
+            real y[3], x[3];
+            eulerAtan2Arguments<ORDER>(m, y, x);
+            for (int i=0; i<3; i++)
+                angles[i] = parity * atan2(y[i], x[i]);
+        }
+    }
+#endif
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_EULER_END
+    #include "gmInline.h"
+#endif
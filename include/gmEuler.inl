@@ -0,0 +1,218 @@
+namespace gmath {
+
+    /*------ Constructors ------*/
+
+    template <typename real>
+    GMATH_INLINE EulerT<real>::EulerT(Unit inUnit)
+    {
+        x=0.0;
+        y=0.0;
+        z=0.0;
+
+        unit = inUnit;
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real>::EulerT(const EulerT<real>& other)
+    {
+        memcpy(&x, &other.x, 3*sizeof(real));
+        unit = other.unit;
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE EulerT<real>::EulerT(const EulerT<otherReal>& other)
+        : x(real(other.x)), y(real(other.y)), z(real(other.z)), unit(other.getUnit())
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real>::EulerT(const real inX, const real inY, const real inZ, Unit inUnit)
+    {
+        x = inX; y = inY; z = inZ;
+        unit = inUnit;
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real>::EulerT(const Vector3T<real>& vec, Unit inUnit)
+    {
+        memcpy(&x, vec.data(), 3*sizeof(real));
+        unit = inUnit;
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real>::EulerT(const real* values, Unit inUnit)
+    {
+        x = values[0];
+        y = values[1];
+        z = values[2];
+
+        unit = inUnit;
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real>::EulerT(const std::vector<real>& values, Unit inUnit)
+    {
+        x = values[0];
+        y = values[1];
+        z = values[2];
+
+        unit = inUnit;
+    }
+
+    /*------ Data access ------*/
+
+    template <typename real>
+    GMATH_INLINE real* EulerT<real>::data()
+    {
+        return &x;
+    }
+
+    template <typename real>
+    GMATH_INLINE const real* EulerT<real>::data() const
+    {
+        return &x;
+    }
+    
+    /*------ Coordinate access ------*/
+
+    template <typename real>
+    GMATH_INLINE real EulerT<real>::operator[] (int i) const
+    {
+        if (i>2) {
+            throw out_of_range("gEuler:\n\t index out of range");
+        }
+        return *(&x+i);
+    }
+
+    template <typename real>
+    GMATH_INLINE real& EulerT<real>::operator[] (int i)
+    {
+        if (i>2) {
+            throw out_of_range("gEuler:\n\t index out of range");
+        }
+        return *(&x+i);
+    }
+
+    /*------ Comparisons ------*/
+
+    template <typename real>
+    GMATH_INLINE bool EulerT<real>::operator == (const EulerT<real> &other) const
+    {
+        return (
+            fabs(x-other.x)<EPSILON &&
+            fabs(y-other.y)<EPSILON &&
+            fabs(z-other.z)<EPSILON );
+    }
+
+    template <typename real>
+    GMATH_INLINE bool EulerT<real>::operator != (const EulerT<real> &other) const
+    {
+        return (
+            fabs(x-other.x)>EPSILON ||
+            fabs(y-other.y)>EPSILON ||
+            fabs(z-other.z)>EPSILON );
+    }
+
+    /*------ Methods ------*/
+
+    template <typename real>
+    GMATH_INLINE void EulerT<real>::set(const real inX, const real inY, const real inZ)
+    {
+        x=inX; y=inY; z=inZ;
+    }
+
+    template <typename real>
+    GMATH_INLINE void EulerT<real>::set(const real* values)
+    {
+        x=values[0]; y=values[1]; z=values[2];
+    }
+
+    template <typename real>
+    GMATH_INLINE void EulerT<real>::set(const std::vector<real>& values)
+    {
+        x=values[0]; y=values[1]; z=values[2];
+    }
+
+    template <typename real>
+    GMATH_INLINE Unit EulerT<real>::getUnit() const
+    {
+        return unit;
+    }
+
+    template <typename real>
+    GMATH_INLINE void EulerT<real>::setUnit(Unit inUnit)
+    {
+        if (unit!=inUnit)
+        {
+            unit = inUnit;
+            if (inUnit==Unit::degrees)
+            {
+                x = gmath::toDegrees(x);
+                y = gmath::toDegrees(y);
+                z = gmath::toDegrees(z);
+            }
+            else
+            {
+                x = gmath::toRadians(x);
+                y = gmath::toRadians(y);
+                z = gmath::toRadians(z);
+            }
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real> EulerT<real>::toDegrees() const
+    {
+        if (unit==Unit::degrees)
+        {
+            return EulerT<real>( (*this) );
+        }
+        else
+        {
+           return EulerT<real>(
+                gmath::toDegrees(x),
+                gmath::toDegrees(y),
+                gmath::toDegrees(z),
+                Unit::degrees
+                );
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real> EulerT<real>::toRadians() const
+    {
+        if (unit==Unit::radians)
+        {
+            return EulerT<real>( (*this) );
+        }
+        else
+        {
+            return EulerT<real>(
+                gmath::toRadians(x),
+                gmath::toRadians(y),
+                gmath::toRadians(z),
+                Unit::radians
+                );
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> EulerT<real>::toVector() const
+    {
+        return Vector3T<real>(x, y, z);
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string EulerT<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Euler(" << x << ", " << y << ", " << z << ");";
+        if (unit==Unit::degrees)
+            oss << " - degrees -";
+        else
+            oss << " - radians -"; 
+
+        return oss.str();
+    }
+}
\ No newline at end of file
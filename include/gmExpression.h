@@ -0,0 +1,636 @@
+#pragma once
+
+#include "gmRoot.h"
+#include "gmVector3.h"
+#include "gmVector4.h"
+#include "gmMatrix4.h"
+#include "gmQuaternion.h"
+
+namespace gmath
+{
+    /*  Expression templates for Vector3T, Vector4T and QuaternionT, an opt-in layer over their operators.
+
+        A chain of operators like a + q.rotateVector(b * c) makes a temporary at every step, and in the
+        library build every operator and every copy is a call. Here the operators on expressions only
+        build a small tree of types, evaluated in one go by eval or assign: the whole chain is inlined,
+        the intermediate values stay in registers. With GMATH_HEADER_ONLY the compiler can inline the
+        operators as well, the expressions matter most for the library build.
+
+            using namespace gmath::expr;
+            Vector3 tr = eval(lazy(parent.tr) + rotate(parent.ori, lazy(local.tr) * parent.sc));
+            assign(out, lazy(p1) * t + lazy(p0) * (1.0 - t));
+
+        lazy wraps a value into an expression; once one side of an operator is an expression the other
+        can be a plain value. Every node repeats the operations of the matching operator or method, in the
+        same order, so the results are the same: + - * / (NaN for a division by zero), unary -, cross, dot,
+        Vector3 * Matrix4, QuaternionT * QuaternionT, conjugate and rotate (QuaternionT::rotateVector).
+
+        The leaves keep references to the values and the matrices, an expression must be evaluated in the
+        statement that builds it: keep a value, not an expression, in an auto variable.
+        assign evaluates the whole expression before writing, so out can be one of its operands, and it
+        writes the components directly, without any call into the library build. */
+
+    namespace expr
+    {
+        /*------ Bases ------*/
+        // An expression E derives from the base of its type and defines evaluate, writing all its components.
+
+        template <typename real, typename E>
+        struct Vector3Expression
+        {
+            const E& self() const { return static_cast<const E&>(*this); }
+        };
+
+        template <typename real, typename E>
+        struct Vector4Expression
+        {
+            const E& self() const { return static_cast<const E&>(*this); }
+        };
+
+        template <typename real, typename E>
+        struct QuaternionExpression
+        {
+            const E& self() const { return static_cast<const E&>(*this); }
+        };
+
+        /*------ Leaves ------*/
+
+        template <typename real>
+        class Vector3Ref : public Vector3Expression<real, Vector3Ref<real> >
+        {
+            const Vector3T<real>& v;
+        public:
+            explicit Vector3Ref(const Vector3T<real>& v) : v(v) {}
+            void evaluate(real& x, real& y, real& z) const { x = v.x; y = v.y; z = v.z; }
+        };
+
+        template <typename real>
+        class Vector4Ref : public Vector4Expression<real, Vector4Ref<real> >
+        {
+            const Vector4T<real>& v;
+        public:
+            explicit Vector4Ref(const Vector4T<real>& v) : v(v) {}
+            void evaluate(real& x, real& y, real& z, real& w) const { x = v.x; y = v.y; z = v.z; w = v.w; }
+        };
+
+        template <typename real>
+        class QuaternionRef : public QuaternionExpression<real, QuaternionRef<real> >
+        {
+            const QuaternionT<real>& q;
+        public:
+            explicit QuaternionRef(const QuaternionT<real>& q) : q(q) {}
+            void evaluate(real& x, real& y, real& z, real& w) const { x = q.x; y = q.y; z = q.z; w = q.w; }
+        };
+
+        template <typename real>
+        inline Vector3Ref<real> lazy(const Vector3T<real>& v) { return Vector3Ref<real>(v); }
+        template <typename real>
+        inline Vector4Ref<real> lazy(const Vector4T<real>& v) { return Vector4Ref<real>(v); }
+        template <typename real>
+        inline QuaternionRef<real> lazy(const QuaternionT<real>& q) { return QuaternionRef<real>(q); }
+        // a temporary would be gone before the expression is evaluated: lazy(a + b) doesn't compile
+        template <typename real>
+        void lazy(const Vector3T<real>&& v) = delete;
+        template <typename real>
+        void lazy(const Vector4T<real>&& v) = delete;
+        template <typename real>
+        void lazy(const QuaternionT<real>&& q) = delete;
+
+        // the scalar of an operator takes the type of the expression, lazy(aVector3f) * 2.0 works like aVector3f * 2.0
+        template <typename real>
+        struct Scalar { typedef real type; };
+
+        /*------ Component operations ------*/
+
+        struct Add      { template <typename real> static real apply(real a, real b) { return a + b; } };
+        struct Subtract { template <typename real> static real apply(real a, real b) { return a - b; } };
+        struct Multiply { template <typename real> static real apply(real a, real b) { return a * b; } };
+
+        /*------ Vector3 nodes ------*/
+
+        template <typename real, typename A, typename B, typename OP>
+        class Vector3Binary : public Vector3Expression<real, Vector3Binary<real, A, B, OP> >
+        {
+            A a;
+            B b;
+        public:
+            Vector3Binary(const A& a, const B& b) : a(a), b(b) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                real ax, ay, az, bx, by, bz;
+                a.evaluate(ax, ay, az);
+                b.evaluate(bx, by, bz);
+                x = OP::apply(ax, bx);
+                y = OP::apply(ay, by);
+                z = OP::apply(az, bz);
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector3Scale : public Vector3Expression<real, Vector3Scale<real, A> >
+        {
+            A a;
+            real s;
+        public:
+            Vector3Scale(const A& a, real s) : a(a), s(s) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                a.evaluate(x, y, z);
+                x *= s;
+                y *= s;
+                z *= s;
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector3Divide : public Vector3Expression<real, Vector3Divide<real, A> >
+        {
+            A a;
+            real s;
+        public:
+            Vector3Divide(const A& a, real s) : a(a), s(s) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                a.evaluate(x, y, z);
+                if (s == 0.0)
+                    x = y = z = NAN;
+                else
+                {
+                    x /= s;
+                    y /= s;
+                    z /= s;
+                }
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector3Negate : public Vector3Expression<real, Vector3Negate<real, A> >
+        {
+            A a;
+        public:
+            explicit Vector3Negate(const A& a) : a(a) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                a.evaluate(x, y, z);
+                x = -x;
+                y = -y;
+                z = -z;
+            }
+        };
+
+        template <typename real, typename A, typename B>
+        class Vector3Cross : public Vector3Expression<real, Vector3Cross<real, A, B> >
+        {
+            A a;
+            B b;
+        public:
+            Vector3Cross(const A& a, const B& b) : a(a), b(b) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                real ax, ay, az, bx, by, bz;
+                a.evaluate(ax, ay, az);
+                b.evaluate(bx, by, bz);
+                x = ay*bz - az*by;
+                y = az*bx - ax*bz;
+                z = ax*by - ay*bx;
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector3Transform : public Vector3Expression<real, Vector3Transform<real, A> >
+        {
+            A a;
+            const Matrix4T<real>& mat;
+        public:
+            Vector3Transform(const A& a, const Matrix4T<real>& mat) : a(a), mat(mat) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                real px, py, pz;
+                a.evaluate(px, py, pz);
+                const real* m = mat.data();
+                x = m[0] * px + m[4] * py + m[8]  * pz + m[12];
+                y = m[1] * px + m[5] * py + m[9]  * pz + m[13];
+                z = m[2] * px + m[6] * py + m[10] * pz + m[14];
+            }
+        };
+
+        template <typename real, typename Q, typename V>
+        class Vector3Rotate : public Vector3Expression<real, Vector3Rotate<real, Q, V> >
+        {
+            Q q;
+            V v;
+        public:
+            Vector3Rotate(const Q& q, const V& v) : q(q), v(v) {}
+            void evaluate(real& x, real& y, real& z) const
+            {
+                real qx, qy, qz, qw, vx, vy, vz;
+                q.evaluate(qx, qy, qz, qw);
+                v.evaluate(vx, vy, vz);
+                real tx = qy*vz - qz*vy;
+                real ty = qz*vx - qx*vz;
+                real tz = qx*vy - qy*vx;
+                tx += tx;
+                ty += ty;
+                tz += tz;
+                x = (vx + qw*tx) + (qy*tz - qz*ty);
+                y = (vy + qw*ty) + (qz*tx - qx*tz);
+                z = (vz + qw*tz) + (qx*ty - qy*tx);
+            }
+        };
+
+        /*------ Vector4 nodes ------*/
+
+        template <typename real, typename A, typename B, typename OP>
+        class Vector4Binary : public Vector4Expression<real, Vector4Binary<real, A, B, OP> >
+        {
+            A a;
+            B b;
+        public:
+            Vector4Binary(const A& a, const B& b) : a(a), b(b) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                real ax, ay, az, aw, bx, by, bz, bw;
+                a.evaluate(ax, ay, az, aw);
+                b.evaluate(bx, by, bz, bw);
+                x = OP::apply(ax, bx);
+                y = OP::apply(ay, by);
+                z = OP::apply(az, bz);
+                w = OP::apply(aw, bw);
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector4Scale : public Vector4Expression<real, Vector4Scale<real, A> >
+        {
+            A a;
+            real s;
+        public:
+            Vector4Scale(const A& a, real s) : a(a), s(s) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                a.evaluate(x, y, z, w);
+                x *= s;
+                y *= s;
+                z *= s;
+                w *= s;
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector4Divide : public Vector4Expression<real, Vector4Divide<real, A> >
+        {
+            A a;
+            real s;
+        public:
+            Vector4Divide(const A& a, real s) : a(a), s(s) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                a.evaluate(x, y, z, w);
+                if (s == 0.0)
+                    x = y = z = w = NAN;
+                else
+                {
+                    x /= s;
+                    y /= s;
+                    z /= s;
+                    w /= s;
+                }
+            }
+        };
+
+        template <typename real, typename A>
+        class Vector4Negate : public Vector4Expression<real, Vector4Negate<real, A> >
+        {
+            A a;
+        public:
+            explicit Vector4Negate(const A& a) : a(a) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                a.evaluate(x, y, z, w);
+                x = -x;
+                y = -y;
+                z = -z;
+                w = -w;
+            }
+        };
+
+        /*------ Quaternion nodes ------*/
+
+        template <typename real, typename A, typename B, typename OP>
+        class QuaternionBinary : public QuaternionExpression<real, QuaternionBinary<real, A, B, OP> >
+        {
+            A a;
+            B b;
+        public:
+            QuaternionBinary(const A& a, const B& b) : a(a), b(b) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                real ax, ay, az, aw, bx, by, bz, bw;
+                a.evaluate(ax, ay, az, aw);
+                b.evaluate(bx, by, bz, bw);
+                x = OP::apply(ax, bx);
+                y = OP::apply(ay, by);
+                z = OP::apply(az, bz);
+                w = OP::apply(aw, bw);
+            }
+        };
+
+        // QuaternionT::operator *: the vector part is cross(b, a) + b * a.w + a * b.w
+        template <typename real, typename A, typename B>
+        class QuaternionProduct : public QuaternionExpression<real, QuaternionProduct<real, A, B> >
+        {
+            A a;
+            B b;
+        public:
+            QuaternionProduct(const A& a, const B& b) : a(a), b(b) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                real ax, ay, az, aw, bx, by, bz, bw;
+                a.evaluate(ax, ay, az, aw);
+                b.evaluate(bx, by, bz, bw);
+                x = (by*az - bz*ay) + bx*aw + ax*bw;
+                y = (bz*ax - bx*az) + by*aw + ay*bw;
+                z = (bx*ay - by*ax) + bz*aw + az*bw;
+                w = aw*bw - (bx*ax + by*ay + bz*az);
+            }
+        };
+
+        template <typename real, typename A>
+        class QuaternionScale : public QuaternionExpression<real, QuaternionScale<real, A> >
+        {
+            A a;
+            real s;
+        public:
+            QuaternionScale(const A& a, real s) : a(a), s(s) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                a.evaluate(x, y, z, w);
+                x *= s;
+                y *= s;
+                z *= s;
+                w *= s;
+            }
+        };
+
+        template <typename real, typename A>
+        class QuaternionNegate : public QuaternionExpression<real, QuaternionNegate<real, A> >
+        {
+            A a;
+        public:
+            explicit QuaternionNegate(const A& a) : a(a) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                a.evaluate(x, y, z, w);
+                x = -x;
+                y = -y;
+                z = -z;
+                w = -w;
+            }
+        };
+
+        template <typename real, typename A>
+        class QuaternionConjugate : public QuaternionExpression<real, QuaternionConjugate<real, A> >
+        {
+            A a;
+        public:
+            explicit QuaternionConjugate(const A& a) : a(a) {}
+            void evaluate(real& x, real& y, real& z, real& w) const
+            {
+                a.evaluate(x, y, z, w);
+                x = -x;
+                y = -y;
+                z = -z;
+            }
+        };
+
+        /*------ Vector3 operators ------*/
+
+        template <typename real, typename A, typename B>
+        inline Vector3Binary<real, A, B, Add> operator + (const Vector3Expression<real, A>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Binary<real, A, B, Add>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline Vector3Binary<real, A, Vector3Ref<real>, Add> operator + (const Vector3Expression<real, A>& a, const Vector3T<real>& b)
+        { return Vector3Binary<real, A, Vector3Ref<real>, Add>(a.self(), Vector3Ref<real>(b)); }
+        template <typename real, typename B>
+        inline Vector3Binary<real, Vector3Ref<real>, B, Add> operator + (const Vector3T<real>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Binary<real, Vector3Ref<real>, B, Add>(Vector3Ref<real>(a), b.self()); }
+
+        template <typename real, typename A, typename B>
+        inline Vector3Binary<real, A, B, Subtract> operator - (const Vector3Expression<real, A>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Binary<real, A, B, Subtract>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline Vector3Binary<real, A, Vector3Ref<real>, Subtract> operator - (const Vector3Expression<real, A>& a, const Vector3T<real>& b)
+        { return Vector3Binary<real, A, Vector3Ref<real>, Subtract>(a.self(), Vector3Ref<real>(b)); }
+        template <typename real, typename B>
+        inline Vector3Binary<real, Vector3Ref<real>, B, Subtract> operator - (const Vector3T<real>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Binary<real, Vector3Ref<real>, B, Subtract>(Vector3Ref<real>(a), b.self()); }
+
+        /** Component by component, like Vector3T * Vector3T. */
+        template <typename real, typename A, typename B>
+        inline Vector3Binary<real, A, B, Multiply> operator * (const Vector3Expression<real, A>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Binary<real, A, B, Multiply>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline Vector3Binary<real, A, Vector3Ref<real>, Multiply> operator * (const Vector3Expression<real, A>& a, const Vector3T<real>& b)
+        { return Vector3Binary<real, A, Vector3Ref<real>, Multiply>(a.self(), Vector3Ref<real>(b)); }
+        template <typename real, typename B>
+        inline Vector3Binary<real, Vector3Ref<real>, B, Multiply> operator * (const Vector3T<real>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Binary<real, Vector3Ref<real>, B, Multiply>(Vector3Ref<real>(a), b.self()); }
+
+        template <typename real, typename A>
+        inline Vector3Scale<real, A> operator * (const Vector3Expression<real, A>& a, typename Scalar<real>::type s)
+        { return Vector3Scale<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline Vector3Scale<real, A> operator * (typename Scalar<real>::type s, const Vector3Expression<real, A>& a)
+        { return Vector3Scale<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline Vector3Divide<real, A> operator / (const Vector3Expression<real, A>& a, typename Scalar<real>::type s)
+        { return Vector3Divide<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline Vector3Negate<real, A> operator - (const Vector3Expression<real, A>& a)
+        { return Vector3Negate<real, A>(a.self()); }
+
+        /** Like Vector3T * Matrix4T, a point: with the translation. */
+        template <typename real, typename A>
+        inline Vector3Transform<real, A> operator * (const Vector3Expression<real, A>& a, const Matrix4T<real>& mat)
+        { return Vector3Transform<real, A>(a.self(), mat); }
+
+        template <typename real, typename A, typename B>
+        inline Vector3Cross<real, A, B> cross(const Vector3Expression<real, A>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Cross<real, A, B>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline Vector3Cross<real, A, Vector3Ref<real> > cross(const Vector3Expression<real, A>& a, const Vector3T<real>& b)
+        { return Vector3Cross<real, A, Vector3Ref<real> >(a.self(), Vector3Ref<real>(b)); }
+        template <typename real, typename B>
+        inline Vector3Cross<real, Vector3Ref<real>, B> cross(const Vector3T<real>& a, const Vector3Expression<real, B>& b)
+        { return Vector3Cross<real, Vector3Ref<real>, B>(Vector3Ref<real>(a), b.self()); }
+
+        /** Evaluated at once, a number is not an expression. */
+        template <typename real, typename A, typename B>
+        inline real dot(const Vector3Expression<real, A>& a, const Vector3Expression<real, B>& b)
+        {
+            real ax, ay, az, bx, by, bz;
+            a.self().evaluate(ax, ay, az);
+            b.self().evaluate(bx, by, bz);
+            return ax*bx + ay*by + az*bz;
+        }
+        template <typename real, typename A>
+        inline real dot(const Vector3Expression<real, A>& a, const Vector3T<real>& b)
+        { return dot(a, Vector3Ref<real>(b)); }
+        template <typename real, typename B>
+        inline real dot(const Vector3T<real>& a, const Vector3Expression<real, B>& b)
+        { return dot(Vector3Ref<real>(a), b); }
+
+        /** q.rotateVector(v), q must be normalized. */
+        template <typename real, typename Q, typename V>
+        inline Vector3Rotate<real, Q, V> rotate(const QuaternionExpression<real, Q>& q, const Vector3Expression<real, V>& v)
+        { return Vector3Rotate<real, Q, V>(q.self(), v.self()); }
+        template <typename real, typename V>
+        inline Vector3Rotate<real, QuaternionRef<real>, V> rotate(const QuaternionT<real>& q, const Vector3Expression<real, V>& v)
+        { return Vector3Rotate<real, QuaternionRef<real>, V>(QuaternionRef<real>(q), v.self()); }
+        template <typename real, typename Q>
+        inline Vector3Rotate<real, Q, Vector3Ref<real> > rotate(const QuaternionExpression<real, Q>& q, const Vector3T<real>& v)
+        { return Vector3Rotate<real, Q, Vector3Ref<real> >(q.self(), Vector3Ref<real>(v)); }
+
+        /*------ Vector4 operators ------*/
+
+        template <typename real, typename A, typename B>
+        inline Vector4Binary<real, A, B, Add> operator + (const Vector4Expression<real, A>& a, const Vector4Expression<real, B>& b)
+        { return Vector4Binary<real, A, B, Add>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline Vector4Binary<real, A, Vector4Ref<real>, Add> operator + (const Vector4Expression<real, A>& a, const Vector4T<real>& b)
+        { return Vector4Binary<real, A, Vector4Ref<real>, Add>(a.self(), Vector4Ref<real>(b)); }
+        template <typename real, typename B>
+        inline Vector4Binary<real, Vector4Ref<real>, B, Add> operator + (const Vector4T<real>& a, const Vector4Expression<real, B>& b)
+        { return Vector4Binary<real, Vector4Ref<real>, B, Add>(Vector4Ref<real>(a), b.self()); }
+
+        template <typename real, typename A, typename B>
+        inline Vector4Binary<real, A, B, Subtract> operator - (const Vector4Expression<real, A>& a, const Vector4Expression<real, B>& b)
+        { return Vector4Binary<real, A, B, Subtract>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline Vector4Binary<real, A, Vector4Ref<real>, Subtract> operator - (const Vector4Expression<real, A>& a, const Vector4T<real>& b)
+        { return Vector4Binary<real, A, Vector4Ref<real>, Subtract>(a.self(), Vector4Ref<real>(b)); }
+        template <typename real, typename B>
+        inline Vector4Binary<real, Vector4Ref<real>, B, Subtract> operator - (const Vector4T<real>& a, const Vector4Expression<real, B>& b)
+        { return Vector4Binary<real, Vector4Ref<real>, B, Subtract>(Vector4Ref<real>(a), b.self()); }
+
+        template <typename real, typename A>
+        inline Vector4Scale<real, A> operator * (const Vector4Expression<real, A>& a, typename Scalar<real>::type s)
+        { return Vector4Scale<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline Vector4Scale<real, A> operator * (typename Scalar<real>::type s, const Vector4Expression<real, A>& a)
+        { return Vector4Scale<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline Vector4Divide<real, A> operator / (const Vector4Expression<real, A>& a, typename Scalar<real>::type s)
+        { return Vector4Divide<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline Vector4Negate<real, A> operator - (const Vector4Expression<real, A>& a)
+        { return Vector4Negate<real, A>(a.self()); }
+
+        /*------ Quaternion operators ------*/
+
+        template <typename real, typename A, typename B>
+        inline QuaternionBinary<real, A, B, Add> operator + (const QuaternionExpression<real, A>& a, const QuaternionExpression<real, B>& b)
+        { return QuaternionBinary<real, A, B, Add>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline QuaternionBinary<real, A, QuaternionRef<real>, Add> operator + (const QuaternionExpression<real, A>& a, const QuaternionT<real>& b)
+        { return QuaternionBinary<real, A, QuaternionRef<real>, Add>(a.self(), QuaternionRef<real>(b)); }
+        template <typename real, typename B>
+        inline QuaternionBinary<real, QuaternionRef<real>, B, Add> operator + (const QuaternionT<real>& a, const QuaternionExpression<real, B>& b)
+        { return QuaternionBinary<real, QuaternionRef<real>, B, Add>(QuaternionRef<real>(a), b.self()); }
+
+        template <typename real, typename A, typename B>
+        inline QuaternionBinary<real, A, B, Subtract> operator - (const QuaternionExpression<real, A>& a, const QuaternionExpression<real, B>& b)
+        { return QuaternionBinary<real, A, B, Subtract>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline QuaternionBinary<real, A, QuaternionRef<real>, Subtract> operator - (const QuaternionExpression<real, A>& a, const QuaternionT<real>& b)
+        { return QuaternionBinary<real, A, QuaternionRef<real>, Subtract>(a.self(), QuaternionRef<real>(b)); }
+        template <typename real, typename B>
+        inline QuaternionBinary<real, QuaternionRef<real>, B, Subtract> operator - (const QuaternionT<real>& a, const QuaternionExpression<real, B>& b)
+        { return QuaternionBinary<real, QuaternionRef<real>, B, Subtract>(QuaternionRef<real>(a), b.self()); }
+
+        /** The product of QuaternionT::operator *. */
+        template <typename real, typename A, typename B>
+        inline QuaternionProduct<real, A, B> operator * (const QuaternionExpression<real, A>& a, const QuaternionExpression<real, B>& b)
+        { return QuaternionProduct<real, A, B>(a.self(), b.self()); }
+        template <typename real, typename A>
+        inline QuaternionProduct<real, A, QuaternionRef<real> > operator * (const QuaternionExpression<real, A>& a, const QuaternionT<real>& b)
+        { return QuaternionProduct<real, A, QuaternionRef<real> >(a.self(), QuaternionRef<real>(b)); }
+        template <typename real, typename B>
+        inline QuaternionProduct<real, QuaternionRef<real>, B> operator * (const QuaternionT<real>& a, const QuaternionExpression<real, B>& b)
+        { return QuaternionProduct<real, QuaternionRef<real>, B>(QuaternionRef<real>(a), b.self()); }
+
+        template <typename real, typename A>
+        inline QuaternionScale<real, A> operator * (const QuaternionExpression<real, A>& a, typename Scalar<real>::type s)
+        { return QuaternionScale<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline QuaternionScale<real, A> operator * (typename Scalar<real>::type s, const QuaternionExpression<real, A>& a)
+        { return QuaternionScale<real, A>(a.self(), s); }
+        template <typename real, typename A>
+        inline QuaternionNegate<real, A> operator - (const QuaternionExpression<real, A>& a)
+        { return QuaternionNegate<real, A>(a.self()); }
+        template <typename real, typename A>
+        inline QuaternionConjugate<real, A> conjugate(const QuaternionExpression<real, A>& a)
+        { return QuaternionConjugate<real, A>(a.self()); }
+
+        /*------ Evaluation ------*/
+
+        template <typename real, typename E>
+        inline Vector3T<real> eval(const Vector3Expression<real, E>& e)
+        {
+            real x, y, z;
+            e.self().evaluate(x, y, z);
+            return Vector3T<real>(x, y, z);
+        }
+
+        template <typename real, typename E>
+        inline Vector4T<real> eval(const Vector4Expression<real, E>& e)
+        {
+            real x, y, z, w;
+            e.self().evaluate(x, y, z, w);
+            return Vector4T<real>(x, y, z, w);
+        }
+
+        template <typename real, typename E>
+        inline QuaternionT<real> eval(const QuaternionExpression<real, E>& e)
+        {
+            real x, y, z, w;
+            e.self().evaluate(x, y, z, w);
+            return QuaternionT<real>(x, y, z, w);
+        }
+
+        template <typename real, typename E>
+        inline Vector3T<real>& assign(Vector3T<real>& out, const Vector3Expression<real, E>& e)
+        {
+            real x, y, z;
+            e.self().evaluate(x, y, z);
+            out.x = x;
+            out.y = y;
+            out.z = z;
+            return out;
+        }
+
+        template <typename real, typename E>
+        inline Vector4T<real>& assign(Vector4T<real>& out, const Vector4Expression<real, E>& e)
+        {
+            real x, y, z, w;
+            e.self().evaluate(x, y, z, w);
+            out.x = x;
+            out.y = y;
+            out.z = z;
+            out.w = w;
+            return out;
+        }
+
+        template <typename real, typename E>
+        inline QuaternionT<real>& assign(QuaternionT<real>& out, const QuaternionExpression<real, E>& e)
+        {
+            real x, y, z, w;
+            e.self().evaluate(x, y, z, w);
+            out.x = x;
+            out.y = y;
+            out.z = z;
+            out.w = w;
+            return out;
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#define GMATH_FRUSTUM_BEGIN
+
+#include <string>
+#include <vector>
+#include "gmRoot.h"
+#include "gmParallel.h"
+#include "gmVector3.h"
+#include "gmVector4.h"
+#include "gmMatrix4.h"
+#include "gmBounds.h"
+
+namespace gmath
+{
+    /**
+    The volume seen through a projection, 6 planes with their normals pointing inside.
+
+    fromMatrix4 extracts the planes of a view projection matrix, the camera inverse times a projection
+    of Matrix4::setPerspective or Matrix4::setOrthographic (Gribb and Hartmann): the points p with
+    (p.x, p.y, p.z, 1) * mat in the clip volume -w <= x, y, z <= w.
+    The batch functions cull arrays of spheres or boxes to a bit mask on the simd kernels and the
+    gmath::parallel threads, bit i%8 of visible[i/8] for object i, (count+7)/8 bytes.
+    The tests of spheres and boxes are conservative: an object near a corner of the frustum, outside
+    of it but not on the outer side of a single plane, is visible.
+    */
+    class Frustum
+    {
+    public:
+        /*------ properties ------*/
+        /** Left, right, bottom, top, near and far: the unit normal in x, y, z and the distance in w, a point p
+            is on the inner side of a plane when plane.x*p.x + plane.y*p.y + plane.z*p.z + plane.w >= 0. */
+        Vector4 planes[6];
+
+        /** Objects per chunk of work given to a thread by the batch functions, a multiple of 8. */
+        static const size_t PARALLEL_GRAIN = 16384;
+
+        /*------ constructors ------*/
+        /** A frustum without planes (all zero), everything is visible. */
+        Frustum();
+        explicit Frustum(const Matrix4& viewProjection);
+
+        /*------ comparisons ------*/
+        bool operator == (const Frustum& other) const;
+        bool operator != (const Frustum& other) const;
+
+        /*------ methods ------*/
+        void fromMatrix4(const Matrix4& viewProjection);
+
+        bool contains(const Vector3& point) const;
+        bool overlapsSphere(const Vector3& center, double radius) const;
+        /** False for an empty box. */
+        bool overlaps(const AABB& box) const;
+
+        /** Cull count spheres of centers x, y, z triplets and radii, returns the number of visible ones. */
+        size_t cullSpheres(const double* centers, const double* radii, size_t count, unsigned char* visible) const;
+        /** As above, visible is resized to the number of bytes of the mask. */
+        size_t cullSpheres(const std::vector<Vector3>& centers, const std::vector<double>& radii,
+                           std::vector<unsigned char>& visible) const;
+
+        /** Cull count boxes, the same bits as overlaps, returns the number of visible ones. */
+        size_t cullBoxes(const AABB* boxes, size_t count, unsigned char* visible) const;
+        size_t cullBoxes(const std::vector<AABB>& boxes, std::vector<unsigned char>& visible) const;
+
+        std::string toString() const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_FRUSTUM_END
+    #include "gmInline.h"
+#endif
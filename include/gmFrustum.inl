@@ -0,0 +1,148 @@
+namespace gmath
+{
+    namespace detail
+    {
+        // Fixed blocks of Frustum::PARALLEL_GRAIN objects, each one writes its own bytes of the mask.
+        // cull(first, count) culls count objects from first and returns the number of visible ones.
+        template <typename Cull>
+        GMATH_INLINE size_t cullBlocks(size_t count, const Cull& cull)
+        {
+            const size_t grain = Frustum::PARALLEL_GRAIN;
+            size_t blockCount = (count + grain - 1) / grain;
+            if (blockCount == 0)
+                return 0;
+            if (blockCount == 1)
+                return cull(0, count);
+
+            std::vector<size_t> inside(blockCount);
+            parallel::parallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+                for (size_t b=begin; b<end; b++)
+                {
+                    size_t first = b*grain;
+                    inside[b] = cull(first, count-first < grain ? count-first : grain);
+                }
+            });
+            size_t total = 0;
+            for (size_t b=0; b<blockCount; b++)
+                total += inside[b];
+            return total;
+        }
+    }
+
+    /*------ constructors ------*/
+
+    GMATH_INLINE Frustum::Frustum()
+    {
+        for (int k=0; k<6; k++)
+            planes[k] = Vector4(0.0, 0.0, 0.0, 0.0);
+    }
+
+    GMATH_INLINE Frustum::Frustum(const Matrix4& viewProjection)
+    {
+        fromMatrix4(viewProjection);
+    }
+
+    /*------ comparisons ------*/
+
+    GMATH_INLINE bool Frustum::operator == (const Frustum& other) const
+    {
+        for (int k=0; k<6; k++)
+        {
+            if (planes[k] != other.planes[k])
+                return false;
+        }
+        return true;
+    }
+
+    GMATH_INLINE bool Frustum::operator != (const Frustum& other) const
+    {
+        return !(*this == other);
+    }
+
+    /*------ methods ------*/
+
+    GMATH_INLINE void Frustum::fromMatrix4(const Matrix4& viewProjection)
+    {
+        // Gribb and Hartmann, Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix:
+        // with row vectors the clip coordinate c is the dot product with column c, a plane is w + c or w - c
+        const double* m = viewProjection.data();
+        for (int k=0; k<6; k++)
+        {
+            int c = k / 2;
+            double sign = k % 2 ? -1.0 : 1.0;
+            Vector4 plane(m[3] + sign*m[c], m[7] + sign*m[4+c], m[11] + sign*m[8+c], m[15] + sign*m[12+c]);
+            double length = sqrt(plane.x*plane.x + plane.y*plane.y + plane.z*plane.z);
+            planes[k] = length > 0.0 ? plane / length : plane;
+        }
+    }
+
+    GMATH_INLINE bool Frustum::contains(const Vector3& point) const
+    {
+        return overlapsSphere(point, 0.0);
+    }
+
+    GMATH_INLINE bool Frustum::overlapsSphere(const Vector3& center, double radius) const
+    {
+        unsigned char visible;
+        return simd::cullSpheres(planes[0].data(), center.data(), &radius, 1, &visible) != 0;
+    }
+
+    GMATH_INLINE bool Frustum::overlaps(const AABB& box) const
+    {
+        unsigned char visible;
+        return simd::cullBoxes(planes[0].data(), box.min.data(), 1, 6, &visible) != 0;
+    }
+
+    GMATH_INLINE size_t Frustum::cullSpheres(const double* centers, const double* radii, size_t count, unsigned char* visible) const
+    {
+        const double* p = planes[0].data();
+        return detail::cullBlocks(count, [&](size_t first, size_t n) {
+            return simd::cullSpheres(p, centers + 3*first, radii + first, n, visible + first/8);
+        });
+    }
+
+    GMATH_INLINE size_t Frustum::cullSpheres(const std::vector<Vector3>& centers, const std::vector<double>& radii,
+                                             std::vector<unsigned char>& visible) const
+    {
+        if (centers.size() != radii.size())
+            throw GMathError("Frustum.cullSpheres: there must be a radius per center");
+
+        visible.resize((centers.size() + 7) / 8);
+        if (centers.empty())
+            return 0;
+        return cullSpheres(centers[0].data(), &radii[0], centers.size(), &visible[0]);
+    }
+
+    GMATH_INLINE size_t Frustum::cullBoxes(const AABB* boxes, size_t count, unsigned char* visible) const
+    {
+        const double* p = planes[0].data();
+        const size_t stride = sizeof(AABB) / sizeof(double);
+        return detail::cullBlocks(count, [&](size_t first, size_t n) {
+            return simd::cullBoxes(p, boxes[first].min.data(), n, stride, visible + first/8);
+        });
+    }
+
+    GMATH_INLINE size_t Frustum::cullBoxes(const std::vector<AABB>& boxes, std::vector<unsigned char>& visible) const
+    {
+        visible.resize((boxes.size() + 7) / 8);
+        if (boxes.empty())
+            return 0;
+        return cullBoxes(&boxes[0], boxes.size(), &visible[0]);
+    }
+
+    GMATH_INLINE std::string Frustum::toString() const
+    {
+        const char* names[6] = { "left  :", "right :", "bottom:", "top   :", "near  :", "far   :" };
+        std::stringstream oss;
+        oss << "gmath::Frustum(";
+        for (int k=0; k<6; k++)
+        {
+            if (k)
+                oss << std::endl << "               ";
+            oss << names[k] << planes[k].x << ", " << planes[k].y << ", " << planes[k].z << ", " << planes[k].w;
+        }
+        oss << ");";
+
+        return oss.str();
+    }
+}
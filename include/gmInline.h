@@ -0,0 +1,76 @@
+/*  Header only mode (GMATH_HEADER_ONLY).
+
+    Every GMath header includes this file at its bottom, that's why there is no "#pragma once" here.
+    The implementation files (*.inl) can only be included once all the classes are fully declared,
+    so each header marks where it begins and where it ends (GMATH_<NAME>_BEGIN, GMATH_<NAME>_END)
+    and the definitions are pulled in by the first header that closes while no other GMath header
+    is still half way through. */
+
+#if defined(GMATH_HEADER_ONLY) && !defined(GMATH_INLINE_DEFINED)
+#if (!defined(GMATH_ROOT_BEGIN)            || defined(GMATH_ROOT_END))       && \
+    (!defined(GMATH_VECTOR3_BEGIN)         || defined(GMATH_VECTOR3_END))    && \
+    (!defined(GMATH_VECTOR4_BEGIN)         || defined(GMATH_VECTOR4_END))    && \
+    (!defined(GMATH_EULER_BEGIN)           || defined(GMATH_EULER_END))      && \
+    (!defined(GMATH_MATRIX3_BEGIN)         || defined(GMATH_MATRIX3_END))    && \
+    (!defined(GMATH_MATRIX4_BEGIN)         || defined(GMATH_MATRIX4_END))    && \
+    (!defined(GMATH_QUATERNION_BEGIN)      || defined(GMATH_QUATERNION_END)) && \
+    (!defined(GMATH_XFO_BEGIN)             || defined(GMATH_XFO_END))        && \
+    (!defined(GMATH_DUALQUATERNION_BEGIN)  || defined(GMATH_DUALQUATERNION_END)) && \
+    (!defined(GMATH_SIMD_BEGIN)            || defined(GMATH_SIMD_END))       && \
+    (!defined(GMATH_BATCH_BEGIN)           || defined(GMATH_BATCH_END))      && \
+    (!defined(GMATH_VECTOR3ARRAY_BEGIN)    || defined(GMATH_VECTOR3ARRAY_END))    && \
+    (!defined(GMATH_QUATERNIONARRAY_BEGIN) || defined(GMATH_QUATERNIONARRAY_END)) && \
+    (!defined(GMATH_XFOARRAY_BEGIN)        || defined(GMATH_XFOARRAY_END))        && \
+    (!defined(GMATH_PARALLEL_BEGIN)        || defined(GMATH_PARALLEL_END))        && \
+    (!defined(GMATH_TRANSFORMHIERARCHY_BEGIN) || defined(GMATH_TRANSFORMHIERARCHY_END)) && \
+    (!defined(GMATH_TRANSFORMCACHE_BEGIN)  || defined(GMATH_TRANSFORMCACHE_END))  && \
+    (!defined(GMATH_INVERSECACHEDTRANSFORM_BEGIN) || defined(GMATH_INVERSECACHEDTRANSFORM_END)) && \
+    (!defined(GMATH_SKINNING_BEGIN)        || defined(GMATH_SKINNING_END))        && \
+    (!defined(GMATH_BVH_BEGIN)             || defined(GMATH_BVH_END))             && \
+    (!defined(GMATH_POINTGRID_BEGIN)       || defined(GMATH_POINTGRID_END))       && \
+    (!defined(GMATH_BOUNDS_BEGIN)          || defined(GMATH_BOUNDS_END))          && \
+    (!defined(GMATH_FRUSTUM_BEGIN)         || defined(GMATH_FRUSTUM_END))         && \
+    (!defined(GMATH_USEFULFUNCTIONS_BEGIN) || defined(GMATH_USEFULFUNCTIONS_END))
+
+    #define GMATH_INLINE_DEFINED
+
+    // the definitions cross reference each other, so declare everything first
+    #include "gmUsefulFunctions.h"
+    #include "gmBatch.h"
+    #include "gmXfoArray.h"
+    #include "gmTransformCache.h"
+    #include "gmInverseCachedTransform.h"
+    #include "gmDualQuaternion.h"
+    #include "gmSkinning.h"
+    #include "gmBvh.h"
+    #include "gmPointGrid.h"
+    #include "gmBounds.h"
+    #include "gmFrustum.h"
+
+    #include "gmRoot.inl"
+    #include "gmSimd.inl"
+    #include "gmVector3.inl"
+    #include "gmVector4.inl"
+    #include "gmEuler.inl"
+    #include "gmMatrix3.inl"
+    #include "gmMatrix4.inl"
+    #include "gmQuaternion.inl"
+    #include "gmXfo.inl"
+    #include "gmDualQuaternion.inl"
+    #include "gmUsefulFunctions.inl"
+    #include "gmBatch.inl"
+    #include "gmVector3Array.inl"
+    #include "gmQuaternionArray.inl"
+    #include "gmXfoArray.inl"
+    #include "gmParallel.inl"
+    #include "gmTransformHierarchy.inl"
+    #include "gmTransformCache.inl"
+    #include "gmInverseCachedTransform.inl"
+    #include "gmSkinning.inl"
+    #include "gmBvh.inl"
+    #include "gmPointGrid.inl"
+    #include "gmBounds.inl"
+    #include "gmFrustum.inl"
+
+#endif
+#endif
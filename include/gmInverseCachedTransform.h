@@ -0,0 +1,87 @@
+#pragma once
+#define GMATH_INVERSECACHEDTRANSFORM_BEGIN
+
+#include "gmRoot.h"
+#include "gmVector3.h"
+#include "gmMatrix4.h"
+#include "gmXfo.h"
+#include "gmBatch.h"
+
+namespace gmath
+{
+    /**
+    A transform that keeps its inverse, for code mapping many points into the space of the
+    same transform (skin binding, collisions...). For the globals of a whole hierarchy see TransformCache.
+
+    The inverse is computed on the first request after a change and kept until the next set(),
+    the value can only be changed through set() so the inverse is never stale.
+    Points are mapped back with the inverse as an affine Matrix4: for an Xfo the result can differ from
+    Xfo::inverseTransformVector by a few ULP, and it also works with non-uniform scaling.
+
+    T is Xfo or Matrix4. The inverse is computed by a const method, so an InverseCachedTransform shared
+    between threads must have its inverse computed (by any inverse query) before it is shared.
+    */
+    template <typename T>
+    class InverseCachedTransform
+    {
+    private:
+        T _value;
+        mutable T _inverse;
+        mutable Matrix4 _inverseMatrix;
+        mutable bool _cached;
+        mutable bool _invertible;
+
+        void updateInverse() const;
+
+    public:
+        /*------ constructors ------*/
+
+        /** The identity. */
+        InverseCachedTransform();
+        explicit InverseCachedTransform(const T& value);
+
+        /*------ value ------*/
+
+        const T& get() const;
+        /** Replace the transform, the inverse will be computed again when needed. */
+        void set(const T& value);
+        InverseCachedTransform& operator = (const T& value);
+        /** True if the inverse of the current value is already computed. */
+        bool isInverseCached() const;
+
+        /*------ inverse ------*/
+
+        /** The inverse transform, see Xfo::inverse and Matrix4::inverse.
+            Throws GMathError for an Xfo with non-uniform scaling, its inverse can't be an Xfo. */
+        const T& inverse() const;
+        /** The inverse as an affine matrix, a point times it gives the inverse transformed point. */
+        const Matrix4& inverseMatrix() const;
+
+        /*------ points ------*/
+
+        /** Xfo::transformVector or Vector3 * Matrix4. */
+        Vector3 transformVector(const Vector3& vec) const;
+        Vector3 inverseTransformVector(const Vector3& vec) const;
+
+        /** The batch versions, see transformPoints in gmBatch.h for the layouts. */
+        void transformPoints(const double* in, double* out, size_t count, size_t stride=3) const;
+        void transformPoints(const double* inX, const double* inY, const double* inZ,
+                             double* outX, double* outY, double* outZ, size_t count) const;
+        void inverseTransformPoints(const double* in, double* out, size_t count, size_t stride=3) const;
+        void inverseTransformPoints(const double* inX, const double* inY, const double* inZ,
+                                    double* outX, double* outY, double* outZ, size_t count) const;
+    };
+
+    typedef InverseCachedTransform<Xfo> InverseCachedXfo;
+    typedef InverseCachedTransform<Matrix4> InverseCachedMatrix4;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class InverseCachedTransform<Xfo>;
+        extern template class InverseCachedTransform<Matrix4>;
+    #endif
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_INVERSECACHEDTRANSFORM_END
+    #include "gmInline.h"
+#endif
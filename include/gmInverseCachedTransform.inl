@@ -0,0 +1,159 @@
+namespace gmath
+{
+    namespace detail
+    {
+        // The affine matrix of the inverse of Xfo::transformVector: minus tr, the inverse rotation,
+        // then every coordinate divided by its scale. Unlike Xfo::inverse it exists with non-uniform scaling.
+        GMATH_INLINE Matrix4 inverseAffine(const Xfo& xfo)
+        {
+            Matrix4 mat(xfo.ori.inverse());
+            Vector3 inverseScale = xfo.sc.inverse();
+            double* m = mat.data();
+            for (int row=0; row<3; row++)
+            {
+                m[row*4]   *= inverseScale.x;
+                m[row*4+1] *= inverseScale.y;
+                m[row*4+2] *= inverseScale.z;
+            }
+            for (int col=0; col<3; col++)
+                m[12+col] = -(xfo.tr.x*m[col] + xfo.tr.y*m[4+col] + xfo.tr.z*m[8+col]);
+            return mat;
+        }
+
+        // The inverse of value and its affine matrix, false if value has no inverse of its own type.
+        GMATH_INLINE bool invertTransform(const Xfo& value, Xfo& inverse, Matrix4& inverseMatrix)
+        {
+            inverseMatrix = inverseAffine(value);
+            if (!value.hasUniformScale())
+                return false;
+            inverse = value.inverse();
+            return true;
+        }
+
+        GMATH_INLINE bool invertTransform(const Matrix4& value, Matrix4& inverse, Matrix4& inverseMatrix)
+        {
+            inverse = value.inverse();
+            inverseMatrix = inverse;
+            return true;
+        }
+
+        GMATH_INLINE Vector3 transformPoint(const Xfo& xfo, const Vector3& vec)
+        {
+            return xfo.transformVector(vec);
+        }
+
+        GMATH_INLINE Vector3 transformPoint(const Matrix4& mat, const Vector3& vec)
+        {
+            return vec * mat;
+        }
+    }
+
+    /*------ constructors ------*/
+
+    template <typename T>
+    GMATH_INLINE InverseCachedTransform<T>::InverseCachedTransform()
+        : _cached(false), _invertible(false)
+    {
+    }
+
+    template <typename T>
+    GMATH_INLINE InverseCachedTransform<T>::InverseCachedTransform(const T& value)
+        : _value(value), _cached(false), _invertible(false)
+    {
+    }
+
+    /*------ value ------*/
+
+    template <typename T>
+    GMATH_INLINE const T& InverseCachedTransform<T>::get() const
+    {
+        return _value;
+    }
+
+    template <typename T>
+    GMATH_INLINE void InverseCachedTransform<T>::set(const T& value)
+    {
+        _value = value;
+        _cached = false;
+    }
+
+    template <typename T>
+    GMATH_INLINE InverseCachedTransform<T>& InverseCachedTransform<T>::operator = (const T& value)
+    {
+        set(value);
+        return *this;
+    }
+
+    template <typename T>
+    GMATH_INLINE bool InverseCachedTransform<T>::isInverseCached() const
+    {
+        return _cached;
+    }
+
+    /*------ inverse ------*/
+
+    template <typename T>
+    GMATH_INLINE void InverseCachedTransform<T>::updateInverse() const
+    {
+        if (_cached)
+            return;
+        _invertible = detail::invertTransform(_value, _inverse, _inverseMatrix);
+        _cached = true;
+    }
+
+    template <typename T>
+    GMATH_INLINE const T& InverseCachedTransform<T>::inverse() const
+    {
+        updateInverse();
+        if (!_invertible)
+            throw GMathError("InverseCachedTransform.inverse: Cannot invert xfo with non-uniform scaling without causing shearing. Use inverseMatrix or inverseTransformVector instead");
+        return _inverse;
+    }
+
+    template <typename T>
+    GMATH_INLINE const Matrix4& InverseCachedTransform<T>::inverseMatrix() const
+    {
+        updateInverse();
+        return _inverseMatrix;
+    }
+
+    /*------ points ------*/
+
+    template <typename T>
+    GMATH_INLINE Vector3 InverseCachedTransform<T>::transformVector(const Vector3& vec) const
+    {
+        return detail::transformPoint(_value, vec);
+    }
+
+    template <typename T>
+    GMATH_INLINE Vector3 InverseCachedTransform<T>::inverseTransformVector(const Vector3& vec) const
+    {
+        return vec * inverseMatrix();
+    }
+
+    template <typename T>
+    GMATH_INLINE void InverseCachedTransform<T>::transformPoints(const double* in, double* out, size_t count, size_t stride) const
+    {
+        gmath::transformPoints(_value, in, out, count, stride);
+    }
+
+    template <typename T>
+    GMATH_INLINE void InverseCachedTransform<T>::transformPoints(const double* inX, const double* inY, const double* inZ,
+                                                          double* outX, double* outY, double* outZ, size_t count) const
+    {
+        gmath::transformPoints(_value, inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    template <typename T>
+    GMATH_INLINE void InverseCachedTransform<T>::inverseTransformPoints(const double* in, double* out, size_t count, size_t stride) const
+    {
+        gmath::transformPoints(inverseMatrix(), in, out, count, stride);
+    }
+
+    template <typename T>
+    GMATH_INLINE void InverseCachedTransform<T>::inverseTransformPoints(const double* inX, const double* inY, const double* inZ,
+                                                                 double* outX, double* outY, double* outZ, size_t count) const
+    {
+        gmath::transformPoints(inverseMatrix(), inX, inY, inZ, outX, outY, outZ, count);
+    }
+}
@@ -1,4 +1,5 @@
 #pragma once
+#define GMATH_MATRIX3_BEGIN
 
 #include "gmRoot.h"
 #include "gmVector3.h"
@@ -7,7 +8,7 @@
 namespace gmath
 {
     // Quaternion forward declaration
-    class Quaternion;
+    template <typename real> class QuaternionT;
 
     /** Matrix class (3x3). @n
             [Xx, Xy, Xz] @n
@@ -16,108 +17,124 @@ namespace gmath
 
         This class represents a 3x3 matrix that can be used to store
         rotations transformations. */
-    class Matrix3
+    template <typename real>
+    class Matrix3T
     {
     private:
         /*------ properties ------*/
-        double _data[9];
+        real _data[9];
 
     public:
         /*------ constructors ------*/
-        Matrix3();
-        Matrix3(double xx, double xy, double xz,
-                double yx, double yy, double yz,
-                double zx, double zy, double zz);
-        Matrix3(const Matrix3 &other);
-        Matrix3(const Vector3 &axisX,
-                const Vector3 &axisY,
-                const Vector3 &axisZ);
-        Matrix3(const Quaternion& quat);
-        Matrix3(const double* values);
-        Matrix3(const std::vector<double>& values);
+        Matrix3T();
+        Matrix3T(real xx, real xy, real xz,
+                real yx, real yy, real yz,
+                real zx, real zy, real zz);
+        Matrix3T(const Matrix3T &other);
+        /** Conversion from the other precision, for example Matrix3f(aMatrix3). */
+        template <typename otherReal>
+        explicit Matrix3T(const Matrix3T<otherReal>& other);
+        Matrix3T(const Vector3T<real> &axisX,
+                const Vector3T<real> &axisY,
+                const Vector3T<real> &axisZ);
+        Matrix3T(const QuaternionT<real>& quat);
+        Matrix3T(const real* values);
+        Matrix3T(const std::vector<real>& values);
 
         /** Pointer access for direct copying. */
-        double* data();
-        const double* data() const;
+        real* data();
+        const real* data() const;
 
         /*------ coordinate access ------*/
-        double operator[] (int i) const;
-        double &operator[] (int i);
-        double operator() (int row, int col) const;
-        double &operator() (int row, int col);
+        real operator[] (int i) const;
+        real &operator[] (int i);
+        real operator() (int row, int col) const;
+        real &operator() (int row, int col);
 
         /*------ Arithmetic operations ------*/
-        Matrix3 operator - () const;
-        Matrix3 operator - (double value) const;
-        Matrix3 operator - (const Matrix3 &other) const;
-        Matrix3 operator + (double value) const;
-        Matrix3 operator + (const Matrix3 &other) const;
-        Matrix3 operator / (double value) const;
-        Matrix3 operator * (double value) const;
-        Matrix3 operator * (const Matrix3 &other) const;
+        Matrix3T operator - () const;
+        Matrix3T operator - (real value) const;
+        Matrix3T operator - (const Matrix3T &other) const;
+        Matrix3T operator + (real value) const;
+        Matrix3T operator + (const Matrix3T &other) const;
+        Matrix3T operator / (real value) const;
+        Matrix3T operator * (real value) const;
+        Matrix3T operator * (const Matrix3T &other) const;
 
         /*------ Arithmetic updates ------*/
-        Matrix3& operator += (double value);
-        Matrix3& operator += (const Matrix3 &other);
-        Matrix3& operator -= (double value);
-        Matrix3& operator -= (const Matrix3 &other);
-        Matrix3& operator /= (double value);
-        Matrix3& operator *= (double value);
-        Matrix3& operator *= (const Matrix3 &other);
+        Matrix3T& operator += (real value);
+        Matrix3T& operator += (const Matrix3T &other);
+        Matrix3T& operator -= (real value);
+        Matrix3T& operator -= (const Matrix3T &other);
+        Matrix3T& operator /= (real value);
+        Matrix3T& operator *= (real value);
+        Matrix3T& operator *= (const Matrix3T &other);
 
         /*------ Comparisons ------*/
-        bool operator == (const Matrix3 &other) const;
-        bool operator != (const Matrix3 &other) const;
+        bool operator == (const Matrix3T &other) const;
+        bool operator != (const Matrix3T &other) const;
 
         /*------ Assignment ------*/
-        void operator = (const Matrix3 &other);
+        void operator = (const Matrix3T &other);
 
         /*------ methods ------*/
         void setToIdentity();
-        void set(double xx, double xy, double xz,
-                 double yx, double yy, double yz,
-                 double zx, double zy, double zz);
-        void set(const double* values);
-        void set(const std::vector<double>& values);
-
-        Vector3 getRow(unsigned int i) const;
-        void setRow(unsigned int i, const Vector3 &vec);
-
-        Vector3 getAxisX() const;
-        Vector3 getAxisY() const;
-        Vector3 getAxisZ() const;
-        void setAxisX(const Vector3& vec);
-        void setAxisY(const Vector3& vec);
-        void setAxisZ(const Vector3& vec);
-
-        void setScale(const Vector3 &scale);
-        void setScale(double sX, double sY, double sZ);
-        void addScale(const Vector3 &scale);
-        void addScale(double sX, double sY, double sZ);
-        Vector3 getScale() const;
+        void set(real xx, real xy, real xz,
+                 real yx, real yy, real yz,
+                 real zx, real zy, real zz);
+        void set(const real* values);
+        void set(const std::vector<real>& values);
+
+        Vector3T<real> getRow(unsigned int i) const;
+        void setRow(unsigned int i, const Vector3T<real> &vec);
+
+        Vector3T<real> getAxisX() const;
+        Vector3T<real> getAxisY() const;
+        Vector3T<real> getAxisZ() const;
+        void setAxisX(const Vector3T<real>& vec);
+        void setAxisY(const Vector3T<real>& vec);
+        void setAxisZ(const Vector3T<real>& vec);
+
+        void setScale(const Vector3T<real> &scale);
+        void setScale(real sX, real sY, real sZ);
+        void addScale(const Vector3T<real> &scale);
+        void addScale(real sX, real sY, real sZ);
+        Vector3T<real> getScale() const;
 
         /** Remember to take out scale first */
-        void fromQuaternion(const Quaternion& rotationQuat);
-        Quaternion toQuaternion() const;
-        void toQuaternion(Quaternion &outQuaternion) const;
-
-        void fromEuler(const double& angleX, const double& angleY, const double& angleZ, RotationOrder order=RotationOrder::XYZ);
-        void fromEuler(const Euler &rotation, RotationOrder order=RotationOrder::XYZ);
-        Euler toEuler(RotationOrder order=RotationOrder::XYZ) const;
-        void toEuler(Euler& euler, RotationOrder order=RotationOrder::XYZ) const;
-
-        Matrix3 transpose() const;
+        void fromQuaternion(const QuaternionT<real>& rotationQuat);
+        QuaternionT<real> toQuaternion() const;
+        void toQuaternion(QuaternionT<real> &outQuaternion) const;
+
+        void fromEuler(const real& angleX, const real& angleY, const real& angleZ, RotationOrder order=RotationOrder::XYZ);
+        void fromEuler(const EulerT<real> &rotation, RotationOrder order=RotationOrder::XYZ);
+        EulerT<real> toEuler(RotationOrder order=RotationOrder::XYZ) const;
+        void toEuler(EulerT<real>& euler, RotationOrder order=RotationOrder::XYZ) const;
+        /** Same as above with the order known at compile time, e.g. mat.fromEuler<RotationOrder::ZXY>(x, y, z).
+            The angles are in radians. */
+        template <RotationOrder ORDER>
+        void fromEuler(real angleX, real angleY, real angleZ);
+        template <RotationOrder ORDER>
+        EulerT<real> toEuler() const;
+
+        Matrix3T transpose() const;
         void transposeInPlace();
 
         /** The determinant of a matrix is a floating point value which is used to
             indicate whether the matrix has an inverse or not. If zero, then no inverse exists. */
-        double determinant() const;
+        real determinant() const;
 
-        Matrix3 inverse() const;
+        Matrix3T inverse() const;
         void inverseInPlace();
 
-        Matrix3 orthogonal() const;
+        Matrix3T orthogonal() const;
         void orthogonalInPlace();
+
+        /** The eigenvalues of the symmetric part of this matrix, (M + Mt) / 2, by decreasing value, and
+            their eigenvectors as the rows of vectors, which is a rotation matrix. For a covariance matrix
+            the rows are the principal axes. Cyclic Jacobi rotations, accurate to about EPSILON of the
+            largest eigenvalue, repeated eigenvalues included. */
+        void symmetricEigen(Vector3T<real>& values, Matrix3T& vectors) const;
         
         /** Returns a rotation matrix that rotates one vector into another.
 
@@ -130,19 +147,32 @@ namespace gmath
             Efficiently Building a Matrix to Rotate One Vector to Another
             Journal of Graphics Tools, 4(4):1-4, 1999
             http://www.acm.org/jgt/papers/MollerHughes99/ */
-        void fromVectorToVector(const Vector3 &fromVec, const Vector3 &toVec);
-        void fromAxisAngle(const Vector3 &axis, double angle);
+        void fromVectorToVector(const Vector3T<real> &fromVec, const Vector3T<real> &toVec);
+        void fromAxisAngle(const Vector3T<real> &axis, real angle);
 
         /** Look from pos to target.
 
             The resulting transformation is a rotation Matrix where the primaryAxis points to target.
             The secondaryAxis is as close as possible to the up vector. */
-        void lookAt(const Vector3 &pointAt, const Vector3 &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
-        static Matrix3 createLookAt(const Vector3 &pointAt, const Vector3 &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
+        void lookAt(const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
+        static Matrix3T createLookAt(const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
 
         std::string toString() const;
 
         // Special Matrices.
-        static const Matrix3 IDENTITY;
+        static const Matrix3T IDENTITY;
     };
+
+    typedef Matrix3T<double> Matrix3;
+    typedef Matrix3T<float> Matrix3f;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class Matrix3T<float>;
+        extern template class Matrix3T<double>;
+    #endif
 }
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_MATRIX3_END
+    #include "gmInline.h"
+#endif
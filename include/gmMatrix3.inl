@@ -0,0 +1,1050 @@
+namespace gmath
+{
+    /*------ constructors ------*/
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T()
+    {
+        _data[0]=1.0; _data[1]=0.0; _data[2]=0.0;
+        _data[3]=0.0; _data[4]=1.0; _data[5]=0.0;
+        _data[6]=0.0; _data[7]=0.0; _data[8]=1.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(
+        real xx, real xy, real xz,
+        real yx, real yy, real yz,
+        real zx, real zy, real zz)
+    {
+        _data[0]=xx; _data[1]=xy; _data[2]=xz;
+        _data[3]=yx; _data[4]=yy; _data[5]=yz;
+        _data[6]=zx; _data[7]=zy; _data[8]=zz;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(const Matrix3T<real> & other)
+    {
+        memcpy(_data, other._data, 9*sizeof(real));
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(const Matrix3T<otherReal>& other)
+    {
+        const otherReal* values = other.data();
+        for (int i=0; i<9; i++)
+            _data[i] = real(values[i]);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(
+            const Vector3T<real> &axisX,
+            const Vector3T<real> &axisY,
+            const Vector3T<real> &axisZ)
+    {
+        memcpy(&_data[0], axisX.data(), 3*sizeof(real));
+        memcpy(&_data[3], axisY.data(), 3*sizeof(real));
+        memcpy(&_data[6], axisZ.data(), 3*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(const QuaternionT<real>& quat)
+    {
+        this->fromQuaternion(quat);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(const real* values)
+    {
+        set(values);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>::Matrix3T(const std::vector<real>& values)
+    {
+        set(values);
+    }   
+
+    /*------ Data access ------*/
+
+    template <typename real>
+    GMATH_INLINE real* Matrix3T<real>::data()
+    {
+        return &_data[0];
+    }
+
+    template <typename real>
+    GMATH_INLINE const real* Matrix3T<real>::data() const
+    {
+        return &_data[0];
+    }
+
+    /*------ Coordinates access ------*/
+    
+    template <typename real>
+    GMATH_INLINE real Matrix3T<real>::operator[] (int i) const
+    {
+        if (i>=0 && i<9)
+        {
+            return this->_data[i];
+        }
+        else {
+            throw out_of_range("gmath::Matrix3: index out of range");
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE real& Matrix3T<real>::operator[] (int i)
+    {
+        if (i>=0 && i<9)
+        {
+            return this->_data[i];
+        }
+        else {
+            throw out_of_range("gmath::Matrix3: index out of range");
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE real Matrix3T<real>::operator() (int row, int col) const
+    {
+        if (row>=0 && row<3 && col>=0 && col<3)
+        {
+            return this->_data[row*3+col];
+        }
+        else
+        {
+            throw out_of_range("gmath::Matrix3: row or column index out of range");
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE real &Matrix3T<real>::operator() (int row, int col)
+    {
+        if (row>=0 && row<3 && col>=0 && col<3)
+        {
+            return this->_data[row*3+col];
+        }
+        else
+        {
+            throw out_of_range("gmath::Matrix3: row or column index out of range");
+        }
+    }
+
+    /*------ Arithmetic operations ------*/
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator + (real value) const
+    {
+        Matrix3T<real> retMatrix(
+            _data[0]+value, _data[1]+value, _data[2]+value,
+            _data[3]+value, _data[4]+value, _data[5]+value,
+            _data[6]+value, _data[7]+value, _data[8]+value
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator + (const Matrix3T<real> &other) const
+    {
+        
+        const real* b = other.data();
+        Matrix3T<real> retMatrix(
+            _data[0]+b[0], _data[1]+b[1], _data[2]+b[2],
+            _data[3]+b[3], _data[4]+b[4], _data[5]+b[5],
+            _data[6]+b[6], _data[7]+b[7], _data[8]+b[8]
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator - (real value) const
+    {
+        Matrix3T<real> retMatrix(
+            _data[0]-value, _data[1]-value, _data[2]-value,
+            _data[3]-value, _data[4]-value, _data[5]-value,
+            _data[6]-value, _data[7]-value, _data[8]-value
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator - () const
+    {
+        Matrix3T<real> newMatrix3((*this).inverse());
+        return newMatrix3;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator - (const Matrix3T<real> &other) const
+    {
+        
+        const real* b = other.data();
+        Matrix3T<real> retMatrix(
+            _data[0]-b[0], _data[1]-b[1], _data[2]-b[2],
+            _data[3]-b[3], _data[4]-b[4], _data[5]-b[5],
+            _data[6]-b[6], _data[7]-b[7], _data[8]-b[8]
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator / (real value) const
+    {
+        Matrix3T<real> retMatrix(
+            _data[0]/value, _data[1]/value, _data[2]/value,
+            _data[3]/value, _data[4]/value, _data[5]/value,
+            _data[6]/value, _data[7]/value, _data[8]/value
+            );
+
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator * (real value) const
+    {
+        Matrix3T<real> retMatrix(
+            _data[0]*value, _data[1]*value, _data[2]*value,
+            _data[3]*value, _data[4]*value, _data[5]*value,
+            _data[6]*value, _data[7]*value, _data[8]*value
+            );
+
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::operator * (const Matrix3T<real> &other) const
+    {
+        const real* b = other.data();
+        Matrix3T<real> retMatrix(
+            _data[0]*b[0] + _data[1]*b[3] + _data[2]*b[6],
+            _data[0]*b[1] + _data[1]*b[4] + _data[2]*b[7],
+            _data[0]*b[2] + _data[1]*b[5] + _data[2]*b[8],
+
+            _data[3]*b[0] + _data[4]*b[3] + _data[5]*b[6],
+            _data[3]*b[1] + _data[4]*b[4] + _data[5]*b[7],
+            _data[3]*b[2] + _data[4]*b[5] + _data[5]*b[8],
+
+            _data[6]*b[0] + _data[7]*b[3] + _data[8]*b[6],
+            _data[6]*b[1] + _data[7]*b[4] + _data[8]*b[7],
+            _data[6]*b[2] + _data[7]*b[5] + _data[8]*b[8]
+            );
+        return retMatrix;
+    }
+
+    /*------ Arithmetic updates ------*/
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator += (real value)
+    {
+        _data[0]+=value; _data[1]+=value; _data[2]+=value;
+        _data[3]+=value; _data[4]+=value; _data[5]+=value;
+        _data[6]+=value; _data[7]+=value; _data[8]+=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator += (const Matrix3T<real> &other)
+    {
+        real* a = data();
+        const real* b = other.data();
+        _data[0]+=b[0]; _data[1]+=b[1]; _data[2]+=b[2];
+        _data[3]+=b[3]; _data[4]+=b[4]; _data[5]+=b[5];
+        _data[6]+=b[6]; _data[7]+=b[7]; _data[8]+=b[8];
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator -= (real value)
+    {
+        _data[0]-=value; _data[1]-=value; _data[2]-=value;
+        _data[3]-=value; _data[4]-=value; _data[5]-=value;
+        _data[6]-=value; _data[7]-=value; _data[8]-=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator -= (const Matrix3T<real> &other)
+    {
+        real* a = data();
+        const real* b = other.data();
+
+        _data[0]-=b[0]; _data[1]-=b[1]; _data[2]-=b[2];
+        _data[3]-=b[3]; _data[4]-=b[4]; _data[5]-=b[5];
+        _data[6]-=b[6]; _data[7]-=b[7]; _data[8]-=b[8];
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator /= (real value)
+    {
+        _data[0]/=value; _data[1]/=value; _data[2]/=value;
+        _data[3]/=value; _data[4]/=value; _data[5]/=value;
+        _data[6]/=value; _data[7]/=value; _data[8]/=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator *= (real value)
+    {
+        _data[0]*=value; _data[1]*=value; _data[2]*=value;
+        _data[3]*=value; _data[4]*=value; _data[5]*=value;
+        _data[6]*=value; _data[7]*=value; _data[8]*=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real>& Matrix3T<real>::operator *= (const Matrix3T<real> &other)
+    {
+        const real* a = &_data[0];
+        const real* b = &other._data[0];
+        real c[9];
+
+        c[0] = _data[0]*b[0] + _data[1]*b[3] + _data[2]*b[6];
+        c[1] = _data[0]*b[1] + _data[1]*b[4] + _data[2]*b[7];
+        c[2] = _data[0]*b[2] + _data[1]*b[5] + _data[2]*b[8];
+        c[3] = _data[3]*b[0] + _data[4]*b[3] + _data[5]*b[6];
+        c[4] = _data[3]*b[1] + _data[4]*b[4] + _data[5]*b[7];
+        c[5] = _data[3]*b[2] + _data[4]*b[5] + _data[5]*b[8];
+        c[6] = _data[6]*b[0] + _data[7]*b[3] + _data[8]*b[6];
+        c[7] = _data[6]*b[1] + _data[7]*b[4] + _data[8]*b[7];
+        c[8] = _data[6]*b[2] + _data[7]*b[5] + _data[8]*b[8];
+
+        memcpy(_data, c, 9*sizeof(real));
+        return *this;
+    }
+
+    /*------ Comparisons ------*/
+
+    template <typename real>
+    GMATH_INLINE bool Matrix3T<real>::operator == (const Matrix3T<real> &other) const
+    {
+        const real* b = &other._data[0];
+        real e = gmath::EPSILON;
+        return (fabs(_data[0]-b[0])<e && fabs(_data[1]-b[1])<e && fabs(_data[2]-b[2])<e &&
+                fabs(_data[3]-b[3])<e && fabs(_data[4]-b[4])<e && fabs(_data[5]-b[5])<e &&
+                fabs(_data[6]-b[6])<e && fabs(_data[7]-b[7])<e && fabs(_data[8]-b[8])<e);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool Matrix3T<real>::operator != (const Matrix3T<real> &other) const
+    {
+        const real* b = &other._data[0];
+        real e = gmath::EPSILON;
+        return (fabs(_data[0]-b[0])>e || fabs(_data[1]-b[1])>e || fabs(_data[2]-b[3])>e ||
+                fabs(_data[3]-b[3])>e || fabs(_data[0]-b[0])>e || fabs(_data[0]-b[0])>e ||
+                fabs(_data[0]-b[0])>e || fabs(_data[0]-b[0])>e || fabs(_data[0]-b[0])>e);
+    }
+
+    /*------ Assignment ------*/
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::operator = (const Matrix3T<real> &other)
+    {
+        memcpy(_data, other._data, 9*sizeof(real));
+    }
+
+    /*------ methods ------*/
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setToIdentity()
+    {
+        _data[0]=1.0; _data[1]=0.0; _data[2]=0.0;
+        _data[3]=0.0; _data[4]=1.0; _data[5]=0.0;
+        _data[6]=0.0; _data[7]=0.0; _data[8]=1.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::set(
+        real xx, real xy, real xz,
+        real yx, real yy, real yz,
+        real zx, real zy, real zz)
+    {
+        _data[0]=xx; _data[1]=xy; _data[2]=xz;
+        _data[3]=yx; _data[4]=yy; _data[5]=yz;
+        _data[6]=zx; _data[7]=zy; _data[8]=zz;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::set(const real* values)
+    {
+        memcpy(_data, values, 9*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::set(const std::vector<real>& values)
+    {
+        if (values.size()!=9) {
+            throw out_of_range("gmath::Matrix3: values must be of 9 elments");
+        }
+
+        memcpy(_data, values.data(), 9*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix3T<real>::getRow(unsigned int i) const
+    {
+        if (i>2)
+        {
+            throw out_of_range("gmath::Matrix3: index out of range");
+        }
+        return Vector3T<real>( _data[i*3], _data[i*3+1], _data[i*3+2] );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setRow(unsigned int i, const Vector3T<real> &vec)
+    {
+        if (i>2)
+        {
+            throw out_of_range("gmath::Matrix3: index out of range");
+        }
+        _data[i*3]   = vec.x;
+        _data[i*3+1] = vec.y;
+        _data[i*3+2] = vec.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix3T<real>::getAxisX() const
+    {
+        return getRow(0);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix3T<real>::getAxisY() const
+    {
+        return getRow(1);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix3T<real>::getAxisZ() const
+    {
+        return getRow(2);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setAxisX(const Vector3T<real>& vec)
+    {
+        setRow(0, vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setAxisY(const Vector3T<real>& vec)
+    {
+        setRow(1, vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setAxisZ(const Vector3T<real>& vec)
+    {
+        setRow(2, vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::transpose() const
+    {
+        return Matrix3T<real>(
+                _data[0], _data[3], _data[6],
+                _data[1], _data[4], _data[7],
+                _data[2], _data[5], _data[8] );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::transposeInPlace()
+    {
+        this->set(
+            _data[0], _data[3], _data[6],
+            _data[1], _data[4], _data[7],
+            _data[2], _data[5], _data[8] );
+    }
+
+    template <typename real>
+    GMATH_INLINE real Matrix3T<real>::determinant() const
+    {
+        real det;
+        det = _data[0] * ( _data[4]*_data[8] - _data[7]*_data[5] )
+            - _data[1] * ( _data[3]*_data[8] - _data[6]*_data[5] )
+            + _data[2] * ( _data[3]*_data[7] - _data[6]*_data[4] );
+        return det;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::inverse() const
+    {
+        Matrix3T<real> retMatrix;
+        real invDet = 1/determinant();
+
+        if ( invDet < gmath::EPSILON )
+        {
+            retMatrix = *this;
+            retMatrix.setToIdentity();
+        }
+        else
+        {
+            retMatrix._data[0] =   _data[4]*_data[8] - _data[5]*_data[7]  / invDet;
+            retMatrix._data[1] = -(_data[1]*_data[8] - _data[7]*_data[2]) / invDet;
+            retMatrix._data[2] =   _data[1]*_data[5] - _data[4]*_data[2]  / invDet;
+
+            retMatrix._data[3] = -(_data[3]*_data[8] - _data[5]*_data[6]) / invDet;
+            retMatrix._data[4] =   _data[0]*_data[8] - _data[6]*_data[2]  / invDet;
+            retMatrix._data[5] = -(_data[0]*_data[5] - _data[3]*_data[2]) / invDet;
+
+            retMatrix._data[6] =   _data[3]*_data[7] - _data[6]*_data[4]  / invDet;
+            retMatrix._data[7] = -(_data[0]*_data[7] - _data[6]*_data[1]) / invDet;
+            retMatrix._data[8] =   _data[0]*_data[4] - _data[1]*_data[3]  / invDet;
+        }
+
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::inverseInPlace()
+    {
+        real m[9];
+        real invDet = 1/determinant();
+
+        if ( invDet < gmath::EPSILON )
+        {
+            this->setToIdentity();
+        }
+        else
+        {
+            m[0] =   _data[4]*_data[8] - _data[5]*_data[7]  / invDet;
+            m[1] = -(_data[1]*_data[8] - _data[7]*_data[2]) / invDet;
+            m[2] =   _data[1]*_data[5] - _data[4]*_data[2]  / invDet;
+
+            m[3] = -(_data[3]*_data[8] - _data[5]*_data[6]) / invDet;
+            m[4] =   _data[0]*_data[8] - _data[6]*_data[2]  / invDet;
+            m[5] = -(_data[0]*_data[5] - _data[3]*_data[2]) / invDet;
+
+            m[6] =   _data[3]*_data[7] - _data[6]*_data[4]  / invDet;
+            m[7] = -(_data[0]*_data[7] - _data[6]*_data[1]) / invDet;
+            m[8] =   _data[0]*_data[4] - _data[1]*_data[3]  / invDet;
+
+            memcpy(_data, m, 9*sizeof(real));
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::orthogonal() const
+    {
+        Matrix3T<real> m(*this);
+        m.orthogonalInPlace();
+        return m;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::orthogonalInPlace() //primaryAxis, secondaryAxis)
+    {
+        // Code take it from WildMagic 5  -  www.geometrictools.com  -  here the matrix is transpose
+        // Algorithm uses Gram-Schmidt orthogonalization.  If 'this' matrix is
+        // M = [m0|m1|m2], then orthonormal output matrix is Q = [q0|q1|q2],
+        //
+        //   q0 = m0/|m0|
+        //   q1 = (m1-(q0*m1)q0)/|m1-(q0*m1)q0|
+        //   q2 = (m2-(q0*m2)q0-(q1*m2)q1)/|m2-(q0*m2)q0-(q1*m2)q1|
+        //
+        // where |V| indicates length of vector V and A*B indicates dot
+        // product of vectors A and B.
+
+        // Compute q0. length xAxis
+        real invLength = (1.0 / sqrt(_data[0]*_data[0] + _data[1]*_data[1] + _data[2]*_data[2]));
+
+        _data[0] *= invLength;
+        _data[1] *= invLength;
+        _data[2] *= invLength;
+
+        // Compute q1.
+        real dot0 = _data[0]*_data[3] + _data[1]*_data[4] +
+            _data[2]*_data[5];
+
+        _data[3] -= dot0*_data[0];
+        _data[4] -= dot0*_data[1];
+        _data[5] -= dot0*_data[2];
+
+        invLength = (1.0 / sqrt(_data[3]*_data[3] + _data[4]*_data[4] + _data[5]*_data[5]));
+
+        _data[3] *= invLength;
+        _data[4] *= invLength;
+        _data[5] *= invLength;
+
+        // compute q2
+        real dot1 = _data[3]*_data[6] + _data[4]*_data[7] +
+            _data[5]*_data[8];
+
+        dot0 = _data[0]*_data[6] + _data[1]*_data[7] +
+            _data[2]*_data[8];
+
+        _data[6] -= dot0*_data[0] + dot1*_data[3];
+        _data[7] -= dot0*_data[1] + dot1*_data[4];
+        _data[8] -= dot0*_data[2] + dot1*_data[5];
+
+        invLength = (1.0 / sqrt(_data[6]*_data[6] + _data[7]*_data[7] + _data[8]*_data[8]));
+
+        _data[6] *= invLength;
+        _data[7] *= invLength;
+        _data[8] *= invLength;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::symmetricEigen(Vector3T<real>& values, Matrix3T& vectors) const
+    {
+        // Jacobi rotations as in Numerical Recipes, each one zeroes an element off the diagonal of a,
+        // the product of the rotations (the eigenvectors in columns) is accumulated in v.
+        const int MAX_SWEEPS = 16;
+        const real epsilon = std::numeric_limits<real>::epsilon();
+
+        real a[3][3], v[3][3];
+        for (int i=0; i<3; i++)
+        {
+            for (int j=0; j<3; j++)
+            {
+                a[i][j] = real(0.5) * (_data[i*3+j] + _data[j*3+i]);
+                v[i][j] = i == j ? real(1.0) : real(0.0);
+            }
+        }
+
+        for (int sweep=0; sweep<MAX_SWEEPS; sweep++)
+        {
+            real off = a[0][1]*a[0][1] + a[0][2]*a[0][2] + a[1][2]*a[1][2];
+            real diagonal = a[0][0]*a[0][0] + a[1][1]*a[1][1] + a[2][2]*a[2][2];
+            if (!(off > epsilon*epsilon * (diagonal + off)))
+                break;
+
+            const int pairs[3][2] = { {0, 1}, {0, 2}, {1, 2} };
+            for (int k=0; k<3; k++)
+            {
+                int p = pairs[k][0], q = pairs[k][1], r = 3 - p - q;
+                real apq = a[p][q];
+                if (apq == real(0.0))
+                    continue;
+
+                // the rotation angle zeroing a[p][q], t = tan(angle) chosen of magnitude <= 1
+                real theta = (a[q][q] - a[p][p]) / (real(2.0) * apq);
+                real t = real(1.0) / (abs(theta) + sqrt(theta*theta + real(1.0)));
+                if (theta < real(0.0))
+                    t = -t;
+                real c = real(1.0) / sqrt(t*t + real(1.0));
+                real s = t*c;
+                real tau = s / (real(1.0) + c);
+
+                a[p][p] -= t*apq;
+                a[q][q] += t*apq;
+                a[p][q] = a[q][p] = real(0.0);
+                real arp = a[r][p], arq = a[r][q];
+                a[r][p] = a[p][r] = arp - s*(arq + tau*arp);
+                a[r][q] = a[q][r] = arq + s*(arp - tau*arq);
+                for (int i=0; i<3; i++)
+                {
+                    real vip = v[i][p], viq = v[i][q];
+                    v[i][p] = vip - s*(viq + tau*vip);
+                    v[i][q] = viq + s*(vip - tau*viq);
+                }
+            }
+        }
+
+        int order[3] = { 0, 1, 2 };
+        for (int i=0; i<2; i++)
+        {
+            for (int j=i+1; j<3; j++)
+            {
+                if (a[order[j]][order[j]] > a[order[i]][order[i]])
+                {
+                    int swap = order[i];
+                    order[i] = order[j];
+                    order[j] = swap;
+                }
+            }
+        }
+        for (int i=0; i<3; i++)
+        {
+            values[i] = a[order[i]][order[i]];
+            for (int j=0; j<3; j++)
+                vectors._data[i*3+j] = v[j][order[i]];
+        }
+
+        // right handed: z = x ^ y
+        if (vectors.determinant() < real(0.0))
+        {
+            for (int j=6; j<9; j++)
+                vectors._data[j] = -vectors._data[j];
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setScale(const Vector3T<real> &scale)
+    {
+        Vector3T<real> x(_data[0], _data[1], _data[2]);
+        Vector3T<real> y(_data[3], _data[4], _data[5]);
+        Vector3T<real> z(_data[6], _data[7], _data[8]);
+        x.normalizeInPlace();
+        y.normalizeInPlace();
+        z.normalizeInPlace();
+        x *= scale.x;
+        y *= scale.y;
+        z *= scale.z;
+
+        this->set(
+            x.x, x.y, x.z,
+            y.x, y.y, y.z,
+            z.x, z.y, z.z );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::setScale(real sX, real sY, real sZ)
+    {
+        Vector3T<real> x(_data[0], _data[1], _data[2]);
+        Vector3T<real> y(_data[3], _data[4], _data[5]);
+        Vector3T<real> z(_data[6], _data[7], _data[8]);
+        x.normalizeInPlace();
+        y.normalizeInPlace();
+        z.normalizeInPlace();
+        x *= sX;
+        y *= sY;
+        z *= sZ;
+
+        this->set(
+            x.x, x.y, x.z,
+            y.x, y.y, y.z,
+            z.x, z.y, z.z );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::addScale(const Vector3T<real> &scale)
+    {
+        _data[0]+=scale.x; _data[1]+=scale.x; _data[2]+=scale.x;
+        _data[3]+=scale.y; _data[4]+=scale.y; _data[5]+=scale.y;
+        _data[6]+=scale.z; _data[7]+=scale.z; _data[8]+=scale.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::addScale(real sX, real sY, real sZ)
+    {
+        _data[0]+=sX; _data[1]+=sX; _data[2]+=sX;
+        _data[3]+=sY; _data[4]+=sY; _data[5]+=sY;
+        _data[6]+=sZ; _data[7]+=sZ; _data[8]+=sZ;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix3T<real>::getScale() const
+    {
+        Vector3T<real> x(_data[0], _data[1], _data[2]);
+        Vector3T<real> y(_data[3], _data[4], _data[5]);
+        Vector3T<real> z(_data[6], _data[7], _data[8]);
+
+        return Vector3T<real>(x.length(), y.length(), z.length());
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::fromQuaternion(const QuaternionT<real>& rotationQuat)
+    {
+        *this = rotationQuat.toMatrix3();
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> Matrix3T<real>::toQuaternion() const
+    {
+        QuaternionT<real> quat;
+        quat.fromMatrix3( (*this) );
+        return quat;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::toQuaternion(QuaternionT<real> &outQuaternion) const
+    {
+        outQuaternion.fromMatrix3( (*this) );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::fromEuler(const real& angleX, const real& angleY, const real& angleZ, RotationOrder order)
+    {
+        switch (order)
+        {
+        case RotationOrder::XYZ :
+            fromEuler<RotationOrder::XYZ>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::XZY :
+            fromEuler<RotationOrder::XZY>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::YXZ :
+            fromEuler<RotationOrder::YXZ>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::YZX :
+            fromEuler<RotationOrder::YZX>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::ZXY :
+            fromEuler<RotationOrder::ZXY>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::ZYX :
+            fromEuler<RotationOrder::ZYX>(angleX, angleY, angleZ);
+            break;
+        }
+    }
+
+    template <typename real>
+    template <RotationOrder ORDER>
+    GMATH_INLINE void Matrix3T<real>::fromEuler(real angleX, real angleY, real angleZ)
+    {
+        const real angles[3] = { angleX, angleY, angleZ };
+        detail::eulerToMatrix3<ORDER>(angles, _data);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::fromEuler(const EulerT<real> &rotation, RotationOrder order)
+    {   
+        // ensure euler is radians
+        EulerT<real> r = rotation.toRadians();
+        fromEuler(r.x, r.y, r.z, order);
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real> Matrix3T<real>::toEuler(RotationOrder order) const
+    {
+        // ensure euler is radians
+        EulerT<real> retAngles(Unit::radians);
+        toEuler(retAngles, order);
+        return retAngles;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::toEuler(EulerT<real>& euler, RotationOrder order) const
+    {
+        switch (order)
+        {
+        case RotationOrder::XZY :
+            euler = toEuler<RotationOrder::XZY>();
+            break;
+        case RotationOrder::YXZ :
+            euler = toEuler<RotationOrder::YXZ>();
+            break;
+        case RotationOrder::YZX :
+            euler = toEuler<RotationOrder::YZX>();
+            break;
+        case RotationOrder::ZXY :
+            euler = toEuler<RotationOrder::ZXY>();
+            break;
+        case RotationOrder::ZYX :
+            euler = toEuler<RotationOrder::ZYX>();
+            break;
+        default:
+            euler = toEuler<RotationOrder::XYZ>();
+        }
+    }
+
+    template <typename real>
+    template <RotationOrder ORDER>
+    GMATH_INLINE EulerT<real> Matrix3T<real>::toEuler() const
+    {
+        EulerT<real> euler(Unit::radians);
+        detail::MatrixRotation<real, 3> rotation = { _data };
+        detail::eulerFromRotation<ORDER>(rotation, euler.data());
+        return euler;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::fromVectorToVector(const Vector3T<real> &fromVec, const Vector3T<real> &toVec)
+    {
+        Vector3T<real> x, u, v;
+        real e = fromVec.dot(toVec);
+        real f = fabs(e);
+
+        if (f > 1.0-gmath::EPSILON) // "from" and "to" vectors parallel or almost parallel
+        {
+            real fx = fabs(fromVec.x);
+            real fy = fabs(fromVec.y);
+            real fz = fabs(fromVec.z);
+
+            if (fx<fy)
+            {
+                if (fx<fz) {
+                    x.set(1.0, 0.0, 0.0);
+                }
+                else {
+                    x.set(0.0, 0.0, 1.0);
+                }
+            }
+            else
+            {
+                if (fy<fz) {
+                    x.set(0.0, 1.0, 0.0);
+                }
+                else {
+                    x.set(0.0, 0.0, 1.0);
+                }
+            }
+
+            u = x - fromVec;
+            v = x - toVec;
+
+            real c1 = 2.0/(u.dot(u));
+            real c2 = 2.0/(v.dot(v));
+            real c3 = v.dot(u*(c1*c2));
+
+            real uvals[3];
+            real vvals[3];
+            uvals[0]=u.x; uvals[1]=u.y; uvals[2]=u.z;
+            vvals[0]=v.x; vvals[1]=v.y; vvals[2]=v.z;
+            for (unsigned int i=0; i<3; i++)
+            {
+                for (unsigned int j=0; j<3; j++)
+                {
+                    this->_data[i*3+j] =  - c1*uvals[i]*uvals[j] - c2*vvals[i]*vvals[j] + c3*vvals[i]*uvals[j];
+                }
+                this->_data[i*4] += 1.0;
+            }
+        }
+        else  // the most common case, unless "from"="to", or "from"=-"to"
+        {
+            v = fromVec.cross(toVec);
+            real h = 1.0/(1.0 + e);    // optimization by Gottfried Chen
+            real hvx = h*v.x;
+            real hvz = h*v.z;
+            real hvxy = hvx*v.y;
+            real hvxz = hvx*v.z;
+            real hvyz = hvz*v.y;
+
+
+            this->_data[0] = e + hvx*v.x;
+            this->_data[1] = hvxy - v.z;
+            this->_data[2] = hvxz + v.y;
+
+            this->_data[3] = hvxy + v.z;
+            this->_data[4] = e + h*v.y*v.y;
+            this->_data[5] = hvyz - v.x;
+
+            this->_data[6] = hvxz - v.y;
+            this->_data[7] = hvyz + v.x;
+            this->_data[8] = e + hvz*v.z;
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::lookAt(const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis, Axis secondaryAxis)
+    {
+        Vector3T<real> primary, secondary, terziary;
+        
+        primary = pointAt;
+        secondary = normal;
+        primary.normalizeInPlace();
+        secondary.normalizeInPlace();
+
+        /*
+        double f = fabs( primary.dot(secondary) );
+        if (f > 1.0-gmath::EPSILON)
+            throw GMathError("gMatrix4:\n\ttarget vector and up vector are perpendicular, impossible to create a matrix out of them.");
+        */
+        
+        terziary = secondary.crossNormalize(primary);
+        secondary = primary.crossNormalize(terziary);
+
+
+        if ( ((int)primaryAxis<0) && ((int)secondaryAxis>0) ) 
+        {
+            primary  *= -1.0;
+            terziary *= -1.0;
+        }
+        else if ( ((int)primaryAxis>0) && ((int)secondaryAxis<0) ) 
+        {
+            secondary *= -1.0;
+            terziary  *= -1.0;
+        }
+        else if ( ((int)primaryAxis<0) && ((int)secondaryAxis<0) )
+        {
+            primary   *= -1.0;
+            secondary *= -1.0;
+        } 
+
+        if (primaryAxis == Axis::POSX || primaryAxis == Axis::NEGX)
+        {
+            if (secondaryAxis == Axis::POSY || secondaryAxis == Axis::NEGY)
+            {
+                this->setAxisX(primary);
+                this->setAxisY(secondary);
+                this->setAxisZ(-terziary);
+            }
+            else if (secondaryAxis == Axis::POSZ || secondaryAxis == Axis::NEGZ)
+            {
+                this->setAxisX(primary);
+                this->setAxisY(terziary);
+                this->setAxisZ(secondary);
+            }
+        }
+        else if (primaryAxis == Axis::POSY || primaryAxis == Axis::NEGY)
+        {
+            if (secondaryAxis == Axis::POSX || secondaryAxis == Axis::NEGX)
+            {
+                this->setAxisX(secondary);
+                this->setAxisY(primary);
+                this->setAxisZ(terziary);
+            }
+            else if (secondaryAxis == Axis::POSZ || secondaryAxis == Axis::NEGZ)
+            {
+                this->setAxisX(-terziary);
+                this->setAxisY(primary);
+                this->setAxisZ(secondary);
+            }
+        }
+        else if (primaryAxis == Axis::POSZ || primaryAxis == Axis::NEGZ)
+        {
+            if (secondaryAxis == Axis::POSX || secondaryAxis == Axis::NEGX)
+            {
+                this->setAxisX(secondary);
+                this->setAxisY(-terziary);
+                this->setAxisZ(primary);
+            }
+            else if (secondaryAxis == Axis::POSY || secondaryAxis == Axis::NEGY)
+            {
+                this->setAxisX(terziary);
+                this->setAxisY(secondary);
+                this->setAxisZ(primary);
+            }
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix3T<real>::createLookAt(const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis, Axis secondaryAxis)
+    {
+        Matrix3T<real> mat;
+        mat.lookAt(pointAt, normal, primaryAxis, secondaryAxis);
+        return mat;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix3T<real>::fromAxisAngle(const Vector3T<real> &axis, real angle)
+    {
+        real sqr_a = axis.x*axis.x;
+        real sqr_b = axis.y*axis.y;
+        real sqr_c = axis.z*axis.z;
+        real len2  = sqr_a+sqr_b+sqr_c;
+
+        real k2    = cos(angle);
+        real k1    = (1.0-k2)/len2;
+        real k3    = sin(angle)/sqrt(len2);
+        real k1ab  = k1*axis.x*axis.y;
+        real k1ac  = k1*axis.x*axis.z;
+        real k1bc  = k1*axis.y*axis.z;
+        real k3a   = k3*axis.x;
+        real k3b   = k3*axis.y;
+        real k3c   = k3*axis.z;
+
+        _data[0] = k1*sqr_a+k2; _data[1] = k1ab+k3c;    _data[2] = k1ac-k3b;
+        _data[3] = k1ab-k3c;    _data[4] = k1*sqr_b+k2; _data[5] = k1bc+k3a;
+        _data[6] = k1ac+k3b;    _data[7] = k1bc-k3a;    _data[8] = k1*sqr_c+k2;
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string Matrix3T<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Matrix3(" << _data[0] << ", " << _data[1] << ", " << _data[2] << std::endl;
+        oss << "               " << _data[3] << ", " << _data[4] << ", " << _data[5] << std::endl;
+        oss << "               " << _data[6] << ", " << _data[7] << ", " << _data[8] << ");";
+
+        return oss.str();
+    }
+
+
+    template <typename real>
+    GMATH_INLINE const Matrix3T<real> Matrix3T<real>::IDENTITY = Matrix3T<real>(1.0, 0.0, 0.0,
+                                              0.0, 1.0, 0.0,
+                                              0.0, 0.0, 1.0);
+}
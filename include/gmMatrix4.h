@@ -1,10 +1,12 @@
 #pragma once
+#define GMATH_MATRIX4_BEGIN
 
 #include "gmRoot.h"
 #include "gmVector3.h"
 #include "gmVector4.h"
 #include "gmMatrix3.h"
 #include "gmEuler.h"
+#include "gmSimd.h"
 
 #ifdef CMAYA
     #include <maya/MMatrix.h>
@@ -19,7 +21,7 @@ namespace gmath
 {
 
     // Quaternion forward declaration
-    class Quaternion;
+    template <typename real> class QuaternionT;
 
     /**
     Matrix class (4x4).
@@ -31,146 +33,150 @@ namespace gmath
     This class represents a 4x4 matrix that can be used to store transformations.
     This matrix is ROW MAJOR.
     */
-    class Matrix4
+    template <typename real>
+    class Matrix4T
     {
     private:
         /*------ properties ------*/
-        double _data[16];
+        real _data[16];
     
     public:
         /*------ constructors ------*/
-        Matrix4();
-        Matrix4(double xx, double xy, double xz, double xw,
-                double yx, double yy, double yz, double yw,
-                double zx, double zy, double zz, double zw,
-                double px, double py, double pz, double pw);
+        Matrix4T();
+        Matrix4T(real xx, real xy, real xz, real xw,
+                real yx, real yy, real yz, real yw,
+                real zx, real zy, real zz, real zw,
+                real px, real py, real pz, real pw);
 
-        Matrix4(const Matrix4 &other);
+        Matrix4T(const Matrix4T &other);
+        /** Conversion from the other precision, for example Matrix4f(aMatrix4). */
+        template <typename otherReal>
+        explicit Matrix4T(const Matrix4T<otherReal>& other);
 
-        Matrix4(const Vector4 &row0,
-                const Vector4 &row1,
-                const Vector4 &row2,
-                const Vector4 &row3);
+        Matrix4T(const Vector4T<real> &row0,
+                const Vector4T<real> &row1,
+                const Vector4T<real> &row2,
+                const Vector4T<real> &row3);
 
-        Matrix4(const Vector3 &row0,
-                const Vector3 &row1,
-                const Vector3 &row2,
-                const Vector3 &row3);
+        Matrix4T(const Vector3T<real> &row0,
+                const Vector3T<real> &row1,
+                const Vector3T<real> &row2,
+                const Vector3T<real> &row3);
 
-        Matrix4(const Vector3 &row0,
-                const Vector3 &row1,
-                const Vector3 &row2);
+        Matrix4T(const Vector3T<real> &row0,
+                const Vector3T<real> &row1,
+                const Vector3T<real> &row2);
 
-        Matrix4(const Quaternion& quat);
-        Matrix4(const Quaternion& quat, const Vector3& pos);
+        Matrix4T(const QuaternionT<real>& quat);
+        Matrix4T(const QuaternionT<real>& quat, const Vector3T<real>& pos);
 
-        Matrix4(const double* list);
-        Matrix4(const std::vector<double>& values);
+        Matrix4T(const real* list);
+        Matrix4T(const std::vector<real>& values);
 
         /** Pointer access for direct copying. */
-        double* data();
-        const double* data() const;
+        real* data();
+        const real* data() const;
 
         /*------ coordinate access ------*/
-        double operator[] (int i) const;
-        double &operator[] (int i);
-        double operator() (int row, int col) const;
-        double &operator() (int row, int col);
+        real operator[] (int i) const;
+        real &operator[] (int i);
+        real operator() (int row, int col) const;
+        real &operator() (int row, int col);
 
         /*------ Arithmetic operations ------*/
-        Matrix4 operator + (const double &value) const;
-        Matrix4 operator + (const Matrix4 &other) const;
-        Matrix4 operator - (const double &value) const;
-        Matrix4 operator - (const Matrix4 &other) const;
-        Matrix4 operator / (const double &value) const;
-        Matrix4 operator * (const double &value) const;
-        Matrix4 operator * (const Matrix4 &other) const;
+        Matrix4T operator + (const real &value) const;
+        Matrix4T operator + (const Matrix4T &other) const;
+        Matrix4T operator - (const real &value) const;
+        Matrix4T operator - (const Matrix4T &other) const;
+        Matrix4T operator / (const real &value) const;
+        Matrix4T operator * (const real &value) const;
+        Matrix4T operator * (const Matrix4T &other) const;
 
         /*------ Arithmetic updates ------*/
-        Matrix4& operator += (const double &value);
-        Matrix4& operator += (const Matrix4 &other);
-        Matrix4& operator -= (const double &value);
-        Matrix4& operator -= (const Matrix4 &other);
-        Matrix4& operator /= (const double &value);
-        Matrix4& operator *= (const double &value);
-        Matrix4& operator *= (const Matrix4 &other);
+        Matrix4T& operator += (const real &value);
+        Matrix4T& operator += (const Matrix4T &other);
+        Matrix4T& operator -= (const real &value);
+        Matrix4T& operator -= (const Matrix4T &other);
+        Matrix4T& operator /= (const real &value);
+        Matrix4T& operator *= (const real &value);
+        Matrix4T& operator *= (const Matrix4T &other);
 
         /*------ Comparisons ------*/
-        bool operator == (const Matrix4 &other) const;
-        bool operator != (const Matrix4 &other) const;
+        bool operator == (const Matrix4T &other) const;
+        bool operator != (const Matrix4T &other) const;
 
         /*------ Assignment ------*/
-        void operator = (const Matrix4 &other);
+        void operator = (const Matrix4T &other);
 
         /*------ Sets and Gets ------*/
-        void set(double xx, double xy, double xz, double xw,
-                 double yx, double yy, double yz, double yw,
-                 double zx, double zy, double zz, double zw,
-                 double px, double py, double pz, double pw);
-        void set(const double* values);
-        void set(const std::vector<double>& values);
+        void set(real xx, real xy, real xz, real xw,
+                 real yx, real yy, real yz, real yw,
+                 real zx, real zy, real zz, real zw,
+                 real px, real py, real pz, real pw);
+        void set(const real* values);
+        void set(const std::vector<real>& values);
 
         void setToIdentity();
 
-        Vector3 getRow(unsigned int i) const;
-        Vector4 getRow2(unsigned int i) const;
-        void setRow(unsigned int i, const Vector3 &vec);
-        void setRow(unsigned int i, const Vector4 &vec);
+        Vector3T<real> getRow(unsigned int i) const;
+        Vector4T<real> getRow2(unsigned int i) const;
+        void setRow(unsigned int i, const Vector3T<real> &vec);
+        void setRow(unsigned int i, const Vector4T<real> &vec);
         
-        Vector3 getAxisX() const;
-        Vector3 getAxisY() const;
-        Vector3 getAxisZ() const;
+        Vector3T<real> getAxisX() const;
+        Vector3T<real> getAxisY() const;
+        Vector3T<real> getAxisZ() const;
         
-        void setAxisX(const Vector3 &vec);
-        void setAxisY(const Vector3 &vec);
-        void setAxisZ(const Vector3 &vec);
-
-        void setPosition(const Vector3 &pos);
-        void setPosition(double inX, double inY, double inZ);
-        void addPosition(const Vector3 &pos);
-        void addPosition(double inX, double inY, double inZ);
+        void setAxisX(const Vector3T<real> &vec);
+        void setAxisY(const Vector3T<real> &vec);
+        void setAxisZ(const Vector3T<real> &vec);
+
+        void setPosition(const Vector3T<real> &pos);
+        void setPosition(real inX, real inY, real inZ);
+        void addPosition(const Vector3T<real> &pos);
+        void addPosition(real inX, real inY, real inZ);
         /** Move the matrix accordingly to its axis, no the world axis */
-        void translate(const Vector3 &pos);
-        void translate(double inX, double inY, double inZ);
-        Vector3 getPosition() const;
+        void translate(const Vector3T<real> &pos);
+        void translate(real inX, real inY, real inZ);
+        Vector3T<real> getPosition() const;
 
-        void setRotation(const Matrix3& rotationMatrix);
-        void setRotation(const Quaternion& rotationQuat);
-        void setRotation(const Euler &rotation, RotationOrder order=RotationOrder::XYZ);
-        void setRotation(double angleX, double angleY, double angleZ, RotationOrder order=RotationOrder::XYZ);
+        void setRotation(const Matrix3T<real>& rotationMatrix);
+        void setRotation(const QuaternionT<real>& rotationQuat);
+        void setRotation(const EulerT<real> &rotation, RotationOrder order=RotationOrder::XYZ);
+        void setRotation(real angleX, real angleY, real angleZ, RotationOrder order=RotationOrder::XYZ);
 
-        void setScale(const Vector3 &scale);
-        void setScale(double sX, double sY, double sZ);
-        void addScale(const Vector3 &scale);
-        void addScale(double sX, double sY, double sZ);
-        Vector3 getScale() const;
+        void setScale(const Vector3T<real> &scale);
+        void setScale(real sX, real sY, real sZ);
+        void addScale(const Vector3T<real> &scale);
+        void addScale(real sX, real sY, real sZ);
+        Vector3T<real> getScale() const;
 
         /** Remember to take out scale first */
-        Matrix3 toMatrix3() const;
-        Quaternion toQuaternion() const;
-        Euler toEuler(RotationOrder order=RotationOrder::XYZ) const; 
-        void toMatrix3(Matrix3 &outMatrix3) const;
-        void toQuaternion(Quaternion &outQuaternion) const;
-        void toEuler(Euler &outEuler, RotationOrder order=RotationOrder::XYZ) const;
-
-        void fromMatrix3(const Matrix3 &inMat3);
-        void fromQuaternion(const Quaternion &inQuat);
-        void fromEuler(const double &angleX, const double &angleY, const double &angleZ, RotationOrder order=RotationOrder::XYZ);
-        void fromEuler(const Euler &inEuler, RotationOrder order=RotationOrder::XYZ);
+        Matrix3T<real> toMatrix3() const;
+        QuaternionT<real> toQuaternion() const;
+        EulerT<real> toEuler(RotationOrder order=RotationOrder::XYZ) const; 
+        void toMatrix3(Matrix3T<real> &outMatrix3) const;
+        void toQuaternion(QuaternionT<real> &outQuaternion) const;
+        void toEuler(EulerT<real> &outEuler, RotationOrder order=RotationOrder::XYZ) const;
+
+        void fromMatrix3(const Matrix3T<real> &inMat3);
+        void fromQuaternion(const QuaternionT<real> &inQuat);
+        void fromEuler(const real &angleX, const real &angleY, const real &angleZ, RotationOrder order=RotationOrder::XYZ);
+        void fromEuler(const EulerT<real> &inEuler, RotationOrder order=RotationOrder::XYZ);
         
-        Vector3 rotateVector(const Vector3 &vec) const;
+        Vector3T<real> rotateVector(const Vector3T<real> &vec) const;
 
-        Matrix4 transpose() const;
+        Matrix4T transpose() const;
         void transposeInPlace();
 
         /** The determinant of a matrix is a floating point value which is used to
             indicate whether the matrix has an inverse or not. If zero, then no inverse exists. */
-        double determinant() const;
+        real determinant() const;
 
-        Matrix4 inverse() const;
+        Matrix4T inverse() const;
         void inverseInPlace();
 
-        Matrix4 orthogonal() const;
+        Matrix4T orthogonal() const;
         void orthogonalInPlace();
 
         /* Returns a rotation matrix that rotates one vector into another.
@@ -184,24 +190,51 @@ namespace gmath
             Efficiently Building a Matrix to Rotate One Vector to Another
             Journal of Graphics Tools, 4(4):1-4, 1999
             http://www.acm.org/jgt/papers/MollerHughes99/ */
-        void fromVectorToVector(const Vector3 &fromVec, const Vector3 &toVec);
+        void fromVectorToVector(const Vector3T<real> &fromVec, const Vector3T<real> &toVec);
 
         /** Look from pos to target.
           *
           * The resulting transformation is a rotation Matrix where the primaryAxis points to target.
           * The secondaryAxis is as close as possible to the up vector. */
-        void lookAt(const Vector3 &pos, const Vector3 &pointAt, const Vector3 &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
+        void lookAt(const Vector3T<real> &pos, const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
         // Like the previous lookAt but this one takes the position from the matrix itself
-        void lookAt(const Vector3 &pointAt, const Vector3 &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
-        static Matrix4 createLookAt(const Vector3 &pos, const Vector3 &pointAt, const Vector3 &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
-
-        void fromAxisAngle(const Vector3 &axis, double angle);
+        void lookAt(const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
+        static Matrix4T createLookAt(const Vector3T<real> &pos, const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis=Axis::POSZ, Axis secondaryAxis=Axis::POSY);
+
+        /** Perspective projection of a camera looking down -Z, the OpenGL one (gluPerspective) for row vectors:
+          * the clip coordinates of p are (p.x, p.y, p.z, 1) * mat, the points between zNear and zFar in front
+          * of the camera get x/w, y/w and z/w in [-1, 1]. Use it with the inverse of the camera matrix, made
+          * by lookAt with the primary axis NEGZ.
+          * fovY is the vertical field of view in radians, aspect the width over the height.
+          * Throws GMathError unless 0 < fovY < PI, aspect > 0 and 0 < zNear < zFar. */
+        void setPerspective(real fovY, real aspect, real zNear, real zFar);
+        /** The same with the edges of the view on the near plane, off center when left != -right (glFrustum). */
+        void setPerspective(real left, real right, real bottom, real top, real zNear, real zFar);
+        /** Orthographic projection of the box from left to right, bottom to top and -zNear to -zFar on z (glOrtho),
+          * to [-1, 1] on every axis. Throws GMathError when a range is empty. */
+        void setOrthographic(real left, real right, real bottom, real top, real zNear, real zFar);
+        static Matrix4T createPerspective(real fovY, real aspect, real zNear, real zFar);
+        static Matrix4T createPerspective(real left, real right, real bottom, real top, real zNear, real zFar);
+        static Matrix4T createOrthographic(real left, real right, real bottom, real top, real zNear, real zFar);
+
+        void fromAxisAngle(const Vector3T<real> &axis, real angle);
 
         std::string toString() const;
 
         // Special Matrices.
-        static const Matrix4 IDENTITY;
+        static const Matrix4T IDENTITY;
     };
-}
 
+    typedef Matrix4T<double> Matrix4;
+    typedef Matrix4T<float> Matrix4f;
 
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class Matrix4T<float>;
+        extern template class Matrix4T<double>;
+    #endif
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_MATRIX4_END
+    #include "gmInline.h"
+#endif
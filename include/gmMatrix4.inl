@@ -0,0 +1,1285 @@
+namespace gmath
+{
+    /*------ Constructors ------*/
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T()
+    {
+        _data[0]=1.0;  _data[1]=0.0;  _data[2]=0.0;  _data[3]=0.0;
+        _data[4]=0.0;  _data[5]=1.0;  _data[6]=0.0;  _data[7]=0.0;
+        _data[8]=0.0;  _data[9]=0.0; _data[10]=1.0; _data[11]=0.0;
+        _data[12]=0.0; _data[13]=0.0; _data[14]=0.0; _data[15]=1.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(
+        real xx, real xy, real xz, real xw,
+        real yx, real yy, real yz, real yw,
+        real zx, real zy, real zz, real zw,
+        real px, real py, real pz, real pw)
+    {
+        _data[0]=xx;  _data[1]=xy;  _data[2]=xz;  _data[3]=xw;
+        _data[4]=yx;  _data[5]=yy;  _data[6]=yz;  _data[7]=yw;
+        _data[8]=zx;  _data[9]=zy;  _data[10]=zz; _data[11]=zw;
+        _data[12]=px; _data[13]=py; _data[14]=pz; _data[15]=pw;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(const Matrix4T<real> & other)
+    {
+        memcpy(_data, other._data, 16*sizeof(real));
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(const Matrix4T<otherReal>& other)
+    {
+        const otherReal* values = other.data();
+        for (int i=0; i<16; i++)
+            _data[i] = real(values[i]);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(
+        const Vector4T<real> &row0,
+        const Vector4T<real> &row1,
+        const Vector4T<real> &row2,
+        const Vector4T<real> &row3)
+    {
+        memcpy(&_data[0],  row0.data(), 4*sizeof(real));
+        memcpy(&_data[4],  row1.data(), 4*sizeof(real));
+        memcpy(&_data[8],  row2.data(), 4*sizeof(real));
+        memcpy(&_data[12], row3.data(), 4*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(
+        const Vector3T<real> &row0,
+        const Vector3T<real> &row1,
+        const Vector3T<real> &row2,
+        const Vector3T<real> &row3)
+    {
+        memcpy(&_data[0],  row0.data(), 3*sizeof(real));
+        memcpy(&_data[4],  row1.data(), 3*sizeof(real));
+        memcpy(&_data[8],  row2.data(), 3*sizeof(real));
+        memcpy(&_data[12], row3.data(), 3*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(
+        const Vector3T<real> &row0,
+        const Vector3T<real> &row1,
+        const Vector3T<real> &row2)
+    {
+        memcpy(&_data[0],  row0.data(), 3*sizeof(real));
+        memcpy(&_data[4],  row1.data(), 3*sizeof(real));
+        memcpy(&_data[8],  row2.data(), 3*sizeof(real));
+        _data[12]=0.0; _data[13]=0.0; _data[14]=0.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(const QuaternionT<real> &quat)
+    {
+        quat.setMatrix4((*this));
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(const QuaternionT<real> &quat, const Vector3T<real> &pos)
+    {
+        quat.setMatrix4((*this));
+        this->setPosition(pos);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(const real* values)
+    {
+        set(values);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>::Matrix4T(const std::vector<real>& values)
+    {
+        set(values);
+    }
+
+    /*------ Coordinates access ------*/
+
+    template <typename real>
+    GMATH_INLINE real* Matrix4T<real>::data()
+    {
+        return &_data[0];
+    }
+
+    template <typename real>
+    GMATH_INLINE const real* Matrix4T<real>::data() const
+    {
+        return &_data[0];
+    }
+
+    template <typename real>
+    GMATH_INLINE real Matrix4T<real>::operator[] (int i) const
+    {
+        if (i>=0 && i<16)
+        {
+            return this->_data[i];
+        }
+        else {
+            throw out_of_range("gmath::Matrix3: index out of range");
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE real& Matrix4T<real>::operator[] (int i)
+    {
+        if (i>=0 && i<16)
+        {
+            return this->_data[i];
+        }
+        else {
+            throw out_of_range("gmath::Vector4: index out of range");
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE real Matrix4T<real>::operator() (int row, int col) const
+    {
+        if (row>=0 && row<4 && col>=0 && col<4)
+        {
+            return this->_data[row*4+col];
+        }
+        else
+        {
+            throw out_of_range("gmath::Matrix4: row or column index out of range");
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE real &Matrix4T<real>::operator() (int row, int col)
+    {
+        if (row>=0 && row<4 && col>=0 && col<4)
+        {
+            return this->_data[row*4+col];
+        }
+        else
+        {
+            throw out_of_range("gmath::Matrix4: row or column index out of range");
+        }
+    }
+
+    /*------ Arithmetic operations ------*/
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator + (const real &value) const
+    {
+        Matrix4T<real> retMatrix(
+            _data[0]+value,  _data[1]+value,  _data[2]+value,  _data[3]+value,
+            _data[4]+value,  _data[5]+value,  _data[6]+value,  _data[7]+value,
+            _data[8]+value,  _data[9]+value,  _data[10]+value, _data[11]+value,
+            _data[12]+value, _data[13]+value, _data[14]+value, _data[15]+value
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator + (const Matrix4T<real> &other) const
+    {
+        const real* b = other.data();
+        Matrix4T<real> retMatrix(
+            _data[0]+b[0],   _data[1]+b[1],   _data[2]+b[2],   _data[3]+b[3],
+            _data[4]+b[4],   _data[5]+b[5],   _data[6]+b[6],   _data[7]+b[7],
+            _data[8]+b[8],   _data[9]+b[9],   _data[10]+b[10], _data[11]+b[11],
+            _data[12]+b[12], _data[13]+b[13], _data[14]+b[14], _data[15]+b[15]
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator - (const real &value) const
+    {
+        Matrix4T<real> retMatrix(
+            _data[0]-value,  _data[1]-value,  _data[2]-value,  _data[3]-value,
+            _data[4]-value,  _data[5]-value,  _data[6]-value,  _data[7]-value,
+            _data[8]-value,  _data[9]-value,  _data[10]-value, _data[11]-value,
+            _data[12]-value, _data[13]-value, _data[14]-value, _data[15]-value
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator - (const Matrix4T<real> &other) const
+    {
+        const real* b = other.data();
+        Matrix4T<real> retMatrix(
+            _data[0]-b[0],   _data[1]-b[1],   _data[2]-b[2],   _data[3]-b[3],
+            _data[4]-b[4],   _data[5]-b[5],   _data[6]-b[6],   _data[7]-b[7],
+            _data[8]-b[8],   _data[9]-b[9],   _data[10]-b[10], _data[11]-b[11],
+            _data[12]-b[12], _data[13]-b[13], _data[14]-b[14], _data[15]-b[15]
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator / (const real &value) const
+    {
+        Matrix4T<real> retMatrix(
+            _data[0]/value,  _data[1]/value,  _data[2]/value,  _data[3]/value,
+            _data[4]/value,  _data[5]/value,  _data[6]/value,  _data[7]/value,
+            _data[8]/value,  _data[9]/value,  _data[10]/value, _data[11]/value,
+            _data[12]/value, _data[13]/value, _data[14]/value, _data[15]/value
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator * (const real &value) const
+    {
+        Matrix4T<real> retMatrix(
+            _data[0]*value,  _data[1]*value,  _data[2]*value,  _data[3]*value,
+            _data[4]*value,  _data[5]*value,  _data[6]*value,  _data[7]*value,
+            _data[8]*value,  _data[9]*value,  _data[10]*value, _data[11]*value,
+            _data[12]*value, _data[13]*value, _data[14]*value, _data[15]*value
+            );
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::operator * (const Matrix4T<real> &other) const
+    {
+        Matrix4T<real> retMatrix;
+        simd::multiply4x4(_data, other._data, retMatrix._data);
+        return retMatrix;
+    }
+
+    /*------ Arithmetic updates ------*/
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator += (const real &value)
+    {
+         _data[0]+=value;  _data[1]+=value;  _data[2]+=value;  _data[3]+=value;
+         _data[4]+=value;  _data[5]+=value;  _data[6]+=value;  _data[7]+=value;
+         _data[8]+=value;  _data[9]+=value; _data[10]+=value; _data[11]+=value;
+        _data[12]+=value; _data[13]+=value; _data[14]+=value; _data[15]+=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator += (const Matrix4T<real> &other)
+    {
+        const real* b = other.data();
+
+         _data[0]+=b[0];   _data[1]+=b[1];   _data[2]+=b[2];   _data[3]+=b[3];
+         _data[4]+=b[4];   _data[5]+=b[5];   _data[6]+=b[6];   _data[7]+=b[7];
+         _data[8]+=b[8];   _data[9]+=b[9];  _data[10]+=b[10]; _data[11]+=b[11];
+        _data[12]+=b[12]; _data[13]+=b[13]; _data[14]+=b[14]; _data[15]+=b[15];
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator -= (const real &value)
+    {
+         _data[0]-=value;  _data[1]-=value;  _data[2]-=value;  _data[3]-=value;
+         _data[4]-=value;  _data[5]-=value;  _data[6]-=value;  _data[7]-=value;
+         _data[8]-=value;  _data[9]-=value; _data[10]-=value; _data[11]-=value;
+        _data[12]-=value; _data[13]-=value; _data[14]-=value; _data[15]-=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator -= (const Matrix4T<real> &other)
+    {
+        const real* b = other.data();
+
+         _data[0]-=b[0];   _data[1]-=b[1];   _data[2]-=b[2];   _data[3]-=b[3];
+         _data[4]-=b[4];   _data[5]-=b[5];   _data[6]-=b[6];   _data[7]-=b[7];
+         _data[8]-=b[8];   _data[9]-=b[9];  _data[10]-=b[10]; _data[11]-=b[11];
+        _data[12]-=b[12]; _data[13]-=b[13]; _data[14]-=b[14]; _data[15]-=b[15];
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator /= (const real &value)
+    {
+         _data[0]/=value;  _data[1]/=value;  _data[2]/=value;  _data[3]/=value;
+         _data[4]/=value;  _data[5]/=value;  _data[6]/=value;  _data[7]/=value;
+         _data[8]/=value;  _data[9]/=value; _data[10]/=value; _data[11]/=value;
+        _data[12]/=value; _data[13]/=value; _data[14]/=value; _data[15]/=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator *= (const real &value)
+    {
+         _data[0]*=value;  _data[1]*=value;  _data[2]*=value;  _data[3]*=value;
+         _data[4]*=value;  _data[5]*=value;  _data[6]*=value;  _data[7]*=value;
+         _data[8]*=value;  _data[9]*=value; _data[10]*=value; _data[11]*=value;
+        _data[12]*=value; _data[13]*=value; _data[14]*=value; _data[15]*=value;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real>& Matrix4T<real>::operator *= (const Matrix4T<real> &other)
+    {
+        simd::multiply4x4(_data, other._data, _data);
+        return *this;
+    }
+
+    /*------ Comparisons ------*/
+
+    template <typename real>
+    GMATH_INLINE bool Matrix4T<real>::operator == (const Matrix4T<real> &other) const
+    {
+        const real* b = &other._data[0];
+        real e = gmath::EPSILON;
+        return (fabs(_data[0]-b[0])<e && fabs(_data[1]-b[1])<e && fabs(_data[2]-b[2])<e && fabs(_data[3]-b[3])<e && 
+                fabs(_data[4]-b[4])<e && fabs(_data[5]-b[5])<e && fabs(_data[6]-b[6])<e && fabs(_data[7]-b[7])<e && 
+                fabs(_data[8]-b[8])<e && fabs(_data[9]-b[9])<e && fabs(_data[10]-b[10])<e && fabs(_data[11]-b[11])<e &&
+                fabs(_data[12]-b[12])<e && fabs(_data[13]-b[13])<e && fabs(_data[14]-b[14])<e && fabs(_data[15]-b[15])<e);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool Matrix4T<real>::operator != (const Matrix4T<real> &other) const
+    {
+        const real* b = &other._data[0];
+        real e = gmath::EPSILON;
+        return (fabs(_data[0]-b[0])>e || fabs(_data[1]-b[1])>e || fabs(_data[2]-b[2])>e || fabs(_data[3]-b[3])>e ||
+                fabs(_data[4]-b[4])>e || fabs(_data[5]-b[5])>e || fabs(_data[6]-b[6])>e || fabs(_data[7]-b[7])>e || 
+                fabs(_data[8]-b[8])>e || fabs(_data[9]-b[9])>e || fabs(_data[10]-b[10])>e || fabs(_data[11]-b[11])>e ||
+                fabs(_data[12]-b[12])>e || fabs(_data[13]-b[13])>e || fabs(_data[14]-b[14])>e || fabs(_data[15]-b[15])>e);
+    }
+
+    /*------ Assignment ------*/
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::operator = (const Matrix4T<real> &other)
+    {
+        _data[ 0] = other._data[0];
+        _data[ 1] = other._data[1];
+        _data[ 2] = other._data[2];
+        _data[ 3] = other._data[3];
+        _data[ 4] = other._data[4];
+        _data[ 5] = other._data[5];
+        _data[ 6] = other._data[6];
+        _data[ 7] = other._data[7];
+        _data[ 8] = other._data[8];
+        _data[ 9] = other._data[9];
+        _data[10] = other._data[10];
+        _data[11] = other._data[11];
+        _data[12] = other._data[12];
+        _data[13] = other._data[13];
+        _data[14] = other._data[14];
+        _data[15] = other._data[15];
+    }
+    /*------ Methods ------*/
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setToIdentity()
+    {
+        _data[0] =1;  _data[1]=0;  _data[2]=0;  _data[3]=0;
+        _data[4] =0;  _data[5]=1;  _data[6]=0;  _data[7]=0;
+        _data[8] =0;  _data[9]=0; _data[10]=1; _data[11]=0;
+        _data[12]=0; _data[13]=0; _data[14]=0; _data[15]=1;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::set(
+        real xx, real xy, real xz, real xw,
+        real yx, real yy, real yz, real yw,
+        real zx, real zy, real zz, real zw,
+        real px, real py, real pz, real pw)
+    {
+        _data[0]=xx;  _data[1]=xy;  _data[2]=xz;  _data[3]=xw;
+        _data[4]=yx;  _data[5]=yy;  _data[6]=yz;  _data[7]=yw;
+        _data[8]=zx;  _data[9]=zy;  _data[10]=zz; _data[11]=zw;
+        _data[12]=px; _data[13]=py; _data[14]=pz; _data[15]=pw;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::set(const real* values)
+    {
+        memcpy(_data, values, 16*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::set(const std::vector<real>& values)
+    {
+        if (values.size()!=16) {
+            throw out_of_range("gmath::Matrix4: values must be of 16 elments");
+        }
+
+        memcpy(_data, values.data(), 16*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::getRow(unsigned int i) const
+    {
+        if (i>3)
+        {
+            throw out_of_range("gmath::Matrix4: index out of range");
+        }
+        return Vector3T<real>( _data[i*4], _data[i*4+1], _data[i*4+2] );
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real> Matrix4T<real>::getRow2(unsigned int i) const
+    {
+        if (i>3)
+        {
+            throw out_of_range("gmath::Matrix4: index out of range");
+        }
+        return Vector4T<real>( _data[i*4], _data[i*4+1], _data[i*4+2], _data[i*4+3] );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setRow(unsigned int i, const Vector3T<real> &vec)
+    {
+        if (i>3)
+        {
+            throw out_of_range("gmath::Matrix4: index out of range");
+        }
+        _data[i*4]   = vec.x;
+        _data[i*4+1] = vec.y;
+        _data[i*4+2] = vec.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setRow(unsigned int i, const Vector4T<real> &vec)
+    {
+        if (i>4)
+        {
+            throw out_of_range("gmath::Matrix4: index out of range");
+        }
+        _data[i*4]   = vec.x;
+        _data[i*4+1] = vec.y;
+        _data[i*4+2] = vec.z;
+        _data[i*4+3] = vec.w;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::getAxisX() const
+    {
+        return getRow(0);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::getAxisY() const
+    {
+        return getRow(1);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::getAxisZ() const
+    {
+        return getRow(2);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setAxisX(const Vector3T<real> &vec)
+    {
+        setRow(0, vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setAxisY(const Vector3T<real> &vec)
+    {
+        setRow(1, vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setAxisZ(const Vector3T<real> &vec)
+    {
+        setRow(2, vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setPosition(const Vector3T<real> &pos)
+    {
+        _data[12] = pos.x;
+        _data[13] = pos.y;
+        _data[14] = pos.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setPosition(real inX, real inY, real inZ)
+    {
+        _data[12] = inX;
+        _data[13] = inY;
+        _data[14] = inZ;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::addPosition(const Vector3T<real> &pos)
+    {
+        _data[12] += pos.x;
+        _data[13] += pos.y;
+        _data[14] += pos.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::addPosition(real inX, real inY, real inZ)
+    {
+        _data[12] += inX;
+        _data[13] += inY;
+        _data[14] += inZ;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::translate (const Vector3T<real> &pos)
+    {
+        _data[12] += pos.x * _data[0] + pos.y * _data[4] + pos.z * _data[8];
+        _data[13] += pos.x * _data[1] + pos.y * _data[5] + pos.z * _data[9];
+        _data[14] += pos.x * _data[2] + pos.y * _data[6] + pos.z * _data[10];
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::translate(real inX, real inY, real inZ)
+    {
+        _data[12] += inX * _data[0] + inY * _data[4] + inZ * _data[8];
+        _data[13] += inX * _data[1] + inY * _data[5] + inZ * _data[9];
+        _data[14] += inX * _data[2] + inY * _data[6] + inZ * _data[10];
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::getPosition() const
+    {
+        return Vector3T<real>( _data[12], _data[13], _data[14] );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setRotation(const Matrix3T<real>& rotationMatrix)
+    {
+        const real* rot = &rotationMatrix.data()[0];
+        _data[0]=rot[0];  _data[1]=rot[1];  _data[2]=rot[2];  
+        _data[4]=rot[3];  _data[5]=rot[4];  _data[6]=rot[5];
+        _data[8]=rot[6];  _data[9]=rot[7];  _data[10]=rot[8];
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setRotation(const QuaternionT<real>& rotationQuat)
+    {
+        real xx = 2.0 * rotationQuat.x * rotationQuat.x;
+        real yy = 2.0 * rotationQuat.y * rotationQuat.y;
+        real zz = 2.0 * rotationQuat.z * rotationQuat.z;
+        real xy = 2.0 * rotationQuat.x * rotationQuat.y;
+        real zw = 2.0 * rotationQuat.z * rotationQuat.w;
+        real xz = 2.0 * rotationQuat.x * rotationQuat.z;
+        real yw = 2.0 * rotationQuat.y * rotationQuat.w;
+        real yz = 2.0 * rotationQuat.y * rotationQuat.z;
+        real xw = 2.0 * rotationQuat.x * rotationQuat.w;
+        
+        _data[0]=1.0-yy-zz; _data[1]=xy+zw;     _data[2]=xz-yw;
+        _data[4]=xy-zw;     _data[5]=1.0-xx-zz; _data[6]=yz+xw;
+        _data[8]=xz+yw;     _data[9]=yz-xw;     _data[10]=1.0-xx-yy;
+
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setRotation(real angleX, real angleY, real angleZ, RotationOrder order)
+    {
+        real cx, sx, cy, sy, cz, sz;
+
+        cx = cos(angleX);
+        sx = sin(angleX);
+        cy = cos(angleY);
+        sy = sin(angleY);
+        cz = cos(angleZ);
+        sz = sin(angleZ);
+
+        Matrix3T<real> XMat(
+            1.0, 0.0, 0.0,
+            0.0,  cx,  sx,
+            0.0, -sx,  cx);
+
+        Matrix3T<real> YMat(
+             cy, 0.0, -sy,
+            0.0, 1.0, 0.0,
+             sy, 0.0,  cy);
+
+        Matrix3T<real> ZMat(
+             cz,  sz, 0.0,
+            -sz,  cz, 0.0,
+            0.0, 0.0, 1.0);
+
+        switch (order)
+        {
+        case RotationOrder::XYZ :
+            this->setRotation( XMat*(YMat*ZMat) );
+            break;
+        case RotationOrder::XZY :
+            this->setRotation( XMat*(ZMat*YMat) );
+            break;
+        case RotationOrder::YXZ :
+            this->setRotation( YMat*(XMat*ZMat) );
+            break;
+        case RotationOrder::YZX :
+            this->setRotation( YMat*(ZMat*XMat) );
+            break;
+        case RotationOrder::ZXY :
+            this->setRotation( ZMat*(XMat*YMat) );
+            break;
+        case RotationOrder::ZYX :
+            this->setRotation( ZMat*(YMat*XMat) );
+            break;
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setRotation(const EulerT<real> &rotation, RotationOrder order)
+    {
+        // ensure euler is radians
+        EulerT<real> r = rotation.toRadians();
+        this->setRotation(r.x, r.y, r.z, order);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::getScale() const
+    {
+        Vector3T<real> x(_data[0], _data[1], _data[2]);
+        Vector3T<real> y(_data[4], _data[5], _data[6]);
+        Vector3T<real> z(_data[8], _data[9], _data[10]);
+
+        return Vector3T<real>(x.length(), y.length(), z.length());
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setScale(const Vector3T<real> &scale)
+    {
+        Vector3T<real> x(_data[0], _data[1], _data[2]);
+        Vector3T<real> y(_data[4], _data[5], _data[6]);
+        Vector3T<real> z(_data[8], _data[9], _data[10]);
+        x.normalizeInPlace();
+        y.normalizeInPlace();
+        z.normalizeInPlace();
+        x *= scale.x;
+        y *= scale.y;
+        z *= scale.z;
+
+        _data[0]=x.x; _data[1]=x.y; _data[2]=x.z;
+        _data[4]=y.x; _data[5]=y.y; _data[6]=y.z;
+        _data[8]=z.x; _data[9]=z.y; _data[10]=z.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setScale(real sX, real sY, real sZ)
+    {
+        Vector3T<real> x(_data[0], _data[1], _data[2]);
+        Vector3T<real> y(_data[4], _data[5], _data[6]);
+        Vector3T<real> z(_data[8], _data[9], _data[10]);
+        x.normalizeInPlace();
+        y.normalizeInPlace();
+        z.normalizeInPlace();
+        x *= sX;
+        y *= sY;
+        z *= sZ;
+
+        _data[0]=x.x; _data[1]=x.y; _data[2]=x.z;
+        _data[4]=y.x; _data[5]=y.y; _data[6]=y.z;
+        _data[8]=z.x; _data[9]=z.y; _data[10]=z.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::addScale(const Vector3T<real> &scale)
+    {
+
+        _data[0]+=scale.x; _data[1]+=scale.x; _data[2]+=scale.x;
+        _data[4]+=scale.y; _data[5]+=scale.y; _data[6]+=scale.y;
+        _data[8]+=scale.z; _data[9]+=scale.z; _data[10]+=scale.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::addScale(real sX, real sY, real sZ)
+    {
+        _data[0]+=sX; _data[1]+=sX; _data[2]+=sX;
+        _data[4]+=sY; _data[5]+=sY; _data[6]+=sY;
+        _data[8]+=sZ; _data[9]+=sZ; _data[10]+=sZ;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> Matrix4T<real>::toMatrix3() const
+    {
+        Matrix3T<real> rot(
+            _data[0],  _data[1],  _data[2],  
+            _data[4],  _data[5],  _data[6],
+            _data[8],  _data[9],  _data[10]);
+        return rot;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> Matrix4T<real>::toQuaternion() const
+    {
+        QuaternionT<real> quat;
+        quat.fromMatrix4( (*this) );
+        return quat;
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real> Matrix4T<real>::toEuler(RotationOrder order) const
+    {
+        EulerT<real> retEuler(Unit::radians);
+        this->toEuler(retEuler, order);
+        return retEuler;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::toMatrix3(Matrix3T<real> &outMatrix3) const
+    {
+        outMatrix3.set(
+            _data[0], _data[1], _data[2],  
+            _data[4], _data[5], _data[6],
+            _data[8], _data[9], _data[10]);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::toQuaternion(QuaternionT<real> &outQuaternion) const
+    {
+        outQuaternion.fromMatrix4( (*this) );
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::toEuler(EulerT<real>& eulerAngles, RotationOrder order) const
+    {
+        eulerAngles.setUnit(Unit::radians);
+        detail::MatrixRotation<real, 4> rotation = { _data };
+        switch (order)
+        {
+        case RotationOrder::XZY :
+            detail::eulerFromRotation<RotationOrder::XZY>(rotation, eulerAngles.data());
+            break;
+        case RotationOrder::YXZ :
+            detail::eulerFromRotation<RotationOrder::YXZ>(rotation, eulerAngles.data());
+            break;
+        case RotationOrder::YZX :
+            detail::eulerFromRotation<RotationOrder::YZX>(rotation, eulerAngles.data());
+            break;
+        case RotationOrder::ZXY :
+            detail::eulerFromRotation<RotationOrder::ZXY>(rotation, eulerAngles.data());
+            break;
+        case RotationOrder::ZYX :
+            detail::eulerFromRotation<RotationOrder::ZYX>(rotation, eulerAngles.data());
+            break;
+        default:
+            detail::eulerFromRotation<RotationOrder::XYZ>(rotation, eulerAngles.data());
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::fromMatrix3(const Matrix3T<real> &inMat3)
+    {
+        memcpy(&_data[0],  &inMat3.data()[0], 3*sizeof(real));
+        memcpy(&_data[4],  &inMat3.data()[3], 3*sizeof(real));
+        memcpy(&_data[8],  &inMat3.data()[6], 3*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::fromQuaternion(const QuaternionT<real> &inQuat)
+    {
+        *this = inQuat.toMatrix4();
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::fromEuler(const real &angleX, const real &angleY, const real &angleZ, RotationOrder order)
+    {
+        Matrix3T<real> rotationMat;
+        rotationMat.fromEuler(angleX, angleY, angleZ, order);
+        this->fromMatrix3(rotationMat);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::fromEuler(const EulerT<real> &rotation, RotationOrder order)
+    {
+        // ensure euler is radians
+        EulerT<real> r = rotation.toRadians();
+        fromEuler(r.x, r.y, r.z, order);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Matrix4T<real>::rotateVector(const Vector3T<real> &vec) const
+    {
+        Vector3T<real> retVec(
+            _data[0] * vec.x + _data[1] * vec.y + _data[2]  * vec.z,
+            _data[4] * vec.x + _data[5] * vec.y + _data[6]  * vec.z,
+            _data[8] * vec.x + _data[9] * vec.y + _data[10] * vec.z
+            );
+        return retVec;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::transpose() const
+    {
+        Matrix4T<real> retMatrix;
+        simd::transpose4x4(_data, retMatrix._data);
+        return retMatrix;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::transposeInPlace()
+    {
+        simd::transpose4x4(_data, _data);
+    }
+
+    template <typename real>
+    GMATH_INLINE real Matrix4T<real>::determinant() const
+    {
+        real a0 = _data[ 0]*_data[ 5] - _data[ 1]*_data[ 4];
+        real a1 = _data[ 0]*_data[ 6] - _data[ 2]*_data[ 4];
+        real a2 = _data[ 0]*_data[ 7] - _data[ 3]*_data[ 4];
+        real a3 = _data[ 1]*_data[ 6] - _data[ 2]*_data[ 5];
+        real a4 = _data[ 1]*_data[ 7] - _data[ 3]*_data[ 5];
+        real a5 = _data[ 2]*_data[ 7] - _data[ 3]*_data[ 6];
+        real b0 = _data[ 8]*_data[13] - _data[ 9]*_data[12];
+        real b1 = _data[ 8]*_data[14] - _data[10]*_data[12];
+        real b2 = _data[ 8]*_data[15] - _data[11]*_data[12];
+        real b3 = _data[ 9]*_data[14] - _data[10]*_data[13];
+        real b4 = _data[ 9]*_data[15] - _data[11]*_data[13];
+        real b5 = _data[10]*_data[15] - _data[11]*_data[14];
+        real det = a0*b5 - a1*b4 + a2*b3 + a3*b2 - a4*b1 + a5*b0;
+        return det;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::inverse() const
+    {
+        Matrix4T<real> inverseMat;
+        simd::inverse4x4(_data, inverseMat._data);
+        return inverseMat;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::orthogonal() const
+    {
+        Matrix4T<real> m(*this);
+        m.orthogonalInPlace();
+        return m;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::orthogonalInPlace() //primaryAxis, secondaryAxis)
+    {
+        // Code take it from WildMagig 5  -  www.geometrictools.com  -  here the matrix is transpose
+        // Algorithm uses Gram-Schmidt orthogonalization.  If 'this' matrix is
+        // M = [m0|m1|m2], then orthonormal output matrix is Q = [q0|q1|q2],
+        //
+        //   q0 = m0/|m0|
+        //   q1 = (m1-(q0*m1)q0)/|m1-(q0*m1)q0|
+        //   q2 = (m2-(q0*m2)q0-(q1*m2)q1)/|m2-(q0*m2)q0-(q1*m2)q1|
+        //
+        // where |V| indicates length of vector V and A*B indicates dot
+        // product of vectors A and B.
+
+        // Compute q0. length xAxis
+        real invLength = 1 / sqrt(_data[0]*_data[0] +
+            _data[1]*_data[1] + _data[2]*_data[2]);
+
+        _data[0] *= invLength;
+        _data[1] *= invLength;
+        _data[2] *= invLength;
+
+        // Compute q1.
+        real dot0 = _data[0]*_data[4] + _data[1]*_data[5] +
+            _data[2]*_data[6];
+
+        _data[4] -= dot0*_data[0];
+        _data[5] -= dot0*_data[1];
+        _data[6] -= dot0*_data[2];
+
+        invLength = 1 / sqrt(_data[4]*_data[4] +
+            _data[5]*_data[5] + _data[6]*_data[6]);
+
+        _data[4] *= invLength;
+        _data[5] *= invLength;
+        _data[6] *= invLength;
+
+        // compute q2
+        real dot1 = _data[4]*_data[8] + _data[5]*_data[9] +
+            _data[6]*_data[10];
+
+        dot0 = _data[0]*_data[8] + _data[1]*_data[9] +
+            _data[2]*_data[10];
+
+        _data[8]  -= dot0*_data[0] + dot1*_data[4];
+        _data[9]  -= dot0*_data[1] + dot1*_data[5];
+        _data[10] -= dot0*_data[2] + dot1*_data[6];
+
+        invLength = 1 / sqrt(_data[8]*_data[8] +
+            _data[9]*_data[9] + _data[10]*_data[10]);
+
+        _data[8]  *= invLength;
+        _data[9]  *= invLength;
+        _data[10] *= invLength;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::inverseInPlace()
+    {
+        simd::inverse4x4(_data, _data);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::fromVectorToVector(const Vector3T<real> &fromVec, const Vector3T<real> &toVec)
+    {
+        Vector3T<real> x, u, v;
+        real e = fromVec.dot(toVec);
+        real f = fabs(e);
+
+        if (f > 1.0-gmath::EPSILON) // "from" and "to" vectors parallel or almost parallel
+        {
+            real fx = fabs(fromVec.x);
+            real fy = fabs(fromVec.y);
+            real fz = fabs(fromVec.z);
+
+            if (fx<fy)
+            {
+                if (fx<fz) {
+                    x.set(1.0, 0.0, 0.0);
+                }
+                else {
+                    x.set(0.0, 0.0, 1.0);
+                }
+            }
+            else
+            {
+                if (fy<fz) {
+                    x.set(0.0, 1.0, 0.0);
+                }
+                else {
+                    x.set(0.0, 0.0, 1.0);
+                }
+            }
+
+            u = x - fromVec;
+            v = x - toVec;
+
+            real c1 = 2.0/(u.dot(u));
+            real c2 = 2.0/(v.dot(v));
+            real c3 = v.dot(u*(c1*c2));
+
+            real uvals[3];
+            real vvals[3];
+            uvals[0]=u.x; uvals[1]=u.y; uvals[2]=u.z;
+            vvals[0]=v.x; vvals[1]=v.y; vvals[2]=v.z;
+            for (unsigned int i=0; i<3; i++)
+            {
+                for (unsigned int j=0; j<3; j++)
+                {
+                    this->_data[i*4+j] =  - c1*uvals[i]*uvals[j] - c2*vvals[i]*vvals[j] + c3*vvals[i]*uvals[j];
+                }
+            }
+        }
+        else  // the most common case, unless "from"="to", or "from"=-"to"
+        {
+            v = fromVec.cross(toVec);
+            real h = 1.0/(1.0 + e);    // optimization by Gottfried Chen
+            real hvx = h*v.x;
+            real hvz = h*v.z;
+            real hvxy = hvx*v.y;
+            real hvxz = hvx*v.z;
+            real hvyz = hvz*v.y;
+
+
+            this->_data[0] = e + hvx*v.x;
+            this->_data[1] = hvxy - v.z;
+            this->_data[2] = hvxz + v.y;
+
+            this->_data[4] = hvxy + v.z;
+            this->_data[5] = e + h*v.y*v.y;
+            this->_data[6] = hvyz - v.x;
+
+            this->_data[8] = hvxz - v.y;
+            this->_data[9] = hvyz + v.x;
+            this->_data[10] = e + hvz*v.z;
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::lookAt(const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis, Axis secondaryAxis)
+    {
+        this->lookAt(this->getPosition(), pointAt, normal, primaryAxis, secondaryAxis);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::lookAt(const Vector3T<real> &pos, const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis, Axis secondaryAxis)
+    {
+        Vector3T<real> primary, secondary, terziary;
+        
+        primary = pointAt - pos;
+        secondary = normal - pos;
+        primary.normalizeInPlace();
+        secondary.normalizeInPlace();
+
+        /*
+        double f = fabs( primary.dot(secondary) );
+        if (f > 1.0-gmath::EPSILON)
+            throw GMathError("Matrix4:\n\ttarget vector and up vector are perpendicular, impossible to create a matrix out of them."); */
+        
+        terziary = secondary.crossNormalize(primary);
+        secondary = primary.crossNormalize(terziary);
+
+
+        if ( ((int)primaryAxis<0) && ((int)secondaryAxis>0) ) 
+        {
+            primary  *= -1.0;
+            terziary *= -1.0;
+        }
+        else if ( ((int)primaryAxis>0) && ((int)secondaryAxis<0) ) 
+        {
+            secondary *= -1.0;
+            terziary  *= -1.0;
+        }
+        else if ( ((int)primaryAxis<0) && ((int)secondaryAxis<0) )
+        {
+            primary   *= -1.0;
+            secondary *= -1.0;
+        } 
+
+        if (primaryAxis == Axis::POSX || primaryAxis == Axis::NEGX)
+        {
+            if (secondaryAxis == Axis::POSY || secondaryAxis == Axis::NEGY)
+            {
+                this->setAxisX(primary);
+                this->setAxisY(secondary);
+                this->setAxisZ(-terziary);
+            }
+            else if (secondaryAxis == Axis::POSZ || secondaryAxis == Axis::NEGZ)
+            {
+                this->setAxisX(primary);
+                this->setAxisY(terziary);
+                this->setAxisZ(secondary);
+            }
+        }
+        else if (primaryAxis == Axis::POSY || primaryAxis == Axis::NEGY)
+        {
+            if (secondaryAxis == Axis::POSX || secondaryAxis == Axis::NEGX)
+            {
+                this->setAxisX(secondary);
+                this->setAxisY(primary);
+                this->setAxisZ(terziary);
+            }
+            else if (secondaryAxis == Axis::POSZ || secondaryAxis == Axis::NEGZ)
+            {
+                this->setAxisX(-terziary);
+                this->setAxisY(primary);
+                this->setAxisZ(secondary);
+            }
+        }
+        else if (primaryAxis == Axis::POSZ || primaryAxis == Axis::NEGZ)
+        {
+            if (secondaryAxis == Axis::POSX || secondaryAxis == Axis::NEGX)
+            {
+                this->setAxisX(secondary);
+                this->setAxisY(-terziary);
+                this->setAxisZ(primary);
+            }
+            else if (secondaryAxis == Axis::POSY || secondaryAxis == Axis::NEGY)
+            {
+                this->setAxisX(terziary);
+                this->setAxisY(secondary);
+                this->setAxisZ(primary);
+            }
+        }
+
+        this->setPosition(pos);
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::createLookAt(const Vector3T<real> &pos, const Vector3T<real> &pointAt, const Vector3T<real> &normal, Axis primaryAxis, Axis secondaryAxis)
+    {
+        Matrix4T<real> mat;
+        mat.lookAt(pos, pointAt, normal, primaryAxis, secondaryAxis);
+        return mat;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setPerspective(real fovY, real aspect, real zNear, real zFar)
+    {
+        if (!(fovY > 0.0 && fovY < PI && aspect > 0.0))
+            throw GMathError("Matrix4.setPerspective: the field of view must be in (0, PI) and the aspect positive");
+
+        real top = zNear * tan(fovY * 0.5);
+        real right = top * aspect;
+        this->setPerspective(-right, right, -top, top, zNear, zFar);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setPerspective(real left, real right, real bottom, real top, real zNear, real zFar)
+    {
+        if (!(zNear > 0.0 && zFar > zNear))
+            throw GMathError("Matrix4.setPerspective: the planes must be 0 < zNear < zFar");
+        if (!(right != left && top != bottom))
+            throw GMathError("Matrix4.setPerspective: the view is empty");
+
+        // the transpose of the glFrustum matrix, w is the distance in front of the camera
+        real width = right - left, height = top - bottom, depth = zFar - zNear;
+        _data[0] = 2.0*zNear / width;      _data[1] = 0.0;                     _data[2] = 0.0;                        _data[3] = 0.0;
+        _data[4] = 0.0;                    _data[5] = 2.0*zNear / height;      _data[6] = 0.0;                        _data[7] = 0.0;
+        _data[8] = (right+left) / width;   _data[9] = (top+bottom) / height;   _data[10] = -(zFar+zNear) / depth;     _data[11] = -1.0;
+        _data[12] = 0.0;                   _data[13] = 0.0;                    _data[14] = -2.0*zFar*zNear / depth;   _data[15] = 0.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::setOrthographic(real left, real right, real bottom, real top, real zNear, real zFar)
+    {
+        if (!(right != left && top != bottom && zFar != zNear))
+            throw GMathError("Matrix4.setOrthographic: the view is empty");
+
+        real width = right - left, height = top - bottom, depth = zFar - zNear;
+        _data[0] = 2.0 / width;                _data[1] = 0.0;                        _data[2] = 0.0;                        _data[3] = 0.0;
+        _data[4] = 0.0;                        _data[5] = 2.0 / height;               _data[6] = 0.0;                        _data[7] = 0.0;
+        _data[8] = 0.0;                        _data[9] = 0.0;                        _data[10] = -2.0 / depth;              _data[11] = 0.0;
+        _data[12] = -(right+left) / width;     _data[13] = -(top+bottom) / height;    _data[14] = -(zFar+zNear) / depth;     _data[15] = 1.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::createPerspective(real fovY, real aspect, real zNear, real zFar)
+    {
+        Matrix4T<real> mat;
+        mat.setPerspective(fovY, aspect, zNear, zFar);
+        return mat;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::createPerspective(real left, real right, real bottom, real top, real zNear, real zFar)
+    {
+        Matrix4T<real> mat;
+        mat.setPerspective(left, right, bottom, top, zNear, zFar);
+        return mat;
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> Matrix4T<real>::createOrthographic(real left, real right, real bottom, real top, real zNear, real zFar)
+    {
+        Matrix4T<real> mat;
+        mat.setOrthographic(left, right, bottom, top, zNear, zFar);
+        return mat;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Matrix4T<real>::fromAxisAngle(const Vector3T<real> &axis, real angle)
+    {
+        real sqr_a = axis.x*axis.x;
+        real sqr_b = axis.y*axis.y;
+        real sqr_c = axis.z*axis.z;
+        real len2  = sqr_a+sqr_b+sqr_c;
+
+        real k2    = cos(angle);
+        real k1    = (1.0-k2)/len2;
+        real k3    = sin(angle)/sqrt(len2);
+        real k1ab  = k1*axis.x*axis.y;
+        real k1ac  = k1*axis.x*axis.z;
+        real k1bc  = k1*axis.y*axis.z;
+        real k3a   = k3*axis.x;
+        real k3b   = k3*axis.y;
+        real k3c   = k3*axis.z;
+
+        _data[0] = k1*sqr_a+k2; _data[1] = k1ab+k3c;    _data[2] = k1ac-k3b;
+        _data[4] = k1ab-k3c;    _data[5] = k1*sqr_b+k2; _data[6] = k1bc+k3a;
+        _data[8] = k1ac+k3b;    _data[9] = k1bc-k3a;    _data[10] = k1*sqr_c+k2;
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string Matrix4T<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Matrix4(" << _data[ 0] << ", " << _data[ 1] << ", " << _data[ 2] << ", " << _data[ 3] << std::endl;
+        oss << "               " << _data[ 4] << ", " << _data[ 5] << ", " << _data[ 6] << ", " << _data[ 7] << std::endl;
+        oss << "               " << _data[ 8] << ", " << _data[ 9] << ", " << _data[10] << ", " << _data[11] << std::endl;
+        oss << "               " << _data[12] << ", " << _data[13] << ", " << _data[14] << ", " << _data[15] << ");";
+
+        return oss.str();
+    }
+
+
+    template <typename real>
+    GMATH_INLINE const Matrix4T<real> Matrix4T<real>::IDENTITY = Matrix4T<real>(1.0, 0.0, 0.0, 0.0,
+                                              0.0, 1.0, 0.0, 0.0,
+                                              0.0, 0.0, 1.0, 0.0,
+                                              0.0, 0.0, 0.0, 1.0);
+
+
+    #ifdef CMAYA
+    
+        template <typename real>
+        GMATH_INLINE void Matrix4T<real>::fromMayaMatrix(const MMatrix &mmatrix)
+        {
+            for (int i=0; i<4; i++)
+                for (int j=0; j<4; j++)
+                    _data[i*4+j] = real(mmatrix(i, j));
+        }
+
+        template <typename real>
+        GMATH_INLINE MMatrix Matrix4T<real>::toMayaMatrix() const
+        {   
+            double value[4][4];
+            for (int i=0; i<4; i++)
+                for (int j=0; j<4; j++)
+                    value[i][j] = _data[i*4+j];
+            return MMatrix(value);
+        }
+
+        /*------------------ Free functions ------------------*/
+
+        GMATH_INLINE MDagPath mpathFromString(const std::string &dagName)
+        {
+            MSelectionList sl;
+            sl.add(MString(dagName.data()));
+            MDagPath path;
+            sl.getDagPath(0, path);
+            return path;
+        }
+        
+        GMATH_INLINE Matrix4 getGlobalMatrix(const MDagPath &path)
+        {
+            Matrix4 gmatrix;
+            gmatrix.fromMayaMatrix(path.inclusiveMatrix());
+            return gmatrix;
+        }
+
+        GMATH_INLINE Matrix4 getGlobalMatrix(const std::string &dagName)
+        {
+            return getGlobalMatrix(mpathFromString(dagName));
+        }
+
+        GMATH_INLINE void setGlobalMatrix(MDagPath &path, const Matrix4 &gmatrix)
+        {
+            MMatrix localMatrix = gmatrix.toMayaMatrix() * path.exclusiveMatrixInverse();
+
+            MTransformationMatrix mtmatrix(localMatrix);
+
+            MFnTransform mfnTransform(path);
+            mfnTransform.set(mtmatrix);
+        }
+
+        GMATH_INLINE void setGlobalMatrix(const std::string &dagName, const Matrix4 &gmatrix)
+        {
+            MDagPath path = mpathFromString(dagName);
+            setGlobalMatrix(path, gmatrix);
+        }
+
+        GMATH_INLINE Matrix4 getLocalMatrix(const MDagPath &path)
+        {
+            MMatrix matrix = path.inclusiveMatrix() * path.exclusiveMatrixInverse();
+            Matrix4 gmatrix;
+            gmatrix.fromMayaMatrix(matrix);
+            return gmatrix;
+        }
+
+        GMATH_INLINE Matrix4 getLocalMatrix(const std::string &dagName)
+        {
+            return getLocalMatrix(mpathFromString(dagName));
+        }
+        
+        GMATH_INLINE void setLocalMatrix(MDagPath &path, const Matrix4 &gmatrix)
+        {
+            MTransformationMatrix mtmatrix(gmatrix.toMayaMatrix());
+
+            MFnTransform mfnTransform(path);
+            mfnTransform.set(mtmatrix);
+        }
+
+        GMATH_INLINE void setLocalMatrix(const std::string &dagName, const Matrix4 &gmatrix)
+        {
+            MDagPath path = mpathFromString(dagName);
+            setLocalMatrix(path, gmatrix);
+        }
+
+    #endif
+}
+
@@ -0,0 +1,39 @@
+#pragma once
+#define GMATH_PARALLEL_BEGIN
+
+#include <functional>
+#include "gmRoot.h"
+
+namespace gmath
+{
+    /**
+    The thread pool shared by the multithreaded parts of GMath (TransformHierarchy...).
+
+    The worker threads are started the first time they are needed and wait for work in between,
+    so splitting a job costs a few microseconds, not a thread creation.
+    On Linux and Mac the programs using GMath must be linked with -pthread.
+    */
+    namespace parallel
+    {
+        /** Number of threads used for a parallel job, the calling thread included.
+            By default it is the number of hardware threads. */
+        size_t getThreadCount();
+
+        /** Change the number of threads, 1 makes every job run serially on the calling thread.
+            This function is not thread safe, call it while no job is running. */
+        void setThreadCount(size_t count);
+
+        /** Split the range [0, count) in chunks of at least grain items and call func(begin, end) on each chunk,
+            from the worker threads and from the calling thread. Returns once every chunk is done.
+
+            Ranges smaller than two chunks, jobs started from inside another job and jobs started while
+            the pool is busy with another thread's job run serially on the calling thread.
+            If func throws, the remaining chunks are skipped and the first exception is thrown again here. */
+        void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& func);
+    }
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_PARALLEL_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,207 @@
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gmath
+{
+namespace parallel
+{
+namespace detail
+{
+    class Pool
+    {
+    private:
+        std::vector<std::thread> _workers;
+        size_t _threadCount;
+
+        std::mutex _busy;                   // one job at a time
+        std::mutex _mutex;                  // protects everything below
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        unsigned long long _generation;
+        bool _stop;
+
+        // the running job
+        const std::function<void(size_t, size_t)>* _func;
+        size_t _count;
+        size_t _chunk;
+        size_t _chunkCount;
+        std::atomic<size_t> _nextChunk;
+        size_t _runningWorkers;
+        std::exception_ptr _error;
+
+    public:
+        Pool()
+            : _generation(0), _stop(false), _func(NULL), _count(0), _chunk(0), _chunkCount(0),
+              _nextChunk(0), _runningWorkers(0)
+        {
+            unsigned int hardware = std::thread::hardware_concurrency();
+            _threadCount = hardware > 0 ? hardware : 1;
+        }
+
+        ~Pool()
+        {
+            stopWorkers();
+        }
+
+        size_t threadCount() const
+        {
+            return _threadCount;
+        }
+
+        void setThreadCount(size_t count)
+        {
+            std::lock_guard<std::mutex> busy(_busy);
+            stopWorkers();
+            _threadCount = count > 0 ? count : 1;
+        }
+
+        void run(size_t count, size_t grain, const std::function<void(size_t, size_t)>& func)
+        {
+            if (grain == 0)
+                grain = 1;
+
+            std::unique_lock<std::mutex> busy(_busy, std::try_to_lock);
+            if (_threadCount < 2 || count < 2*grain || insideJob() || !busy.owns_lock())
+            {
+                func(0, count);
+                return;
+            }
+
+            if (_workers.empty())
+                startWorkers();
+
+            // a few chunks per thread, so a slow chunk doesn't leave the others idle
+            size_t chunkCount = (count + grain - 1) / grain;
+            size_t maxChunks = _threadCount * 4;
+            if (chunkCount > maxChunks)
+                chunkCount = maxChunks;
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _func = &func;
+                _count = count;
+                _chunk = (count + chunkCount - 1) / chunkCount;
+                _chunkCount = (count + _chunk - 1) / _chunk;
+                _nextChunk = 0;
+                _runningWorkers = _workers.size();
+                _error = std::exception_ptr();
+                _generation++;
+            }
+            _wake.notify_all();
+
+            insideJob() = true;
+            work();
+            insideJob() = false;
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock, [this] { return _runningWorkers == 0; });
+            _func = NULL;
+
+            if (_error)
+            {
+                std::exception_ptr error = _error;
+                _error = std::exception_ptr();
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        static bool& insideJob()
+        {
+            static thread_local bool inside = false;
+            return inside;
+        }
+
+        void startWorkers()
+        {
+            _stop = false;
+            for (size_t i=1; i<_threadCount; i++)
+                _workers.push_back(std::thread(&Pool::workerLoop, this));
+        }
+
+        void stopWorkers()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (size_t i=0; i<_workers.size(); i++)
+                _workers[i].join();
+            _workers.clear();
+        }
+
+        void workerLoop()
+        {
+            insideJob() = true;
+            unsigned long long seen = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wake.wait(lock, [&] { return _stop || _generation != seen; });
+                    if (_stop)
+                        return;
+                    seen = _generation;
+                }
+
+                work();
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_runningWorkers == 0)
+                    _done.notify_one();
+            }
+        }
+
+        void work()
+        {
+            while (true)
+            {
+                size_t chunk = _nextChunk.fetch_add(1);
+                if (chunk >= _chunkCount)
+                    return;
+
+                size_t begin = chunk * _chunk;
+                size_t end = begin + _chunk < _count ? begin + _chunk : _count;
+                try
+                {
+                    (*_func)(begin, end);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (!_error)
+                        _error = std::current_exception();
+                    _nextChunk = _chunkCount;
+                }
+            }
+        }
+    };
+
+    GMATH_INLINE Pool& pool()
+    {
+        static Pool instance;
+        return instance;
+    }
+}
+
+    GMATH_INLINE size_t getThreadCount()
+    {
+        return detail::pool().threadCount();
+    }
+
+    GMATH_INLINE void setThreadCount(size_t count)
+    {
+        detail::pool().setThreadCount(count);
+    }
+
+    GMATH_INLINE void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& func)
+    {
+        detail::pool().run(count, grain, func);
+    }
+}
+}
@@ -0,0 +1,113 @@
+#pragma once
+#define GMATH_POINTGRID_BEGIN
+
+#include <vector>
+#include <utility>
+#include "gmRoot.h"
+#include "gmParallel.h"
+#include "gmVector3.h"
+
+namespace gmath
+{
+    /**
+    Uniform grid over a point cloud, for the points within a radius and the nearest points.
+
+    The space is cut in cubic cells, the cells are hashed into a table with as many buckets as there
+    are points (rounded up to a power of two) and the points are copied bucket by bucket, so the
+    points of a cell are next to each other in memory and empty space costs nothing.
+    The cell size is the main setting: the queries are fastest when a cell holds a few points and the
+    radius of a search is about one cell, by default it is chosen for about 2 points per cell (for the
+    points of a surface too, at the cost of hashing them twice). A search far from every point walks
+    through many empty cells.
+
+    The index of a point is its position in the array given to build. The grid keeps its own copy
+    of the points, build again after they moved. The queries are const and can be made from several
+    threads at once, the batch versions run on the gmath::parallel threads.
+    */
+    class PointGrid
+    {
+    private:
+        double _origin[3];
+        double _cellSize;
+        double _invCellSize;
+        int _maxCell[3];
+        size_t _mask;
+        /** The points of bucket b are _start[b] to _start[b+1]-1 of the arrays below. */
+        std::vector<size_t> _start;
+        std::vector<double> _points;
+        std::vector<int> _cells;
+        std::vector<size_t> _indices;
+
+        static bool fitsCells(const double* extent, double cellSize);
+        void insert(const Vector3* points, size_t count, const double* min, const double* max, double cellSize);
+        size_t countCells() const;
+        void cellOf(const double* point, int* cell) const;
+        size_t bucketOf(const int* cell) const;
+        void nearestCell(const double* point, int* cell) const;
+
+    public:
+        /** The index of a query that found nothing. */
+        static const size_t NONE = size_t(-1);
+
+        /** Points per chunk of work given to a thread while building. */
+        static const size_t PARALLEL_GRAIN = 8192;
+        /** Queries per chunk of work given to a thread by the batch queries. */
+        static const size_t QUERY_GRAIN = 256;
+
+        /*------ constructors ------*/
+        PointGrid();
+
+        /** See build. */
+        PointGrid(const std::vector<Vector3>& points, double cellSize=0.0);
+
+        /*------ setup ------*/
+
+        /** Index count points. A cellSize of 0 chooses it from the number of points and how they fill their bounds.
+            Throws GMathError if cellSize is negative or too small for the extent of the points
+            (more than 2^30 cells along an axis) or if a point is not finite. */
+        void build(const Vector3* points, size_t count, double cellSize=0.0);
+        void build(const std::vector<Vector3>& points, double cellSize=0.0);
+
+        void clear();
+
+        size_t getPointCount() const;
+        double getCellSize() const;
+
+        /*------ queries ------*/
+
+        /** The indices of the points at radius or less from center, appended to indices in no particular order.
+            Returns how many were found. */
+        size_t findInRadius(const Vector3& center, double radius, std::vector<size_t>& indices) const;
+
+        /** The k points nearest to point and not further than maxDistance, by increasing distance
+            (equal distances by increasing index). indices and squaredDistances, when not NULL, receive
+            k values, NONE and INFINITY past the points found. Returns how many were found. */
+        size_t findNearest(const Vector3& point, size_t k, size_t* indices, double* squaredDistances=NULL, double maxDistance=DBL_MAX) const;
+
+        /** The nearest point, NONE if there is none within maxDistance. */
+        size_t findNearest(const Vector3& point, double maxDistance=DBL_MAX) const;
+
+        /** findInRadius for count centers, in parallel. The results are in compressed rows: the indices
+            found for center i are indices[offsets[i]] to indices[offsets[i+1]-1]. */
+        void findInRadius(const Vector3* centers, size_t count, double radius,
+                          std::vector<size_t>& offsets, std::vector<size_t>& indices) const;
+
+        /** findNearest for count points, in parallel, indices and squaredDistances hold k values per point. */
+        void findNearest(const Vector3* points, size_t count, size_t k, size_t* indices,
+                         double* squaredDistances=NULL, double maxDistance=DBL_MAX) const;
+    };
+
+    /** Pair every point with its mirror image through the plane (see Vector3::mirror), for mirroring
+        the vertices or the joints of a symmetric character. Two points are paired when each is the
+        point nearest to the mirror image of the other, within tolerance. The first index of a pair is
+        the point on the positive side of the plane, a point on the plane is paired with itself unless
+        another point is closer to its image. The pairs are sorted by their first index, the points
+        without mirror are left out. Throws GMathError if tolerance is negative.
+        Builds a PointGrid and queries it in parallel. */
+    std::vector< std::pair<size_t, size_t> > buildSymmetryMap(const std::vector<Vector3>& points, CartesianPlane plane, double tolerance);
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_POINTGRID_END
+    #include "gmInline.h"
+#endif
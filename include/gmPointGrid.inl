@@ -0,0 +1,552 @@
+#include <algorithm>
+
+namespace gmath
+{
+    namespace detail
+    {
+        // the cells are indexed by int, keep a margin for the cells around the points
+        const double GRID_MAX_CELLS = 1073741824.0;
+
+        /** The cell size for about POINTS_PER_CELL points per cell, the points filling their bounds.
+            Flat and thin clouds are measured in 2 and 1 dimensions. */
+        const double GRID_POINTS_PER_CELL = 2.0;
+
+        /** The cell size for GRID_POINTS_PER_CELL if the points filled their bounds. */
+        GMATH_INLINE double automaticCellSize(const double* extent, size_t count)
+        {
+            double sorted[3] = { extent[0], extent[1], extent[2] };
+            std::sort(sorted, sorted+3);
+            double perPoint = GRID_POINTS_PER_CELL / double(count);
+            // <= as a flat cloud has an extent of 0 and a cube root of 0 too, it takes the 2d size and a line the 1d one
+            double size = cbrt(sorted[2] * sorted[1] * sorted[0] * perPoint);
+            if (sorted[0] <= size)
+            {
+                size = sqrt(sorted[2] * sorted[1] * perPoint);
+                if (sorted[1] <= size)
+                    size = sorted[2] * perPoint;
+            }
+            return size > 0.0 ? size : 1.0;
+        }
+
+        GMATH_INLINE int symmetryAxis(CartesianPlane plane)
+        {
+            switch (plane)
+            {
+            case CartesianPlane::XY:
+                return 2;
+            case CartesianPlane::ZX:
+                return 1;
+            default:
+                return 0;
+            }
+        }
+    }
+
+    /*------ constructors ------*/
+
+    GMATH_INLINE PointGrid::PointGrid()
+    {
+        clear();
+    }
+
+    GMATH_INLINE PointGrid::PointGrid(const std::vector<Vector3>& points, double cellSize)
+    {
+        build(points, cellSize);
+    }
+
+    /*------ setup ------*/
+
+    GMATH_INLINE void PointGrid::cellOf(const double* point, int* cell) const
+    {
+        for (int a=0; a<3; a++)
+            cell[a] = int(floor((point[a] - _origin[a]) * _invCellSize));
+    }
+
+    GMATH_INLINE size_t PointGrid::bucketOf(const int* cell) const
+    {
+        // Teschner et al. 2003, Optimized Spatial Hashing for Collision Detection of Deformable Objects
+        unsigned long long hash = (unsigned long long)(unsigned int)cell[0] * 73856093ULL
+                                ^ (unsigned long long)(unsigned int)cell[1] * 19349663ULL
+                                ^ (unsigned long long)(unsigned int)cell[2] * 83492791ULL;
+        return size_t(hash) & _mask;
+    }
+
+    GMATH_INLINE void PointGrid::nearestCell(const double* point, int* cell) const
+    {
+        // clamped in double, a point far away would overflow an int
+        for (int a=0; a<3; a++)
+        {
+            double c = floor((point[a] - _origin[a]) * _invCellSize);
+            c = c < 0.0 ? 0.0 : (c > double(_maxCell[a]) ? double(_maxCell[a]) : c);
+            cell[a] = int(c);
+        }
+    }
+
+    GMATH_INLINE void PointGrid::build(const std::vector<Vector3>& points, double cellSize)
+    {
+        build(points.empty() ? NULL : &points[0], points.size(), cellSize);
+    }
+
+    GMATH_INLINE void PointGrid::build(const Vector3* points, size_t count, double cellSize)
+    {
+        if (!(cellSize >= 0.0))
+            throw GMathError("PointGrid.build: the cell size must not be negative");
+
+        clear();
+        if (!count)
+            return;
+
+        // the bounds of fixed blocks of points, so they don't depend on the number of threads
+        size_t blockCount = (count + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN;
+        std::vector<double> blockBounds(blockCount*6);
+        std::vector<char> blockFinite(blockCount);
+        parallel::parallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+            for (size_t b=begin; b<end; b++)
+            {
+                double* min = &blockBounds[b*6];
+                double* max = min+3;
+                bool finite = true;
+                for (int a=0; a<3; a++)
+                {
+                    min[a] = INFINITY;
+                    max[a] = -INFINITY;
+                }
+                size_t last = (b+1)*PARALLEL_GRAIN < count ? (b+1)*PARALLEL_GRAIN : count;
+                for (size_t i=b*PARALLEL_GRAIN; i<last; i++)
+                {
+                    const double* p = points[i].data();
+                    for (int a=0; a<3; a++)
+                    {
+                        finite = finite && fabs(p[a]) <= DBL_MAX;
+                        min[a] = p[a] < min[a] ? p[a] : min[a];
+                        max[a] = p[a] > max[a] ? p[a] : max[a];
+                    }
+                }
+                blockFinite[b] = finite;
+            }
+        });
+
+        double min[3] = { INFINITY, INFINITY, INFINITY }, max[3] = { -INFINITY, -INFINITY, -INFINITY };
+        for (size_t b=0; b<blockCount; b++)
+        {
+            if (!blockFinite[b])
+                throw GMathError("PointGrid.build: the points must be finite");
+            for (int a=0; a<3; a++)
+            {
+                min[a] = blockBounds[b*6+a] < min[a] ? blockBounds[b*6+a] : min[a];
+                max[a] = blockBounds[b*6+3+a] > max[a] ? blockBounds[b*6+3+a] : max[a];
+            }
+        }
+
+        double extent[3] = { max[0] - min[0], max[1] - min[1], max[2] - min[2] };
+        if (cellSize > 0.0)
+        {
+            if (!fitsCells(extent, cellSize))
+                throw GMathError("PointGrid.build: the cell size is too small for the extent of the points");
+            insert(points, count, min, max, cellSize);
+            return;
+        }
+
+        // the points of a surface or a curve leave most of their bounds empty and crowd the cells
+        // they are in, then the cells are made smaller as for a surface
+        cellSize = detail::automaticCellSize(extent, count);
+        insert(points, count, min, max, cellSize);
+        double perCell = double(count) / double(countCells());
+        if (perCell > 2.0 * detail::GRID_POINTS_PER_CELL)
+        {
+            cellSize *= sqrt(detail::GRID_POINTS_PER_CELL / perCell);
+            if (fitsCells(extent, cellSize))
+                insert(points, count, min, max, cellSize);
+        }
+    }
+
+    GMATH_INLINE bool PointGrid::fitsCells(const double* extent, double cellSize)
+    {
+        for (int a=0; a<3; a++)
+        {
+            if (!(extent[a] / cellSize < detail::GRID_MAX_CELLS))
+                return false;
+        }
+        return true;
+    }
+
+    GMATH_INLINE void PointGrid::insert(const Vector3* points, size_t count, const double* min, const double* max, double cellSize)
+    {
+        for (int a=0; a<3; a++)
+            _origin[a] = min[a];
+        _cellSize = cellSize;
+        _invCellSize = 1.0 / cellSize;
+        cellOf(max, _maxCell);
+
+        size_t bucketCount = 1;
+        while (bucketCount < count)
+            bucketCount *= 2;
+        _mask = bucketCount - 1;
+
+        std::vector<int> cells(count*3);
+        std::vector<size_t> buckets(count);
+        parallel::parallelFor(count, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i=begin; i<end; i++)
+            {
+                cellOf(points[i].data(), &cells[i*3]);
+                buckets[i] = bucketOf(&cells[i*3]);
+            }
+        });
+
+        // counting sort by bucket, the points of a bucket stay by increasing index
+        _start.assign(bucketCount+1, 0);
+        for (size_t i=0; i<count; i++)
+            _start[buckets[i]+1]++;
+        for (size_t b=0; b<bucketCount; b++)
+            _start[b+1] += _start[b];
+        std::vector<size_t> next(_start.begin(), _start.end()-1);
+        _indices.resize(count);
+        for (size_t i=0; i<count; i++)
+            _indices[next[buckets[i]]++] = i;
+
+        _points.resize(count*3);
+        _cells.resize(count*3);
+        parallel::parallelFor(count, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t s=begin; s<end; s++)
+            {
+                size_t i = _indices[s];
+                for (int a=0; a<3; a++)
+                {
+                    _points[s*3+a] = points[i][a];
+                    _cells[s*3+a] = cells[i*3+a];
+                }
+            }
+        });
+    }
+
+    GMATH_INLINE size_t PointGrid::countCells() const
+    {
+        // a point starts a cell if no point before it in its bucket is in the same cell,
+        // counted in fixed blocks of buckets so the sum doesn't depend on the number of threads
+        size_t bucketCount = _start.size() - 1;
+        size_t blockCount = (bucketCount + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN;
+        std::vector<size_t> blockCells(blockCount);
+        parallel::parallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+            for (size_t b=begin; b<end; b++)
+            {
+                size_t cells = 0;
+                size_t last = (b+1)*PARALLEL_GRAIN < bucketCount ? (b+1)*PARALLEL_GRAIN : bucketCount;
+                for (size_t bucket=b*PARALLEL_GRAIN; bucket<last; bucket++)
+                {
+                    for (size_t s=_start[bucket]; s<_start[bucket+1]; s++)
+                    {
+                        const int* cell = &_cells[s*3];
+                        size_t t = _start[bucket];
+                        while (t < s && (_cells[t*3] != cell[0] || _cells[t*3+1] != cell[1] || _cells[t*3+2] != cell[2]))
+                            t++;
+                        cells += t == s;
+                    }
+                }
+                blockCells[b] = cells;
+            }
+        });
+        size_t cells = 0;
+        for (size_t b=0; b<blockCount; b++)
+            cells += blockCells[b];
+        return cells;
+    }
+
+    GMATH_INLINE void PointGrid::clear()
+    {
+        for (int a=0; a<3; a++)
+        {
+            _origin[a] = 0.0;
+            _maxCell[a] = 0;
+        }
+        _cellSize = 1.0;
+        _invCellSize = 1.0;
+        _mask = 0;
+        _start.assign(2, 0);
+        _points.clear();
+        _cells.clear();
+        _indices.clear();
+    }
+
+    GMATH_INLINE size_t PointGrid::getPointCount() const
+    {
+        return _indices.size();
+    }
+
+    GMATH_INLINE double PointGrid::getCellSize() const
+    {
+        return _cellSize;
+    }
+
+    /*------ queries ------*/
+
+    GMATH_INLINE size_t PointGrid::findInRadius(const Vector3& center, double radius, std::vector<size_t>& indices) const
+    {
+        if (_indices.empty() || !(radius >= 0.0))
+            return 0;
+
+        const double* p = center.data();
+        double radius2 = radius*radius;
+        int low[3], high[3];
+        double cellCount = 1.0;
+        for (int a=0; a<3; a++)
+        {
+            double first = floor((p[a] - radius - _origin[a]) * _invCellSize);
+            double last = floor((p[a] + radius - _origin[a]) * _invCellSize);
+            if (last < 0.0 || first > double(_maxCell[a]))
+                return 0;
+            low[a] = first < 0.0 ? 0 : int(first);
+            high[a] = last > double(_maxCell[a]) ? _maxCell[a] : int(last);
+            cellCount *= double(high[a] - low[a] + 1);
+        }
+
+        size_t found = 0;
+        if (cellCount > double(_indices.size()))
+        {
+            // a radius of many cells, every point is cheaper
+            for (size_t s=0; s<_indices.size(); s++)
+            {
+                const double* point = &_points[s*3];
+                double dx = point[0] - p[0], dy = point[1] - p[1], dz = point[2] - p[2];
+                if (dx*dx + dy*dy + dz*dz <= radius2)
+                {
+                    indices.push_back(_indices[s]);
+                    found++;
+                }
+            }
+            return found;
+        }
+
+        int cell[3];
+        for (cell[0]=low[0]; cell[0]<=high[0]; cell[0]++)
+        {
+            for (cell[1]=low[1]; cell[1]<=high[1]; cell[1]++)
+            {
+                for (cell[2]=low[2]; cell[2]<=high[2]; cell[2]++)
+                {
+                    size_t bucket = bucketOf(cell);
+                    for (size_t s=_start[bucket]; s<_start[bucket+1]; s++)
+                    {
+                        // a bucket holds the points of every cell hashed to it
+                        const int* pointCell = &_cells[s*3];
+                        if (pointCell[0] != cell[0] || pointCell[1] != cell[1] || pointCell[2] != cell[2])
+                            continue;
+                        const double* point = &_points[s*3];
+                        double dx = point[0] - p[0], dy = point[1] - p[1], dz = point[2] - p[2];
+                        if (dx*dx + dy*dy + dz*dz <= radius2)
+                        {
+                            indices.push_back(_indices[s]);
+                            found++;
+                        }
+                    }
+                }
+            }
+        }
+        return found;
+    }
+
+    GMATH_INLINE size_t PointGrid::findNearest(const Vector3& point, size_t k, size_t* indices, double* squaredDistances, double maxDistance) const
+    {
+        typedef std::pair<double, size_t> Candidate;
+
+        for (size_t i=0; i<k; i++)
+        {
+            if (indices)
+                indices[i] = NONE;
+            if (squaredDistances)
+                squaredDistances[i] = INFINITY;
+        }
+        if (!k || _indices.empty())
+            return 0;
+
+        // The search starts from the cell of the point clamped into the grid and visits the shells of cells
+        // around it until the unvisited cells are further than the k-th point found. For any point x of the
+        // grid, |x - point|^2 >= |x - clamped|^2 + |clamped - point|^2.
+        double clamped[3];
+        double outside2 = 0.0;
+        for (int a=0; a<3; a++)
+        {
+            double high = _origin[a] + double(_maxCell[a] + 1) * _cellSize;
+            clamped[a] = point[a] < _origin[a] ? _origin[a] : (point[a] > high ? high : point[a]);
+            outside2 += (point[a] - clamped[a]) * (point[a] - clamped[a]);
+        }
+        double max2 = maxDistance*maxDistance;
+        if (outside2 > max2)
+            return 0;
+
+        int center[3];
+        nearestCell(clamped, center);
+
+        const double* p = point.data();
+        std::vector<Candidate> heap;
+        heap.reserve(k);
+        auto visit = [&](const int* cell) {
+            size_t bucket = bucketOf(cell);
+            for (size_t s=_start[bucket]; s<_start[bucket+1]; s++)
+            {
+                const int* pointCell = &_cells[s*3];
+                if (pointCell[0] != cell[0] || pointCell[1] != cell[1] || pointCell[2] != cell[2])
+                    continue;
+                const double* q = &_points[s*3];
+                double dx = q[0] - p[0], dy = q[1] - p[1], dz = q[2] - p[2];
+                Candidate candidate(dx*dx + dy*dy + dz*dz, _indices[s]);
+                if (candidate.first > max2)
+                    continue;
+                if (heap.size() < k)
+                {
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end());
+                }
+                else if (candidate < heap.front())
+                {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end());
+                }
+            }
+        };
+
+        for (int ring=0; ; ring++)
+        {
+            int low[3], high[3];
+            for (int a=0; a<3; a++)
+            {
+                low[a] = center[a] - ring < 0 ? 0 : center[a] - ring;
+                high[a] = center[a] + ring > _maxCell[a] ? _maxCell[a] : center[a] + ring;
+            }
+
+            // the shell of cells at ring from the center: the whole z line on its sides, the two ends elsewhere
+            int cell[3];
+            for (cell[0]=low[0]; cell[0]<=high[0]; cell[0]++)
+            {
+                for (cell[1]=low[1]; cell[1]<=high[1]; cell[1]++)
+                {
+                    if (abs(cell[0] - center[0]) == ring || abs(cell[1] - center[1]) == ring)
+                    {
+                        for (cell[2]=low[2]; cell[2]<=high[2]; cell[2]++)
+                            visit(cell);
+                        continue;
+                    }
+                    cell[2] = center[2] - ring;
+                    if (cell[2] >= 0)
+                        visit(cell);
+                    cell[2] = center[2] + ring;
+                    if (cell[2] <= _maxCell[2])
+                        visit(cell);
+                }
+            }
+
+            // the distance from the clamped point to the cells not visited yet
+            double bound = INFINITY;
+            for (int a=0; a<3; a++)
+            {
+                if (center[a] - ring > 0)
+                {
+                    double face = clamped[a] - (_origin[a] + double(center[a] - ring) * _cellSize);
+                    bound = face < bound ? face : bound;
+                }
+                if (center[a] + ring < _maxCell[a])
+                {
+                    double face = _origin[a] + double(center[a] + ring + 1) * _cellSize - clamped[a];
+                    bound = face < bound ? face : bound;
+                }
+            }
+            // every cell visited
+            if (bound == INFINITY)
+                break;
+            double limit = bound*bound + outside2;
+            if (limit > max2 || (heap.size() == k && heap.front().first <= limit))
+                break;
+        }
+
+        std::sort_heap(heap.begin(), heap.end());
+        for (size_t i=0; i<heap.size(); i++)
+        {
+            if (indices)
+                indices[i] = heap[i].second;
+            if (squaredDistances)
+                squaredDistances[i] = heap[i].first;
+        }
+        return heap.size();
+    }
+
+    GMATH_INLINE size_t PointGrid::findNearest(const Vector3& point, double maxDistance) const
+    {
+        size_t index;
+        findNearest(point, 1, &index, NULL, maxDistance);
+        return index;
+    }
+
+    GMATH_INLINE void PointGrid::findInRadius(const Vector3* centers, size_t count, double radius,
+                                              std::vector<size_t>& offsets, std::vector<size_t>& indices) const
+    {
+        // fixed blocks of queries, each with its own list, then copied in order
+        size_t blockCount = (count + QUERY_GRAIN - 1) / QUERY_GRAIN;
+        std::vector< std::vector<size_t> > found(blockCount);
+        offsets.assign(count+1, 0);
+        parallel::parallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+            for (size_t b=begin; b<end; b++)
+            {
+                size_t last = (b+1)*QUERY_GRAIN < count ? (b+1)*QUERY_GRAIN : count;
+                for (size_t i=b*QUERY_GRAIN; i<last; i++)
+                    offsets[i+1] = findInRadius(centers[i], radius, found[b]);
+            }
+        });
+
+        for (size_t i=0; i<count; i++)
+            offsets[i+1] += offsets[i];
+        indices.resize(offsets[count]);
+        for (size_t b=0; b<blockCount; b++)
+        {
+            if (!found[b].empty())
+                memcpy(&indices[offsets[b*QUERY_GRAIN]], &found[b][0], found[b].size()*sizeof(size_t));
+        }
+    }
+
+    GMATH_INLINE void PointGrid::findNearest(const Vector3* points, size_t count, size_t k, size_t* indices,
+                                             double* squaredDistances, double maxDistance) const
+    {
+        parallel::parallelFor(count, QUERY_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i=begin; i<end; i++)
+                findNearest(points[i], k, indices + i*k, squaredDistances ? squaredDistances + i*k : NULL, maxDistance);
+        });
+    }
+
+    /*------ symmetry ------*/
+
+    GMATH_INLINE std::vector< std::pair<size_t, size_t> > buildSymmetryMap(const std::vector<Vector3>& points, CartesianPlane plane, double tolerance)
+    {
+        if (!(tolerance >= 0.0))
+            throw GMathError("buildSymmetryMap: the tolerance must not be negative");
+
+        std::vector< std::pair<size_t, size_t> > pairs;
+        size_t count = points.size();
+        if (!count)
+            return pairs;
+
+        // the cells at least as big as the tolerance, so a query looks at the cells next to its own only
+        PointGrid grid(points);
+        if (grid.getCellSize() < tolerance)
+            grid.build(points, tolerance);
+
+        // Vector3::mirror through a cartesian plane negates one coordinate
+        int axis = detail::symmetryAxis(plane);
+        std::vector<Vector3> images(points);
+        for (size_t i=0; i<count; i++)
+            images[i][axis] = -images[i][axis];
+
+        std::vector<size_t> nearest(count);
+        grid.findNearest(&images[0], count, 1, &nearest[0], NULL, tolerance);
+
+        for (size_t i=0; i<count; i++)
+        {
+            size_t j = nearest[i];
+            if (j == PointGrid::NONE || nearest[j] != i)
+                continue;
+            // both points see each other, the pair is added once, from its positive side
+            if (j != i && (points[i][axis] < points[j][axis] || (points[i][axis] == points[j][axis] && j < i)))
+                continue;
+            pairs.push_back(std::make_pair(i, j));
+        }
+        return pairs;
+    }
+}
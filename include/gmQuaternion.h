@@ -1,4 +1,5 @@
 #pragma once
+#define GMATH_QUATERNION_BEGIN
 
 #include <string>
 #include <stdexcept>
@@ -15,52 +16,56 @@ using namespace std;
 
 namespace gmath
 {
-    class Quaternion
+    template <typename real>
+    class QuaternionT
     {
     public:
         /*------ constructors ------*/
-        Quaternion();
-        Quaternion(double x, double y, double z, double w);
-        Quaternion(const Quaternion &values);
-        Quaternion(const Matrix3& inMat);
-        Quaternion(const Matrix4& inMat);
-        Quaternion(const Vector3& axis, double angle);
-        Quaternion(double angleX, double angleY, double angleZ);
-        Quaternion(const double *values);
-        Quaternion(const std::vector<double>& values);
+        GMATH_CONSTEXPR QuaternionT();
+        GMATH_CONSTEXPR QuaternionT(real x, real y, real z, real w);
+        GMATH_CONSTEXPR QuaternionT(const QuaternionT &values);
+        /** Conversion from the other precision, for example Quaternionf(aQuaternion). */
+        template <typename otherReal>
+        explicit QuaternionT(const QuaternionT<otherReal>& other);
+        QuaternionT(const Matrix3T<real>& inMat);
+        QuaternionT(const Matrix4T<real>& inMat);
+        QuaternionT(const Vector3T<real>& axis, real angle);
+        QuaternionT(real angleX, real angleY, real angleZ);
+        QuaternionT(const real *values);
+        QuaternionT(const std::vector<real>& values);
 
         /*------ properties ------*/
-        double x, y, z, w;
+        real x, y, z, w;
 
         /*------ coordinate access ------*/
-        double operator[] (int i) const;
-        double& operator[] (int i);
+        real operator[] (int i) const;
+        real& operator[] (int i);
 
         /** Pointer access for direct copying. */
-        double* data();
-        const double* data() const;
+        real* data();
+        const real* data() const;
 
         /*------ Arithmetic operations ------*/
-        Quaternion operator - () const;
-        Quaternion operator + (const Quaternion &other) const;
-        Quaternion operator - (const Quaternion &other) const;
-        Quaternion operator * (const Quaternion &other) const;
-        Quaternion operator * (double scalar) const;
-        Quaternion operator / (double scalar) const;
+        GMATH_CONSTEXPR QuaternionT operator - () const;
+        GMATH_CONSTEXPR QuaternionT operator + (const QuaternionT &other) const;
+        GMATH_CONSTEXPR QuaternionT operator - (const QuaternionT &other) const;
+        GMATH_CONSTEXPR QuaternionT operator * (const QuaternionT &other) const;
+        GMATH_CONSTEXPR QuaternionT operator * (real scalar) const;
+        QuaternionT operator / (real scalar) const;
 
         /*------ Arithmetic updates ------*/
-        Quaternion& operator += (const Quaternion &other);
-        Quaternion& operator -= (const Quaternion &other);
-        Quaternion& operator *= (const Quaternion &other);
-        Quaternion& operator *= (double scalar);
-        Quaternion& operator /= (double scalar);
+        QuaternionT& operator += (const QuaternionT &other);
+        QuaternionT& operator -= (const QuaternionT &other);
+        QuaternionT& operator *= (const QuaternionT &other);
+        QuaternionT& operator *= (real scalar);
+        QuaternionT& operator /= (real scalar);
 
         /*------ Arithmetic comparisons ------*/
-        bool operator == (const Quaternion &other) const;
-        bool operator != (const Quaternion &other) const;
+        bool operator == (const QuaternionT &other) const;
+        bool operator != (const QuaternionT &other) const;
 
         /*------ Arithmetic assignment ------*/
-        void operator = (const Quaternion & other);
+        void operator = (const QuaternionT & other);
 
         /*------ methods ------*/
 
@@ -69,74 +74,99 @@ namespace gmath
             @param inY The wanted value for y
             @param inZ The wanted value for z
             @param inW The wanted value for w */
-        void set(double inX, double inY, double inZ, double inW);
-        void set(const double *values);
-        void set(const std::vector<double>& values);
+        void set(real inX, real inY, real inZ, real inW);
+        void set(const real *values);
+        void set(const std::vector<real>& values);
 
         void setToIdentity();
 
-        Vector3 getAxisY() const;
-        Vector3 getAxisX() const;
-        Vector3 getAxisZ() const;
-        Vector3 getAxis(Axis axis) const;
-
-        void fromMatrix3(const Matrix3 &mat);
-        void fromMatrix4(const Matrix4 &mat);
-        Matrix3 toMatrix3() const;
-        Matrix4 toMatrix4() const;
-        void setMatrix4(Matrix4& outMat) const;
-        void setMatrix4(Matrix4& outMat, const Vector3& scale, const Vector3& pos) const;
-
-        void fromAxisAngle(const Vector3& axis, double angle);
-        void toAxisAngle(Vector3& outAxis, double& outAngle) const;
-
-        void fromEuler(double angleX, double angleY, double angleZ, RotationOrder order=RotationOrder::XYZ);
-        void fromEuler(const Euler& euler, RotationOrder order=RotationOrder::XYZ);
-        Euler toEuler(RotationOrder order=RotationOrder::XYZ) const;
-
-        double length () const;
-        double squaredLength () const;
-
-        Quaternion  unit() const;
-        Quaternion& unitInPlace();
+        Vector3T<real> getAxisY() const;
+        Vector3T<real> getAxisX() const;
+        Vector3T<real> getAxisZ() const;
+        Vector3T<real> getAxis(Axis axis) const;
+
+        void fromMatrix3(const Matrix3T<real> &mat);
+        void fromMatrix4(const Matrix4T<real> &mat);
+        Matrix3T<real> toMatrix3() const;
+        Matrix4T<real> toMatrix4() const;
+        void setMatrix4(Matrix4T<real>& outMat) const;
+        void setMatrix4(Matrix4T<real>& outMat, const Vector3T<real>& scale, const Vector3T<real>& pos) const;
+
+        void fromAxisAngle(const Vector3T<real>& axis, real angle);
+        void toAxisAngle(Vector3T<real>& outAxis, real& outAngle) const;
+
+        void fromEuler(real angleX, real angleY, real angleZ, RotationOrder order=RotationOrder::XYZ);
+        void fromEuler(const EulerT<real>& euler, RotationOrder order=RotationOrder::XYZ);
+        EulerT<real> toEuler(RotationOrder order=RotationOrder::XYZ) const;
+        /** Same as above with the order known at compile time, e.g. quat.fromEuler<RotationOrder::ZXY>(x, y, z).
+            The angles are in radians. */
+        template <RotationOrder ORDER>
+        void fromEuler(real angleX, real angleY, real angleZ);
+        template <RotationOrder ORDER>
+        EulerT<real> toEuler() const;
+
+        real length () const;
+        real squaredLength () const;
+
+        QuaternionT  unit() const;
+        QuaternionT& unitInPlace();
         
         void normalizeInPlace();
-        Quaternion normalize() const;
+        QuaternionT normalize() const;
 
-        Quaternion inverse() const;
+        QuaternionT inverse() const;
         void inverseInPlace();
 
         void conjugateInPlace();
-        Quaternion conjugate() const;
+        GMATH_CONSTEXPR QuaternionT conjugate() const;
 
-        Quaternion exp() const;
-        Quaternion log() const;
+        QuaternionT exp() const;
+        QuaternionT log() const;
 
-        Vector3 rotateVector(const Vector3 &vec) const;
+        /** Rotate vec by this quaternion, which must be normalized. */
+        Vector3T<real> rotateVector(const Vector3T<real> &vec) const;
 
         /** Perform the dot product between this vector and the given vector */
-        double dot(const Quaternion & other) const;
+        GMATH_CONSTEXPR real dot(const QuaternionT & other) const;
 
         /** Matches this quaternion with another one ensuring that they are 
             withing the same hemisphere. The delta between Quaternion values
             is the shortest path over the hypersphere. 
             Original code from FabricEngine Math extension*/
-        void matchHemisphere(const Quaternion& other);
+        void matchHemisphere(const QuaternionT& other);
 
         /** Reflects this Quaternion according to the CartesianPlane provided. */
-        Quaternion& mirrorInPlace(CartesianPlane plane=CartesianPlane::ZY);
-        Quaternion mirror(CartesianPlane plane=CartesianPlane::ZY) const;
+        QuaternionT& mirrorInPlace(CartesianPlane plane=CartesianPlane::ZY);
+        QuaternionT mirror(CartesianPlane plane=CartesianPlane::ZY) const;
 
         /** Reflects this Quaternion according to the mirror plane's normal. */
-        Quaternion& mirrorInPlace(const Vector3& mirrorNormal, Axis primary=Axis::POSY, Axis secondary=Axis::POSZ);
-        Quaternion mirror(const Vector3& mirrorNormal, Axis primary=Axis::POSY, Axis secondary=Axis::POSZ) const;
+        QuaternionT& mirrorInPlace(const Vector3T<real>& mirrorNormal, Axis primary=Axis::POSY, Axis secondary=Axis::POSZ);
+        QuaternionT mirror(const Vector3T<real>& mirrorNormal, Axis primary=Axis::POSY, Axis secondary=Axis::POSZ) const;
 
         /*  This function comes from Imath, part of ILM's OpenEXR library.
 
             Spherical linear interpolation.
             Assumes q1 and q2 are normalized and that q1 != -q2. */
-        void slerpInPlace(const Quaternion &q1, const Quaternion &q2, double t, bool shortestPath=true);
-        Quaternion slerp(const Quaternion &q2, double t, bool shortestPath=true) const;
+        void slerpInPlace(const QuaternionT &q1, const QuaternionT &q2, real t, bool shortestPath=true);
+        QuaternionT slerp(const QuaternionT &q2, real t, bool shortestPath=true) const;
+
+        /*  Cheaper alternatives to slerp, for blending many rotations.
+            Like slerp they assume unit quaternions and always take the shortest path. */
+
+        /** Normalized linear interpolation: same path as slerp but not at constant speed. */
+        QuaternionT nlerp(const QuaternionT &q2, real t) const;
+
+        /** nlerp with t corrected by a polynomial fit, so the speed is close to constant.
+            From Arseny Kapoulkine, "Approximating slerp", 2015. */
+        QuaternionT correctedNlerp(const QuaternionT &q2, real t) const;
+
+        /** Slerp computed with a polynomial in the cosine of the angle, no sqrt and no trigonometric functions.
+            From David Eberly, "A Fast and Accurate Algorithm for Computing SLERP", 2011.
+            With precise false the polynomial has 8 terms instead of 16, see SlerpMethod for the errors. */
+        QuaternionT polynomialSlerp(const QuaternionT &q2, real t, bool precise=true) const;
+
+        /** One of the four functions above, see SlerpMethod for their errors. */
+        QuaternionT interpolate(const QuaternionT &q2, real t, SlerpMethod method) const;
 
         std::string toString() const;
 
@@ -145,4 +175,65 @@ namespace gmath
             MQuaternion toMayaQuaternion() const;
         #endif
     };
+
+    typedef QuaternionT<double> Quaternion;
+    typedef QuaternionT<float> Quaternionf;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class QuaternionT<float>;
+        extern template class QuaternionT<double>;
+    #endif
+
+    namespace detail
+    {
+        /*  The weights of q1 and q2 (q2 already in the hemisphere of q1, cosine = q1.dot(q2) >= 0)
+            for the approximated methods, the result is w1 * q1 + w2 * q2, normalized for the nlerps.
+            Defined here, not in the .inl, so the loops of QuaternionArray and XfoArray can inline them. */
+
+        template <typename real>
+        inline void correctedNlerpWeights(real cosine, real t, real& w1, real& w2)
+        {
+            real a = real(1.0904) + cosine * (real(-3.2452) + cosine * (real(3.55645) - cosine * real(1.43519)));
+            real b = real(0.848013) + cosine * (real(-1.06021) + cosine * real(0.215638));
+            real k = a * (t - real(0.5)) * (t - real(0.5)) + b;
+            real corrected = t + t * (t - real(0.5)) * (t - real(1.0)) * k;
+            w1 = real(1.0) - corrected;
+            w2 = corrected;
+        }
+
+        /** Eberly's series of sin(t * angle) / sin(angle) in (cosine - 1), truncated to TERMS terms (at most 16),
+            the last term is scaled by 1 + mu to balance the error of the truncation. */
+        template <int TERMS, typename real>
+        inline void polynomialSlerpWeights(real cosine, real t, real& w1, real& w2)
+        {
+            // u[i] = 1 / ((i+1) * (2i+3)), v[i] = (i+1) / (2i+3)
+            static const double u[16] = { 1.0/(1*3), 1.0/(2*5), 1.0/(3*7), 1.0/(4*9), 1.0/(5*11), 1.0/(6*13), 1.0/(7*15), 1.0/(8*17),
+                                          1.0/(9*19), 1.0/(10*21), 1.0/(11*23), 1.0/(12*25), 1.0/(13*27), 1.0/(14*29), 1.0/(15*31), 1.0/(16*33) };
+            static const double v[16] = { 1.0/3, 2.0/5, 3.0/7, 4.0/9, 5.0/11, 6.0/13, 7.0/15, 8.0/17,
+                                          9.0/19, 10.0/21, 11.0/23, 12.0/25, 13.0/27, 14.0/29, 15.0/31, 16.0/33 };
+            const double onePlusMu = 1.90110745351730037;
+
+            real xm1 = cosine - real(1.0);
+            real d = real(1.0) - t;
+            real sqrT = t * t;
+            real sqrD = d * d;
+
+            real uLast = real(u[TERMS-1] * onePlusMu);
+            real vLast = real(v[TERMS-1] * onePlusMu);
+            real bT = real(1.0) + (uLast * sqrT - vLast) * xm1;
+            real bD = real(1.0) + (uLast * sqrD - vLast) * xm1;
+            for (int i=TERMS-2; i>=0; i--)
+            {
+                bT = real(1.0) + (real(u[i]) * sqrT - real(v[i])) * xm1 * bT;
+                bD = real(1.0) + (real(u[i]) * sqrD - real(v[i])) * xm1 * bD;
+            }
+            w1 = d * bD;
+            w2 = t * bT;
+        }
+    }
 }
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_QUATERNION_END
+    #include "gmInline.h"
+#endif
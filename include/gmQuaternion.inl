@@ -0,0 +1,952 @@
+namespace gmath{
+    //--------------------------------------------------------------------------
+    // Taken from Imath
+    // Don Hatch's version of sin(x)/x, which is accurate for very small x.
+    // Returns 1 for x == 0.
+    //--------------------------------------------------------------------------
+    inline double sinx_over_x (double x)
+    {
+        if (x * x < gmath::EPSILON)
+            return 1.0;
+        else
+            return  sin (x) / x;
+    }
+
+
+    /*------ Constructors ------*/
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real>::QuaternionT()
+        : x(0.0), y(0.0), z(0.0), w(1.0)
+    {
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real>::QuaternionT(real x, real y, real z, real w)
+        : x(x), y(y), z(z), w(w)
+    {
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real>::QuaternionT(const QuaternionT<real> &other)
+        : x(other.x), y(other.y), z(other.z), w(other.w)
+    {
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(const QuaternionT<otherReal>& other)
+        : x(real(other.x)), y(real(other.y)), z(real(other.z)), w(real(other.w))
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(const Matrix3T<real>& inMat)
+    {
+        fromMatrix3(inMat);
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(const Matrix4T<real>& inMat)
+    {
+        fromMatrix4(inMat);
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(const Vector3T<real>& axis, real angle)
+    {
+        fromAxisAngle(axis, angle);
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(real angleX, real angleY, real angleZ)
+    {
+        fromEuler(angleX, angleY, angleZ);
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(const real *values)
+    {
+        set(values);
+    }
+    
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>::QuaternionT(const std::vector<real>& values)
+    {
+        set(values);
+    }
+
+    /*------ Coordinate access ------*/
+
+    template <typename real>
+    GMATH_INLINE real QuaternionT<real>::operator[] (int i) const
+    {
+        if (i>3) {
+            throw out_of_range("gmath::Quaternion:\n\t index out of range");
+        }
+        return *(&x+i);
+    }
+
+    template <typename real>
+    GMATH_INLINE real& QuaternionT<real>::operator[] (int i)
+    {
+        if (i>3) {
+            throw out_of_range("gmath::Quaternion:\n\t index out of range");
+        }
+        return *(&x+i);
+    }
+
+    template <typename real>
+    GMATH_INLINE real* QuaternionT<real>::data()
+    {
+        return &x;
+    }
+
+    template <typename real>
+    GMATH_INLINE const real* QuaternionT<real>::data() const
+    {
+        return &x;
+    }
+
+    /*------ Arithmetic operations ------*/
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real> QuaternionT<real>::operator - () const
+    {
+        return QuaternionT<real>(-x, -y, -z, -w);
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real> QuaternionT<real>::operator + (const QuaternionT<real> &other) const
+    {
+        QuaternionT<real> newQuaternion(x+other.x, y+other.y, z+other.z, w+other.w);
+
+        return newQuaternion;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real> QuaternionT<real>::operator - (const QuaternionT<real> &other) const
+    {
+        QuaternionT<real> newQuaternion(x-other.x, y-other.y, z-other.z, w-other.w);
+        return newQuaternion;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real> QuaternionT<real>::operator * (real scalar) const
+    {
+        QuaternionT<real> newQuaternion(x*scalar, y*scalar, z*scalar, w*scalar);
+
+        return newQuaternion;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real> QuaternionT<real>::operator * (const QuaternionT<real> &other) const
+    {
+        Vector3T<real> av(x, y, z);
+        Vector3T<real> bv(other.x, other.y, other.z); 
+        Vector3T<real> v = bv.cross(av) + (bv * this->w) + (av * other.w);
+        real rw = this->w * other.w - bv.dot(av);
+
+        return QuaternionT<real>(v.x, v.y, v.z, rw);
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::operator / (real scalar) const
+    {
+        if (scalar == 0.0)
+        {
+            QuaternionT<real> newQuaternion;
+            newQuaternion.x = NAN;
+            newQuaternion.y = NAN;
+            newQuaternion.z = NAN;
+            newQuaternion.w = NAN;
+            return newQuaternion;
+        }
+        else
+        {
+            return *this * (1.0/scalar);
+        }
+    }
+
+    /*------ Arithmetic updates ------*/
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::operator += (const QuaternionT<real> & other)
+    {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        w += other.w;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::operator -= (const QuaternionT<real> & other)
+    {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        w -= other.w;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::operator *= (real scalar)
+    {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        w *= scalar;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::operator *= (const QuaternionT<real> &other)
+    {
+        Vector3T<real> av(x, y, z);
+        Vector3T<real> bv(other.x, other.y, other.z); 
+        Vector3T<real> v = bv.cross(av) + (bv * this->w) + (av * other.w);
+        real rw = this->w * other.w - bv.dot(av);
+
+        set(v.x, v.y, v.z, rw);
+        
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::operator /= (real scalar)
+    {
+        if (scalar == 0.0)
+        {
+            x = NAN;
+            y = NAN;
+            z = NAN;
+            w = NAN;
+        }
+        else
+        {
+            *this *= (1.0/scalar);
+        }
+        return *this;
+    }
+
+    /*------ Comparisons ------*/
+
+    template <typename real>
+    GMATH_INLINE bool QuaternionT<real>::operator == (const QuaternionT<real> & other) const
+    {
+        return (fabs(x-other.x) < gmath::EPSILON && 
+                fabs(y-other.y) < gmath::EPSILON && 
+                fabs(z-other.z) < gmath::EPSILON &&
+                fabs(w-other.w) < gmath::EPSILON);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool QuaternionT<real>::operator != (const QuaternionT<real> & other) const
+    {
+        return (fabs(x-other.x) > gmath::EPSILON || 
+                fabs(y-other.y) > gmath::EPSILON || 
+                fabs(z-other.z) > gmath::EPSILON ||
+                fabs(w-other.w) < gmath::EPSILON);
+    }
+
+    /*------ Assignments ------*/
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::operator = (const QuaternionT<real> & other)
+    {
+        x = other.x;
+        y = other.y;
+        z = other.z;
+        w = other.w;
+    }
+
+    /*------ Methods ------*/
+    
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::set(real inX, real inY, real inZ, real inW)
+    {
+        x = inX;
+        y = inY;
+        z = inZ;
+        w = inW;
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::set(const real *values)
+    {
+        x = values[0];
+        y = values[1];
+        z = values[2];
+        w = values[3];
+    }
+    
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::set(const std::vector<real>& values)
+    {
+        if (values.size()!=4)
+            throw out_of_range("gmath::Quaternion: values must be of 4 elements");
+        
+        x = values[0];
+        y = values[1];
+        z = values[2];
+        w = values[3];
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::setToIdentity()
+    {
+        x=0.0; y=0.0; z=0.0; w=1.0; 
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> QuaternionT<real>::getAxisX() const
+    {
+        return this->rotateVector(Vector3T<real>::XAXIS); 
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> QuaternionT<real>::getAxisY() const
+    {
+        return this->rotateVector(Vector3T<real>::YAXIS); 
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> QuaternionT<real>::getAxisZ() const
+    {
+        return this->rotateVector(Vector3T<real>::ZAXIS); 
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> QuaternionT<real>::getAxis(Axis axis) const
+    {
+        return this->rotateVector(Vector3T<real>(getVector3FromAxis(axis))); 
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::fromMatrix3(const Matrix3T<real>& mat)
+    {
+        // Code from Geometric Tools www.geometrictools.com
+        // Algorithm in Ken Shoemake's article in 1987 SIGGRAPH course notes
+        // article "HQuaternion Calculus and Fast Animation".
+
+        const int next[3] = { 1, 2, 0 };
+
+        real trace = mat(0,0) + mat(1,1) + mat(2,2);
+        real root;
+
+        if (trace > 0)
+        {
+            // |w| > 1/2, may as well choose w > 1/2
+            root = sqrt(trace + 1.0);  // 2w
+            w = 0.5*root;
+            root = 0.5/root;  // 1/(4w)
+            x = (mat(1,2) - mat(2,1))*root;
+            y = (mat(2,0) - mat(0,2))*root;
+            z = (mat(0,1) - mat(1,0))*root;
+        }
+        else
+        {
+            // |w| <= 1/2
+            int i = 0;
+            if (mat(1,1) > mat(0,0))
+            {
+                i = 1;
+            }
+            if (mat(2,2) > mat(i,i))
+            {
+                i = 2;
+            }
+            int j = next[i];
+            int k = next[j];
+
+            root = sqrt(mat(i,i) - mat(j,j) - mat(k,k) + 1.0);
+            real* quat[3] = { &x, &y, &z };
+            *quat[i] = 0.5*root;
+            root = 0.5/root;
+            w = (mat(j,k) - mat(k,j))*root;
+            *quat[j] = (mat(i,j) + mat(j,i))*root;
+            *quat[k] = (mat(i,k) + mat(k,i))*root;
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::fromMatrix4(const Matrix4T<real>& mat)
+    {
+        fromMatrix3(mat.toMatrix3());
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix3T<real> QuaternionT<real>::toMatrix3() const
+    {
+        real xx = 2.0*x*x;
+        real yy = 2.0*y*y;
+        real zz = 2.0*z*z;
+        real xy = 2.0*x*y;
+        real zw = 2.0*z*w;
+        real xz = 2.0*x*z;
+        real yw = 2.0*y*w;
+        real yz = 2.0*y*z;
+        real xw = 2.0*x*w;
+        return Matrix3T<real>(
+                1.0-yy-zz, xy+zw,     xz-yw,
+                xy-zw,     1.0-xx-zz, yz+xw,
+                xz+yw,     yz-xw,     1.0-xx-yy 
+                );
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> QuaternionT<real>::toMatrix4() const
+    {
+        real xx = 2.0*x*x;
+        real yy = 2.0*y*y;
+        real zz = 2.0*z*z;
+        real xy = 2.0*x*y;
+        real zw = 2.0*z*w;
+        real xz = 2.0*x*z;
+        real yw = 2.0*y*w;
+        real yz = 2.0*y*z;
+        real xw = 2.0*x*w;
+        return Matrix4T<real>(
+                1.0-yy-zz, xy+zw,     xz-yw,     0.0,
+                xy-zw,     1.0-xx-zz, yz+xw,     0.0,
+                xz+yw,     yz-xw,     1.0-xx-yy, 0.0,
+                0.0,       0.0,       0.0,       1.0
+                );
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::setMatrix4(Matrix4T<real>& outMat) const
+    {
+        real xx = 2.0*x*x;
+        real yy = 2.0*y*y;
+        real zz = 2.0*z*z;
+        real xy = 2.0*x*y;
+        real zw = 2.0*z*w;
+        real xz = 2.0*x*z;
+        real yw = 2.0*y*w;
+        real yz = 2.0*y*z;
+        real xw = 2.0*x*w;
+        outMat.set(
+                1.0-yy-zz, xy+zw,     xz-yw,     0.0,
+                xy-zw,     1.0-xx-zz, yz+xw,     0.0,
+                xz+yw,     yz-xw,     1.0-xx-yy, 0.0,
+                0.0,       0.0,       0.0,       1.0
+                );
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::setMatrix4(Matrix4T<real>& outMat, const Vector3T<real>& scale, const Vector3T<real>& pos) const
+    {
+        real xx = 2.0*x*x;
+        real yy = 2.0*y*y;
+        real zz = 2.0*z*z;
+        real xy = 2.0*x*y;
+        real zw = 2.0*z*w;
+        real xz = 2.0*x*z;
+        real yw = 2.0*y*w;
+        real yz = 2.0*y*z;
+        real xw = 2.0*x*w;
+        outMat.set(
+                1.0-yy-zz, xy+zw,     xz-yw,     0.0,
+                xy-zw,     1.0-xx-zz, yz+xw,     0.0,
+                xz+yw,     yz-xw,     1.0-xx-yy, 0.0,
+                pos.x,     pos.y,     pos.z,     1.0);
+        outMat.setScale(scale);
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::fromAxisAngle(const Vector3T<real>& axis, real angle)
+    {
+        // assert:  axis[] is unit length
+        //
+        // The quaternion representing the rotation is
+        //   q = cos(A/2)+sin(A/2)*(x*i+y*j+z*k)
+
+        real halfAngle = angle/2.0;
+        Vector3T<real> quatVec = axis.normalize() * sin(halfAngle);
+        w = cos(halfAngle);
+        x = quatVec.x;
+        y = quatVec.y;
+        z = quatVec.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::toAxisAngle (Vector3T<real>& outAxis, real& outAngle) const
+    {
+        // The quaternion representing the rotation is
+        //   q = cos(A/2)+sin(A/2)*(x*i+y*j+z*k)
+
+        real sqrLength = x*x + y*y
+            + z*z;
+
+        if (sqrLength > gmath::EPSILON)
+        {
+            outAngle = (2)*acos(w);
+            real invLength;
+            if (sqrLength != 0)
+                invLength = 1/sqrt(sqrLength);
+            else
+                invLength = 0;
+            outAxis.x = x*invLength;
+            outAxis.y = y*invLength;
+            outAxis.z = z*invLength;
+        }
+        else
+        {
+            // Angle is 0 (mod 2*gmath::PI), so any axis will do.
+            outAngle = 0;
+            outAxis.set(1, 0, 0);
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::fromEuler(real angleX, real angleY, real angleZ, RotationOrder order)
+    {
+        switch (order)
+        {
+        case RotationOrder::XYZ :
+            fromEuler<RotationOrder::XYZ>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::XZY :
+            fromEuler<RotationOrder::XZY>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::YXZ :
+            fromEuler<RotationOrder::YXZ>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::YZX :
+            fromEuler<RotationOrder::YZX>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::ZXY :
+            fromEuler<RotationOrder::ZXY>(angleX, angleY, angleZ);
+            break;
+        case RotationOrder::ZYX :
+            fromEuler<RotationOrder::ZYX>(angleX, angleY, angleZ);
+            break;
+        }
+    }
+
+    template <typename real>
+    template <RotationOrder ORDER>
+    GMATH_INLINE void QuaternionT<real>::fromEuler(real angleX, real angleY, real angleZ)
+    {
+        const real angles[3] = { angleX, angleY, angleZ };
+        detail::eulerToQuaternion<ORDER>(angles, data());
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::fromEuler(const EulerT<real>& euler, RotationOrder order)
+    {
+        // ensure euler is radians
+        EulerT<real> r = euler.toRadians();
+        fromEuler(r.x, r.y, r.z, order);
+    }
+
+    template <typename real>
+    GMATH_INLINE EulerT<real> QuaternionT<real>::toEuler(RotationOrder order) const
+    {
+        switch (order)
+        {
+        case RotationOrder::XZY :
+            return toEuler<RotationOrder::XZY>();
+        case RotationOrder::YXZ :
+            return toEuler<RotationOrder::YXZ>();
+        case RotationOrder::YZX :
+            return toEuler<RotationOrder::YZX>();
+        case RotationOrder::ZXY :
+            return toEuler<RotationOrder::ZXY>();
+        case RotationOrder::ZYX :
+            return toEuler<RotationOrder::ZYX>();
+        default:
+            return toEuler<RotationOrder::XYZ>();
+        }
+    }
+
+    template <typename real>
+    template <RotationOrder ORDER>
+    GMATH_INLINE EulerT<real> QuaternionT<real>::toEuler() const
+    {
+        EulerT<real> euler(Unit::radians);
+        detail::QuaternionRotation<real> rotation = { data() };
+        detail::eulerFromRotation<ORDER>(rotation, euler.data());
+        return euler;
+    }
+
+    template <typename real>
+    GMATH_INLINE real QuaternionT<real>::length () const
+    {
+        return sqrt(w*w + x*x + y*y + z*z);
+    }
+
+    template <typename real>
+    GMATH_INLINE real QuaternionT<real>::squaredLength () const
+    {
+        return w*w + x*x + y*y + z*z;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::unit() const
+    {
+        real n = length();
+        return *this / n;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::unitInPlace()
+    {
+        real n = length();
+        *this /= n;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::normalizeInPlace ()
+    {
+        real len = length();
+
+        if (len > gmath::EPSILON)
+        {
+            real invLength = (1)/len;
+            w *= invLength;
+            x *= invLength;
+            y *= invLength;
+            z *= invLength;
+        }
+        else
+        {
+            w = 0;
+            x = 0;
+            y = 0;
+            z = 0;
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::normalize () const
+    {
+        QuaternionT<real> retQuat;
+        real len = length();
+
+        if (len > gmath::EPSILON)
+        {
+            real invLength = (1)/len;
+            retQuat.w = w*invLength;
+            retQuat.x = x*invLength;
+            retQuat.y = y*invLength;
+            retQuat.z = z*invLength;
+        }
+        else
+        {
+            retQuat.w = 0;
+            retQuat.x = 0;
+            retQuat.y = 0;
+            retQuat.z = 0;
+        }
+        return retQuat;
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::inverseInPlace ()
+    {
+        unitInPlace().conjugateInPlace();
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::inverse () const
+    {
+        return unit().conjugate();
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::conjugateInPlace ()
+    {
+        set(-x, -y, -z, w);
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR QuaternionT<real> QuaternionT<real>::conjugate () const
+    {
+        return QuaternionT<real>(-x, -y, -z, w);
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::exp () const
+    {
+        // If q = A*(x*i+y*j+z*k) where (x,y,z) is unit length, then
+        // exp(q) = cos(A)+sin(A)*(x*i+y*j+z*k).  If sin(A) is near zero,
+        // use exp(q) = cos(A)+A*(x*i+y*j+z*k) since A/sin(A) has limit 1.
+
+        QuaternionT<real> result;
+
+        real angle = sqrt(x*x + y*y + z*z);
+
+        real sn = sin(angle);
+        result.w = cos(angle);
+
+        if (fabs(sn) >= gmath::EPSILON)
+        {
+            real coeff = sn/angle;
+
+            result.x = coeff*x;
+            result.y = coeff*y;
+            result.z = coeff*z;
+            //result.w = coeff*w;
+        }
+        else
+        {
+            result.x = x;
+            result.y = y;
+            result.z = z;
+            //result.w = w;
+        }
+
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::log () const
+    {
+        // If q = cos(A)+sin(A)*(x*i+y*j+z*k) where (x,y,z) is unit length, then
+        // log(q) = A*(x*i+y*j+z*k).  If sin(A) is near zero, use log(q) =
+        // sin(A)*(x*i+y*j+z*k) since sin(A)/A has limit 1.
+
+        QuaternionT<real> result;
+        result.w = 0;
+
+        if (fabs(w) < 1)
+        {
+            real angle = acos(w);
+            real sn = sin(angle);
+            if (fabs(sn) >= gmath::EPSILON)
+            {
+                real coeff = angle/sn;
+                result.x = coeff*x;
+                result.y = coeff*y;
+                result.z = coeff*z;
+                //result.w = coeff*w;
+                return result;
+            }
+        }
+
+        result.x = x;
+        result.y = y;
+        result.z = z;
+        result.w = w;
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> QuaternionT<real>::rotateVector(const Vector3T<real>& vec) const
+    {
+        // Same result as conjugate() * (Quaternion(vec, 0) * *this) for a unit quaternion,
+        // with 15 multiplications instead of 32: t = 2 * cross(xyz, vec), vec + w * t + cross(xyz, t)
+        real tx = y*vec.z - z*vec.y;
+        real ty = z*vec.x - x*vec.z;
+        real tz = x*vec.y - y*vec.x;
+        tx += tx;
+        ty += ty;
+        tz += tz;
+        return Vector3T<real>((vec.x + w*tx) + (y*tz - z*ty),
+                              (vec.y + w*ty) + (z*tx - x*tz),
+                              (vec.z + w*tz) + (x*ty - y*tx));
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR real QuaternionT<real>::dot(const QuaternionT<real> & other) const
+    {
+        return x*other.x + y*other.y + z*other.z + w*other.w;
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::matchHemisphere(const QuaternionT<real>& other) 
+    {
+        if(dot(other) < 0.0){
+            x=-x; y=-y; z=-z; w=-w;
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::mirrorInPlace(CartesianPlane plane) 
+    {
+        real data[4] = {x, y, z, w};
+        switch (plane) {
+            case CartesianPlane::XY: 
+                x=data[2];  y=data[3]; z=data[0]; w=data[1]; break;
+            case CartesianPlane::YZ: 
+                x=-data[3]; y=data[2]; z=data[1]; w=-data[0]; break;
+            case CartesianPlane::ZX: 
+                z=-data[2]; w=-data[3]; break;
+        }
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::mirror(CartesianPlane plane) const
+    {
+        QuaternionT<real> result(*this);
+        result.mirrorInPlace(plane);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real>& QuaternionT<real>::mirrorInPlace(const Vector3T<real>& mirrorNormal, Axis primary, Axis secondary) 
+    {
+        Vector3T<real> pointAt = this->getAxis(primary);
+        Vector3T<real> normal  = this->getAxis(secondary);
+        pointAt.mirrorInPlace(mirrorNormal);
+        normal.mirrorInPlace(mirrorNormal);
+        // aim is only available in double precision
+        QuaternionT<double> result;
+        aim(result, Vector3T<double>(pointAt), Vector3T<double>(normal), primary, secondary);
+        *this = QuaternionT<real>(result);
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::mirror(const Vector3T<real>& mirrorNormal, Axis primary, Axis secondary) const
+    {
+        QuaternionT<real> result(*this);
+        result.mirrorInPlace(mirrorNormal, primary, secondary);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE void QuaternionT<real>::slerpInPlace(const QuaternionT<real> &q1, const QuaternionT<real> &q2, real t, bool shortestPath)
+    {   
+        QuaternionT<real> Q2 = q2;
+        if (q1.dot(q2)<0.0)
+        {
+            Q2 = -q2;
+        }
+
+        QuaternionT<real> qd = q1 - Q2;
+        real lengthD =  sqrt (qd.dot(qd));
+
+        QuaternionT<real> qs = q1 + Q2;
+        real lengthS =  sqrt (qs.dot(qs));
+
+        real a = 2.0 *  atan2(lengthD, lengthS);
+        real s = 1.0 - t;
+
+        (*this) = 
+            q1 * (sinx_over_x(s * a) / sinx_over_x(a) * s)  +
+            Q2 * (sinx_over_x(t * a) / sinx_over_x(a) * t) ;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::slerp(const QuaternionT<real> &q2, real t, bool shortestPath) const
+    {   
+        QuaternionT<real> Q2 = q2;
+        if ((*this).dot(q2)<0.0)
+        {
+            Q2 = -q2;
+        }
+
+        QuaternionT<real> qd = (*this) - Q2;
+        real lengthD =  sqrt (qd.dot(qd));
+
+        QuaternionT<real> qs = (*this) + Q2;
+        real lengthS =  sqrt (qs.dot(qs));
+
+        real a = 2.0 *  atan2(lengthD, lengthS);
+        real s = 1.0 - t;
+
+        return
+            (*this) * (sinx_over_x(s * a) / sinx_over_x(a) * s)  +
+            Q2 * (sinx_over_x(t * a) / sinx_over_x(a) * t) ;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::nlerp(const QuaternionT<real> &q2, real t) const
+    {
+        real cosine = (*this).dot(q2);
+        QuaternionT<real> Q2 = cosine < 0.0 ? -q2 : q2;
+
+        QuaternionT<real> result = (*this) * (1.0 - t) + Q2 * t;
+        result.normalizeInPlace();
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::correctedNlerp(const QuaternionT<real> &q2, real t) const
+    {
+        real cosine = (*this).dot(q2);
+        QuaternionT<real> Q2 = q2;
+        if (cosine < 0.0)
+        {
+            Q2 = -q2;
+            cosine = -cosine;
+        }
+
+        real w1, w2;
+        detail::correctedNlerpWeights(cosine, t, w1, w2);
+        QuaternionT<real> result = (*this) * w1 + Q2 * w2;
+        result.normalizeInPlace();
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::polynomialSlerp(const QuaternionT<real> &q2, real t, bool precise) const
+    {
+        real cosine = (*this).dot(q2);
+        QuaternionT<real> Q2 = q2;
+        if (cosine < 0.0)
+        {
+            Q2 = -q2;
+            cosine = -cosine;
+        }
+
+        real w1, w2;
+        if (precise)
+            detail::polynomialSlerpWeights<16>(cosine, t, w1, w2);
+        else
+            detail::polynomialSlerpWeights<8>(cosine, t, w1, w2);
+        return (*this) * w1 + Q2 * w2;
+    }
+
+    template <typename real>
+    GMATH_INLINE QuaternionT<real> QuaternionT<real>::interpolate(const QuaternionT<real> &q2, real t, SlerpMethod method) const
+    {
+        switch (method)
+        {
+            case SlerpMethod::POLYNOMIAL:
+                return polynomialSlerp(q2, t, true);
+            case SlerpMethod::POLYNOMIAL_FAST:
+                return polynomialSlerp(q2, t, false);
+            case SlerpMethod::CORRECTED_NLERP:
+                return correctedNlerp(q2, t);
+            case SlerpMethod::NLERP:
+                return nlerp(q2, t);
+            default:
+                return slerp(q2, t);
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string QuaternionT<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Quaternion("<< x <<", "<< y <<", "<< z <<", "<< w <<");";
+
+        return oss.str();
+    }
+
+    #ifdef CMAYA
+
+        template <typename real>
+        GMATH_INLINE void QuaternionT<real>::fromMayaQuaternion(const MQuaternion &mquat)
+        {
+            double dest[4];
+            mquat.get(dest);
+            set(real(dest[0]), real(dest[1]), real(dest[2]), real(dest[3]));
+        }
+
+        template <typename real>
+        GMATH_INLINE MQuaternion QuaternionT<real>::toMayaQuaternion() const
+        {
+            return MQuaternion(x, y, z, w);
+        }
+
+    #endif
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+#define GMATH_QUATERNIONARRAY_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmQuaternion.h"
+#include "gmVector3Array.h"
+#include "gmSimd.h"
+
+namespace gmath
+{
+    /**
+    Array of Quaternion stored as a structure of arrays.
+
+    The x, y, z and w components live in four separate arrays aligned to simd::ALIGNMENT bytes,
+    so the bulk methods process several quaternions per instruction.
+    */
+    class QuaternionArray
+    {
+    private:
+        /*------ properties ------*/
+        simd::SoaStorage _storage;
+
+    public:
+        /*------ constructors ------*/
+        QuaternionArray();
+        explicit QuaternionArray(size_t size);
+        QuaternionArray(const Quaternion* values, size_t count);
+        QuaternionArray(const std::vector<Quaternion>& values);
+
+        /*------ size ------*/
+        size_t size() const;
+
+        /** Change the number of quaternions. The existing ones are kept, the new ones are identities. */
+        void resize(size_t size);
+
+        /*------ coordinate access ------*/
+
+        /** The component arrays, size() values each. */
+        double* x();
+        double* y();
+        double* z();
+        double* w();
+        const double* x() const;
+        const double* y() const;
+        const double* z() const;
+        const double* w() const;
+
+        /** The component arrays, for the simd kernels. */
+        simd::QuaternionSoa soa() const;
+
+        Quaternion get(size_t i) const;
+        void set(size_t i, const Quaternion& quat);
+
+        /*------ conversion ------*/
+        void fromQuaternions(const Quaternion* values, size_t count);
+        void fromQuaternions(const std::vector<Quaternion>& values);
+        void toQuaternions(Quaternion* out) const;
+        std::vector<Quaternion> toQuaternions() const;
+
+        /*------ bulk methods ------*/
+        // Unless stated otherwise, out is resized to size() and it can be this or other.
+
+        /** Quaternion::normalizeInPlace on every quaternion. */
+        void normalizeInPlace();
+
+        /** out[i] = this[i].dot(other[i]), out must have room for size() values. */
+        void dot(const QuaternionArray& other, double* out) const;
+
+        /** out[i] = this[i] * other[i] */
+        void multiply(const QuaternionArray& other, QuaternionArray& out) const;
+
+        /** out[i] = this[i].slerp(other[i], t, shortestPath) */
+        void slerp(const QuaternionArray& other, double t, QuaternionArray& out, bool shortestPath=true) const;
+
+        /** out[i] = this[i].interpolate(other[i], t, method), the approximated methods run without
+            any function call per quaternion, so the compiler can vectorize them. */
+        void slerp(const QuaternionArray& other, double t, QuaternionArray& out, SlerpMethod method) const;
+
+        /** out[i] = this[i].rotateVector(vectors[i]). out can be vectors. */
+        void rotateVector(const Vector3Array& vectors, Vector3Array& out) const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_QUATERNIONARRAY_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,232 @@
+namespace gmath
+{
+    /*------ constructors ------*/
+
+    GMATH_INLINE QuaternionArray::QuaternionArray()
+        : _storage(4)
+    {
+    }
+
+    GMATH_INLINE QuaternionArray::QuaternionArray(size_t size)
+        : _storage(4)
+    {
+        resize(size);
+    }
+
+    GMATH_INLINE QuaternionArray::QuaternionArray(const Quaternion* values, size_t count)
+        : _storage(4)
+    {
+        fromQuaternions(values, count);
+    }
+
+    GMATH_INLINE QuaternionArray::QuaternionArray(const std::vector<Quaternion>& values)
+        : _storage(4)
+    {
+        fromQuaternions(values);
+    }
+
+    /*------ size ------*/
+
+    GMATH_INLINE size_t QuaternionArray::size() const
+    {
+        return _storage.size();
+    }
+
+    GMATH_INLINE void QuaternionArray::resize(size_t size)
+    {
+        size_t oldSize = _storage.size();
+        _storage.resize(size);
+
+        double* pw = w();
+        for (size_t i=oldSize; i<size; i++)
+            pw[i] = 1.0;
+    }
+
+    /*------ coordinate access ------*/
+
+    GMATH_INLINE double* QuaternionArray::x() { return _storage.component(0); }
+    GMATH_INLINE double* QuaternionArray::y() { return _storage.component(1); }
+    GMATH_INLINE double* QuaternionArray::z() { return _storage.component(2); }
+    GMATH_INLINE double* QuaternionArray::w() { return _storage.component(3); }
+    GMATH_INLINE const double* QuaternionArray::x() const { return _storage.component(0); }
+    GMATH_INLINE const double* QuaternionArray::y() const { return _storage.component(1); }
+    GMATH_INLINE const double* QuaternionArray::z() const { return _storage.component(2); }
+    GMATH_INLINE const double* QuaternionArray::w() const { return _storage.component(3); }
+
+    GMATH_INLINE simd::QuaternionSoa QuaternionArray::soa() const
+    {
+        // the kernels take mutable pointers, the const methods only pass them as inputs
+        QuaternionArray& self = const_cast<QuaternionArray&>(*this);
+        simd::QuaternionSoa result = { self.x(), self.y(), self.z(), self.w() };
+        return result;
+    }
+
+    GMATH_INLINE Quaternion QuaternionArray::get(size_t i) const
+    {
+        if (i >= size()) {
+            throw out_of_range("gmath::QuaternionArray - index out of range");
+        }
+        return Quaternion(x()[i], y()[i], z()[i], w()[i]);
+    }
+
+    GMATH_INLINE void QuaternionArray::set(size_t i, const Quaternion& quat)
+    {
+        if (i >= size()) {
+            throw out_of_range("gmath::QuaternionArray - index out of range");
+        }
+        x()[i] = quat.x;
+        y()[i] = quat.y;
+        z()[i] = quat.z;
+        w()[i] = quat.w;
+    }
+
+    /*------ conversion ------*/
+
+    GMATH_INLINE void QuaternionArray::fromQuaternions(const Quaternion* values, size_t count)
+    {
+        _storage.resize(count);
+        simd::QuaternionSoa q = soa();
+        for (size_t i=0; i<count; i++)
+        {
+            q.x[i] = values[i].x;
+            q.y[i] = values[i].y;
+            q.z[i] = values[i].z;
+            q.w[i] = values[i].w;
+        }
+    }
+
+    GMATH_INLINE void QuaternionArray::fromQuaternions(const std::vector<Quaternion>& values)
+    {
+        fromQuaternions(values.empty() ? NULL : &values[0], values.size());
+    }
+
+    GMATH_INLINE void QuaternionArray::toQuaternions(Quaternion* out) const
+    {
+        simd::QuaternionSoa q = soa();
+        for (size_t i=0; i<size(); i++)
+            out[i].set(q.x[i], q.y[i], q.z[i], q.w[i]);
+    }
+
+    GMATH_INLINE std::vector<Quaternion> QuaternionArray::toQuaternions() const
+    {
+        std::vector<Quaternion> result(size());
+        if (!result.empty())
+            toQuaternions(&result[0]);
+        return result;
+    }
+
+    /*------ bulk methods ------*/
+
+    GMATH_INLINE void QuaternionArray::normalizeInPlace()
+    {
+        simd::normalizeQuaternions(soa(), size());
+    }
+
+    GMATH_INLINE void QuaternionArray::dot(const QuaternionArray& other, double* out) const
+    {
+        if (other.size() != size())
+            throw GMathError("QuaternionArray.dot: the two arrays must have the same size");
+
+        simd::dotQuaternions(soa(), other.soa(), out, size());
+    }
+
+    GMATH_INLINE void QuaternionArray::multiply(const QuaternionArray& other, QuaternionArray& out) const
+    {
+        if (other.size() != size())
+            throw GMathError("QuaternionArray.multiply: the two arrays must have the same size");
+
+        out._storage.resize(size());
+        simd::multiplyQuaternions(soa(), other.soa(), out.soa(), size());
+    }
+
+    GMATH_INLINE void QuaternionArray::slerp(const QuaternionArray& other, double t, QuaternionArray& out, bool shortestPath) const
+    {
+        if (other.size() != size())
+            throw GMathError("QuaternionArray.slerp: the two arrays must have the same size");
+
+        out._storage.resize(size());
+        simd::QuaternionSoa a = soa();
+        simd::QuaternionSoa b = other.soa();
+        simd::QuaternionSoa r = out.soa();
+        for (size_t i=0; i<size(); i++)
+        {
+            Quaternion q = Quaternion(a.x[i], a.y[i], a.z[i], a.w[i]).slerp(
+                Quaternion(b.x[i], b.y[i], b.z[i], b.w[i]), t, shortestPath);
+            r.x[i] = q.x;
+            r.y[i] = q.y;
+            r.z[i] = q.z;
+            r.w[i] = q.w;
+        }
+    }
+
+    namespace detail
+    {
+        GMATH_INLINE void nlerpWeights(double, double t, double& w1, double& w2)
+        {
+            w1 = 1.0 - t;
+            w2 = t;
+        }
+
+        /*  out = a * w1 + b * w2, with b taken in the hemisphere of a and
+            WEIGHTS(cosine, t, w1, w2) the weights of one of the approximated slerps. */
+        template <void (*WEIGHTS)(double, double, double&, double&)>
+        GMATH_INLINE void blendQuaternions(const simd::QuaternionSoa& a, const simd::QuaternionSoa& b, double t,
+                                           const simd::QuaternionSoa& out, size_t count)
+        {
+            for (size_t i=0; i<count; i++)
+            {
+                double cosine = a.x[i]*b.x[i] + a.y[i]*b.y[i] + a.z[i]*b.z[i] + a.w[i]*b.w[i];
+                double sign = cosine < 0.0 ? -1.0 : 1.0;
+
+                double w1, w2;
+                WEIGHTS(cosine * sign, t, w1, w2);
+                w2 *= sign;
+
+                double x = a.x[i]*w1 + b.x[i]*w2;
+                double y = a.y[i]*w1 + b.y[i]*w2;
+                double z = a.z[i]*w1 + b.z[i]*w2;
+                double w = a.w[i]*w1 + b.w[i]*w2;
+                out.x[i] = x;
+                out.y[i] = y;
+                out.z[i] = z;
+                out.w[i] = w;
+            }
+        }
+    }
+
+    GMATH_INLINE void QuaternionArray::slerp(const QuaternionArray& other, double t, QuaternionArray& out, SlerpMethod method) const
+    {
+        if (other.size() != size())
+            throw GMathError("QuaternionArray.slerp: the two arrays must have the same size");
+
+        out._storage.resize(size());
+        switch (method)
+        {
+            case SlerpMethod::POLYNOMIAL:
+                detail::blendQuaternions< detail::polynomialSlerpWeights<16, double> >(soa(), other.soa(), t, out.soa(), size());
+                break;
+            case SlerpMethod::POLYNOMIAL_FAST:
+                detail::blendQuaternions< detail::polynomialSlerpWeights<8, double> >(soa(), other.soa(), t, out.soa(), size());
+                break;
+            case SlerpMethod::CORRECTED_NLERP:
+                detail::blendQuaternions< detail::correctedNlerpWeights<double> >(soa(), other.soa(), t, out.soa(), size());
+                simd::normalizeQuaternions(out.soa(), size());
+                break;
+            case SlerpMethod::NLERP:
+                detail::blendQuaternions<detail::nlerpWeights>(soa(), other.soa(), t, out.soa(), size());
+                simd::normalizeQuaternions(out.soa(), size());
+                break;
+            default:
+                slerp(other, t, out);
+        }
+    }
+
+    GMATH_INLINE void QuaternionArray::rotateVector(const Vector3Array& vectors, Vector3Array& out) const
+    {
+        if (vectors.size() != size())
+            throw GMathError("QuaternionArray.rotateVector: the two arrays must have the same size");
+
+        out.resize(size());
+        simd::rotateVectors(soa(), vectors.soa(), out.soa(), size());
+    }
+}
@@ -36,9 +36,11 @@ SOFTWARE.
 */
 
 #pragma once
+#define GMATH_ROOT_BEGIN
 
 #include <float.h>
 #include <math.h>
+#include <string.h>
 #include <sstream>
 #include <exception>
 
@@ -55,6 +57,22 @@ SOFTWARE.
     #include <memory.h>
 #endif
 
+/*  GMATH_HEADER_ONLY
+
+    By default GMath is built as a library (gmath-static, gmath-shared) and every
+    method is a real function call. Defining GMATH_HEADER_ONLY before including any
+    GMath header turns all the implementation files (*.inl) into inline code, so the
+    compiler can inline the arithmetic at the call site and no library is needed.
+    The header only mode requires C++17, the constants (Vector3::XAXIS, Matrix4::IDENTITY...)
+    become inline variables. */
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_INLINE inline
+    #define GMATH_CONSTEXPR constexpr
+#else
+    #define GMATH_INLINE
+    #define GMATH_CONSTEXPR
+#endif
+
 namespace gmath
 {
     const double EPSILON =  1e-08;
@@ -130,6 +148,29 @@ namespace gmath
         XZ = ZX
     };
 
+    /** How Quaternion::interpolate (and the Xfo and array versions) blend two rotations.
+        The errors are the largest rotation angle between the result and EXACT, for unit quaternions,
+        measured by benchmark/benchSlerp. */
+    enum class SlerpMethod {
+        EXACT = 0,              // Quaternion::slerp
+        POLYNOMIAL = 1,         // polynomial approximation of slerp (16 terms), error < 1e-7 rad, not normalized
+        POLYNOMIAL_FAST = 2,    // same with 8 terms, error < 5e-5 rad, length off by less than 1e-4
+        CORRECTED_NLERP = 3,    // nlerp with a corrected t, error < 1e-3 rad
+        NLERP = 4               // normalized linear interpolation, not constant speed, error < 0.15 rad
+    };
+
+    /** Result of the Xfo operations that report errors instead of throwing them. */
+    enum class XfoStatus {
+        OK = 0,
+        NON_UNIFORM_SCALE = 1   // the exact result would need shearing, the one given ignores it
+    };
+
+    /** How orthonormalizeMatrices removes the drift of rotation matrices. */
+    enum class OrthonormalizeMethod {
+        GRAM_SCHMIDT = 0,       // Matrix3::orthogonal, the x row keeps its direction, the fastest
+        POLAR = 1               // the closest rotation, every row moves by the same amount
+    };
+
     bool isAxisX(Axis axis);
     bool isAxisY(Axis axis);
     bool isAxisZ(Axis axis);
@@ -174,3 +215,8 @@ namespace gmath
         return gmath::min(gmath::max(value, min), max);
     }
 }
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_ROOT_END
+    #include "gmInline.h"
+#endif
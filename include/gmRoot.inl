@@ -0,0 +1,66 @@
+namespace gmath
+{
+	GMATH_INLINE std::string GMathError::prefix = "GMathError: ";
+
+    // const double EPSILON = 1e-08;
+    // const double PI = 4.0*atan(1.0);
+    // const double HALFPI = PI*0.5;
+    // const double MAX = DBL_MAX;
+    // const double MIN = -DBL_MAX;
+    // const double SMALLEST = DBL_MIN;
+
+    GMATH_INLINE bool isAxisX(Axis axis)
+    {
+        return (axis == Axis::POSX || axis == Axis::NEGX);
+    }
+
+    GMATH_INLINE bool isAxisY(Axis axis)
+    {
+        return (axis == Axis::POSY || axis == Axis::NEGY);
+    }
+
+    GMATH_INLINE bool isAxisZ(Axis axis)
+    {
+        return (axis == Axis::POSZ || axis == Axis::NEGZ);
+    }
+
+    GMATH_INLINE double acos (double x)
+    {
+        if (-(double)1 < x) {
+            if (x < (double)1) {
+                return (double) ::acos((double)x);
+            }
+            else {
+                return (double)0;
+            }
+        }
+        else {
+            return PI;
+        }
+    }
+
+    GMATH_INLINE double asin (double x)
+    {
+        if (-(double)1 < x) {
+            if (x < (double)1) {
+                return (double) ::asin((double)x);
+            }
+            else {
+                return HALFPI;
+            }
+        }
+        else {
+            return -HALFPI;
+        }
+    }
+
+    GMATH_INLINE double toRadians(double x)
+    {
+        return x*(PI/(double)180.0);
+    }
+
+    GMATH_INLINE double toDegrees(double x)
+    {
+        return x*((double)180.0/PI);
+    }
+}
\ No newline at end of file
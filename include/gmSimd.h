@@ -0,0 +1,278 @@
+#pragma once
+#define GMATH_SIMD_BEGIN
+
+#include "gmRoot.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define GMATH_SIMD_X86
+#endif
+
+namespace gmath
+{
+    /**
+    Low level kernels used by Matrix4, by the batch functions and by the array classes.
+
+    Every kernel has a scalar version and, on x86, SIMD versions (SSE2, AVX2, AVX-512).
+    When a kernel has no version for an instruction set, the one of the closest set below it is used.
+    The best version supported by the running CPU is chosen the first time a kernel is used,
+    no special compiler flag is needed to build GMath.
+
+    All the matrices are 16 doubles ROW MAJOR, like Matrix4::data().
+    The output can be the same memory as any of the inputs.
+
+    Precision:
+    the SIMD versions perform exactly the same operations, in the same order, as the scalar ones
+    (no fused multiply-add, no reciprocal approximation), so their results are identical to the scalar
+    results: the error bound between any two instruction sets is 0 ULP.
+    The only exception is a scalar build compiled with floating point contraction (e.g. -mfma together with
+    -ffp-contract=fast), in that case each element can differ from the SIMD result by the rounding of
+    one product, less than 1 ULP of the largest term of its sum.
+    */
+    namespace simd
+    {
+        enum class InstructionSet
+        {
+            SCALAR = 0,
+            SSE2 = 1,
+            AVX2 = 2,
+            AVX512 = 3
+        };
+
+        /** The best instruction set supported by this CPU and operating system. */
+        InstructionSet detectInstructionSet();
+
+        /** The instruction set currently used by the kernels. */
+        InstructionSet getInstructionSet();
+
+        /** Force the kernels to use a specific instruction set, mostly useful for benchmarks and tests.
+            If the CPU doesn't support it, the best supported one below it is used instead.
+            Returns the instruction set actually selected. This function is not thread safe. */
+        InstructionSet setInstructionSet(InstructionSet set);
+
+        const char* instructionSetName(InstructionSet set);
+
+        /** out = a * b */
+        void multiply4x4(const double* a, const double* b, double* out);
+
+        /** out = inverse of m, a matrix full of zeros if m is singular.
+            Returns the determinant of m. */
+        double inverse4x4(const double* m, double* out);
+
+        /** out = transpose of m */
+        void transpose4x4(const double* m, double* out);
+
+        /** Single precision versions of the three kernels above, used by Matrix4f.
+            The multiply and transpose have SSE2 and AVX2 versions, the inverse is scalar only. */
+        void multiply4x4(const float* a, const float* b, float* out);
+        float inverse4x4(const float* m, float* out);
+        void transpose4x4(const float* m, float* out);
+
+        /** Transform count points by the matrix m, each point gives the same result as Vector3 * Matrix4.
+            Points are x, y, z triplets stride doubles apart (in and out use the same stride).
+            in and out can be the same buffer. */
+        void transformPoints4x4(const double* m, const double* in, double* out, size_t count, size_t stride);
+
+        /** As above, with the coordinates in separate x, y, z arrays. */
+        void transformPoints4x4(const double* m, const double* inX, const double* inY, const double* inZ,
+                                double* outX, double* outY, double* outZ, size_t count);
+
+        /*------ Skinning ------*/
+
+        /** The influences of the vertices of a skinned mesh in compressed rows: the influences of vertex v are
+            the indices offsets[v] to offsets[v+1]-1 of joints and weights. A joint is the index of its entry
+            in palette: 16 doubles, a row major matrix, for skinVertices, 12 doubles, qr, qd, the scale and
+            a padding, for skinVerticesDualQuaternion. */
+        struct SkinInfluences
+        {
+            const double* palette;
+            const size_t* offsets;
+            const unsigned int* joints;
+            const double* weights;
+        };
+
+        /** Linear blend skinning of the vertices begin to end-1, see LinearBlendSkinner.
+            Every point is multiplied by the weighted sum of the matrices of its influences, like Vector3 * Matrix4,
+            a vertex without influence is copied. Points and normals are packed x, y, z triplets.
+            The normals, when inNormals is not NULL, are multiplied by the cofactors of the 3x3 part of the sum,
+            its inverse transpose up to a factor, and normalized: they stay perpendicular to a scaled or sheared surface. */
+        void skinVertices(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                          const double* inNormals, double* outNormals, size_t begin, size_t end);
+
+        /** Dual quaternion skinning of the vertices begin to end-1, see DualQuaternionSkinner.
+            The dual quaternions of the influences are blended in the hemisphere of the first one and normalized,
+            their scales are blended linearly, every point is scaled then moved by the blended dual quaternion.
+            The normals get the inverse transpose of the scale and the rotation, then are normalized. */
+        void skinVerticesDualQuaternion(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                        const double* inNormals, double* outNormals, size_t begin, size_t end);
+
+        /*------ Math functions ------*/
+        /*  Elementary functions over arrays, for the batch conversions. They use polynomial approximations
+            instead of libm, their results are identical on every instruction set but can differ from
+            the libm functions. Maximum errors, in ULP of the exact result:
+                batchSinCos     1.5 for |angle| < 4, 2.5 up to 1e6 (beyond it, and for infinity or NaN, libm is used)
+                batchAtan2      2
+                batchAsin       1.5
+                batchAcos       1.5
+                batchSqrt       0, correctly rounded
+                batchRsqrt      1.5, 1 / sqrt with two roundings
+            Like gmath::asin and gmath::acos, the inputs of batchAsin and batchAcos are clamped to [-1, 1], NaN stays NaN.
+            The output can be the same memory as the input. */
+
+        /** outSin[i] = sin(angles[i]), outCos[i] = cos(angles[i]) */
+        void batchSinCos(const double* angles, double* outSin, double* outCos, size_t count);
+
+        /** out[i] = atan2(y[i], x[i]), with the special values of the standard atan2 */
+        void batchAtan2(const double* y, const double* x, double* out, size_t count);
+
+        void batchAsin(const double* in, double* out, size_t count);
+        void batchAcos(const double* in, double* out, size_t count);
+        void batchSqrt(const double* in, double* out, size_t count);
+        void batchRsqrt(const double* in, double* out, size_t count);
+
+        /*------ Structure of arrays ------*/
+
+        /** Pointers to the component arrays of Vector3Array and QuaternionArray. */
+        struct Vector3Soa
+        {
+            double* x;
+            double* y;
+            double* z;
+        };
+
+        struct QuaternionSoa
+        {
+            double* x;
+            double* y;
+            double* z;
+            double* w;
+        };
+
+        /** The rows of 3x3 matrices, m.y.z holds the element (1, 2) of every matrix. */
+        struct Matrix3Soa
+        {
+            Vector3Soa x;
+            Vector3Soa y;
+            Vector3Soa z;
+        };
+
+        /** Alignment, in bytes, of the arrays allocated with alignedAlloc. */
+        const size_t ALIGNMENT = 64;
+
+        void* alignedAlloc(size_t bytes);
+        void alignedFree(void* ptr);
+
+        /** Storage of the array classes: a number of component arrays (x, y, z...) of size() doubles each,
+            every one of them starting on an ALIGNMENT boundary. */
+        class SoaStorage
+        {
+        private:
+            double* _data;
+            size_t _components;
+            size_t _size;
+            size_t _capacity;   // doubles reserved for each component, a multiple of ALIGNMENT
+
+        public:
+            explicit SoaStorage(size_t components, size_t size=0);
+            SoaStorage(const SoaStorage& other);
+            SoaStorage(SoaStorage&& other);
+            ~SoaStorage();
+
+            SoaStorage& operator = (const SoaStorage& other);
+            SoaStorage& operator = (SoaStorage&& other);
+
+            size_t size() const;
+            /** The existing values are kept, the new ones are zero. */
+            void resize(size_t size);
+
+            double* component(size_t i);
+            const double* component(size_t i) const;
+        };
+
+        /*  The following kernels work on count elements and give the same result as the matching
+            Vector3 or Quaternion method called on every element. The output can be one of the inputs. */
+
+        /** Vector3::normalizeInPlace */
+        void normalizeVectors(const Vector3Soa& v, size_t count);
+
+        /** Vector3::dot */
+        void dotVectors(const Vector3Soa& a, const Vector3Soa& b, double* out, size_t count);
+
+        /** Vector3::cross */
+        void crossVectors(const Vector3Soa& a, const Vector3Soa& b, const Vector3Soa& out, size_t count);
+
+        /** Quaternion::normalizeInPlace */
+        void normalizeQuaternions(const QuaternionSoa& q, size_t count);
+
+        /** Quaternion::dot */
+        void dotQuaternions(const QuaternionSoa& a, const QuaternionSoa& b, double* out, size_t count);
+
+        /** Quaternion::operator * */
+        void multiplyQuaternions(const QuaternionSoa& a, const QuaternionSoa& b, const QuaternionSoa& out, size_t count);
+
+        /** Quaternion::rotateVector */
+        void rotateVectors(const QuaternionSoa& q, const Vector3Soa& v, const Vector3Soa& out, size_t count);
+
+        /*  Decomposition of 3x3 matrices, in place: the rows of m become orthonormal.
+            A singular matrix gives NaN. */
+
+        /** Every matrix is scale * shear * rotation: the rows are orthonormalized from x to z and give the rotation
+            (left in m and converted to ori like Quaternion::fromMatrix3), the lengths sc and the shears
+            (xy, xz, yz) with row y = sc.y * (y' + xy * x'), row z = sc.z * (z' + xz * x' + yz * y') in the rotation rows x', y', z'.
+            A matrix with a negative determinant gets a negative scale on the three axes. */
+        void decomposeAffine(const Matrix3Soa& m, const QuaternionSoa& ori, const Vector3Soa& sc, const Vector3Soa& shear, size_t count);
+
+        /** Matrix3::orthogonalInPlace, Gram-Schmidt from the x row. */
+        void orthonormalizeGramSchmidt(const Matrix3Soa& m, size_t count);
+
+        /** The closest orthonormal matrix (the rotation of the polar decomposition), by Newton iterations,
+            no row is favoured. A few iterations for a drifting rotation, about 30 for a scale of 1e6. */
+        void orthonormalizePolar(const Matrix3Soa& m, size_t count);
+
+        /*------ Intersections ------*/
+        /*  Lines against planes, without a branch on the values. The points and the vectors are packed x, y, z triplets,
+            a plane is a normal and a point on it: the triplets planeStride doubles apart in normals and points,
+            3 for a plane per line, 0 for the same plane for every line.
+            types[i] receives the value of the gmath::IntersectionType of line i, out its intersection point
+            only when it is an INTERSECTION, the other points are left as they were, so out can be an input.
+            They return the number of INTERSECTION. */
+
+        /** intersectLinePlane for every line through p0[i] and p1[i], with exactly the same results. */
+        size_t intersectLinesPlanes(const double* p0, const double* p1, const double* normals, const double* points, size_t planeStride,
+                                    double* out, unsigned char* types, size_t count, bool infiniteLine);
+
+        /** The rays origins[i] + directions[i] * t for t >= 0, the point is origins[i] + directions[i] * t. */
+        size_t intersectRaysPlanes(const double* origins, const double* directions, const double* normals, const double* points,
+                                   size_t planeStride, double* out, unsigned char* types, size_t count);
+
+        /*------ Bounds ------*/
+        /*  Points are x, y, z triplets stride doubles apart. */
+
+        /** Grow min and max (3 doubles each) to the count points transformed by m like Vector3 * Matrix4,
+            or as they are when m is NULL. A NaN coordinate is ignored, a bound of zero can be -0 or +0
+            depending on the instruction set. */
+        void boundPoints(const double* m, const double* in, size_t count, size_t stride, double* min, double* max);
+
+        /** Add the sums of the count points minus shift to sums[0..2] and the sums of their outer
+            products to sums[3..11], a row major 3x3 matrix: the moments for a covariance matrix.
+            A point with a NaN or infinite coordinate is skipped, returns the number of points added. */
+        size_t momentsPoints(const double* in, size_t count, size_t stride, const double* shift, double* sums);
+
+        /*------ Culling ------*/
+        /*  Against 6 planes, 24 doubles: the normal x, y, z of a plane and then its w, normals pointing inside.
+            Bit i%8 of visible[i/8] is set when object i is visible, the bits after the last object are cleared.
+            They return the number of visible objects. */
+
+        /** The spheres of centers x, y, z triplets and radii[i] at a signed distance above -radii[i] from every plane. */
+        size_t cullSpheres(const double* planes, const double* centers, const double* radii, size_t count, unsigned char* visible);
+
+        /** The boxes of min x, y, z and max x, y, z, stride doubles apart, with their corner the furthest along the
+            normal on the positive side of every plane. A box that crosses the corner of two planes outside of
+            the volume is visible, an empty box (min above max on an axis) is not. */
+        size_t cullBoxes(const double* planes, const double* boxes, size_t count, size_t stride, unsigned char* visible);
+    }
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_SIMD_END
+    #include "gmInline.h"
+#endif
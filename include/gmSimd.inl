@@ -0,0 +1,3281 @@
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <new>
+
+#ifdef GMATH_SIMD_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define GMATH_TARGET(isa)
+    #elif defined(__clang__)
+        #define GMATH_TARGET(isa) __attribute__((target(isa)))
+    #else
+        // AVX-512 implies FMA and gcc would fuse the multiply-add pairs, changing the rounding
+        #define GMATH_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+    #endif
+#endif
+
+namespace gmath
+{
+namespace simd
+{
+namespace kernels
+{
+    /*------ Scalar ------*/
+
+    template <typename real>
+    GMATH_INLINE void multiplyScalar(const real* a, const real* b, real* out)
+    {
+        real r[16];
+        for (int i=0; i<16; i+=4)
+        {
+            r[i  ] = a[i]*b[0] + a[i+1]*b[4] + a[i+2]*b[8]  + a[i+3]*b[12];
+            r[i+1] = a[i]*b[1] + a[i+1]*b[5] + a[i+2]*b[9]  + a[i+3]*b[13];
+            r[i+2] = a[i]*b[2] + a[i+1]*b[6] + a[i+2]*b[10] + a[i+3]*b[14];
+            r[i+3] = a[i]*b[3] + a[i+1]*b[7] + a[i+2]*b[11] + a[i+3]*b[15];
+        }
+        memcpy(out, r, 16*sizeof(real));
+    }
+
+    template <typename real>
+    GMATH_INLINE real inverseScalar(const real* m, real* out)
+    {
+        real a0 = m[ 0]*m[ 5] - m[ 1]*m[ 4];
+        real a1 = m[ 0]*m[ 6] - m[ 2]*m[ 4];
+        real a2 = m[ 0]*m[ 7] - m[ 3]*m[ 4];
+        real a3 = m[ 1]*m[ 6] - m[ 2]*m[ 5];
+        real a4 = m[ 1]*m[ 7] - m[ 3]*m[ 5];
+        real a5 = m[ 2]*m[ 7] - m[ 3]*m[ 6];
+        real b0 = m[ 8]*m[13] - m[ 9]*m[12];
+        real b1 = m[ 8]*m[14] - m[10]*m[12];
+        real b2 = m[ 8]*m[15] - m[11]*m[12];
+        real b3 = m[ 9]*m[14] - m[10]*m[13];
+        real b4 = m[ 9]*m[15] - m[11]*m[13];
+        real b5 = m[10]*m[15] - m[11]*m[14];
+        real det = a0*b5 - a1*b4 + a2*b3 + a3*b2 - a4*b1 + a5*b0;
+
+        if (fabs(det) > gmath::EPSILON)
+        {
+            real r[16];
+            r[ 0] = + m[ 5]*b5 - m[ 6]*b4 + m[ 7]*b3;
+            r[ 4] = - m[ 4]*b5 + m[ 6]*b2 - m[ 7]*b1;
+            r[ 8] = + m[ 4]*b4 - m[ 5]*b2 + m[ 7]*b0;
+            r[12] = - m[ 4]*b3 + m[ 5]*b1 - m[ 6]*b0;
+            r[ 1] = - m[ 1]*b5 + m[ 2]*b4 - m[ 3]*b3;
+            r[ 5] = + m[ 0]*b5 - m[ 2]*b2 + m[ 3]*b1;
+            r[ 9] = - m[ 0]*b4 + m[ 1]*b2 - m[ 3]*b0;
+            r[13] = + m[ 0]*b3 - m[ 1]*b1 + m[ 2]*b0;
+            r[ 2] = + m[13]*a5 - m[14]*a4 + m[15]*a3;
+            r[ 6] = - m[12]*a5 + m[14]*a2 - m[15]*a1;
+            r[10] = + m[12]*a4 - m[13]*a2 + m[15]*a0;
+            r[14] = - m[12]*a3 + m[13]*a1 - m[14]*a0;
+            r[ 3] = - m[ 9]*a5 + m[10]*a4 - m[11]*a3;
+            r[ 7] = + m[ 8]*a5 - m[10]*a2 + m[11]*a1;
+            r[11] = - m[ 8]*a4 + m[ 9]*a2 - m[11]*a0;
+            r[15] = + m[ 8]*a3 - m[ 9]*a1 + m[10]*a0;
+
+            real invDet = (1)/det;
+            for (int i=0; i<16; i++)
+                out[i] = r[i] * invDet;
+        }
+        else
+        {
+            memset(out, 0, 16*sizeof(real));
+        }
+        return det;
+    }
+
+    template <typename real>
+    GMATH_INLINE void transposeScalar(const real* m, real* out)
+    {
+        real r[16] = {
+            m[0], m[4], m[ 8], m[12],
+            m[1], m[5], m[ 9], m[13],
+            m[2], m[6], m[10], m[14],
+            m[3], m[7], m[11], m[15] };
+        memcpy(out, r, 16*sizeof(real));
+    }
+
+    GMATH_INLINE void transformPointsScalar(const double* m, const double* in, double* out, size_t count, size_t stride)
+    {
+        for (size_t i=0; i<count; i++, in+=stride, out+=stride)
+        {
+            double x = in[0], y = in[1], z = in[2];
+            out[0] = m[0]*x + m[4]*y + m[8]*z  + m[12];
+            out[1] = m[1]*x + m[5]*y + m[9]*z  + m[13];
+            out[2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+        }
+    }
+
+    GMATH_INLINE void transformPointsScalar(const double* m, const double* inX, const double* inY, const double* inZ,
+                                            double* outX, double* outY, double* outZ, size_t count)
+    {
+        for (size_t i=0; i<count; i++)
+        {
+            double x = inX[i], y = inY[i], z = inZ[i];
+            outX[i] = m[0]*x + m[4]*y + m[8]*z  + m[12];
+            outY[i] = m[1]*x + m[5]*y + m[9]*z  + m[13];
+            outZ[i] = m[2]*x + m[6]*y + m[10]*z + m[14];
+        }
+    }
+
+    /*------ Scalar, structure of arrays ------*/
+
+    GMATH_INLINE void normalizeVectorsScalar(const Vector3Soa& v, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            double len = sqrt(v.x[i]*v.x[i] + v.y[i]*v.y[i] + v.z[i]*v.z[i]);
+            double nlen = len < gmath::EPSILON ? 1.0 : 1.0/len;
+            v.x[i] *= nlen;
+            v.y[i] *= nlen;
+            v.z[i] *= nlen;
+        }
+    }
+
+    GMATH_INLINE void dotVectorsScalar(const Vector3Soa& a, const Vector3Soa& b, double* out, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+            out[i] = a.x[i]*b.x[i] + a.y[i]*b.y[i] + a.z[i]*b.z[i];
+    }
+
+    GMATH_INLINE void crossVectorsScalar(const Vector3Soa& a, const Vector3Soa& b, const Vector3Soa& out, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            double x = a.y[i]*b.z[i] - a.z[i]*b.y[i];
+            double y = a.z[i]*b.x[i] - a.x[i]*b.z[i];
+            double z = a.x[i]*b.y[i] - a.y[i]*b.x[i];
+            out.x[i] = x;
+            out.y[i] = y;
+            out.z[i] = z;
+        }
+    }
+
+    GMATH_INLINE void normalizeQuaternionsScalar(const QuaternionSoa& q, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            double len = sqrt(q.w[i]*q.w[i] + q.x[i]*q.x[i] + q.y[i]*q.y[i] + q.z[i]*q.z[i]);
+            if (len > gmath::EPSILON)
+            {
+                double invLength = (1)/len;
+                q.w[i] *= invLength;
+                q.x[i] *= invLength;
+                q.y[i] *= invLength;
+                q.z[i] *= invLength;
+            }
+            else
+            {
+                q.w[i] = 0;
+                q.x[i] = 0;
+                q.y[i] = 0;
+                q.z[i] = 0;
+            }
+        }
+    }
+
+    GMATH_INLINE void dotQuaternionsScalar(const QuaternionSoa& a, const QuaternionSoa& b, double* out, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+            out[i] = a.x[i]*b.x[i] + a.y[i]*b.y[i] + a.z[i]*b.z[i] + a.w[i]*b.w[i];
+    }
+
+    // Quaternion::operator *, written for one element so that rotate can reuse it
+    GMATH_INLINE void multiplyQuaternion(double ax, double ay, double az, double aw,
+                                         double bx, double by, double bz, double bw,
+                                         double& ox, double& oy, double& oz, double& ow)
+    {
+        ox = ((by*az - bz*ay) + bx*aw) + ax*bw;
+        oy = ((bz*ax - bx*az) + by*aw) + ay*bw;
+        oz = ((bx*ay - by*ax) + bz*aw) + az*bw;
+        ow = aw*bw - (bx*ax + by*ay + bz*az);
+    }
+
+    GMATH_INLINE void multiplyQuaternionsScalar(const QuaternionSoa& a, const QuaternionSoa& b, const QuaternionSoa& out,
+                                                size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            multiplyQuaternion(a.x[i], a.y[i], a.z[i], a.w[i], b.x[i], b.y[i], b.z[i], b.w[i],
+                               out.x[i], out.y[i], out.z[i], out.w[i]);
+        }
+    }
+
+    GMATH_INLINE void rotateVectorsScalar(const QuaternionSoa& q, const Vector3Soa& v, const Vector3Soa& out,
+                                          size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            // t = 2 * cross(q.xyz, v), out = v + q.w * t + cross(q.xyz, t), see Quaternion::rotateVector
+            double qx = q.x[i], qy = q.y[i], qz = q.z[i], qw = q.w[i];
+            double vx = v.x[i], vy = v.y[i], vz = v.z[i];
+            double tx = qy*vz - qz*vy;
+            double ty = qz*vx - qx*vz;
+            double tz = qx*vy - qy*vx;
+            tx += tx;
+            ty += ty;
+            tz += tz;
+            out.x[i] = (vx + qw*tx) + (qy*tz - qz*ty);
+            out.y[i] = (vy + qw*ty) + (qz*tx - qx*tz);
+            out.z[i] = (vz + qw*tz) + (qx*ty - qy*tx);
+        }
+    }
+
+    /*------ Scalar, skinning ------*/
+
+    // Vector3::normalizeInPlace
+    GMATH_INLINE void storeNormal(double x, double y, double z, double* out)
+    {
+        double len = sqrt(x*x + y*y + z*z);
+        double nlen = len < gmath::EPSILON ? 1.0 : 1.0/len;
+        out[0] = x*nlen;
+        out[1] = y*nlen;
+        out[2] = z*nlen;
+    }
+
+    // A vertex without influence keeps its position and its normal.
+    GMATH_INLINE void copyVertex(const double* inPoints, double* outPoints, const double* inNormals, double* outNormals, size_t v)
+    {
+        for (int c=0; c<3; c++)
+            outPoints[v*3+c] = inPoints[v*3+c];
+        if (inNormals)
+        {
+            for (int c=0; c<3; c++)
+                outNormals[v*3+c] = inNormals[v*3+c];
+        }
+    }
+
+    // The cross product of the rows a and b of a matrix, in the same order as the AVX2 version.
+    GMATH_INLINE void crossRows(const double* a, const double* b, double* out)
+    {
+        out[0] = a[1]*b[2] - a[2]*b[1];
+        out[1] = a[2]*b[0] - a[0]*b[2];
+        out[2] = a[0]*b[1] - a[1]*b[0];
+    }
+
+    GMATH_INLINE void skinVerticesScalar(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                         const double* inNormals, double* outNormals, size_t begin, size_t end)
+    {
+        for (size_t v=begin; v<end; v++)
+        {
+            size_t first = skin.offsets[v], last = skin.offsets[v+1];
+            if (first == last)
+            {
+                copyVertex(inPoints, outPoints, inNormals, outNormals, v);
+                continue;
+            }
+
+            // the weighted sum of the matrices of the influences
+            double m[16];
+            const double* joint = skin.palette + size_t(skin.joints[first])*16;
+            double w = skin.weights[first];
+            for (int k=0; k<16; k++)
+                m[k] = w*joint[k];
+            for (size_t i=first+1; i<last; i++)
+            {
+                joint = skin.palette + size_t(skin.joints[i])*16;
+                w = skin.weights[i];
+                for (int k=0; k<16; k++)
+                    m[k] = m[k] + w*joint[k];
+            }
+
+            double x = inPoints[v*3], y = inPoints[v*3+1], z = inPoints[v*3+2];
+            for (int c=0; c<3; c++)
+                outPoints[v*3+c] = ((x*m[c] + y*m[4+c]) + z*m[8+c]) + m[12+c];
+
+            if (inNormals)
+            {
+                // the cofactors of the 3x3 part, its inverse transpose times the determinant as skinDualQuaternionVertex:
+                // the rows are the cross products of the rows
+                double c[12];
+                crossRows(m+4, m+8, c);
+                crossRows(m+8, m, c+4);
+                crossRows(m, m+4, c+8);
+                double nx = inNormals[v*3], ny = inNormals[v*3+1], nz = inNormals[v*3+2];
+                storeNormal((nx*c[0] + ny*c[4]) + nz*c[8],
+                            (nx*c[1] + ny*c[5]) + nz*c[9],
+                            (nx*c[2] + ny*c[6]) + nz*c[10], outNormals + v*3);
+            }
+        }
+    }
+
+    // Quaternion::rotateVector
+    GMATH_INLINE void rotateByQuaternion(const double* q, const double* vec, double* out)
+    {
+        double tx = q[1]*vec[2] - q[2]*vec[1];
+        double ty = q[2]*vec[0] - q[0]*vec[2];
+        double tz = q[0]*vec[1] - q[1]*vec[0];
+        tx += tx;
+        ty += ty;
+        tz += tz;
+        out[0] = (vec[0] + q[3]*tx) + (q[1]*tz - q[2]*ty);
+        out[1] = (vec[1] + q[3]*ty) + (q[2]*tx - q[0]*tz);
+        out[2] = (vec[2] + q[3]*tz) + (q[0]*ty - q[1]*tx);
+    }
+
+    // Move the vertex v by the blend of a dual quaternion skinning palette: qr, qd (not normalized yet) and the scale.
+    GMATH_INLINE void skinDualQuaternionVertex(const double* blend, const double* inPoints, double* outPoints,
+                                               const double* inNormals, double* outNormals, size_t v)
+    {
+        const double* qr = blend;
+        const double* qd = blend + 4;
+        const double* sc = blend + 8;
+
+        double len = sqrt(((qr[0]*qr[0] + qr[1]*qr[1]) + qr[2]*qr[2]) + qr[3]*qr[3]);
+        if (len <= gmath::EPSILON)
+        {
+            copyVertex(inPoints, outPoints, inNormals, outNormals, v);
+            return;
+        }
+        double invLength = 1.0/len;
+        double r[4] = { qr[0]*invLength, qr[1]*invLength, qr[2]*invLength, qr[3]*invLength };
+        double d[4] = { qd[0]*invLength, qd[1]*invLength, qd[2]*invLength, qd[3]*invLength };
+
+        // DualQuaternion::getTranslation
+        double tx = 2.0 * ((r[3]*d[0] - d[3]*r[0]) + (r[1]*d[2] - r[2]*d[1]));
+        double ty = 2.0 * ((r[3]*d[1] - d[3]*r[1]) + (r[2]*d[0] - r[0]*d[2]));
+        double tz = 2.0 * ((r[3]*d[2] - d[3]*r[2]) + (r[0]*d[1] - r[1]*d[0]));
+
+        double scaled[3] = { inPoints[v*3]*sc[0], inPoints[v*3+1]*sc[1], inPoints[v*3+2]*sc[2] };
+        double rotated[3];
+        rotateByQuaternion(r, scaled, rotated);
+        outPoints[v*3] = rotated[0] + tx;
+        outPoints[v*3+1] = rotated[1] + ty;
+        outPoints[v*3+2] = rotated[2] + tz;
+
+        if (inNormals)
+        {
+            // the inverse transpose of the scale, up to a factor the normalization removes
+            double cofactors[3] = { inNormals[v*3]*(sc[1]*sc[2]), inNormals[v*3+1]*(sc[0]*sc[2]), inNormals[v*3+2]*(sc[0]*sc[1]) };
+            rotateByQuaternion(r, cofactors, rotated);
+            storeNormal(rotated[0], rotated[1], rotated[2], outNormals + v*3);
+        }
+    }
+
+    GMATH_INLINE void skinVerticesDualQuaternionScalar(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                                       const double* inNormals, double* outNormals, size_t begin, size_t end)
+    {
+        for (size_t v=begin; v<end; v++)
+        {
+            size_t first = skin.offsets[v], last = skin.offsets[v+1];
+            if (first == last)
+            {
+                copyVertex(inPoints, outPoints, inNormals, outNormals, v);
+                continue;
+            }
+
+            double blend[12];
+            const double* pivot = skin.palette + size_t(skin.joints[first])*12;
+            double w = skin.weights[first];
+            for (int k=0; k<12; k++)
+                blend[k] = w*pivot[k];
+            for (size_t i=first+1; i<last; i++)
+            {
+                const double* joint = skin.palette + size_t(skin.joints[i])*12;
+                w = skin.weights[i];
+                // the dual quaternions in the hemisphere of the first one, the scales as they are
+                // (the dot product is summed in pairs like the AVX2 version)
+                double dot = (pivot[0]*joint[0] + pivot[1]*joint[1]) + (pivot[2]*joint[2] + pivot[3]*joint[3]);
+                double signedWeight = dot < 0.0 ? -w : w;
+                for (int k=0; k<8; k++)
+                    blend[k] = blend[k] + signedWeight*joint[k];
+                for (int k=8; k<12; k++)
+                    blend[k] = blend[k] + w*joint[k];
+            }
+            skinDualQuaternionVertex(blend, inPoints, outPoints, inNormals, outNormals, v);
+        }
+    }
+
+    /*------ Scalar, decomposition ------*/
+
+    const int POLAR_ITERATIONS = 32;
+    const double POLAR_TOLERANCE = 1.0e-10;
+
+    // Matrix3::orthogonalInPlace on the rows x, y, z with the same operations, the lengths of the rows
+    // and their dot products (xy, xz, yz) on the way are kept for the decomposition.
+    GMATH_INLINE void gramSchmidtScalar(double* x, double* y, double* z, double* lengths, double* dots)
+    {
+        lengths[0] = sqrt(x[0]*x[0] + x[1]*x[1] + x[2]*x[2]);
+        double invLength = 1.0/lengths[0];
+        for (int c=0; c<3; c++)
+            x[c] *= invLength;
+
+        dots[0] = x[0]*y[0] + x[1]*y[1] + x[2]*y[2];
+        for (int c=0; c<3; c++)
+            y[c] -= dots[0]*x[c];
+        lengths[1] = sqrt(y[0]*y[0] + y[1]*y[1] + y[2]*y[2]);
+        invLength = 1.0/lengths[1];
+        for (int c=0; c<3; c++)
+            y[c] *= invLength;
+
+        dots[2] = y[0]*z[0] + y[1]*z[1] + y[2]*z[2];
+        dots[1] = x[0]*z[0] + x[1]*z[1] + x[2]*z[2];
+        for (int c=0; c<3; c++)
+            z[c] -= dots[1]*x[c] + dots[2]*y[c];
+        lengths[2] = sqrt(z[0]*z[0] + z[1]*z[1] + z[2]*z[2]);
+        invLength = 1.0/lengths[2];
+        for (int c=0; c<3; c++)
+            z[c] *= invLength;
+    }
+
+    // Quaternion::fromMatrix3 on orthonormal rows: the same choice of the largest component, written so the
+    // AVX2 version can select it instead of branching.
+    GMATH_INLINE void quaternionFromRowsScalar(const double* x, const double* y, const double* z, double* q)
+    {
+        double trace = x[0] + y[1] + z[2];
+        int largest = 3;
+        if (!(trace > 0.0))
+        {
+            largest = 0;
+            if (y[1] > x[0])
+                largest = 1;
+            if (z[2] > (largest == 1 ? y[1] : x[0]))
+                largest = 2;
+        }
+
+        double radicand;
+        if (largest == 3)
+            radicand = trace + 1.0;
+        else if (largest == 0)
+            radicand = ((x[0] - y[1]) - z[2]) + 1.0;
+        else if (largest == 1)
+            radicand = ((y[1] - z[2]) - x[0]) + 1.0;
+        else
+            radicand = ((z[2] - x[0]) - y[1]) + 1.0;
+        double root = sqrt(radicand);
+        double half = 0.5*root;
+        double s = 0.5/root;
+
+        double a = (y[2] - z[1])*s, b = (z[0] - x[2])*s, c = (x[1] - y[0])*s;
+        double d = (x[1] + y[0])*s, e = (x[2] + z[0])*s, f = (y[2] + z[1])*s;
+        switch (largest)
+        {
+        case 3: q[0] = a;    q[1] = b;    q[2] = c;    q[3] = half; break;
+        case 0: q[0] = half; q[1] = d;    q[2] = e;    q[3] = a;    break;
+        case 1: q[0] = d;    q[1] = half; q[2] = f;    q[3] = b;    break;
+        default: q[0] = e;   q[1] = f;    q[2] = half; q[3] = c;    break;
+        }
+    }
+
+    GMATH_INLINE void loadRowsScalar(const Matrix3Soa& m, size_t i, double* x, double* y, double* z)
+    {
+        x[0] = m.x.x[i]; x[1] = m.x.y[i]; x[2] = m.x.z[i];
+        y[0] = m.y.x[i]; y[1] = m.y.y[i]; y[2] = m.y.z[i];
+        z[0] = m.z.x[i]; z[1] = m.z.y[i]; z[2] = m.z.z[i];
+    }
+
+    GMATH_INLINE void storeRowsScalar(const double* x, const double* y, const double* z, const Matrix3Soa& m, size_t i)
+    {
+        m.x.x[i] = x[0]; m.x.y[i] = x[1]; m.x.z[i] = x[2];
+        m.y.x[i] = y[0]; m.y.y[i] = y[1]; m.y.z[i] = y[2];
+        m.z.x[i] = z[0]; m.z.y[i] = z[1]; m.z.z[i] = z[2];
+    }
+
+    GMATH_INLINE void decomposeAffineScalar(const Matrix3Soa& m, const QuaternionSoa& ori, const Vector3Soa& sc,
+                                            const Vector3Soa& shear, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            double x[3], y[3], z[3], lengths[3], dots[3], q[4];
+            loadRowsScalar(m, i, x, y, z);
+            gramSchmidtScalar(x, y, z, lengths, dots);
+            shear.x[i] = dots[0] / lengths[1];
+            shear.y[i] = dots[1] / lengths[2];
+            shear.z[i] = dots[2] / lengths[2];
+
+            // a mirroring matrix: the rotation and the three scales are negated, the shears stay
+            double det = (x[0]*(y[1]*z[2] - y[2]*z[1]) + x[1]*(y[2]*z[0] - y[0]*z[2])) + x[2]*(y[0]*z[1] - y[1]*z[0]);
+            double sign = det < 0.0 ? -1.0 : 1.0;
+            for (int c=0; c<3; c++)
+            {
+                x[c] *= sign;
+                y[c] *= sign;
+                z[c] *= sign;
+            }
+            sc.x[i] = lengths[0]*sign;
+            sc.y[i] = lengths[1]*sign;
+            sc.z[i] = lengths[2]*sign;
+
+            storeRowsScalar(x, y, z, m, i);
+            quaternionFromRowsScalar(x, y, z, q);
+            ori.x[i] = q[0];
+            ori.y[i] = q[1];
+            ori.z[i] = q[2];
+            ori.w[i] = q[3];
+        }
+    }
+
+    GMATH_INLINE void gramSchmidtScalar(const Matrix3Soa& m, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            double x[3], y[3], z[3], lengths[3], dots[3];
+            loadRowsScalar(m, i, x, y, z);
+            gramSchmidtScalar(x, y, z, lengths, dots);
+            storeRowsScalar(x, y, z, m, i);
+        }
+    }
+
+    // One Newton step of the polar decomposition, rows = 0.5 * (rows + inverse transpose), returns the largest change.
+    GMATH_INLINE double polarStepScalar(double* x, double* y, double* z)
+    {
+        // the inverse transpose is the matrix of the cofactors over the determinant
+        double cx[3] = { y[1]*z[2] - y[2]*z[1], y[2]*z[0] - y[0]*z[2], y[0]*z[1] - y[1]*z[0] };
+        double cy[3] = { z[1]*x[2] - z[2]*x[1], z[2]*x[0] - z[0]*x[2], z[0]*x[1] - z[1]*x[0] };
+        double cz[3] = { x[1]*y[2] - x[2]*y[1], x[2]*y[0] - x[0]*y[2], x[0]*y[1] - x[1]*y[0] };
+        double invDet = 1.0 / ((x[0]*cx[0] + x[1]*cx[1]) + x[2]*cx[2]);
+
+        double change = 0.0;
+        double* rows[3] = { x, y, z };
+        const double* cofactors[3] = { cx, cy, cz };
+        for (int r=0; r<3; r++)
+        {
+            for (int c=0; c<3; c++)
+            {
+                double value = 0.5*(rows[r][c] + cofactors[r][c]*invDet);
+                double delta = fabs(value - rows[r][c]);
+                change = change > delta ? change : delta;
+                rows[r][c] = value;
+            }
+        }
+        return change;
+    }
+
+    GMATH_INLINE void polarScalar(const Matrix3Soa& m, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+        {
+            double x[3], y[3], z[3];
+            loadRowsScalar(m, i, x, y, z);
+            for (int k=0; k<POLAR_ITERATIONS; k++)
+            {
+                if (!(polarStepScalar(x, y, z) > POLAR_TOLERANCE))
+                    break;
+            }
+            storeRowsScalar(x, y, z, m, i);
+        }
+    }
+
+    /*------ Scalar, intersections ------*/
+
+    // the values of gmath::IntersectionType
+    const unsigned char INTERSECTION_HIT = 1;
+    const unsigned char INTERSECTION_MISS = 2;
+    const unsigned char INTERSECTION_PARALLEL = 3;
+    const unsigned char INTERSECTION_ON_PLANE = 4;
+
+    // intersectLinePlane with the same operations, RAY takes a direction instead of the second point.
+    template <bool RAY>
+    GMATH_INLINE size_t intersectPlanesScalar(const double* p0, const double* p1, const double* normals, const double* points,
+                                              size_t planeStride, double* out, unsigned char* types,
+                                              size_t begin, size_t end, bool infiniteLine)
+    {
+        size_t hits = 0;
+        for (size_t i=begin; i<end; i++)
+        {
+            const double* a = p0 + 3*i;
+            const double* b = p1 + 3*i;
+            const double* n = normals + planeStride*i;
+            const double* p = points + planeStride*i;
+            double line[3];
+            for (int c=0; c<3; c++)
+                line[c] = RAY ? b[c] : b[c] - a[c];
+
+            double dotA = (line[0]*n[0] + line[1]*n[1]) + line[2]*n[2];
+            double dotB = ((p[0] - a[0])*n[0] + (p[1] - a[1])*n[1]) + (p[2] - a[2])*n[2];
+            double x = dotB*(1.0/dotA);
+
+            bool parallel = fabs(dotA) <= DBL_MIN;
+            bool outside = RAY ? x < 0.0 : (x < 0.0 || x > 1.0) && !infiniteLine;
+            if (parallel)
+                types[i] = fabs(dotB) <= DBL_MIN ? INTERSECTION_ON_PLANE : INTERSECTION_PARALLEL;
+            else if (outside)
+                types[i] = INTERSECTION_MISS;
+            else
+            {
+                types[i] = INTERSECTION_HIT;
+                for (int c=0; c<3; c++)
+                    out[3*i+c] = RAY ? a[c] + b[c]*x : b[c]*x + a[c]*(1.0 - x);
+                hits++;
+            }
+        }
+        return hits;
+    }
+
+    /*------ Scalar, bounds ------*/
+
+    GMATH_INLINE void boundPointsScalar(const double* m, const double* in, size_t count, size_t stride, double* min, double* max)
+    {
+        double lo[3] = { min[0], min[1], min[2] }, hi[3] = { max[0], max[1], max[2] };
+        for (size_t i=0; i<count; i++, in+=stride)
+        {
+            double p[3] = { in[0], in[1], in[2] };
+            if (m)
+            {
+                double x = p[0], y = p[1], z = p[2];
+                p[0] = m[0]*x + m[4]*y + m[8]*z  + m[12];
+                p[1] = m[1]*x + m[5]*y + m[9]*z  + m[13];
+                p[2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+            }
+            for (int c=0; c<3; c++)
+            {
+                lo[c] = p[c] < lo[c] ? p[c] : lo[c];
+                hi[c] = p[c] > hi[c] ? p[c] : hi[c];
+            }
+        }
+        for (int c=0; c<3; c++)
+        {
+            min[c] = lo[c];
+            max[c] = hi[c];
+        }
+    }
+
+    GMATH_INLINE size_t momentsPointsScalar(const double* in, size_t count, size_t stride, const double* shift, double* sums)
+    {
+        double s[12];
+        memcpy(s, sums, 12*sizeof(double));
+        size_t added = 0;
+        for (size_t i=0; i<count; i++, in+=stride)
+        {
+            // x - x is 0 for a finite x, NaN for an infinite or NaN one
+            if (!(in[0] - in[0] == 0.0 && in[1] - in[1] == 0.0 && in[2] - in[2] == 0.0))
+                continue;
+            added++;
+            double d[3] = { in[0] - shift[0], in[1] - shift[1], in[2] - shift[2] };
+            for (int c=0; c<3; c++)
+            {
+                s[c] += d[c];
+                s[3+c] += d[c]*d[0];
+                s[6+c] += d[c]*d[1];
+                s[9+c] += d[c]*d[2];
+            }
+        }
+        memcpy(sums, s, 12*sizeof(double));
+        return added;
+    }
+
+    /*------ Scalar, culling ------*/
+
+    // bit i of the visibility mask, the first bit of a byte clears it
+    GMATH_INLINE void setVisibleBit(unsigned char* visible, size_t i, bool in)
+    {
+        if (i % 8 == 0)
+            visible[i/8] = 0;
+        visible[i/8] |= (unsigned char)((in ? 1 : 0) << (i % 8));
+    }
+
+    GMATH_INLINE size_t cullSpheresScalar(const double* planes, const double* centers, const double* radii, size_t count, unsigned char* visible)
+    {
+        size_t inside = 0;
+        for (size_t i=0; i<count; i++)
+        {
+            const double* c = centers + 3*i;
+            // without a branch per plane, the objects are in and out at random
+            bool in = true;
+            for (int k=0; k<6; k++)
+            {
+                const double* p = planes + 4*k;
+                in &= p[0]*c[0] + p[1]*c[1] + p[2]*c[2] + p[3] >= -radii[i];
+            }
+            setVisibleBit(visible, i, in);
+            inside += in ? 1 : 0;
+        }
+        return inside;
+    }
+
+    GMATH_INLINE size_t cullBoxesScalar(const double* planes, const double* boxes, size_t count, size_t stride, unsigned char* visible)
+    {
+        size_t inside = 0;
+        for (size_t i=0; i<count; i++)
+        {
+            const double* b = boxes + i*stride;
+            bool in = b[0] <= b[3] && b[1] <= b[4] && b[2] <= b[5];
+            for (int k=0; k<6; k++)
+            {
+                // the largest of the products with min and max on each axis: the furthest corner along the normal
+                const double* p = planes + 4*k;
+                double corner[3];
+                for (int c=0; c<3; c++)
+                {
+                    double low = p[c]*b[c], high = p[c]*b[3+c];
+                    corner[c] = low > high ? low : high;
+                }
+                in &= corner[0] + corner[1] + corner[2] + p[3] >= 0.0;
+            }
+            setVisibleBit(visible, i, in);
+            inside += in ? 1 : 0;
+        }
+        return inside;
+    }
+
+    /*------ Scalar, math functions ------*/
+    // Polynomial approximations from fdlibm (sin, cos) and Cephes (atan, asin), written so that the SIMD
+    // versions can repeat exactly the same operations: every value gets the same result on every instruction set.
+
+    namespace math
+    {
+        // beyond it the reduction by pi/2 below loses precision, libm is used instead
+        const double SINCOS_LIMIT = 1.0e6;
+        const double TWO_OVER_PI = 6.36619772367581382433e-01;
+        // pi/2 in three parts, the first two have 33 bits so n * part is exact for n < 2^20
+        const double PIO2_1 = 1.57079632673412561417e+00;
+        const double PIO2_2 = 6.07710050630396597660e-11;
+        const double PIO2_3 = 2.02226624879595063154e-21;
+
+        const double S1 = -1.66666666666666324348e-01;
+        const double S2 = 8.33333333332248946124e-03;
+        const double S3 = -1.98412698298579493134e-04;
+        const double S4 = 2.75573137070700676789e-06;
+        const double S5 = -2.50507602534068634195e-08;
+        const double S6 = 1.58969099521155010221e-10;
+
+        const double C1 = 4.16666666666666019037e-02;
+        const double C2 = -1.38888888888741095749e-03;
+        const double C3 = 2.48015872894767294178e-05;
+        const double C4 = -2.75573143513906633035e-07;
+        const double C5 = 2.08757232129817482790e-09;
+        const double C6 = -1.13596475577881948265e-11;
+
+        const double PI = 3.14159265358979323846e+00;
+        const double PIO2 = 1.57079632679489661923e+00;
+        const double PIO4 = 7.85398163397448309616e-01;
+        const double MOREBITS = 6.123233995736765886130e-17;    // pi/2 - PIO2
+
+        // atan(t) = t + t * z * P(z) / Q(z), z = t*t, for |t| <= 0.66
+        const double AT_P0 = -8.750608600031904122785e-01;
+        const double AT_P1 = -1.615753718733365076637e+01;
+        const double AT_P2 = -7.500855792314704667340e+01;
+        const double AT_P3 = -1.228866684490136173410e+02;
+        const double AT_P4 = -6.485021904942025371773e+01;
+        const double AT_Q0 = 2.485846490142306297962e+01;
+        const double AT_Q1 = 1.650270098316988542046e+02;
+        const double AT_Q2 = 4.328810604912902668951e+02;
+        const double AT_Q3 = 4.853903996359136964868e+02;
+        const double AT_Q4 = 1.945506571482613964425e+02;
+
+        // asin(a) for a > 0.625, from 1-a
+        const double AS_R0 = 2.967721961301243206100e-03;
+        const double AS_R1 = -5.634242780008963776856e-01;
+        const double AS_R2 = 6.968710824104713396794e+00;
+        const double AS_R3 = -2.556901049652824852289e+01;
+        const double AS_R4 = 2.853665548261061424989e+01;
+        const double AS_S0 = -2.194779531642920639778e+01;
+        const double AS_S1 = 1.470656354026814941758e+02;
+        const double AS_S2 = -3.838770957603691357202e+02;
+        const double AS_S3 = 3.424398657913078477438e+02;
+        // asin(a) = a + a * z * P(z) / Q(z), z = a*a, for a <= 0.625
+        const double AS_P0 = 4.253011369004428248960e-03;
+        const double AS_P1 = -6.019598008014123785661e-01;
+        const double AS_P2 = 5.444622390564711410273e+00;
+        const double AS_P3 = -1.626247967210700244449e+01;
+        const double AS_P4 = 1.956261983317594739197e+01;
+        const double AS_P5 = -8.198089802484824371615e+00;
+        const double AS_Q0 = -1.474091372988853791896e+01;
+        const double AS_Q1 = 7.049610280856842141659e+01;
+        const double AS_Q2 = -1.471791292232726029859e+02;
+        const double AS_Q3 = 1.395105614657485689735e+02;
+        const double AS_Q4 = -4.918853881490881290097e+01;
+    }
+
+    GMATH_INLINE void sinCosScalar(const double* in, double* outSin, double* outCos, size_t begin, size_t end)
+    {
+        using namespace math;
+        for (size_t i=begin; i<end; i++)
+        {
+            double x = in[i];
+            if (!(fabs(x) <= SINCOS_LIMIT))
+            {
+                double s = sin(x);
+                outCos[i] = cos(x);
+                outSin[i] = s;
+                continue;
+            }
+
+            // x = n * pi/2 + r, |r| <= pi/4
+            double n = floor(x*TWO_OVER_PI + 0.5);
+            double r = ((x - n*PIO2_1) - n*PIO2_2) - n*PIO2_3;
+            double z = r*r;
+
+            double ps = ((((S6*z + S5)*z + S4)*z + S3)*z + S2)*z + S1;
+            double pc = ((((C6*z + C5)*z + C4)*z + C3)*z + C2)*z + C1;
+            double sinR = r + (z*r)*ps;
+            double hz = 0.5*z;
+            double w = 1.0 - hz;
+            double cosR = w + (((1.0 - w) - hz) + (z*z)*pc);
+
+            // the quadrant, n modulo 4
+            double q = n - 4.0*floor(n*0.25);
+            bool odd = q == 1.0 || q == 3.0;
+            double s = odd ? cosR : sinR;
+            double c = odd ? sinR : cosR;
+            if (q >= 2.0)
+                s = -s;
+            if (q == 1.0 || q == 2.0)
+                c = -c;
+            // sinR is +0 for x = -0, sin keeps the sign of a zero
+            outSin[i] = x == 0.0 ? x : s;
+            outCos[i] = c;
+        }
+    }
+
+    GMATH_INLINE void atan2Scalar(const double* y, const double* x, double* out, size_t begin, size_t end)
+    {
+        using namespace math;
+        for (size_t i=begin; i<end; i++)
+        {
+            double ax = fabs(x[i]);
+            double ay = fabs(y[i]);
+            if (!(ax <= DBL_MAX && ay <= DBL_MAX))
+            {
+                out[i] = atan2(y[i], x[i]);
+                continue;
+            }
+
+            // atan of the smaller over the larger, in [0, 1], the angles above 0.66 are moved around pi/4
+            bool steep = ax < ay;
+            double low = steep ? ax : ay;
+            double high = steep ? ay : ax;
+            double a = high > 0.0 ? low / high : 0.0;
+            bool far = a > 0.66;
+            double t = far ? (a - 1.0) / (a + 1.0) : a;
+
+            double z = t*t;
+            double p = (((AT_P0*z + AT_P1)*z + AT_P2)*z + AT_P3)*z + AT_P4;
+            double q = ((((z + AT_Q0)*z + AT_Q1)*z + AT_Q2)*z + AT_Q3)*z + AT_Q4;
+            double r = t*(z*p/q) + t;
+            if (far)
+                r = PIO4 + (r + 0.5*MOREBITS);
+
+            if (steep)
+                r = (PIO2 - r) + MOREBITS;
+            if (signbit(x[i]))
+                r = (PI - r) + 2.0*MOREBITS;
+            out[i] = signbit(y[i]) ? -r : r;
+        }
+    }
+
+    // asin of a value in [-1, 1]
+    GMATH_INLINE double asinUnit(double x)
+    {
+        using namespace math;
+        double a = fabs(x);
+        double r;
+        if (a > 0.625)
+        {
+            double zz = 1.0 - a;
+            double p = zz*((((AS_R0*zz + AS_R1)*zz + AS_R2)*zz + AS_R3)*zz + AS_R4) /
+                       ((((zz + AS_S0)*zz + AS_S1)*zz + AS_S2)*zz + AS_S3);
+            zz = sqrt(zz + zz);
+            double z = PIO4 - zz;
+            zz = zz*p - MOREBITS;
+            z = z - zz;
+            r = z + PIO4;
+        }
+        else
+        {
+            double zz = a*a;
+            double z = zz*(((((AS_P0*zz + AS_P1)*zz + AS_P2)*zz + AS_P3)*zz + AS_P4)*zz + AS_P5) /
+                       (((((zz + AS_Q0)*zz + AS_Q1)*zz + AS_Q2)*zz + AS_Q3)*zz + AS_Q4);
+            r = a*z + a;
+        }
+        return signbit(x) ? -r : r;
+    }
+
+    // clamp to [-1, 1] like gmath::asin and gmath::acos, NaN stays NaN
+    GMATH_INLINE double clampUnit(double x)
+    {
+        double y = 1.0 < x ? 1.0 : x;
+        return -1.0 > y ? -1.0 : y;
+    }
+
+    GMATH_INLINE void asinScalar(const double* in, double* out, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+            out[i] = asinUnit(clampUnit(in[i]));
+    }
+
+    GMATH_INLINE void acosScalar(const double* in, double* out, size_t begin, size_t end)
+    {
+        using namespace math;
+        for (size_t i=begin; i<end; i++)
+        {
+            double x = clampUnit(in[i]);
+            if (x > 0.5)
+            {
+                out[i] = 2.0*asinUnit(sqrt(0.5*(1.0 - x)));
+            }
+            else if (x < -0.5)
+            {
+                out[i] = PI - 2.0*asinUnit(sqrt(0.5*(1.0 + x)));
+            }
+            else
+            {
+                double z = PIO4 - asinUnit(x);
+                z = z + MOREBITS;
+                out[i] = z + PIO4;
+            }
+        }
+    }
+
+    GMATH_INLINE void sqrtScalar(const double* in, double* out, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+            out[i] = sqrt(in[i]);
+    }
+
+    GMATH_INLINE void rsqrtScalar(const double* in, double* out, size_t begin, size_t end)
+    {
+        for (size_t i=begin; i<end; i++)
+            out[i] = 1.0 / sqrt(in[i]);
+    }
+
+#ifdef GMATH_SIMD_X86
+
+    /*------ SSE2 ------*/
+
+    GMATH_INLINE GMATH_TARGET("sse2") void multiplySSE2(const double* a, const double* b, double* out)
+    {
+        // b is fully loaded first, so out can be b. Row i of a is read before row i of out is written.
+        __m128d b0l = _mm_loadu_pd(b),    b0h = _mm_loadu_pd(b+2);
+        __m128d b1l = _mm_loadu_pd(b+4),  b1h = _mm_loadu_pd(b+6);
+        __m128d b2l = _mm_loadu_pd(b+8),  b2h = _mm_loadu_pd(b+10);
+        __m128d b3l = _mm_loadu_pd(b+12), b3h = _mm_loadu_pd(b+14);
+
+        for (int i=0; i<16; i+=4)
+        {
+            __m128d a0 = _mm_set1_pd(a[i]);
+            __m128d a1 = _mm_set1_pd(a[i+1]);
+            __m128d a2 = _mm_set1_pd(a[i+2]);
+            __m128d a3 = _mm_set1_pd(a[i+3]);
+
+            __m128d lo = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+                _mm_mul_pd(a0, b0l), _mm_mul_pd(a1, b1l)), _mm_mul_pd(a2, b2l)), _mm_mul_pd(a3, b3l));
+            __m128d hi = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+                _mm_mul_pd(a0, b0h), _mm_mul_pd(a1, b1h)), _mm_mul_pd(a2, b2h)), _mm_mul_pd(a3, b3h));
+
+            _mm_storeu_pd(out+i, lo);
+            _mm_storeu_pd(out+i+2, hi);
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") void transposeSSE2(const double* m, double* out)
+    {
+        __m128d r0l = _mm_loadu_pd(m),    r0h = _mm_loadu_pd(m+2);
+        __m128d r1l = _mm_loadu_pd(m+4),  r1h = _mm_loadu_pd(m+6);
+        __m128d r2l = _mm_loadu_pd(m+8),  r2h = _mm_loadu_pd(m+10);
+        __m128d r3l = _mm_loadu_pd(m+12), r3h = _mm_loadu_pd(m+14);
+
+        _mm_storeu_pd(out,    _mm_unpacklo_pd(r0l, r1l));
+        _mm_storeu_pd(out+2,  _mm_unpacklo_pd(r2l, r3l));
+        _mm_storeu_pd(out+4,  _mm_unpackhi_pd(r0l, r1l));
+        _mm_storeu_pd(out+6,  _mm_unpackhi_pd(r2l, r3l));
+        _mm_storeu_pd(out+8,  _mm_unpacklo_pd(r0h, r1h));
+        _mm_storeu_pd(out+10, _mm_unpacklo_pd(r2h, r3h));
+        _mm_storeu_pd(out+12, _mm_unpackhi_pd(r0h, r1h));
+        _mm_storeu_pd(out+14, _mm_unpackhi_pd(r2h, r3h));
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") void multiplyFloatSSE2(const float* a, const float* b, float* out)
+    {
+        // a row of floats fits one register, every row of out is a combination of the rows of b
+        __m128 b0 = _mm_loadu_ps(b);
+        __m128 b1 = _mm_loadu_ps(b+4);
+        __m128 b2 = _mm_loadu_ps(b+8);
+        __m128 b3 = _mm_loadu_ps(b+12);
+
+        for (int i=0; i<16; i+=4)
+        {
+            __m128 row = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(_mm_set1_ps(a[i]), b0), _mm_mul_ps(_mm_set1_ps(a[i+1]), b1)),
+                _mm_mul_ps(_mm_set1_ps(a[i+2]), b2)), _mm_mul_ps(_mm_set1_ps(a[i+3]), b3));
+            _mm_storeu_ps(out+i, row);
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") void transposeFloatSSE2(const float* m, float* out)
+    {
+        __m128 r0 = _mm_loadu_ps(m);
+        __m128 r1 = _mm_loadu_ps(m+4);
+        __m128 r2 = _mm_loadu_ps(m+8);
+        __m128 r3 = _mm_loadu_ps(m+12);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(out, r0);
+        _mm_storeu_ps(out+4, r1);
+        _mm_storeu_ps(out+8, r2);
+        _mm_storeu_ps(out+12, r3);
+    }
+
+    /*  The inverse is the same cofactor expansion as inverseScalar.
+        Rows 0-1 and rows 2-3 share the same 2x2 determinants pattern, so each of the
+        twelve a/b terms is computed in pairs [a, b]. The cofactors of an output row are
+        sign * ((C * Y - C * Y) + C * Y) where C is a column of m with the rows in the order 1, 0, 3, 2
+        and Y = [b, b, a, a]. Negations are exact, so the result is the same as the scalar one bit for bit. */
+    struct InverseTerms
+    {
+        __m128d c0l, c1l, c2l, c3l;   // [m[4+j], m[j]]
+        __m128d c0h, c1h, c2h, c3h;   // [m[12+j], m[8+j]]
+        __m128d ab[6];                // [a, b]
+        double det;
+    };
+
+    GMATH_INLINE GMATH_TARGET("sse2") void inverseTermsSSE2(const double* m, InverseTerms& t)
+    {
+        __m128d r0l = _mm_loadu_pd(m),    r0h = _mm_loadu_pd(m+2);
+        __m128d r1l = _mm_loadu_pd(m+4),  r1h = _mm_loadu_pd(m+6);
+        __m128d r2l = _mm_loadu_pd(m+8),  r2h = _mm_loadu_pd(m+10);
+        __m128d r3l = _mm_loadu_pd(m+12), r3h = _mm_loadu_pd(m+14);
+
+        // p[i] = [m[i], m[i+8]]
+        __m128d p0 = _mm_unpacklo_pd(r0l, r2l), p1 = _mm_unpackhi_pd(r0l, r2l);
+        __m128d p2 = _mm_unpacklo_pd(r0h, r2h), p3 = _mm_unpackhi_pd(r0h, r2h);
+        __m128d p4 = _mm_unpacklo_pd(r1l, r3l), p5 = _mm_unpackhi_pd(r1l, r3l);
+        __m128d p6 = _mm_unpacklo_pd(r1h, r3h), p7 = _mm_unpackhi_pd(r1h, r3h);
+
+        t.ab[0] = _mm_sub_pd(_mm_mul_pd(p0, p5), _mm_mul_pd(p1, p4));
+        t.ab[1] = _mm_sub_pd(_mm_mul_pd(p0, p6), _mm_mul_pd(p2, p4));
+        t.ab[2] = _mm_sub_pd(_mm_mul_pd(p0, p7), _mm_mul_pd(p3, p4));
+        t.ab[3] = _mm_sub_pd(_mm_mul_pd(p1, p6), _mm_mul_pd(p2, p5));
+        t.ab[4] = _mm_sub_pd(_mm_mul_pd(p1, p7), _mm_mul_pd(p3, p5));
+        t.ab[5] = _mm_sub_pd(_mm_mul_pd(p2, p7), _mm_mul_pd(p3, p6));
+
+        double a[6], b[6];
+        for (int i=0; i<6; i++)
+        {
+            a[i] = _mm_cvtsd_f64(t.ab[i]);
+            b[i] = _mm_cvtsd_f64(_mm_unpackhi_pd(t.ab[i], t.ab[i]));
+        }
+        t.det = a[0]*b[5] - a[1]*b[4] + a[2]*b[3] + a[3]*b[2] - a[4]*b[1] + a[5]*b[0];
+
+        t.c0l = _mm_unpacklo_pd(r1l, r0l); t.c1l = _mm_unpackhi_pd(r1l, r0l);
+        t.c2l = _mm_unpacklo_pd(r1h, r0h); t.c3l = _mm_unpackhi_pd(r1h, r0h);
+        t.c0h = _mm_unpacklo_pd(r3l, r2l); t.c1h = _mm_unpackhi_pd(r3l, r2l);
+        t.c2h = _mm_unpacklo_pd(r3h, r2h); t.c3h = _mm_unpackhi_pd(r3h, r2h);
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") __m128d cofactorsSSE2(__m128d x1, __m128d y1, __m128d x2, __m128d y2,
+                                                            __m128d x3, __m128d y3, __m128d sign, __m128d scale)
+    {
+        __m128d r = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(x1, y1), _mm_mul_pd(x2, y2)), _mm_mul_pd(x3, y3));
+        return _mm_mul_pd(_mm_xor_pd(r, sign), scale);
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") double inverseSSE2(const double* m, double* out)
+    {
+        InverseTerms t;
+        inverseTermsSSE2(m, t);
+
+        if (!(fabs(t.det) > gmath::EPSILON))
+        {
+            memset(out, 0, 16*sizeof(double));
+            return t.det;
+        }
+
+        __m128d yb[6], ya[6];
+        for (int i=0; i<6; i++)
+        {
+            yb[i] = _mm_unpackhi_pd(t.ab[i], t.ab[i]);
+            ya[i] = _mm_unpacklo_pd(t.ab[i], t.ab[i]);
+        }
+
+        __m128d scale = _mm_set1_pd((1)/t.det);
+        __m128d plus = _mm_set_pd(-0.0, 0.0);    // [+, -]
+        __m128d minus = _mm_set_pd(0.0, -0.0);   // [-, +]
+
+        _mm_storeu_pd(out,    cofactorsSSE2(t.c1l, yb[5], t.c2l, yb[4], t.c3l, yb[3], plus, scale));
+        _mm_storeu_pd(out+2,  cofactorsSSE2(t.c1h, ya[5], t.c2h, ya[4], t.c3h, ya[3], plus, scale));
+        _mm_storeu_pd(out+4,  cofactorsSSE2(t.c0l, yb[5], t.c2l, yb[2], t.c3l, yb[1], minus, scale));
+        _mm_storeu_pd(out+6,  cofactorsSSE2(t.c0h, ya[5], t.c2h, ya[2], t.c3h, ya[1], minus, scale));
+        _mm_storeu_pd(out+8,  cofactorsSSE2(t.c0l, yb[4], t.c1l, yb[2], t.c3l, yb[0], plus, scale));
+        _mm_storeu_pd(out+10, cofactorsSSE2(t.c0h, ya[4], t.c1h, ya[2], t.c3h, ya[0], plus, scale));
+        _mm_storeu_pd(out+12, cofactorsSSE2(t.c0l, yb[3], t.c1l, yb[1], t.c2l, yb[0], minus, scale));
+        _mm_storeu_pd(out+14, cofactorsSSE2(t.c0h, ya[3], t.c1h, ya[1], t.c2h, ya[0], minus, scale));
+        return t.det;
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") void transformPointsSSE2(const double* m, const double* in, double* out,
+                                                               size_t count, size_t stride)
+    {
+        __m128d r0l = _mm_loadu_pd(m),    r0h = _mm_load_sd(m+2);
+        __m128d r1l = _mm_loadu_pd(m+4),  r1h = _mm_load_sd(m+6);
+        __m128d r2l = _mm_loadu_pd(m+8),  r2h = _mm_load_sd(m+10);
+        __m128d r3l = _mm_loadu_pd(m+12), r3h = _mm_load_sd(m+14);
+
+        for (size_t i=0; i<count; i++, in+=stride, out+=stride)
+        {
+            __m128d x = _mm_set1_pd(in[0]);
+            __m128d y = _mm_set1_pd(in[1]);
+            __m128d z = _mm_set1_pd(in[2]);
+
+            __m128d lo = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+                _mm_mul_pd(x, r0l), _mm_mul_pd(y, r1l)), _mm_mul_pd(z, r2l)), r3l);
+            __m128d hi = _mm_add_sd(_mm_add_sd(_mm_add_sd(
+                _mm_mul_sd(x, r0h), _mm_mul_sd(y, r1h)), _mm_mul_sd(z, r2h)), r3h);
+
+            _mm_storeu_pd(out, lo);
+            _mm_store_sd(out+2, hi);
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("sse2") void transformPointsSSE2(const double* m, const double* inX, const double* inY, const double* inZ,
+                                                               double* outX, double* outY, double* outZ, size_t count)
+    {
+        size_t i = 0;
+        for (; i+2<=count; i+=2)
+        {
+            __m128d x = _mm_loadu_pd(inX+i);
+            __m128d y = _mm_loadu_pd(inY+i);
+            __m128d z = _mm_loadu_pd(inZ+i);
+
+            for (int c=0; c<3; c++)
+            {
+                __m128d r = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+                    _mm_mul_pd(_mm_set1_pd(m[c]), x), _mm_mul_pd(_mm_set1_pd(m[4+c]), y)),
+                    _mm_mul_pd(_mm_set1_pd(m[8+c]), z)), _mm_set1_pd(m[12+c]));
+                _mm_storeu_pd((c == 0 ? outX : (c == 1 ? outY : outZ)) + i, r);
+            }
+        }
+        transformPointsScalar(m, inX+i, inY+i, inZ+i, outX+i, outY+i, outZ+i, count-i);
+    }
+
+    /*------ AVX2 ------*/
+
+    GMATH_INLINE GMATH_TARGET("avx2") void multiplyAVX2(const double* a, const double* b, double* out)
+    {
+        __m256d b0 = _mm256_loadu_pd(b);
+        __m256d b1 = _mm256_loadu_pd(b+4);
+        __m256d b2 = _mm256_loadu_pd(b+8);
+        __m256d b3 = _mm256_loadu_pd(b+12);
+
+        for (int i=0; i<16; i+=4)
+        {
+            __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_set1_pd(a[i]),   b0),
+                _mm256_mul_pd(_mm256_set1_pd(a[i+1]), b1)),
+                _mm256_mul_pd(_mm256_set1_pd(a[i+2]), b2)),
+                _mm256_mul_pd(_mm256_set1_pd(a[i+3]), b3));
+            _mm256_storeu_pd(out+i, r);
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void multiplyFloatAVX2(const float* a, const float* b, float* out)
+    {
+        // two rows of out at a time, each half of the register works on one row
+        __m256 b0 = _mm256_broadcast_ps((const __m128*)(b));
+        __m256 b1 = _mm256_broadcast_ps((const __m128*)(b+4));
+        __m256 b2 = _mm256_broadcast_ps((const __m128*)(b+8));
+        __m256 b3 = _mm256_broadcast_ps((const __m128*)(b+12));
+
+        for (int i=0; i<16; i+=8)
+        {
+            __m256 a0 = _mm256_setr_m128(_mm_set1_ps(a[i]),   _mm_set1_ps(a[i+4]));
+            __m256 a1 = _mm256_setr_m128(_mm_set1_ps(a[i+1]), _mm_set1_ps(a[i+5]));
+            __m256 a2 = _mm256_setr_m128(_mm_set1_ps(a[i+2]), _mm_set1_ps(a[i+6]));
+            __m256 a3 = _mm256_setr_m128(_mm_set1_ps(a[i+3]), _mm_set1_ps(a[i+7]));
+
+            __m256 rows = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(a0, b0), _mm256_mul_ps(a1, b1)), _mm256_mul_ps(a2, b2)), _mm256_mul_ps(a3, b3));
+            _mm256_storeu_ps(out+i, rows);
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void transposeAVX2(const double* m, double* out)
+    {
+        __m256d r0 = _mm256_loadu_pd(m);
+        __m256d r1 = _mm256_loadu_pd(m+4);
+        __m256d r2 = _mm256_loadu_pd(m+8);
+        __m256d r3 = _mm256_loadu_pd(m+12);
+
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);   // [m0, m4, m2, m6]
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);   // [m1, m5, m3, m7]
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);   // [m8, m12, m10, m14]
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);   // [m9, m13, m11, m15]
+
+        _mm256_storeu_pd(out,    _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(out+4,  _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(out+8,  _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(out+12, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d combineAVX2(__m128d lo, __m128d hi)
+    {
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") double inverseAVX2(const double* m, double* out)
+    {
+        InverseTerms t;
+        inverseTermsSSE2(m, t);
+
+        if (!(fabs(t.det) > gmath::EPSILON))
+        {
+            memset(out, 0, 16*sizeof(double));
+            return t.det;
+        }
+
+        __m256d c0 = combineAVX2(t.c0l, t.c0h);
+        __m256d c1 = combineAVX2(t.c1l, t.c1h);
+        __m256d c2 = combineAVX2(t.c2l, t.c2h);
+        __m256d c3 = combineAVX2(t.c3l, t.c3h);
+
+        __m256d y[6];
+        for (int i=0; i<6; i++)
+            y[i] = combineAVX2(_mm_unpackhi_pd(t.ab[i], t.ab[i]), _mm_unpacklo_pd(t.ab[i], t.ab[i]));
+
+        __m256d scale = _mm256_set1_pd((1)/t.det);
+        __m256d plus = _mm256_set_pd(-0.0, 0.0, -0.0, 0.0);    // [+, -, +, -]
+        __m256d minus = _mm256_set_pd(0.0, -0.0, 0.0, -0.0);   // [-, +, -, +]
+
+        #define GMATH_COFACTORS_AVX2(x1, y1, x2, y2, x3, y3, sign) \
+            _mm256_mul_pd(_mm256_xor_pd(_mm256_add_pd(_mm256_sub_pd( \
+                _mm256_mul_pd(x1, y1), _mm256_mul_pd(x2, y2)), _mm256_mul_pd(x3, y3)), sign), scale)
+
+        _mm256_storeu_pd(out,    GMATH_COFACTORS_AVX2(c1, y[5], c2, y[4], c3, y[3], plus));
+        _mm256_storeu_pd(out+4,  GMATH_COFACTORS_AVX2(c0, y[5], c2, y[2], c3, y[1], minus));
+        _mm256_storeu_pd(out+8,  GMATH_COFACTORS_AVX2(c0, y[4], c1, y[2], c3, y[0], plus));
+        _mm256_storeu_pd(out+12, GMATH_COFACTORS_AVX2(c0, y[3], c1, y[1], c2, y[0], minus));
+
+        #undef GMATH_COFACTORS_AVX2
+        return t.det;
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void transformPointsAVX2(const double* m, const double* in, double* out,
+                                                               size_t count, size_t stride)
+    {
+        __m256d r0 = _mm256_loadu_pd(m);
+        __m256d r1 = _mm256_loadu_pd(m+4);
+        __m256d r2 = _mm256_loadu_pd(m+8);
+        __m256d r3 = _mm256_loadu_pd(m+12);
+
+        for (size_t i=0; i<count; i++, in+=stride, out+=stride)
+        {
+            __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_set1_pd(in[0]), r0),
+                _mm256_mul_pd(_mm256_set1_pd(in[1]), r1)),
+                _mm256_mul_pd(_mm256_set1_pd(in[2]), r2)), r3);
+
+            // the 4th component would overwrite the next point when stride is 3
+            _mm_storeu_pd(out, _mm256_castpd256_pd128(r));
+            _mm_store_sd(out+2, _mm256_extractf128_pd(r, 1));
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void transformPointsAVX2(const double* m, const double* inX, const double* inY, const double* inZ,
+                                                               double* outX, double* outY, double* outZ, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d x = _mm256_loadu_pd(inX+i);
+            __m256d y = _mm256_loadu_pd(inY+i);
+            __m256d z = _mm256_loadu_pd(inZ+i);
+
+            for (int c=0; c<3; c++)
+            {
+                __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                    _mm256_mul_pd(_mm256_set1_pd(m[c]), x), _mm256_mul_pd(_mm256_set1_pd(m[4+c]), y)),
+                    _mm256_mul_pd(_mm256_set1_pd(m[8+c]), z)), _mm256_set1_pd(m[12+c]));
+                _mm256_storeu_pd((c == 0 ? outX : (c == 1 ? outY : outZ)) + i, r);
+            }
+        }
+        transformPointsSSE2(m, inX+i, inY+i, inZ+i, outX+i, outY+i, outZ+i, count-i);
+    }
+
+    /*------ AVX2, structure of arrays ------*/
+    // Four elements at a time, the remaining ones go through the scalar kernels.
+
+    GMATH_INLINE GMATH_TARGET("avx2") void normalizeVectorsAVX2(const Vector3Soa& v, size_t count)
+    {
+        const __m256d epsilon = _mm256_set1_pd(gmath::EPSILON);
+        const __m256d one = _mm256_set1_pd(1.0);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d x = _mm256_loadu_pd(v.x+i), y = _mm256_loadu_pd(v.y+i), z = _mm256_loadu_pd(v.z+i);
+            __m256d len = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(x, x), _mm256_mul_pd(y, y)), _mm256_mul_pd(z, z)));
+            __m256d nlen = _mm256_blendv_pd(_mm256_div_pd(one, len), one, _mm256_cmp_pd(len, epsilon, _CMP_LT_OQ));
+            _mm256_storeu_pd(v.x+i, _mm256_mul_pd(x, nlen));
+            _mm256_storeu_pd(v.y+i, _mm256_mul_pd(y, nlen));
+            _mm256_storeu_pd(v.z+i, _mm256_mul_pd(z, nlen));
+        }
+        normalizeVectorsScalar(v, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void dotVectorsAVX2(const Vector3Soa& a, const Vector3Soa& b, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d d = _mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(a.x+i), _mm256_loadu_pd(b.x+i)),
+                _mm256_mul_pd(_mm256_loadu_pd(a.y+i), _mm256_loadu_pd(b.y+i))),
+                _mm256_mul_pd(_mm256_loadu_pd(a.z+i), _mm256_loadu_pd(b.z+i)));
+            _mm256_storeu_pd(out+i, d);
+        }
+        dotVectorsScalar(a, b, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void crossVectorsAVX2(const Vector3Soa& a, const Vector3Soa& b, const Vector3Soa& out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d ax = _mm256_loadu_pd(a.x+i), ay = _mm256_loadu_pd(a.y+i), az = _mm256_loadu_pd(a.z+i);
+            __m256d bx = _mm256_loadu_pd(b.x+i), by = _mm256_loadu_pd(b.y+i), bz = _mm256_loadu_pd(b.z+i);
+            _mm256_storeu_pd(out.x+i, _mm256_sub_pd(_mm256_mul_pd(ay, bz), _mm256_mul_pd(az, by)));
+            _mm256_storeu_pd(out.y+i, _mm256_sub_pd(_mm256_mul_pd(az, bx), _mm256_mul_pd(ax, bz)));
+            _mm256_storeu_pd(out.z+i, _mm256_sub_pd(_mm256_mul_pd(ax, by), _mm256_mul_pd(ay, bx)));
+        }
+        crossVectorsScalar(a, b, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void normalizeQuaternionsAVX2(const QuaternionSoa& q, size_t count)
+    {
+        const __m256d epsilon = _mm256_set1_pd(gmath::EPSILON);
+        const __m256d one = _mm256_set1_pd(1.0);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d x = _mm256_loadu_pd(q.x+i), y = _mm256_loadu_pd(q.y+i);
+            __m256d z = _mm256_loadu_pd(q.z+i), w = _mm256_loadu_pd(q.w+i);
+            __m256d len = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(w, w), _mm256_mul_pd(x, x)), _mm256_mul_pd(y, y)), _mm256_mul_pd(z, z)));
+            __m256d invLength = _mm256_div_pd(one, len);
+            // a null quaternion becomes (0, 0, 0, 0), like Quaternion::normalizeInPlace
+            __m256d valid = _mm256_cmp_pd(len, epsilon, _CMP_GT_OQ);
+            _mm256_storeu_pd(q.x+i, _mm256_and_pd(_mm256_mul_pd(x, invLength), valid));
+            _mm256_storeu_pd(q.y+i, _mm256_and_pd(_mm256_mul_pd(y, invLength), valid));
+            _mm256_storeu_pd(q.z+i, _mm256_and_pd(_mm256_mul_pd(z, invLength), valid));
+            _mm256_storeu_pd(q.w+i, _mm256_and_pd(_mm256_mul_pd(w, invLength), valid));
+        }
+        normalizeQuaternionsScalar(q, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void dotQuaternionsAVX2(const QuaternionSoa& a, const QuaternionSoa& b, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d d = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(a.x+i), _mm256_loadu_pd(b.x+i)),
+                _mm256_mul_pd(_mm256_loadu_pd(a.y+i), _mm256_loadu_pd(b.y+i))),
+                _mm256_mul_pd(_mm256_loadu_pd(a.z+i), _mm256_loadu_pd(b.z+i))),
+                _mm256_mul_pd(_mm256_loadu_pd(a.w+i), _mm256_loadu_pd(b.w+i)));
+            _mm256_storeu_pd(out+i, d);
+        }
+        dotQuaternionsScalar(a, b, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void multiplyQuaternionAVX2(__m256d ax, __m256d ay, __m256d az, __m256d aw,
+                                                                  __m256d bx, __m256d by, __m256d bz, __m256d bw,
+                                                                  __m256d& ox, __m256d& oy, __m256d& oz, __m256d& ow)
+    {
+        ox = _mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(by, az), _mm256_mul_pd(bz, ay)),
+                                         _mm256_mul_pd(bx, aw)), _mm256_mul_pd(ax, bw));
+        oy = _mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(bz, ax), _mm256_mul_pd(bx, az)),
+                                         _mm256_mul_pd(by, aw)), _mm256_mul_pd(ay, bw));
+        oz = _mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(bx, ay), _mm256_mul_pd(by, ax)),
+                                         _mm256_mul_pd(bz, aw)), _mm256_mul_pd(az, bw));
+        ow = _mm256_sub_pd(_mm256_mul_pd(aw, bw), _mm256_add_pd(_mm256_add_pd(
+            _mm256_mul_pd(bx, ax), _mm256_mul_pd(by, ay)), _mm256_mul_pd(bz, az)));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void multiplyQuaternionsAVX2(const QuaternionSoa& a, const QuaternionSoa& b,
+                                                                   const QuaternionSoa& out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d x, y, z, w;
+            multiplyQuaternionAVX2(_mm256_loadu_pd(a.x+i), _mm256_loadu_pd(a.y+i), _mm256_loadu_pd(a.z+i), _mm256_loadu_pd(a.w+i),
+                                   _mm256_loadu_pd(b.x+i), _mm256_loadu_pd(b.y+i), _mm256_loadu_pd(b.z+i), _mm256_loadu_pd(b.w+i),
+                                   x, y, z, w);
+            _mm256_storeu_pd(out.x+i, x);
+            _mm256_storeu_pd(out.y+i, y);
+            _mm256_storeu_pd(out.z+i, z);
+            _mm256_storeu_pd(out.w+i, w);
+        }
+        multiplyQuaternionsScalar(a, b, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void rotateVectorsAVX2(const QuaternionSoa& q, const Vector3Soa& v,
+                                                             const Vector3Soa& out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d qx = _mm256_loadu_pd(q.x+i), qy = _mm256_loadu_pd(q.y+i);
+            __m256d qz = _mm256_loadu_pd(q.z+i), qw = _mm256_loadu_pd(q.w+i);
+            __m256d vx = _mm256_loadu_pd(v.x+i), vy = _mm256_loadu_pd(v.y+i), vz = _mm256_loadu_pd(v.z+i);
+
+            __m256d tx = _mm256_sub_pd(_mm256_mul_pd(qy, vz), _mm256_mul_pd(qz, vy));
+            __m256d ty = _mm256_sub_pd(_mm256_mul_pd(qz, vx), _mm256_mul_pd(qx, vz));
+            __m256d tz = _mm256_sub_pd(_mm256_mul_pd(qx, vy), _mm256_mul_pd(qy, vx));
+            tx = _mm256_add_pd(tx, tx);
+            ty = _mm256_add_pd(ty, ty);
+            tz = _mm256_add_pd(tz, tz);
+
+            _mm256_storeu_pd(out.x+i, _mm256_add_pd(_mm256_add_pd(vx, _mm256_mul_pd(qw, tx)),
+                                                    _mm256_sub_pd(_mm256_mul_pd(qy, tz), _mm256_mul_pd(qz, ty))));
+            _mm256_storeu_pd(out.y+i, _mm256_add_pd(_mm256_add_pd(vy, _mm256_mul_pd(qw, ty)),
+                                                    _mm256_sub_pd(_mm256_mul_pd(qz, tx), _mm256_mul_pd(qx, tz))));
+            _mm256_storeu_pd(out.z+i, _mm256_add_pd(_mm256_add_pd(vz, _mm256_mul_pd(qw, tz)),
+                                                    _mm256_sub_pd(_mm256_mul_pd(qx, ty), _mm256_mul_pd(qy, tx))));
+        }
+        rotateVectorsScalar(q, v, out, i, count);
+    }
+
+    /*------ AVX2, skinning ------*/
+
+    // crossRows on the x, y, z lanes of a and b, the w lane is not used.
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d crossRowsAVX2(__m256d a, __m256d b)
+    {
+        __m256d ayzx = _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 0, 2, 1));
+        __m256d azxy = _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 1, 0, 2));
+        __m256d byzx = _mm256_permute4x64_pd(b, _MM_SHUFFLE(3, 0, 2, 1));
+        __m256d bzxy = _mm256_permute4x64_pd(b, _MM_SHUFFLE(3, 1, 0, 2));
+        return _mm256_sub_pd(_mm256_mul_pd(ayzx, bzxy), _mm256_mul_pd(azxy, byzx));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void skinVerticesAVX2(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                                            const double* inNormals, double* outNormals, size_t begin, size_t end)
+    {
+        for (size_t v=begin; v<end; v++)
+        {
+            size_t first = skin.offsets[v], last = skin.offsets[v+1];
+            if (first == last)
+            {
+                copyVertex(inPoints, outPoints, inNormals, outNormals, v);
+                continue;
+            }
+
+            // the rows of the weighted sum of the matrices
+            const double* joint = skin.palette + size_t(skin.joints[first])*16;
+            __m256d w = _mm256_set1_pd(skin.weights[first]);
+            __m256d r0 = _mm256_mul_pd(w, _mm256_loadu_pd(joint));
+            __m256d r1 = _mm256_mul_pd(w, _mm256_loadu_pd(joint+4));
+            __m256d r2 = _mm256_mul_pd(w, _mm256_loadu_pd(joint+8));
+            __m256d r3 = _mm256_mul_pd(w, _mm256_loadu_pd(joint+12));
+            for (size_t i=first+1; i<last; i++)
+            {
+                joint = skin.palette + size_t(skin.joints[i])*16;
+                w = _mm256_set1_pd(skin.weights[i]);
+                r0 = _mm256_add_pd(r0, _mm256_mul_pd(w, _mm256_loadu_pd(joint)));
+                r1 = _mm256_add_pd(r1, _mm256_mul_pd(w, _mm256_loadu_pd(joint+4)));
+                r2 = _mm256_add_pd(r2, _mm256_mul_pd(w, _mm256_loadu_pd(joint+8)));
+                r3 = _mm256_add_pd(r3, _mm256_mul_pd(w, _mm256_loadu_pd(joint+12)));
+            }
+
+            double result[4];
+            __m256d point = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_set1_pd(inPoints[v*3]), r0), _mm256_mul_pd(_mm256_set1_pd(inPoints[v*3+1]), r1)),
+                _mm256_mul_pd(_mm256_set1_pd(inPoints[v*3+2]), r2)), r3);
+            _mm256_storeu_pd(result, point);
+            outPoints[v*3] = result[0];
+            outPoints[v*3+1] = result[1];
+            outPoints[v*3+2] = result[2];
+
+            if (inNormals)
+            {
+                // the cofactor rows, as the scalar version
+                __m256d c0 = crossRowsAVX2(r1, r2);
+                __m256d c1 = crossRowsAVX2(r2, r0);
+                __m256d c2 = crossRowsAVX2(r0, r1);
+                __m256d normal = _mm256_add_pd(_mm256_add_pd(
+                    _mm256_mul_pd(_mm256_set1_pd(inNormals[v*3]), c0), _mm256_mul_pd(_mm256_set1_pd(inNormals[v*3+1]), c1)),
+                    _mm256_mul_pd(_mm256_set1_pd(inNormals[v*3+2]), c2));
+                _mm256_storeu_pd(result, normal);
+                storeNormal(result[0], result[1], result[2], outNormals + v*3);
+            }
+        }
+    }
+
+    // The blend of the dual quaternions and the scales of the influences of vertex v in out (12 doubles),
+    // the identity for a vertex without influence. Returns false for a vertex without influence.
+    GMATH_INLINE GMATH_TARGET("avx2") bool blendDualQuaternionsAVX2(const SkinInfluences& skin, size_t v, double* out)
+    {
+        size_t first = skin.offsets[v], last = skin.offsets[v+1];
+        if (first == last)
+        {
+            _mm256_storeu_pd(out, _mm256_set_pd(1.0, 0.0, 0.0, 0.0));
+            _mm256_storeu_pd(out+4, _mm256_setzero_pd());
+            _mm256_storeu_pd(out+8, _mm256_set_pd(0.0, 1.0, 1.0, 1.0));
+            return false;
+        }
+
+        const double* pivot = skin.palette + size_t(skin.joints[first])*12;
+        __m256d pivotQr = _mm256_loadu_pd(pivot);
+        __m256d w = _mm256_set1_pd(skin.weights[first]);
+        __m256d qr = _mm256_mul_pd(w, pivotQr);
+        __m256d qd = _mm256_mul_pd(w, _mm256_loadu_pd(pivot+4));
+        __m256d sc = _mm256_mul_pd(w, _mm256_loadu_pd(pivot+8));
+        for (size_t i=first+1; i<last; i++)
+        {
+            const double* joint = skin.palette + size_t(skin.joints[i])*12;
+            __m256d jointQr = _mm256_loadu_pd(joint);
+            __m256d weight = _mm256_set1_pd(skin.weights[i]);
+
+            // the dot product in every lane, (p0 + p1) + (p2 + p3) as the scalar version, then the weight negated if below 0
+            __m256d pairs = _mm256_hadd_pd(_mm256_mul_pd(pivotQr, jointQr), _mm256_mul_pd(pivotQr, jointQr));
+            __m256d dot = _mm256_add_pd(pairs, _mm256_permute2f128_pd(pairs, pairs, 0x01));
+            __m256d negative = _mm256_cmp_pd(dot, _mm256_setzero_pd(), _CMP_LT_OQ);
+            __m256d signedWeight = _mm256_xor_pd(weight, _mm256_and_pd(negative, _mm256_set1_pd(-0.0)));
+
+            qr = _mm256_add_pd(qr, _mm256_mul_pd(signedWeight, jointQr));
+            qd = _mm256_add_pd(qd, _mm256_mul_pd(signedWeight, _mm256_loadu_pd(joint+4)));
+            sc = _mm256_add_pd(sc, _mm256_mul_pd(weight, _mm256_loadu_pd(joint+8)));
+        }
+        _mm256_storeu_pd(out, qr);
+        _mm256_storeu_pd(out+4, qd);
+        _mm256_storeu_pd(out+8, sc);
+        return true;
+    }
+
+    // The 4 doubles at offset of the 4 rows, as 4 columns.
+    GMATH_INLINE GMATH_TARGET("avx2") void transposeRowsAVX2(const double (*rows)[12], int offset,
+                                                             __m256d& c0, __m256d& c1, __m256d& c2, __m256d& c3)
+    {
+        __m256d r0 = _mm256_loadu_pd(rows[0]+offset);
+        __m256d r1 = _mm256_loadu_pd(rows[1]+offset);
+        __m256d r2 = _mm256_loadu_pd(rows[2]+offset);
+        __m256d r3 = _mm256_loadu_pd(rows[3]+offset);
+
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+        c0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        c1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        c2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        c3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+    // rotateByQuaternion for 4 vectors, in place.
+    GMATH_INLINE GMATH_TARGET("avx2") void rotateByQuaternionAVX2(__m256d qx, __m256d qy, __m256d qz, __m256d qw,
+                                                                  __m256d& vx, __m256d& vy, __m256d& vz)
+    {
+        __m256d tx = _mm256_sub_pd(_mm256_mul_pd(qy, vz), _mm256_mul_pd(qz, vy));
+        __m256d ty = _mm256_sub_pd(_mm256_mul_pd(qz, vx), _mm256_mul_pd(qx, vz));
+        __m256d tz = _mm256_sub_pd(_mm256_mul_pd(qx, vy), _mm256_mul_pd(qy, vx));
+        tx = _mm256_add_pd(tx, tx);
+        ty = _mm256_add_pd(ty, ty);
+        tz = _mm256_add_pd(tz, tz);
+
+        __m256d rx = _mm256_add_pd(_mm256_add_pd(vx, _mm256_mul_pd(qw, tx)), _mm256_sub_pd(_mm256_mul_pd(qy, tz), _mm256_mul_pd(qz, ty)));
+        __m256d ry = _mm256_add_pd(_mm256_add_pd(vy, _mm256_mul_pd(qw, ty)), _mm256_sub_pd(_mm256_mul_pd(qz, tx), _mm256_mul_pd(qx, tz)));
+        __m256d rz = _mm256_add_pd(_mm256_add_pd(vz, _mm256_mul_pd(qw, tz)), _mm256_sub_pd(_mm256_mul_pd(qx, ty), _mm256_mul_pd(qy, tx)));
+        vx = rx;
+        vy = ry;
+        vz = rz;
+    }
+
+    // The blends are computed one vertex at a time, then the normalization and the transform of 4 vertices at once.
+    GMATH_INLINE GMATH_TARGET("avx2") void skinVerticesDualQuaternionAVX2(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                                                          const double* inNormals, double* outNormals, size_t begin, size_t end)
+    {
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d two = _mm256_set1_pd(2.0);
+        const __m256d epsilon = _mm256_set1_pd(gmath::EPSILON);
+
+        size_t v = begin;
+        for (; v+4<=end; v+=4)
+        {
+            double blends[4][12];
+            bool influenced[4];
+            for (int l=0; l<4; l++)
+                influenced[l] = blendDualQuaternionsAVX2(skin, v+l, blends[l]);
+
+            __m256d rx, ry, rz, rw, dx, dy, dz, dw, sx, sy, sz, pad;
+            transposeRowsAVX2(blends, 0, rx, ry, rz, rw);
+            transposeRowsAVX2(blends, 4, dx, dy, dz, dw);
+            transposeRowsAVX2(blends, 8, sx, sy, sz, pad);
+
+            __m256d len = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(rx, rx), _mm256_mul_pd(ry, ry)), _mm256_mul_pd(rz, rz)), _mm256_mul_pd(rw, rw)));
+            int degenerate = _mm256_movemask_pd(_mm256_cmp_pd(len, epsilon, _CMP_LE_OQ));
+            __m256d invLength = _mm256_div_pd(one, len);
+            rx = _mm256_mul_pd(rx, invLength);
+            ry = _mm256_mul_pd(ry, invLength);
+            rz = _mm256_mul_pd(rz, invLength);
+            rw = _mm256_mul_pd(rw, invLength);
+            dx = _mm256_mul_pd(dx, invLength);
+            dy = _mm256_mul_pd(dy, invLength);
+            dz = _mm256_mul_pd(dz, invLength);
+            dw = _mm256_mul_pd(dw, invLength);
+
+            __m256d tx = _mm256_mul_pd(two, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(rw, dx), _mm256_mul_pd(dw, rx)),
+                                                          _mm256_sub_pd(_mm256_mul_pd(ry, dz), _mm256_mul_pd(rz, dy))));
+            __m256d ty = _mm256_mul_pd(two, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(rw, dy), _mm256_mul_pd(dw, ry)),
+                                                          _mm256_sub_pd(_mm256_mul_pd(rz, dx), _mm256_mul_pd(rx, dz))));
+            __m256d tz = _mm256_mul_pd(two, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(rw, dz), _mm256_mul_pd(dw, rz)),
+                                                          _mm256_sub_pd(_mm256_mul_pd(rx, dy), _mm256_mul_pd(ry, dx))));
+
+            const double* p = inPoints + v*3;
+            __m256d px = _mm256_mul_pd(_mm256_set_pd(p[9], p[6], p[3], p[0]), sx);
+            __m256d py = _mm256_mul_pd(_mm256_set_pd(p[10], p[7], p[4], p[1]), sy);
+            __m256d pz = _mm256_mul_pd(_mm256_set_pd(p[11], p[8], p[5], p[2]), sz);
+            rotateByQuaternionAVX2(rx, ry, rz, rw, px, py, pz);
+
+            double results[6][4];
+            _mm256_storeu_pd(results[0], _mm256_add_pd(px, tx));
+            _mm256_storeu_pd(results[1], _mm256_add_pd(py, ty));
+            _mm256_storeu_pd(results[2], _mm256_add_pd(pz, tz));
+
+            if (inNormals)
+            {
+                const double* n = inNormals + v*3;
+                __m256d nx = _mm256_mul_pd(_mm256_set_pd(n[9], n[6], n[3], n[0]), _mm256_mul_pd(sy, sz));
+                __m256d ny = _mm256_mul_pd(_mm256_set_pd(n[10], n[7], n[4], n[1]), _mm256_mul_pd(sx, sz));
+                __m256d nz = _mm256_mul_pd(_mm256_set_pd(n[11], n[8], n[5], n[2]), _mm256_mul_pd(sx, sy));
+                rotateByQuaternionAVX2(rx, ry, rz, rw, nx, ny, nz);
+
+                // storeNormal
+                __m256d normalLength = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(
+                    _mm256_mul_pd(nx, nx), _mm256_mul_pd(ny, ny)), _mm256_mul_pd(nz, nz)));
+                __m256d scale = _mm256_blendv_pd(_mm256_div_pd(one, normalLength), one,
+                                                 _mm256_cmp_pd(normalLength, epsilon, _CMP_LT_OQ));
+                _mm256_storeu_pd(results[3], _mm256_mul_pd(nx, scale));
+                _mm256_storeu_pd(results[4], _mm256_mul_pd(ny, scale));
+                _mm256_storeu_pd(results[5], _mm256_mul_pd(nz, scale));
+            }
+
+            for (int l=0; l<4; l++)
+            {
+                if (!influenced[l] || (degenerate & (1 << l)))
+                {
+                    copyVertex(inPoints, outPoints, inNormals, outNormals, v+l);
+                    continue;
+                }
+                for (int c=0; c<3; c++)
+                    outPoints[(v+l)*3+c] = results[c][l];
+                if (inNormals)
+                {
+                    for (int c=0; c<3; c++)
+                        outNormals[(v+l)*3+c] = results[3+c][l];
+                }
+            }
+        }
+        skinVerticesDualQuaternionScalar(skin, inPoints, outPoints, inNormals, outNormals, v, end);
+    }
+
+    /*------ AVX2, decomposition ------*/
+
+    struct RowsAVX2
+    {
+        __m256d x[3], y[3], z[3];
+    };
+
+    GMATH_INLINE GMATH_TARGET("avx2") void loadRowsAVX2(const Matrix3Soa& m, size_t i, RowsAVX2& r)
+    {
+        r.x[0] = _mm256_loadu_pd(m.x.x+i); r.x[1] = _mm256_loadu_pd(m.x.y+i); r.x[2] = _mm256_loadu_pd(m.x.z+i);
+        r.y[0] = _mm256_loadu_pd(m.y.x+i); r.y[1] = _mm256_loadu_pd(m.y.y+i); r.y[2] = _mm256_loadu_pd(m.y.z+i);
+        r.z[0] = _mm256_loadu_pd(m.z.x+i); r.z[1] = _mm256_loadu_pd(m.z.y+i); r.z[2] = _mm256_loadu_pd(m.z.z+i);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void storeRowsAVX2(const RowsAVX2& r, const Matrix3Soa& m, size_t i)
+    {
+        _mm256_storeu_pd(m.x.x+i, r.x[0]); _mm256_storeu_pd(m.x.y+i, r.x[1]); _mm256_storeu_pd(m.x.z+i, r.x[2]);
+        _mm256_storeu_pd(m.y.x+i, r.y[0]); _mm256_storeu_pd(m.y.y+i, r.y[1]); _mm256_storeu_pd(m.y.z+i, r.y[2]);
+        _mm256_storeu_pd(m.z.x+i, r.z[0]); _mm256_storeu_pd(m.z.y+i, r.z[1]); _mm256_storeu_pd(m.z.z+i, r.z[2]);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d dot3AVX2(const __m256d* a, const __m256d* b)
+    {
+        return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a[0], b[0]), _mm256_mul_pd(a[1], b[1])), _mm256_mul_pd(a[2], b[2]));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void cross3AVX2(const __m256d* a, const __m256d* b, __m256d* out)
+    {
+        out[0] = _mm256_sub_pd(_mm256_mul_pd(a[1], b[2]), _mm256_mul_pd(a[2], b[1]));
+        out[1] = _mm256_sub_pd(_mm256_mul_pd(a[2], b[0]), _mm256_mul_pd(a[0], b[2]));
+        out[2] = _mm256_sub_pd(_mm256_mul_pd(a[0], b[1]), _mm256_mul_pd(a[1], b[0]));
+    }
+
+    // gramSchmidtScalar for 4 matrices.
+    GMATH_INLINE GMATH_TARGET("avx2") void gramSchmidtAVX2(RowsAVX2& r, __m256d* lengths, __m256d* dots)
+    {
+        const __m256d one = _mm256_set1_pd(1.0);
+
+        lengths[0] = _mm256_sqrt_pd(dot3AVX2(r.x, r.x));
+        __m256d invLength = _mm256_div_pd(one, lengths[0]);
+        for (int c=0; c<3; c++)
+            r.x[c] = _mm256_mul_pd(r.x[c], invLength);
+
+        dots[0] = dot3AVX2(r.x, r.y);
+        for (int c=0; c<3; c++)
+            r.y[c] = _mm256_sub_pd(r.y[c], _mm256_mul_pd(dots[0], r.x[c]));
+        lengths[1] = _mm256_sqrt_pd(dot3AVX2(r.y, r.y));
+        invLength = _mm256_div_pd(one, lengths[1]);
+        for (int c=0; c<3; c++)
+            r.y[c] = _mm256_mul_pd(r.y[c], invLength);
+
+        dots[2] = dot3AVX2(r.y, r.z);
+        dots[1] = dot3AVX2(r.x, r.z);
+        for (int c=0; c<3; c++)
+            r.z[c] = _mm256_sub_pd(r.z[c], _mm256_add_pd(_mm256_mul_pd(dots[1], r.x[c]), _mm256_mul_pd(dots[2], r.y[c])));
+        lengths[2] = _mm256_sqrt_pd(dot3AVX2(r.z, r.z));
+        invLength = _mm256_div_pd(one, lengths[2]);
+        for (int c=0; c<3; c++)
+            r.z[c] = _mm256_mul_pd(r.z[c], invLength);
+    }
+
+    // quaternionFromRowsScalar for 4 matrices, the four cases are computed with the same radicand and selected.
+    GMATH_INLINE GMATH_TARGET("avx2") void quaternionFromRowsAVX2(const RowsAVX2& r, __m256d* q)
+    {
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d half = _mm256_set1_pd(0.5);
+        __m256d m00 = r.x[0], m11 = r.y[1], m22 = r.z[2];
+
+        __m256d trace = _mm256_add_pd(_mm256_add_pd(m00, m11), m22);
+        __m256d caseW = _mm256_cmp_pd(trace, _mm256_setzero_pd(), _CMP_GT_OQ);
+        __m256d caseY = _mm256_cmp_pd(m11, m00, _CMP_GT_OQ);
+        __m256d caseZ = _mm256_andnot_pd(caseW, _mm256_cmp_pd(m22, _mm256_blendv_pd(m00, m11, caseY), _CMP_GT_OQ));
+        caseY = _mm256_andnot_pd(_mm256_or_pd(caseW, caseZ), caseY);
+
+        __m256d radicand = _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(m00, m11), m22), one);
+        radicand = _mm256_blendv_pd(radicand, _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(m11, m22), m00), one), caseY);
+        radicand = _mm256_blendv_pd(radicand, _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(m22, m00), m11), one), caseZ);
+        radicand = _mm256_blendv_pd(radicand, _mm256_add_pd(trace, one), caseW);
+        __m256d root = _mm256_sqrt_pd(radicand);
+        __m256d largest = _mm256_mul_pd(half, root);
+        __m256d s = _mm256_div_pd(half, root);
+
+        __m256d a = _mm256_mul_pd(_mm256_sub_pd(r.y[2], r.z[1]), s);
+        __m256d b = _mm256_mul_pd(_mm256_sub_pd(r.z[0], r.x[2]), s);
+        __m256d c = _mm256_mul_pd(_mm256_sub_pd(r.x[1], r.y[0]), s);
+        __m256d d = _mm256_mul_pd(_mm256_add_pd(r.x[1], r.y[0]), s);
+        __m256d e = _mm256_mul_pd(_mm256_add_pd(r.x[2], r.z[0]), s);
+        __m256d f = _mm256_mul_pd(_mm256_add_pd(r.y[2], r.z[1]), s);
+
+        // the x case, then the others over it
+        q[0] = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_blendv_pd(largest, d, caseY), e, caseZ), a, caseW);
+        q[1] = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_blendv_pd(d, largest, caseY), f, caseZ), b, caseW);
+        q[2] = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_blendv_pd(e, f, caseY), largest, caseZ), c, caseW);
+        q[3] = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_blendv_pd(a, b, caseY), c, caseZ), largest, caseW);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void decomposeAffineAVX2(const Matrix3Soa& m, const QuaternionSoa& ori, const Vector3Soa& sc,
+                                                               const Vector3Soa& shear, size_t count)
+    {
+        const __m256d negative = _mm256_set1_pd(-0.0);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            RowsAVX2 r;
+            __m256d lengths[3], dots[3], q[4], cofactors[3];
+            loadRowsAVX2(m, i, r);
+            gramSchmidtAVX2(r, lengths, dots);
+            _mm256_storeu_pd(shear.x+i, _mm256_div_pd(dots[0], lengths[1]));
+            _mm256_storeu_pd(shear.y+i, _mm256_div_pd(dots[1], lengths[2]));
+            _mm256_storeu_pd(shear.z+i, _mm256_div_pd(dots[2], lengths[2]));
+
+            // x * sign with sign = -1 or 1 is a flip of the sign bit
+            cross3AVX2(r.y, r.z, cofactors);
+            __m256d det = dot3AVX2(r.x, cofactors);
+            __m256d flip = _mm256_and_pd(_mm256_cmp_pd(det, _mm256_setzero_pd(), _CMP_LT_OQ), negative);
+            for (int c=0; c<3; c++)
+            {
+                r.x[c] = _mm256_xor_pd(r.x[c], flip);
+                r.y[c] = _mm256_xor_pd(r.y[c], flip);
+                r.z[c] = _mm256_xor_pd(r.z[c], flip);
+            }
+            _mm256_storeu_pd(sc.x+i, _mm256_xor_pd(lengths[0], flip));
+            _mm256_storeu_pd(sc.y+i, _mm256_xor_pd(lengths[1], flip));
+            _mm256_storeu_pd(sc.z+i, _mm256_xor_pd(lengths[2], flip));
+
+            storeRowsAVX2(r, m, i);
+            quaternionFromRowsAVX2(r, q);
+            _mm256_storeu_pd(ori.x+i, q[0]);
+            _mm256_storeu_pd(ori.y+i, q[1]);
+            _mm256_storeu_pd(ori.z+i, q[2]);
+            _mm256_storeu_pd(ori.w+i, q[3]);
+        }
+        decomposeAffineScalar(m, ori, sc, shear, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void gramSchmidtAVX2(const Matrix3Soa& m, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            RowsAVX2 r;
+            __m256d lengths[3], dots[3];
+            loadRowsAVX2(m, i, r);
+            gramSchmidtAVX2(r, lengths, dots);
+            storeRowsAVX2(r, m, i);
+        }
+        gramSchmidtScalar(m, i, count);
+    }
+
+    // The lanes that converged keep their rows while the others iterate, so every matrix gets the iterations of polarScalar.
+    GMATH_INLINE GMATH_TARGET("avx2") void polarAVX2(const Matrix3Soa& m, size_t count)
+    {
+        const __m256d half = _mm256_set1_pd(0.5);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        const __m256d tolerance = _mm256_set1_pd(POLAR_TOLERANCE);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            RowsAVX2 r;
+            loadRowsAVX2(m, i, r);
+            __m256d active = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+            for (int k=0; k<POLAR_ITERATIONS && _mm256_movemask_pd(active); k++)
+            {
+                __m256d cofactors[3][3];
+                cross3AVX2(r.y, r.z, cofactors[0]);
+                cross3AVX2(r.z, r.x, cofactors[1]);
+                cross3AVX2(r.x, r.y, cofactors[2]);
+                __m256d invDet = _mm256_div_pd(one, dot3AVX2(r.x, cofactors[0]));
+
+                __m256d change = _mm256_setzero_pd();
+                __m256d* rows[3] = { r.x, r.y, r.z };
+                for (int row=0; row<3; row++)
+                {
+                    for (int c=0; c<3; c++)
+                    {
+                        __m256d value = _mm256_mul_pd(half, _mm256_add_pd(rows[row][c], _mm256_mul_pd(cofactors[row][c], invDet)));
+                        __m256d delta = _mm256_and_pd(_mm256_sub_pd(value, rows[row][c]), absMask);
+                        change = _mm256_max_pd(change, delta);
+                        rows[row][c] = _mm256_blendv_pd(rows[row][c], value, active);
+                    }
+                }
+                active = _mm256_and_pd(active, _mm256_cmp_pd(change, tolerance, _CMP_GT_OQ));
+            }
+            storeRowsAVX2(r, m, i);
+        }
+        polarScalar(m, i, count);
+    }
+
+    /*------ AVX2, intersections ------*/
+
+    // 4 packed x, y, z triplets to their components and back
+    GMATH_INLINE GMATH_TARGET("avx2") void loadTripletsAVX2(const double* in, __m256d* v)
+    {
+        __m256d a = _mm256_loadu_pd(in), b = _mm256_loadu_pd(in+4), c = _mm256_loadu_pd(in+8);
+        __m256d xy = _mm256_blend_pd(a, b, 0xC);                // x0 y0 x2 y2
+        __m256d zx = _mm256_permute2f128_pd(a, c, 0x21);        // z0 x1 z2 x3
+        __m256d yz = _mm256_blend_pd(b, c, 0xC);                // y1 z1 y3 z3
+        v[0] = _mm256_shuffle_pd(xy, zx, 0xA);
+        v[1] = _mm256_shuffle_pd(xy, yz, 0x5);
+        v[2] = _mm256_shuffle_pd(zx, yz, 0xA);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void storeTripletsAVX2(const __m256d* v, double* out)
+    {
+        __m256d xy = _mm256_shuffle_pd(v[0], v[1], 0x0);
+        __m256d zx = _mm256_shuffle_pd(v[2], v[0], 0xA);
+        __m256d yz = _mm256_shuffle_pd(v[1], v[2], 0xF);
+        _mm256_storeu_pd(out, _mm256_permute2f128_pd(xy, zx, 0x20));
+        _mm256_storeu_pd(out+4, _mm256_blend_pd(yz, xy, 0xC));
+        _mm256_storeu_pd(out+8, _mm256_permute2f128_pd(zx, yz, 0x31));
+    }
+
+    // Bit k of the index to byte k, to add the bits of 4 comparisons to 4 bytes at once.
+    const unsigned int SPREAD_BITS[16] = {
+        0x00000000, 0x00000001, 0x00000100, 0x00000101, 0x00010000, 0x00010001, 0x00010100, 0x00010101,
+        0x01000000, 0x01000001, 0x01000100, 0x01000101, 0x01010000, 0x01010001, 0x01010100, 0x01010101 };
+    const unsigned char BIT_COUNTS[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+    // intersectPlanesScalar for 4 lines, the types come from the bits of the comparisons and the points
+    // are blended over the ones already in out. planeStride is 0 or 3.
+    template <bool RAY>
+    GMATH_INLINE GMATH_TARGET("avx2") size_t intersectPlanesAVX2(const double* p0, const double* p1, const double* normals, const double* points,
+                                                                 size_t planeStride, double* out, unsigned char* types,
+                                                                 size_t count, bool infiniteLine)
+    {
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d tiny = _mm256_set1_pd(DBL_MIN);
+        const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        const __m256d bounded = infiniteLine ? zero : _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+        // the plane of every line when planeStride is 0, else the planes are loaded with the lines
+        bool samePlane = planeStride == 0 && count >= 4;
+        __m256d n[3], p[3];
+        for (int c=0; c<3; c++)
+        {
+            n[c] = samePlane ? _mm256_set1_pd(normals[c]) : zero;
+            p[c] = samePlane ? _mm256_set1_pd(points[c]) : zero;
+        }
+
+        size_t hits = 0;
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d a[3], b[3], line[3], result[3];
+            loadTripletsAVX2(p0 + 3*i, a);
+            loadTripletsAVX2(p1 + 3*i, b);
+            if (planeStride)
+            {
+                loadTripletsAVX2(normals + 3*i, n);
+                loadTripletsAVX2(points + 3*i, p);
+            }
+            for (int c=0; c<3; c++)
+                line[c] = RAY ? b[c] : _mm256_sub_pd(b[c], a[c]);
+
+            __m256d dotA = dot3AVX2(line, n);
+            __m256d dotB = _mm256_add_pd(_mm256_add_pd(
+                _mm256_mul_pd(_mm256_sub_pd(p[0], a[0]), n[0]), _mm256_mul_pd(_mm256_sub_pd(p[1], a[1]), n[1])),
+                _mm256_mul_pd(_mm256_sub_pd(p[2], a[2]), n[2]));
+            __m256d x = _mm256_mul_pd(dotB, _mm256_div_pd(one, dotA));
+
+            __m256d parallel = _mm256_cmp_pd(_mm256_and_pd(dotA, absMask), tiny, _CMP_LE_OQ);
+            __m256d onPlane = _mm256_cmp_pd(_mm256_and_pd(dotB, absMask), tiny, _CMP_LE_OQ);
+            __m256d outside = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+            if (!RAY)
+                outside = _mm256_and_pd(_mm256_or_pd(outside, _mm256_cmp_pd(x, one, _CMP_GT_OQ)), bounded);
+            int parallelBits = _mm256_movemask_pd(parallel);
+            int onPlaneBits = _mm256_movemask_pd(onPlane) & parallelBits;
+            int outsideBits = _mm256_movemask_pd(outside) & ~parallelBits;
+            unsigned int typeBytes = SPREAD_BITS[15]*INTERSECTION_HIT + SPREAD_BITS[outsideBits]
+                                   + 2*SPREAD_BITS[parallelBits] + SPREAD_BITS[onPlaneBits];
+            memcpy(types + i, &typeBytes, 4);
+            hits += BIT_COUNTS[~(parallelBits | outsideBits) & 0xF];
+
+            __m256d hit = _mm256_andnot_pd(_mm256_or_pd(parallel, outside), _mm256_castsi256_pd(_mm256_set1_epi64x(-1)));
+            __m256d previous[3];
+            loadTripletsAVX2(out + 3*i, previous);
+            __m256d rest = _mm256_sub_pd(one, x);
+            for (int c=0; c<3; c++)
+            {
+                __m256d point = RAY ? _mm256_add_pd(a[c], _mm256_mul_pd(b[c], x))
+                                    : _mm256_add_pd(_mm256_mul_pd(b[c], x), _mm256_mul_pd(a[c], rest));
+                result[c] = _mm256_blendv_pd(previous[c], point, hit);
+            }
+            storeTripletsAVX2(result, out + 3*i);
+        }
+        return hits + intersectPlanesScalar<RAY>(p0, p1, normals, points, planeStride, out, types, i, count, infiniteLine);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") size_t intersectLinesPlanesAVX2(const double* p0, const double* p1, const double* normals, const double* points,
+                                                                      size_t planeStride, double* out, unsigned char* types, size_t count, bool infiniteLine)
+    {
+        return intersectPlanesAVX2<false>(p0, p1, normals, points, planeStride, out, types, count, infiniteLine);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") size_t intersectRaysPlanesAVX2(const double* origins, const double* directions, const double* normals,
+                                                                     const double* points, size_t planeStride, double* out,
+                                                                     unsigned char* types, size_t count)
+    {
+        return intersectPlanesAVX2<true>(origins, directions, normals, points, planeStride, out, types, count, false);
+    }
+
+    /*------ AVX2, bounds ------*/
+    // A point per register, x y z in the first 3 lanes, the last lane is not used.
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d loadPointAVX2(const double* in)
+    {
+        return _mm256_maskload_pd(in, _mm256_set_epi64x(0, -1, -1, -1));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void boundPointsAVX2(const double* m, const double* in, size_t count, size_t stride,
+                                                           double* min, double* max)
+    {
+        __m256d r0, r1, r2, r3;
+        if (m)
+        {
+            r0 = _mm256_loadu_pd(m);
+            r1 = _mm256_loadu_pd(m+4);
+            r2 = _mm256_loadu_pd(m+8);
+            r3 = _mm256_loadu_pd(m+12);
+        }
+        else
+            r0 = r1 = r2 = r3 = _mm256_setzero_pd();
+
+        // two points per iteration on two pairs of bounds, for the latency of min and max
+        __m256d lo0 = loadPointAVX2(min), hi0 = loadPointAVX2(max), lo1 = lo0, hi1 = hi0;
+        size_t i = 0;
+        for (; i+2<=count; i+=2, in+=2*stride)
+        {
+            __m256d p0, p1;
+            if (m)
+            {
+                const double* q = in + stride;
+                p0 = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                    _mm256_mul_pd(_mm256_set1_pd(in[0]), r0), _mm256_mul_pd(_mm256_set1_pd(in[1]), r1)),
+                    _mm256_mul_pd(_mm256_set1_pd(in[2]), r2)), r3);
+                p1 = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+                    _mm256_mul_pd(_mm256_set1_pd(q[0]), r0), _mm256_mul_pd(_mm256_set1_pd(q[1]), r1)),
+                    _mm256_mul_pd(_mm256_set1_pd(q[2]), r2)), r3);
+            }
+            else
+            {
+                p0 = loadPointAVX2(in);
+                p1 = loadPointAVX2(in + stride);
+            }
+            // min and max return their second operand when one is NaN, the NaN coordinates are ignored
+            lo0 = _mm256_min_pd(p0, lo0);
+            hi0 = _mm256_max_pd(p0, hi0);
+            lo1 = _mm256_min_pd(p1, lo1);
+            hi1 = _mm256_max_pd(p1, hi1);
+        }
+
+        double lo[4], hi[4];
+        _mm256_storeu_pd(lo, _mm256_min_pd(lo0, lo1));
+        _mm256_storeu_pd(hi, _mm256_max_pd(hi0, hi1));
+        for (int c=0; c<3; c++)
+        {
+            min[c] = lo[c];
+            max[c] = hi[c];
+        }
+        boundPointsScalar(m, in, count-i, stride, min, max);
+    }
+
+    // The lanes of the sums are the ones of momentsPointsScalar, so the sums are the same.
+    GMATH_INLINE GMATH_TARGET("avx2") size_t momentsPointsAVX2(const double* in, size_t count, size_t stride, const double* shift, double* sums)
+    {
+        __m256d offset = loadPointAVX2(shift);
+        __m256d s = loadPointAVX2(sums);
+        __m256d sx = loadPointAVX2(sums+3), sy = loadPointAVX2(sums+6), sz = loadPointAVX2(sums+9);
+        size_t added = 0;
+        for (size_t i=0; i<count; i++, in+=stride)
+        {
+            // the finite test of the scalar version, the unused lane is 0
+            __m256d p = loadPointAVX2(in);
+            if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_sub_pd(p, p), _mm256_setzero_pd(), _CMP_EQ_OQ)) != 0xF)
+                continue;
+            added++;
+            __m256d d = _mm256_sub_pd(p, offset);
+            s = _mm256_add_pd(s, d);
+            sx = _mm256_add_pd(sx, _mm256_mul_pd(d, _mm256_permute4x64_pd(d, 0x00)));
+            sy = _mm256_add_pd(sy, _mm256_mul_pd(d, _mm256_permute4x64_pd(d, 0x55)));
+            sz = _mm256_add_pd(sz, _mm256_mul_pd(d, _mm256_permute4x64_pd(d, 0xAA)));
+        }
+
+        double out[16];
+        _mm256_storeu_pd(out, s);
+        _mm256_storeu_pd(out+4, sx);
+        _mm256_storeu_pd(out+8, sy);
+        _mm256_storeu_pd(out+12, sz);
+        for (int r=0; r<4; r++)
+        {
+            for (int c=0; c<3; c++)
+                sums[r*3+c] = out[r*4+c];
+        }
+        return added;
+    }
+
+    /*------ AVX2, culling ------*/
+    // 8 objects per iteration for a byte of the mask, the same operations as the scalar versions.
+
+    // 4 points of loadPointAVX2 to their components
+    GMATH_INLINE GMATH_TARGET("avx2") void transposePointsAVX2(__m256d p0, __m256d p1, __m256d p2, __m256d p3, __m256d* v)
+    {
+        __m256d xz01 = _mm256_unpacklo_pd(p0, p1);              // x0 x1 z0 z1
+        __m256d y01 = _mm256_unpackhi_pd(p0, p1);               // y0 y1 w0 w1
+        __m256d xz23 = _mm256_unpacklo_pd(p2, p3);              // x2 x3 z2 z3
+        __m256d y23 = _mm256_unpackhi_pd(p2, p3);               // y2 y3 w2 w3
+        v[0] = _mm256_permute2f128_pd(xz01, xz23, 0x20);
+        v[1] = _mm256_permute2f128_pd(y01, y23, 0x20);
+        v[2] = _mm256_permute2f128_pd(xz01, xz23, 0x31);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d planeDistanceAVX2(const double* p, __m256d x, __m256d y, __m256d z)
+    {
+        return _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+            _mm256_mul_pd(_mm256_set1_pd(p[0]), x), _mm256_mul_pd(_mm256_set1_pd(p[1]), y)),
+            _mm256_mul_pd(_mm256_set1_pd(p[2]), z)), _mm256_set1_pd(p[3]));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") size_t cullSpheresAVX2(const double* planes, const double* centers, const double* radii,
+                                                             size_t count, unsigned char* visible)
+    {
+        const __m256d signBit = _mm256_set1_pd(-0.0);
+        size_t inside = 0, i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            int bits[2];
+            for (int h=0; h<2; h++)
+            {
+                __m256d c[3];
+                loadTripletsAVX2(centers + 3*(i+4*h), c);
+                __m256d limit = _mm256_xor_pd(_mm256_loadu_pd(radii + i+4*h), signBit);
+                __m256d in = _mm256_cmp_pd(planeDistanceAVX2(planes, c[0], c[1], c[2]), limit, _CMP_GE_OQ);
+                for (int k=1; k<6; k++)
+                    in = _mm256_and_pd(in, _mm256_cmp_pd(planeDistanceAVX2(planes + 4*k, c[0], c[1], c[2]), limit, _CMP_GE_OQ));
+                bits[h] = _mm256_movemask_pd(in);
+            }
+            visible[i/8] = (unsigned char)(bits[0] | (bits[1] << 4));
+            inside += BIT_COUNTS[bits[0]] + BIT_COUNTS[bits[1]];
+        }
+        return inside + cullSpheresScalar(planes, centers + 3*i, radii + i, count-i, visible + i/8);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") size_t cullBoxesAVX2(const double* planes, const double* boxes, size_t count, size_t stride,
+                                                           unsigned char* visible)
+    {
+        size_t inside = 0, i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            int bits[2];
+            for (int h=0; h<2; h++)
+            {
+                const double* b = boxes + (i+4*h)*stride;
+                __m256d low[3], high[3];
+                transposePointsAVX2(loadPointAVX2(b), loadPointAVX2(b + stride), loadPointAVX2(b + 2*stride),
+                                    loadPointAVX2(b + 3*stride), low);
+                transposePointsAVX2(loadPointAVX2(b + 3), loadPointAVX2(b + stride+3), loadPointAVX2(b + 2*stride+3),
+                                    loadPointAVX2(b + 3*stride+3), high);
+                __m256d in = _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(low[0], high[0], _CMP_LE_OQ),
+                                                         _mm256_cmp_pd(low[1], high[1], _CMP_LE_OQ)),
+                                           _mm256_cmp_pd(low[2], high[2], _CMP_LE_OQ));
+                for (int k=0; k<6; k++)
+                {
+                    const double* p = planes + 4*k;
+                    __m256d corner[3];
+                    for (int c=0; c<3; c++)
+                    {
+                        __m256d n = _mm256_set1_pd(p[c]);
+                        corner[c] = _mm256_max_pd(_mm256_mul_pd(n, low[c]), _mm256_mul_pd(n, high[c]));
+                    }
+                    __m256d distance = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(corner[0], corner[1]), corner[2]), _mm256_set1_pd(p[3]));
+                    in = _mm256_and_pd(in, _mm256_cmp_pd(distance, _mm256_setzero_pd(), _CMP_GE_OQ));
+                }
+                bits[h] = _mm256_movemask_pd(in);
+            }
+            visible[i/8] = (unsigned char)(bits[0] | (bits[1] << 4));
+            inside += BIT_COUNTS[bits[0]] + BIT_COUNTS[bits[1]];
+        }
+        return inside + cullBoxesScalar(planes, boxes + i*stride, count-i, stride, visible + i/8);
+    }
+
+    /*------ AVX2, math functions ------*/
+    // The same operations as the scalar versions, a block of 4 with a value that needs libm goes to the scalar version.
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d floorAVX2(__m256d x)
+    {
+        return _mm256_round_pd(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    // b where mask is set, a elsewhere
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d selectAVX2(__m256d mask, __m256d a, __m256d b)
+    {
+        return _mm256_blendv_pd(a, b, mask);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void sinCosAVX2(const double* in, double* outSin, double* outCos, size_t count)
+    {
+        using namespace math;
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d one = _mm256_set1_pd(1.0), two = _mm256_set1_pd(2.0), three = _mm256_set1_pd(3.0);
+        const __m256d half = _mm256_set1_pd(0.5);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d x = _mm256_loadu_pd(in+i);
+            __m256d inRange = _mm256_cmp_pd(_mm256_andnot_pd(sign, x), _mm256_set1_pd(SINCOS_LIMIT), _CMP_LE_OQ);
+            if (_mm256_movemask_pd(inRange) != 0xF)
+            {
+                sinCosScalar(in, outSin, outCos, i, i+4);
+                continue;
+            }
+
+            __m256d n = floorAVX2(_mm256_add_pd(_mm256_mul_pd(x, _mm256_set1_pd(TWO_OVER_PI)), half));
+            __m256d r = _mm256_sub_pd(_mm256_sub_pd(_mm256_sub_pd(x,
+                _mm256_mul_pd(n, _mm256_set1_pd(PIO2_1))), _mm256_mul_pd(n, _mm256_set1_pd(PIO2_2))), _mm256_mul_pd(n, _mm256_set1_pd(PIO2_3)));
+            __m256d z = _mm256_mul_pd(r, r);
+
+            __m256d ps = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(S6), z), _mm256_set1_pd(S5));
+            ps = _mm256_add_pd(_mm256_mul_pd(ps, z), _mm256_set1_pd(S4));
+            ps = _mm256_add_pd(_mm256_mul_pd(ps, z), _mm256_set1_pd(S3));
+            ps = _mm256_add_pd(_mm256_mul_pd(ps, z), _mm256_set1_pd(S2));
+            ps = _mm256_add_pd(_mm256_mul_pd(ps, z), _mm256_set1_pd(S1));
+            __m256d pc = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(C6), z), _mm256_set1_pd(C5));
+            pc = _mm256_add_pd(_mm256_mul_pd(pc, z), _mm256_set1_pd(C4));
+            pc = _mm256_add_pd(_mm256_mul_pd(pc, z), _mm256_set1_pd(C3));
+            pc = _mm256_add_pd(_mm256_mul_pd(pc, z), _mm256_set1_pd(C2));
+            pc = _mm256_add_pd(_mm256_mul_pd(pc, z), _mm256_set1_pd(C1));
+
+            __m256d sinR = _mm256_add_pd(r, _mm256_mul_pd(_mm256_mul_pd(z, r), ps));
+            __m256d hz = _mm256_mul_pd(half, z);
+            __m256d w = _mm256_sub_pd(one, hz);
+            __m256d cosR = _mm256_add_pd(w, _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(one, w), hz), _mm256_mul_pd(_mm256_mul_pd(z, z), pc)));
+
+            __m256d q = _mm256_sub_pd(n, _mm256_mul_pd(_mm256_set1_pd(4.0), floorAVX2(_mm256_mul_pd(n, _mm256_set1_pd(0.25)))));
+            __m256d q1 = _mm256_cmp_pd(q, one, _CMP_EQ_OQ);
+            __m256d odd = _mm256_or_pd(q1, _mm256_cmp_pd(q, three, _CMP_EQ_OQ));
+            __m256d s = selectAVX2(odd, sinR, cosR);
+            __m256d c = selectAVX2(odd, cosR, sinR);
+            s = _mm256_xor_pd(s, _mm256_and_pd(_mm256_cmp_pd(q, two, _CMP_GE_OQ), sign));
+            c = _mm256_xor_pd(c, _mm256_and_pd(_mm256_or_pd(q1, _mm256_cmp_pd(q, two, _CMP_EQ_OQ)), sign));
+            s = selectAVX2(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ), s, x);
+            _mm256_storeu_pd(outSin+i, s);
+            _mm256_storeu_pd(outCos+i, c);
+        }
+        sinCosScalar(in, outSin, outCos, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void atan2AVX2(const double* y, const double* x, double* out, size_t count)
+    {
+        using namespace math;
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d largest = _mm256_set1_pd(DBL_MAX);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d vx = _mm256_loadu_pd(x+i), vy = _mm256_loadu_pd(y+i);
+            __m256d ax = _mm256_andnot_pd(sign, vx), ay = _mm256_andnot_pd(sign, vy);
+            __m256d finite = _mm256_and_pd(_mm256_cmp_pd(ax, largest, _CMP_LE_OQ), _mm256_cmp_pd(ay, largest, _CMP_LE_OQ));
+            if (_mm256_movemask_pd(finite) != 0xF)
+            {
+                atan2Scalar(y, x, out, i, i+4);
+                continue;
+            }
+
+            __m256d steep = _mm256_cmp_pd(ax, ay, _CMP_LT_OQ);
+            __m256d low = selectAVX2(steep, ay, ax);
+            __m256d high = selectAVX2(steep, ax, ay);
+            __m256d a = _mm256_and_pd(_mm256_div_pd(low, high), _mm256_cmp_pd(high, _mm256_setzero_pd(), _CMP_GT_OQ));
+            __m256d far = _mm256_cmp_pd(a, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+            __m256d t = selectAVX2(far, a, _mm256_div_pd(_mm256_sub_pd(a, one), _mm256_add_pd(a, one)));
+
+            __m256d z = _mm256_mul_pd(t, t);
+            __m256d p = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(AT_P0), z), _mm256_set1_pd(AT_P1));
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(AT_P2));
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(AT_P3));
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(AT_P4));
+            __m256d q = _mm256_add_pd(z, _mm256_set1_pd(AT_Q0));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(AT_Q1));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(AT_Q2));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(AT_Q3));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(AT_Q4));
+            __m256d r = _mm256_add_pd(_mm256_mul_pd(t, _mm256_div_pd(_mm256_mul_pd(z, p), q)), t);
+            r = selectAVX2(far, r, _mm256_add_pd(_mm256_set1_pd(PIO4), _mm256_add_pd(r, _mm256_set1_pd(0.5*MOREBITS))));
+
+            r = selectAVX2(steep, r, _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(PIO2), r), _mm256_set1_pd(MOREBITS)));
+            r = selectAVX2(vx, r, _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(PI), r), _mm256_set1_pd(2.0*MOREBITS)));
+            _mm256_storeu_pd(out+i, _mm256_xor_pd(r, _mm256_and_pd(vy, sign)));
+        }
+        atan2Scalar(y, x, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d asinUnitAVX2(__m256d x)
+    {
+        using namespace math;
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        __m256d a = _mm256_andnot_pd(sign, x);
+
+        // a > 0.625
+        __m256d zz = _mm256_sub_pd(_mm256_set1_pd(1.0), a);
+        __m256d pr = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(AS_R0), zz), _mm256_set1_pd(AS_R1));
+        pr = _mm256_add_pd(_mm256_mul_pd(pr, zz), _mm256_set1_pd(AS_R2));
+        pr = _mm256_add_pd(_mm256_mul_pd(pr, zz), _mm256_set1_pd(AS_R3));
+        pr = _mm256_add_pd(_mm256_mul_pd(pr, zz), _mm256_set1_pd(AS_R4));
+        __m256d qs = _mm256_add_pd(zz, _mm256_set1_pd(AS_S0));
+        qs = _mm256_add_pd(_mm256_mul_pd(qs, zz), _mm256_set1_pd(AS_S1));
+        qs = _mm256_add_pd(_mm256_mul_pd(qs, zz), _mm256_set1_pd(AS_S2));
+        qs = _mm256_add_pd(_mm256_mul_pd(qs, zz), _mm256_set1_pd(AS_S3));
+        __m256d p = _mm256_div_pd(_mm256_mul_pd(zz, pr), qs);
+        zz = _mm256_sqrt_pd(_mm256_add_pd(zz, zz));
+        __m256d z = _mm256_sub_pd(_mm256_set1_pd(PIO4), zz);
+        zz = _mm256_sub_pd(_mm256_mul_pd(zz, p), _mm256_set1_pd(MOREBITS));
+        z = _mm256_sub_pd(z, zz);
+        __m256d large = _mm256_add_pd(z, _mm256_set1_pd(PIO4));
+
+        // a <= 0.625
+        zz = _mm256_mul_pd(a, a);
+        __m256d pp = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(AS_P0), zz), _mm256_set1_pd(AS_P1));
+        pp = _mm256_add_pd(_mm256_mul_pd(pp, zz), _mm256_set1_pd(AS_P2));
+        pp = _mm256_add_pd(_mm256_mul_pd(pp, zz), _mm256_set1_pd(AS_P3));
+        pp = _mm256_add_pd(_mm256_mul_pd(pp, zz), _mm256_set1_pd(AS_P4));
+        pp = _mm256_add_pd(_mm256_mul_pd(pp, zz), _mm256_set1_pd(AS_P5));
+        __m256d qq = _mm256_add_pd(zz, _mm256_set1_pd(AS_Q0));
+        qq = _mm256_add_pd(_mm256_mul_pd(qq, zz), _mm256_set1_pd(AS_Q1));
+        qq = _mm256_add_pd(_mm256_mul_pd(qq, zz), _mm256_set1_pd(AS_Q2));
+        qq = _mm256_add_pd(_mm256_mul_pd(qq, zz), _mm256_set1_pd(AS_Q3));
+        qq = _mm256_add_pd(_mm256_mul_pd(qq, zz), _mm256_set1_pd(AS_Q4));
+        z = _mm256_div_pd(_mm256_mul_pd(zz, pp), qq);
+        __m256d small = _mm256_add_pd(_mm256_mul_pd(a, z), a);
+
+        __m256d r = selectAVX2(_mm256_cmp_pd(a, _mm256_set1_pd(0.625), _CMP_GT_OQ), small, large);
+        return _mm256_xor_pd(r, _mm256_and_pd(x, sign));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") __m256d clampUnitAVX2(__m256d x)
+    {
+        return _mm256_max_pd(_mm256_set1_pd(-1.0), _mm256_min_pd(_mm256_set1_pd(1.0), x));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void asinAVX2(const double* in, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+            _mm256_storeu_pd(out+i, asinUnitAVX2(clampUnitAVX2(_mm256_loadu_pd(in+i))));
+        asinScalar(in, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void acosAVX2(const double* in, double* out, size_t count)
+    {
+        using namespace math;
+        const __m256d one = _mm256_set1_pd(1.0), half = _mm256_set1_pd(0.5), two = _mm256_set1_pd(2.0);
+
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+        {
+            __m256d x = clampUnitAVX2(_mm256_loadu_pd(in+i));
+            __m256d high = _mm256_cmp_pd(x, half, _CMP_GT_OQ);
+            __m256d low = _mm256_cmp_pd(x, _mm256_set1_pd(-0.5), _CMP_LT_OQ);
+
+            __m256d u = selectAVX2(high, x, _mm256_sqrt_pd(_mm256_mul_pd(half, _mm256_sub_pd(one, x))));
+            u = selectAVX2(low, u, _mm256_sqrt_pd(_mm256_mul_pd(half, _mm256_add_pd(one, x))));
+            __m256d s = asinUnitAVX2(u);
+
+            __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(PIO4), s), _mm256_set1_pd(MOREBITS)), _mm256_set1_pd(PIO4));
+            r = selectAVX2(high, r, _mm256_mul_pd(two, s));
+            r = selectAVX2(low, r, _mm256_sub_pd(_mm256_set1_pd(PI), _mm256_mul_pd(two, s)));
+            _mm256_storeu_pd(out+i, r);
+        }
+        acosScalar(in, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void sqrtAVX2(const double* in, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+            _mm256_storeu_pd(out+i, _mm256_sqrt_pd(_mm256_loadu_pd(in+i)));
+        sqrtScalar(in, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx2") void rsqrtAVX2(const double* in, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+4<=count; i+=4)
+            _mm256_storeu_pd(out+i, _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(_mm256_loadu_pd(in+i))));
+        rsqrtScalar(in, out, i, count);
+    }
+
+    /*------ AVX-512 ------*/
+    // Only the kernels that benefit from the wider registers, the others use the AVX2 versions.
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void multiplyAVX512(const double* a, const double* b, double* out)
+    {
+        // every row of b repeated in both halves
+        __m512d b01 = _mm512_loadu_pd(b);
+        __m512d b23 = _mm512_loadu_pd(b+8);
+        __m512i low = _mm512_set_epi64(3, 2, 1, 0, 3, 2, 1, 0);
+        __m512i high = _mm512_set_epi64(7, 6, 5, 4, 7, 6, 5, 4);
+        __m512d b0 = _mm512_permutex2var_pd(b01, low, b01);
+        __m512d b1 = _mm512_permutex2var_pd(b01, high, b01);
+        __m512d b2 = _mm512_permutex2var_pd(b23, low, b23);
+        __m512d b3 = _mm512_permutex2var_pd(b23, high, b23);
+
+        for (int i=0; i<16; i+=8)
+        {
+            // rows i/4 and i/4+1 of a, each element broadcast in its half
+            __m512d rows = _mm512_loadu_pd(a+i);
+            __m512d a0 = _mm512_permutex2var_pd(rows, _mm512_set_epi64(4, 4, 4, 4, 0, 0, 0, 0), rows);
+            __m512d a1 = _mm512_permutex2var_pd(rows, _mm512_set_epi64(5, 5, 5, 5, 1, 1, 1, 1), rows);
+            __m512d a2 = _mm512_permutex2var_pd(rows, _mm512_set_epi64(6, 6, 6, 6, 2, 2, 2, 2), rows);
+            __m512d a3 = _mm512_permutex2var_pd(rows, _mm512_set_epi64(7, 7, 7, 7, 3, 3, 3, 3), rows);
+
+            __m512d r = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(
+                _mm512_mul_pd(a0, b0), _mm512_mul_pd(a1, b1)), _mm512_mul_pd(a2, b2)), _mm512_mul_pd(a3, b3));
+            _mm512_storeu_pd(out+i, r);
+        }
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void transformPointsAVX512(const double* m, const double* inX, const double* inY, const double* inZ,
+                                                                    double* outX, double* outY, double* outZ, size_t count)
+    {
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            __m512d x = _mm512_loadu_pd(inX+i);
+            __m512d y = _mm512_loadu_pd(inY+i);
+            __m512d z = _mm512_loadu_pd(inZ+i);
+
+            for (int c=0; c<3; c++)
+            {
+                __m512d r = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(
+                    _mm512_mul_pd(_mm512_set1_pd(m[c]), x), _mm512_mul_pd(_mm512_set1_pd(m[4+c]), y)),
+                    _mm512_mul_pd(_mm512_set1_pd(m[8+c]), z)), _mm512_set1_pd(m[12+c]));
+                _mm512_storeu_pd((c == 0 ? outX : (c == 1 ? outY : outZ)) + i, r);
+            }
+        }
+        transformPointsAVX2(m, inX+i, inY+i, inZ+i, outX+i, outY+i, outZ+i, count-i);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void rotateVectorsAVX512(const QuaternionSoa& q, const Vector3Soa& v,
+                                                                  const Vector3Soa& out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            __m512d qx = _mm512_loadu_pd(q.x+i), qy = _mm512_loadu_pd(q.y+i);
+            __m512d qz = _mm512_loadu_pd(q.z+i), qw = _mm512_loadu_pd(q.w+i);
+            __m512d vx = _mm512_loadu_pd(v.x+i), vy = _mm512_loadu_pd(v.y+i), vz = _mm512_loadu_pd(v.z+i);
+
+            __m512d tx = _mm512_sub_pd(_mm512_mul_pd(qy, vz), _mm512_mul_pd(qz, vy));
+            __m512d ty = _mm512_sub_pd(_mm512_mul_pd(qz, vx), _mm512_mul_pd(qx, vz));
+            __m512d tz = _mm512_sub_pd(_mm512_mul_pd(qx, vy), _mm512_mul_pd(qy, vx));
+            tx = _mm512_add_pd(tx, tx);
+            ty = _mm512_add_pd(ty, ty);
+            tz = _mm512_add_pd(tz, tz);
+
+            _mm512_storeu_pd(out.x+i, _mm512_add_pd(_mm512_add_pd(vx, _mm512_mul_pd(qw, tx)),
+                                                    _mm512_sub_pd(_mm512_mul_pd(qy, tz), _mm512_mul_pd(qz, ty))));
+            _mm512_storeu_pd(out.y+i, _mm512_add_pd(_mm512_add_pd(vy, _mm512_mul_pd(qw, ty)),
+                                                    _mm512_sub_pd(_mm512_mul_pd(qz, tx), _mm512_mul_pd(qx, tz))));
+            _mm512_storeu_pd(out.z+i, _mm512_add_pd(_mm512_add_pd(vz, _mm512_mul_pd(qw, tz)),
+                                                    _mm512_sub_pd(_mm512_mul_pd(qx, ty), _mm512_mul_pd(qy, tx))));
+        }
+        rotateVectorsScalar(q, v, out, i, count);
+    }
+
+    /*------ AVX-512, math functions ------*/
+    // The same operations as the AVX2 versions, the signs are changed with integer operations (AVX-512F has no xor_pd).
+    // floor, sqrt, min and max use the masked forms with a full mask, the plain ones give false
+    // "used uninitialized" warnings with gcc 12.
+
+    GMATH_INLINE GMATH_TARGET("avx512f") __m512d floorAVX512(__m512d x)
+    {
+        return _mm512_mask_roundscale_pd(x, 0xFF, x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") __m512d squareRootAVX512(__m512d x)
+    {
+        return _mm512_mask_sqrt_pd(x, 0xFF, x);
+    }
+
+    // x with its sign flipped where mask is set
+    GMATH_INLINE GMATH_TARGET("avx512f") __m512d negateAVX512(__mmask8 mask, __m512d x)
+    {
+        __m512i bits = _mm512_castpd_si512(x);
+        return _mm512_castsi512_pd(_mm512_mask_xor_epi64(bits, mask, bits, _mm512_set1_epi64(0x8000000000000000LL)));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") __mmask8 signBitsAVX512(__m512d x)
+    {
+        return _mm512_test_epi64_mask(_mm512_castpd_si512(x), _mm512_set1_epi64(0x8000000000000000LL));
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void sinCosAVX512(const double* in, double* outSin, double* outCos, size_t count)
+    {
+        using namespace math;
+        const __m512d one = _mm512_set1_pd(1.0), half = _mm512_set1_pd(0.5);
+
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            __m512d x = _mm512_loadu_pd(in+i);
+            if (_mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(SINCOS_LIMIT), _CMP_LE_OQ) != 0xFF)
+            {
+                sinCosScalar(in, outSin, outCos, i, i+8);
+                continue;
+            }
+
+            __m512d n = floorAVX512(_mm512_add_pd(_mm512_mul_pd(x, _mm512_set1_pd(TWO_OVER_PI)), half));
+            __m512d r = _mm512_sub_pd(_mm512_sub_pd(_mm512_sub_pd(x,
+                _mm512_mul_pd(n, _mm512_set1_pd(PIO2_1))), _mm512_mul_pd(n, _mm512_set1_pd(PIO2_2))), _mm512_mul_pd(n, _mm512_set1_pd(PIO2_3)));
+            __m512d z = _mm512_mul_pd(r, r);
+
+            __m512d ps = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(S6), z), _mm512_set1_pd(S5));
+            ps = _mm512_add_pd(_mm512_mul_pd(ps, z), _mm512_set1_pd(S4));
+            ps = _mm512_add_pd(_mm512_mul_pd(ps, z), _mm512_set1_pd(S3));
+            ps = _mm512_add_pd(_mm512_mul_pd(ps, z), _mm512_set1_pd(S2));
+            ps = _mm512_add_pd(_mm512_mul_pd(ps, z), _mm512_set1_pd(S1));
+            __m512d pc = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(C6), z), _mm512_set1_pd(C5));
+            pc = _mm512_add_pd(_mm512_mul_pd(pc, z), _mm512_set1_pd(C4));
+            pc = _mm512_add_pd(_mm512_mul_pd(pc, z), _mm512_set1_pd(C3));
+            pc = _mm512_add_pd(_mm512_mul_pd(pc, z), _mm512_set1_pd(C2));
+            pc = _mm512_add_pd(_mm512_mul_pd(pc, z), _mm512_set1_pd(C1));
+
+            __m512d sinR = _mm512_add_pd(r, _mm512_mul_pd(_mm512_mul_pd(z, r), ps));
+            __m512d hz = _mm512_mul_pd(half, z);
+            __m512d w = _mm512_sub_pd(one, hz);
+            __m512d cosR = _mm512_add_pd(w, _mm512_add_pd(_mm512_sub_pd(_mm512_sub_pd(one, w), hz), _mm512_mul_pd(_mm512_mul_pd(z, z), pc)));
+
+            __m512d q = _mm512_sub_pd(n, _mm512_mul_pd(_mm512_set1_pd(4.0), floorAVX512(_mm512_mul_pd(n, _mm512_set1_pd(0.25)))));
+            __mmask8 q1 = _mm512_cmp_pd_mask(q, one, _CMP_EQ_OQ);
+            __mmask8 q2 = _mm512_cmp_pd_mask(q, _mm512_set1_pd(2.0), _CMP_EQ_OQ);
+            __mmask8 odd = q1 | _mm512_cmp_pd_mask(q, _mm512_set1_pd(3.0), _CMP_EQ_OQ);
+            __m512d s = _mm512_mask_blend_pd(odd, sinR, cosR);
+            __m512d c = _mm512_mask_blend_pd(odd, cosR, sinR);
+            s = negateAVX512(_mm512_cmp_pd_mask(q, _mm512_set1_pd(2.0), _CMP_GE_OQ), s);
+            _mm512_storeu_pd(outSin+i, _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OQ), s, x));
+            _mm512_storeu_pd(outCos+i, negateAVX512(q1 | q2, c));
+        }
+        sinCosScalar(in, outSin, outCos, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void atan2AVX512(const double* y, const double* x, double* out, size_t count)
+    {
+        using namespace math;
+        const __m512d one = _mm512_set1_pd(1.0);
+        const __m512d largest = _mm512_set1_pd(DBL_MAX);
+
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            __m512d vx = _mm512_loadu_pd(x+i), vy = _mm512_loadu_pd(y+i);
+            __m512d ax = _mm512_abs_pd(vx), ay = _mm512_abs_pd(vy);
+            __mmask8 finite = _mm512_cmp_pd_mask(ax, largest, _CMP_LE_OQ) & _mm512_cmp_pd_mask(ay, largest, _CMP_LE_OQ);
+            if (finite != 0xFF)
+            {
+                atan2Scalar(y, x, out, i, i+8);
+                continue;
+            }
+
+            __mmask8 steep = _mm512_cmp_pd_mask(ax, ay, _CMP_LT_OQ);
+            __m512d low = _mm512_mask_blend_pd(steep, ay, ax);
+            __m512d high = _mm512_mask_blend_pd(steep, ax, ay);
+            __m512d a = _mm512_maskz_div_pd(_mm512_cmp_pd_mask(high, _mm512_setzero_pd(), _CMP_GT_OQ), low, high);
+            __mmask8 far = _mm512_cmp_pd_mask(a, _mm512_set1_pd(0.66), _CMP_GT_OQ);
+            __m512d t = _mm512_mask_blend_pd(far, a, _mm512_div_pd(_mm512_sub_pd(a, one), _mm512_add_pd(a, one)));
+
+            __m512d z = _mm512_mul_pd(t, t);
+            __m512d p = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(AT_P0), z), _mm512_set1_pd(AT_P1));
+            p = _mm512_add_pd(_mm512_mul_pd(p, z), _mm512_set1_pd(AT_P2));
+            p = _mm512_add_pd(_mm512_mul_pd(p, z), _mm512_set1_pd(AT_P3));
+            p = _mm512_add_pd(_mm512_mul_pd(p, z), _mm512_set1_pd(AT_P4));
+            __m512d q = _mm512_add_pd(z, _mm512_set1_pd(AT_Q0));
+            q = _mm512_add_pd(_mm512_mul_pd(q, z), _mm512_set1_pd(AT_Q1));
+            q = _mm512_add_pd(_mm512_mul_pd(q, z), _mm512_set1_pd(AT_Q2));
+            q = _mm512_add_pd(_mm512_mul_pd(q, z), _mm512_set1_pd(AT_Q3));
+            q = _mm512_add_pd(_mm512_mul_pd(q, z), _mm512_set1_pd(AT_Q4));
+            __m512d r = _mm512_add_pd(_mm512_mul_pd(t, _mm512_div_pd(_mm512_mul_pd(z, p), q)), t);
+            r = _mm512_mask_blend_pd(far, r, _mm512_add_pd(_mm512_set1_pd(PIO4), _mm512_add_pd(r, _mm512_set1_pd(0.5*MOREBITS))));
+
+            r = _mm512_mask_blend_pd(steep, r, _mm512_add_pd(_mm512_sub_pd(_mm512_set1_pd(PIO2), r), _mm512_set1_pd(MOREBITS)));
+            r = _mm512_mask_blend_pd(signBitsAVX512(vx), r, _mm512_add_pd(_mm512_sub_pd(_mm512_set1_pd(PI), r), _mm512_set1_pd(2.0*MOREBITS)));
+            _mm512_storeu_pd(out+i, negateAVX512(signBitsAVX512(vy), r));
+        }
+        atan2Scalar(y, x, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") __m512d asinUnitAVX512(__m512d x)
+    {
+        using namespace math;
+        __m512d a = _mm512_abs_pd(x);
+
+        // a > 0.625
+        __m512d zz = _mm512_sub_pd(_mm512_set1_pd(1.0), a);
+        __m512d pr = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(AS_R0), zz), _mm512_set1_pd(AS_R1));
+        pr = _mm512_add_pd(_mm512_mul_pd(pr, zz), _mm512_set1_pd(AS_R2));
+        pr = _mm512_add_pd(_mm512_mul_pd(pr, zz), _mm512_set1_pd(AS_R3));
+        pr = _mm512_add_pd(_mm512_mul_pd(pr, zz), _mm512_set1_pd(AS_R4));
+        __m512d qs = _mm512_add_pd(zz, _mm512_set1_pd(AS_S0));
+        qs = _mm512_add_pd(_mm512_mul_pd(qs, zz), _mm512_set1_pd(AS_S1));
+        qs = _mm512_add_pd(_mm512_mul_pd(qs, zz), _mm512_set1_pd(AS_S2));
+        qs = _mm512_add_pd(_mm512_mul_pd(qs, zz), _mm512_set1_pd(AS_S3));
+        __m512d p = _mm512_div_pd(_mm512_mul_pd(zz, pr), qs);
+        zz = squareRootAVX512(_mm512_add_pd(zz, zz));
+        __m512d z = _mm512_sub_pd(_mm512_set1_pd(PIO4), zz);
+        zz = _mm512_sub_pd(_mm512_mul_pd(zz, p), _mm512_set1_pd(MOREBITS));
+        z = _mm512_sub_pd(z, zz);
+        __m512d large = _mm512_add_pd(z, _mm512_set1_pd(PIO4));
+
+        // a <= 0.625
+        zz = _mm512_mul_pd(a, a);
+        __m512d pp = _mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(AS_P0), zz), _mm512_set1_pd(AS_P1));
+        pp = _mm512_add_pd(_mm512_mul_pd(pp, zz), _mm512_set1_pd(AS_P2));
+        pp = _mm512_add_pd(_mm512_mul_pd(pp, zz), _mm512_set1_pd(AS_P3));
+        pp = _mm512_add_pd(_mm512_mul_pd(pp, zz), _mm512_set1_pd(AS_P4));
+        pp = _mm512_add_pd(_mm512_mul_pd(pp, zz), _mm512_set1_pd(AS_P5));
+        __m512d qq = _mm512_add_pd(zz, _mm512_set1_pd(AS_Q0));
+        qq = _mm512_add_pd(_mm512_mul_pd(qq, zz), _mm512_set1_pd(AS_Q1));
+        qq = _mm512_add_pd(_mm512_mul_pd(qq, zz), _mm512_set1_pd(AS_Q2));
+        qq = _mm512_add_pd(_mm512_mul_pd(qq, zz), _mm512_set1_pd(AS_Q3));
+        qq = _mm512_add_pd(_mm512_mul_pd(qq, zz), _mm512_set1_pd(AS_Q4));
+        z = _mm512_div_pd(_mm512_mul_pd(zz, pp), qq);
+        __m512d small = _mm512_add_pd(_mm512_mul_pd(a, z), a);
+
+        __m512d r = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, _mm512_set1_pd(0.625), _CMP_GT_OQ), small, large);
+        return negateAVX512(signBitsAVX512(x), r);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") __m512d clampUnitAVX512(__m512d x)
+    {
+        __m512d y = _mm512_mask_min_pd(x, 0xFF, _mm512_set1_pd(1.0), x);
+        return _mm512_mask_max_pd(y, 0xFF, _mm512_set1_pd(-1.0), y);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void asinAVX512(const double* in, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+            _mm512_storeu_pd(out+i, asinUnitAVX512(clampUnitAVX512(_mm512_loadu_pd(in+i))));
+        asinScalar(in, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void acosAVX512(const double* in, double* out, size_t count)
+    {
+        using namespace math;
+        const __m512d one = _mm512_set1_pd(1.0), half = _mm512_set1_pd(0.5), two = _mm512_set1_pd(2.0);
+
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+        {
+            __m512d x = clampUnitAVX512(_mm512_loadu_pd(in+i));
+            __mmask8 high = _mm512_cmp_pd_mask(x, half, _CMP_GT_OQ);
+            __mmask8 low = _mm512_cmp_pd_mask(x, _mm512_set1_pd(-0.5), _CMP_LT_OQ);
+
+            __m512d u = _mm512_mask_blend_pd(high, x, squareRootAVX512(_mm512_mul_pd(half, _mm512_sub_pd(one, x))));
+            u = _mm512_mask_blend_pd(low, u, squareRootAVX512(_mm512_mul_pd(half, _mm512_add_pd(one, x))));
+            __m512d s = asinUnitAVX512(u);
+
+            __m512d r = _mm512_add_pd(_mm512_add_pd(_mm512_sub_pd(_mm512_set1_pd(PIO4), s), _mm512_set1_pd(MOREBITS)), _mm512_set1_pd(PIO4));
+            r = _mm512_mask_blend_pd(high, r, _mm512_mul_pd(two, s));
+            r = _mm512_mask_blend_pd(low, r, _mm512_sub_pd(_mm512_set1_pd(PI), _mm512_mul_pd(two, s)));
+            _mm512_storeu_pd(out+i, r);
+        }
+        acosScalar(in, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void sqrtAVX512(const double* in, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+            _mm512_storeu_pd(out+i, squareRootAVX512(_mm512_loadu_pd(in+i)));
+        sqrtScalar(in, out, i, count);
+    }
+
+    GMATH_INLINE GMATH_TARGET("avx512f") void rsqrtAVX512(const double* in, double* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i+8<=count; i+=8)
+            _mm512_storeu_pd(out+i, _mm512_div_pd(_mm512_set1_pd(1.0), squareRootAVX512(_mm512_loadu_pd(in+i))));
+        rsqrtScalar(in, out, i, count);
+    }
+
+#endif // GMATH_SIMD_X86
+
+    /*------ Dispatch ------*/
+
+    struct Table
+    {
+        InstructionSet set;
+        void (*multiply)(const double* a, const double* b, double* out);
+        double (*inverse)(const double* m, double* out);
+        void (*transpose)(const double* m, double* out);
+        void (*multiplyFloat)(const float* a, const float* b, float* out);
+        float (*inverseFloat)(const float* m, float* out);
+        void (*transposeFloat)(const float* m, float* out);
+        void (*transformPoints)(const double* m, const double* in, double* out, size_t count, size_t stride);
+        void (*transformPointsSoA)(const double* m, const double* inX, const double* inY, const double* inZ,
+                                   double* outX, double* outY, double* outZ, size_t count);
+
+        void (*normalizeVectors)(const Vector3Soa& v, size_t count);
+        void (*dotVectors)(const Vector3Soa& a, const Vector3Soa& b, double* out, size_t count);
+        void (*crossVectors)(const Vector3Soa& a, const Vector3Soa& b, const Vector3Soa& out, size_t count);
+        void (*normalizeQuaternions)(const QuaternionSoa& q, size_t count);
+        void (*dotQuaternions)(const QuaternionSoa& a, const QuaternionSoa& b, double* out, size_t count);
+        void (*multiplyQuaternions)(const QuaternionSoa& a, const QuaternionSoa& b, const QuaternionSoa& out, size_t count);
+        void (*rotateVectors)(const QuaternionSoa& q, const Vector3Soa& v, const Vector3Soa& out, size_t count);
+
+        void (*skinVertices)(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                             const double* inNormals, double* outNormals, size_t begin, size_t end);
+        void (*skinVerticesDualQuaternion)(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                           const double* inNormals, double* outNormals, size_t begin, size_t end);
+
+        void (*decomposeAffine)(const Matrix3Soa& m, const QuaternionSoa& ori, const Vector3Soa& sc, const Vector3Soa& shear, size_t count);
+        void (*gramSchmidt)(const Matrix3Soa& m, size_t count);
+        void (*polar)(const Matrix3Soa& m, size_t count);
+
+        size_t (*intersectLines)(const double* p0, const double* p1, const double* normals, const double* points, size_t planeStride,
+                                 double* out, unsigned char* types, size_t count, bool infiniteLine);
+        size_t (*intersectRays)(const double* origins, const double* directions, const double* normals, const double* points,
+                                size_t planeStride, double* out, unsigned char* types, size_t count);
+
+        void (*boundPoints)(const double* m, const double* in, size_t count, size_t stride, double* min, double* max);
+        size_t (*momentsPoints)(const double* in, size_t count, size_t stride, const double* shift, double* sums);
+
+        size_t (*cullSpheres)(const double* planes, const double* centers, const double* radii, size_t count, unsigned char* visible);
+        size_t (*cullBoxes)(const double* planes, const double* boxes, size_t count, size_t stride, unsigned char* visible);
+
+        void (*sinCos)(const double* in, double* outSin, double* outCos, size_t count);
+        void (*atan2)(const double* y, const double* x, double* out, size_t count);
+        void (*asin)(const double* in, double* out, size_t count);
+        void (*acos)(const double* in, double* out, size_t count);
+        void (*sqrt)(const double* in, double* out, size_t count);
+        void (*rsqrt)(const double* in, double* out, size_t count);
+    };
+
+    // the scalar structure of arrays kernels as table entries
+    GMATH_INLINE void normalizeVectorsScalar(const Vector3Soa& v, size_t count)
+    {
+        normalizeVectorsScalar(v, 0, count);
+    }
+
+    GMATH_INLINE void dotVectorsScalar(const Vector3Soa& a, const Vector3Soa& b, double* out, size_t count)
+    {
+        dotVectorsScalar(a, b, out, 0, count);
+    }
+
+    GMATH_INLINE void crossVectorsScalar(const Vector3Soa& a, const Vector3Soa& b, const Vector3Soa& out, size_t count)
+    {
+        crossVectorsScalar(a, b, out, 0, count);
+    }
+
+    GMATH_INLINE void normalizeQuaternionsScalar(const QuaternionSoa& q, size_t count)
+    {
+        normalizeQuaternionsScalar(q, 0, count);
+    }
+
+    GMATH_INLINE void dotQuaternionsScalar(const QuaternionSoa& a, const QuaternionSoa& b, double* out, size_t count)
+    {
+        dotQuaternionsScalar(a, b, out, 0, count);
+    }
+
+    GMATH_INLINE void multiplyQuaternionsScalar(const QuaternionSoa& a, const QuaternionSoa& b, const QuaternionSoa& out, size_t count)
+    {
+        multiplyQuaternionsScalar(a, b, out, 0, count);
+    }
+
+    GMATH_INLINE void rotateVectorsScalar(const QuaternionSoa& q, const Vector3Soa& v, const Vector3Soa& out, size_t count)
+    {
+        rotateVectorsScalar(q, v, out, 0, count);
+    }
+
+    GMATH_INLINE void decomposeAffineScalar(const Matrix3Soa& m, const QuaternionSoa& ori, const Vector3Soa& sc,
+                                            const Vector3Soa& shear, size_t count)
+    {
+        decomposeAffineScalar(m, ori, sc, shear, 0, count);
+    }
+
+    GMATH_INLINE void gramSchmidtScalar(const Matrix3Soa& m, size_t count)
+    {
+        gramSchmidtScalar(m, 0, count);
+    }
+
+    GMATH_INLINE void polarScalar(const Matrix3Soa& m, size_t count)
+    {
+        polarScalar(m, 0, count);
+    }
+
+    GMATH_INLINE size_t intersectLinesPlanesScalar(const double* p0, const double* p1, const double* normals, const double* points,
+                                                   size_t planeStride, double* out, unsigned char* types, size_t count, bool infiniteLine)
+    {
+        return intersectPlanesScalar<false>(p0, p1, normals, points, planeStride, out, types, 0, count, infiniteLine);
+    }
+
+    GMATH_INLINE size_t intersectRaysPlanesScalar(const double* origins, const double* directions, const double* normals, const double* points,
+                                                  size_t planeStride, double* out, unsigned char* types, size_t count)
+    {
+        return intersectPlanesScalar<true>(origins, directions, normals, points, planeStride, out, types, 0, count, false);
+    }
+
+    GMATH_INLINE void sinCosScalar(const double* in, double* outSin, double* outCos, size_t count)
+    {
+        sinCosScalar(in, outSin, outCos, 0, count);
+    }
+
+    GMATH_INLINE void atan2Scalar(const double* y, const double* x, double* out, size_t count)
+    {
+        atan2Scalar(y, x, out, 0, count);
+    }
+
+    GMATH_INLINE void asinScalar(const double* in, double* out, size_t count)
+    {
+        asinScalar(in, out, 0, count);
+    }
+
+    GMATH_INLINE void acosScalar(const double* in, double* out, size_t count)
+    {
+        acosScalar(in, out, 0, count);
+    }
+
+    GMATH_INLINE void sqrtScalar(const double* in, double* out, size_t count)
+    {
+        sqrtScalar(in, out, 0, count);
+    }
+
+    GMATH_INLINE void rsqrtScalar(const double* in, double* out, size_t count)
+    {
+        rsqrtScalar(in, out, 0, count);
+    }
+
+    GMATH_INLINE Table makeTable(InstructionSet set)
+    {
+        Table table = { InstructionSet::SCALAR, multiplyScalar<double>, inverseScalar<double>, transposeScalar<double>,
+                        multiplyScalar<float>, inverseScalar<float>, transposeScalar<float>,
+                        transformPointsScalar, transformPointsScalar,
+                        normalizeVectorsScalar, dotVectorsScalar, crossVectorsScalar,
+                        normalizeQuaternionsScalar, dotQuaternionsScalar, multiplyQuaternionsScalar, rotateVectorsScalar,
+                        skinVerticesScalar, skinVerticesDualQuaternionScalar,
+                        decomposeAffineScalar, gramSchmidtScalar, polarScalar,
+                        intersectLinesPlanesScalar, intersectRaysPlanesScalar,
+                        boundPointsScalar, momentsPointsScalar,
+                        cullSpheresScalar, cullBoxesScalar,
+                        sinCosScalar, atan2Scalar, asinScalar, acosScalar, sqrtScalar, rsqrtScalar };
+    #ifdef GMATH_SIMD_X86
+        switch (set)
+        {
+        case InstructionSet::AVX512:
+            table.set = set;
+            table.multiply = multiplyAVX512;
+            table.multiplyFloat = multiplyFloatAVX2;
+            table.transposeFloat = transposeFloatSSE2;
+            table.inverse = inverseAVX2;
+            table.transpose = transposeAVX2;
+            table.transformPoints = transformPointsAVX2;
+            table.transformPointsSoA = transformPointsAVX512;
+            table.normalizeVectors = normalizeVectorsAVX2;
+            table.dotVectors = dotVectorsAVX2;
+            table.crossVectors = crossVectorsAVX2;
+            table.normalizeQuaternions = normalizeQuaternionsAVX2;
+            table.dotQuaternions = dotQuaternionsAVX2;
+            table.multiplyQuaternions = multiplyQuaternionsAVX2;
+            table.rotateVectors = rotateVectorsAVX512;
+            table.skinVertices = skinVerticesAVX2;
+            table.skinVerticesDualQuaternion = skinVerticesDualQuaternionAVX2;
+            table.decomposeAffine = decomposeAffineAVX2;
+            table.gramSchmidt = gramSchmidtAVX2;
+            table.polar = polarAVX2;
+            table.intersectLines = intersectLinesPlanesAVX2;
+            table.intersectRays = intersectRaysPlanesAVX2;
+            table.boundPoints = boundPointsAVX2;
+            table.momentsPoints = momentsPointsAVX2;
+            table.cullSpheres = cullSpheresAVX2;
+            table.cullBoxes = cullBoxesAVX2;
+            table.sinCos = sinCosAVX512;
+            table.atan2 = atan2AVX512;
+            table.asin = asinAVX512;
+            table.acos = acosAVX512;
+            table.sqrt = sqrtAVX512;
+            table.rsqrt = rsqrtAVX512;
+            break;
+        case InstructionSet::AVX2:
+            table.set = set;
+            table.multiply = multiplyAVX2;
+            table.multiplyFloat = multiplyFloatAVX2;
+            table.transposeFloat = transposeFloatSSE2;
+            table.inverse = inverseAVX2;
+            table.transpose = transposeAVX2;
+            table.transformPoints = transformPointsAVX2;
+            table.transformPointsSoA = transformPointsAVX2;
+            table.normalizeVectors = normalizeVectorsAVX2;
+            table.dotVectors = dotVectorsAVX2;
+            table.crossVectors = crossVectorsAVX2;
+            table.normalizeQuaternions = normalizeQuaternionsAVX2;
+            table.dotQuaternions = dotQuaternionsAVX2;
+            table.multiplyQuaternions = multiplyQuaternionsAVX2;
+            table.rotateVectors = rotateVectorsAVX2;
+            table.skinVertices = skinVerticesAVX2;
+            table.skinVerticesDualQuaternion = skinVerticesDualQuaternionAVX2;
+            table.decomposeAffine = decomposeAffineAVX2;
+            table.gramSchmidt = gramSchmidtAVX2;
+            table.polar = polarAVX2;
+            table.intersectLines = intersectLinesPlanesAVX2;
+            table.intersectRays = intersectRaysPlanesAVX2;
+            table.boundPoints = boundPointsAVX2;
+            table.momentsPoints = momentsPointsAVX2;
+            table.cullSpheres = cullSpheresAVX2;
+            table.cullBoxes = cullBoxesAVX2;
+            table.sinCos = sinCosAVX2;
+            table.atan2 = atan2AVX2;
+            table.asin = asinAVX2;
+            table.acos = acosAVX2;
+            table.sqrt = sqrtAVX2;
+            table.rsqrt = rsqrtAVX2;
+            break;
+        case InstructionSet::SSE2:
+            table.set = set;
+            table.multiply = multiplySSE2;
+            table.multiplyFloat = multiplyFloatSSE2;
+            table.transposeFloat = transposeFloatSSE2;
+            table.inverse = inverseSSE2;
+            table.transpose = transposeSSE2;
+            table.transformPoints = transformPointsSSE2;
+            table.transformPointsSoA = transformPointsSSE2;
+            break;
+        default:
+            break;
+        }
+    #else
+        (void)set;
+    #endif
+        return table;
+    }
+
+    GMATH_INLINE Table& activeTable()
+    {
+        static Table table = makeTable(detectInstructionSet());
+        return table;
+    }
+}
+
+    /*------ Instruction set ------*/
+
+    GMATH_INLINE InstructionSet detectInstructionSet()
+    {
+    #if defined(GMATH_SIMD_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1<<26)) != 0;
+        bool osxsave = (info[2] & (1<<27)) != 0;
+        bool avx = (info[2] & (1<<28)) != 0;
+
+        bool avx2 = false, avx512 = false;
+        if (maxLeaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1<<5)) != 0;
+            avx512 = (info[1] & (1<<16)) != 0;
+        }
+
+        // the operating system must save the ymm (and zmm) registers
+        unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        bool ymmState = (xcr0 & 0x06) == 0x06;
+        bool zmmState = (xcr0 & 0xe6) == 0xe6;
+
+        if (avx512 && zmmState)
+            return InstructionSet::AVX512;
+        if (avx && avx2 && ymmState)
+            return InstructionSet::AVX2;
+        if (sse2)
+            return InstructionSet::SSE2;
+        return InstructionSet::SCALAR;
+
+    #elif defined(GMATH_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return InstructionSet::AVX512;
+        if (__builtin_cpu_supports("avx2"))
+            return InstructionSet::AVX2;
+        if (__builtin_cpu_supports("sse2"))
+            return InstructionSet::SSE2;
+        return InstructionSet::SCALAR;
+
+    #else
+        return InstructionSet::SCALAR;
+    #endif
+    }
+
+    GMATH_INLINE InstructionSet getInstructionSet()
+    {
+        return kernels::activeTable().set;
+    }
+
+    GMATH_INLINE InstructionSet setInstructionSet(InstructionSet set)
+    {
+        InstructionSet supported = detectInstructionSet();
+        if (static_cast<int>(set) > static_cast<int>(supported))
+            set = supported;
+
+        kernels::activeTable() = kernels::makeTable(set);
+        return set;
+    }
+
+    GMATH_INLINE const char* instructionSetName(InstructionSet set)
+    {
+        switch (set)
+        {
+        case InstructionSet::SSE2:   return "SSE2";
+        case InstructionSet::AVX2:   return "AVX2";
+        case InstructionSet::AVX512: return "AVX-512";
+        default:                     return "scalar";
+        }
+    }
+
+    /*------ Kernels ------*/
+
+    GMATH_INLINE void multiply4x4(const double* a, const double* b, double* out)
+    {
+        kernels::activeTable().multiply(a, b, out);
+    }
+
+    GMATH_INLINE double inverse4x4(const double* m, double* out)
+    {
+        return kernels::activeTable().inverse(m, out);
+    }
+
+    GMATH_INLINE void transpose4x4(const double* m, double* out)
+    {
+        kernels::activeTable().transpose(m, out);
+    }
+
+    GMATH_INLINE void multiply4x4(const float* a, const float* b, float* out)
+    {
+        kernels::activeTable().multiplyFloat(a, b, out);
+    }
+
+    GMATH_INLINE float inverse4x4(const float* m, float* out)
+    {
+        return kernels::activeTable().inverseFloat(m, out);
+    }
+
+    GMATH_INLINE void transpose4x4(const float* m, float* out)
+    {
+        kernels::activeTable().transposeFloat(m, out);
+    }
+
+    GMATH_INLINE void transformPoints4x4(const double* m, const double* in, double* out, size_t count, size_t stride)
+    {
+        kernels::activeTable().transformPoints(m, in, out, count, stride);
+    }
+
+    GMATH_INLINE void transformPoints4x4(const double* m, const double* inX, const double* inY, const double* inZ,
+                                         double* outX, double* outY, double* outZ, size_t count)
+    {
+        kernels::activeTable().transformPointsSoA(m, inX, inY, inZ, outX, outY, outZ, count);
+    }
+
+    /*------ Skinning ------*/
+
+    GMATH_INLINE void skinVertices(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                   const double* inNormals, double* outNormals, size_t begin, size_t end)
+    {
+        kernels::activeTable().skinVertices(skin, inPoints, outPoints, inNormals, outNormals, begin, end);
+    }
+
+    GMATH_INLINE void skinVerticesDualQuaternion(const SkinInfluences& skin, const double* inPoints, double* outPoints,
+                                                 const double* inNormals, double* outNormals, size_t begin, size_t end)
+    {
+        kernels::activeTable().skinVerticesDualQuaternion(skin, inPoints, outPoints, inNormals, outNormals, begin, end);
+    }
+
+    /*------ Math functions ------*/
+
+    GMATH_INLINE void batchSinCos(const double* angles, double* outSin, double* outCos, size_t count)
+    {
+        kernels::activeTable().sinCos(angles, outSin, outCos, count);
+    }
+
+    GMATH_INLINE void batchAtan2(const double* y, const double* x, double* out, size_t count)
+    {
+        kernels::activeTable().atan2(y, x, out, count);
+    }
+
+    GMATH_INLINE void batchAsin(const double* in, double* out, size_t count)
+    {
+        kernels::activeTable().asin(in, out, count);
+    }
+
+    GMATH_INLINE void batchAcos(const double* in, double* out, size_t count)
+    {
+        kernels::activeTable().acos(in, out, count);
+    }
+
+    GMATH_INLINE void batchSqrt(const double* in, double* out, size_t count)
+    {
+        kernels::activeTable().sqrt(in, out, count);
+    }
+
+    GMATH_INLINE void batchRsqrt(const double* in, double* out, size_t count)
+    {
+        kernels::activeTable().rsqrt(in, out, count);
+    }
+
+    /*------ Structure of arrays ------*/
+
+    GMATH_INLINE void* alignedAlloc(size_t bytes)
+    {
+        // over allocate, and keep the pointer returned by malloc just before the aligned block
+        void* raw = malloc(bytes + ALIGNMENT + sizeof(void*));
+        if (!raw)
+            throw std::bad_alloc();
+
+        size_t address = reinterpret_cast<size_t>(raw) + sizeof(void*);
+        void* aligned = reinterpret_cast<void*>((address + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+        return aligned;
+    }
+
+    GMATH_INLINE void alignedFree(void* ptr)
+    {
+        if (ptr)
+            free(reinterpret_cast<void**>(ptr)[-1]);
+    }
+
+    GMATH_INLINE SoaStorage::SoaStorage(size_t components, size_t size)
+        : _data(NULL), _components(components), _size(0), _capacity(0)
+    {
+        resize(size);
+    }
+
+    GMATH_INLINE SoaStorage::SoaStorage(const SoaStorage& other)
+        : _data(NULL), _components(other._components), _size(0), _capacity(0)
+    {
+        *this = other;
+    }
+
+    GMATH_INLINE SoaStorage::SoaStorage(SoaStorage&& other)
+        : _data(other._data), _components(other._components), _size(other._size), _capacity(other._capacity)
+    {
+        other._data = NULL;
+        other._size = 0;
+        other._capacity = 0;
+    }
+
+    GMATH_INLINE SoaStorage::~SoaStorage()
+    {
+        alignedFree(_data);
+    }
+
+    GMATH_INLINE SoaStorage& SoaStorage::operator = (const SoaStorage& other)
+    {
+        if (this != &other)
+        {
+            if (_components != other._components || _capacity < other._size)
+            {
+                alignedFree(_data);
+                _data = NULL;
+                _size = _capacity = 0;
+                _components = other._components;
+            }
+            resize(other._size);
+            for (size_t c=0; c<_components && _size>0; c++)
+                memcpy(component(c), other.component(c), _size*sizeof(double));
+        }
+        return *this;
+    }
+
+    GMATH_INLINE SoaStorage& SoaStorage::operator = (SoaStorage&& other)
+    {
+        if (this != &other)
+        {
+            alignedFree(_data);
+            _data = other._data;
+            _components = other._components;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = NULL;
+            other._size = 0;
+            other._capacity = 0;
+        }
+        return *this;
+    }
+
+    GMATH_INLINE size_t SoaStorage::size() const
+    {
+        return _size;
+    }
+
+    GMATH_INLINE void SoaStorage::resize(size_t size)
+    {
+        if (size <= _capacity)
+        {
+            for (size_t c=0; c<_components && size>_size; c++)
+                memset(component(c)+_size, 0, (size-_size)*sizeof(double));
+            _size = size;
+            return;
+        }
+
+        const size_t perLine = ALIGNMENT / sizeof(double);
+        size_t capacity = (size + perLine - 1) / perLine * perLine;
+
+        double* data = static_cast<double*>(alignedAlloc(_components * capacity * sizeof(double)));
+        memset(data, 0, _components * capacity * sizeof(double));
+        for (size_t c=0; c<_components && _size>0; c++)
+            memcpy(data + c*capacity, component(c), _size*sizeof(double));
+
+        alignedFree(_data);
+        _data = data;
+        _size = size;
+        _capacity = capacity;
+    }
+
+    GMATH_INLINE double* SoaStorage::component(size_t i)
+    {
+        return _data + i*_capacity;
+    }
+
+    GMATH_INLINE const double* SoaStorage::component(size_t i) const
+    {
+        return _data + i*_capacity;
+    }
+
+    GMATH_INLINE void normalizeVectors(const Vector3Soa& v, size_t count)
+    {
+        kernels::activeTable().normalizeVectors(v, count);
+    }
+
+    GMATH_INLINE void dotVectors(const Vector3Soa& a, const Vector3Soa& b, double* out, size_t count)
+    {
+        kernels::activeTable().dotVectors(a, b, out, count);
+    }
+
+    GMATH_INLINE void crossVectors(const Vector3Soa& a, const Vector3Soa& b, const Vector3Soa& out, size_t count)
+    {
+        kernels::activeTable().crossVectors(a, b, out, count);
+    }
+
+    GMATH_INLINE void normalizeQuaternions(const QuaternionSoa& q, size_t count)
+    {
+        kernels::activeTable().normalizeQuaternions(q, count);
+    }
+
+    GMATH_INLINE void dotQuaternions(const QuaternionSoa& a, const QuaternionSoa& b, double* out, size_t count)
+    {
+        kernels::activeTable().dotQuaternions(a, b, out, count);
+    }
+
+    GMATH_INLINE void multiplyQuaternions(const QuaternionSoa& a, const QuaternionSoa& b, const QuaternionSoa& out, size_t count)
+    {
+        kernels::activeTable().multiplyQuaternions(a, b, out, count);
+    }
+
+    GMATH_INLINE void rotateVectors(const QuaternionSoa& q, const Vector3Soa& v, const Vector3Soa& out, size_t count)
+    {
+        kernels::activeTable().rotateVectors(q, v, out, count);
+    }
+
+    GMATH_INLINE void decomposeAffine(const Matrix3Soa& m, const QuaternionSoa& ori, const Vector3Soa& sc, const Vector3Soa& shear, size_t count)
+    {
+        kernels::activeTable().decomposeAffine(m, ori, sc, shear, count);
+    }
+
+    GMATH_INLINE void orthonormalizeGramSchmidt(const Matrix3Soa& m, size_t count)
+    {
+        kernels::activeTable().gramSchmidt(m, count);
+    }
+
+    GMATH_INLINE void orthonormalizePolar(const Matrix3Soa& m, size_t count)
+    {
+        kernels::activeTable().polar(m, count);
+    }
+
+    /*------ Intersections ------*/
+
+    GMATH_INLINE size_t intersectLinesPlanes(const double* p0, const double* p1, const double* normals, const double* points, size_t planeStride,
+                                             double* out, unsigned char* types, size_t count, bool infiniteLine)
+    {
+        return kernels::activeTable().intersectLines(p0, p1, normals, points, planeStride, out, types, count, infiniteLine);
+    }
+
+    GMATH_INLINE size_t intersectRaysPlanes(const double* origins, const double* directions, const double* normals, const double* points,
+                                            size_t planeStride, double* out, unsigned char* types, size_t count)
+    {
+        return kernels::activeTable().intersectRays(origins, directions, normals, points, planeStride, out, types, count);
+    }
+
+    /*------ Bounds ------*/
+
+    GMATH_INLINE void boundPoints(const double* m, const double* in, size_t count, size_t stride, double* min, double* max)
+    {
+        kernels::activeTable().boundPoints(m, in, count, stride, min, max);
+    }
+
+    GMATH_INLINE size_t momentsPoints(const double* in, size_t count, size_t stride, const double* shift, double* sums)
+    {
+        return kernels::activeTable().momentsPoints(in, count, stride, shift, sums);
+    }
+
+    /*------ Culling ------*/
+
+    GMATH_INLINE size_t cullSpheres(const double* planes, const double* centers, const double* radii, size_t count, unsigned char* visible)
+    {
+        return kernels::activeTable().cullSpheres(planes, centers, radii, count, visible);
+    }
+
+    GMATH_INLINE size_t cullBoxes(const double* planes, const double* boxes, size_t count, size_t stride, unsigned char* visible)
+    {
+        return kernels::activeTable().cullBoxes(planes, boxes, count, stride, visible);
+    }
+}
+}
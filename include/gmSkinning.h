@@ -0,0 +1,181 @@
+#pragma once
+#define GMATH_SKINNING_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmParallel.h"
+#include "gmSimd.h"
+#include "gmMatrix4.h"
+#include "gmXfo.h"
+#include "gmDualQuaternion.h"
+
+namespace gmath
+{
+    /**
+    What binds a mesh to a skeleton, shared by the skinners.
+
+    The bind pose is the inverse of the global matrix of every joint when the mesh was bound.
+    The influences of the vertices are stored in compressed rows: the influences of vertex v
+    are the entries offsets[v] to offsets[v+1]-1 of joints and weights, so offsets has one more
+    item than there are vertices, starts at 0 and ends at the number of influences.
+    */
+    class SkinBinding
+    {
+    protected:
+        std::vector<Matrix4> _bindInverses;
+        std::vector<size_t> _offsets;
+        std::vector<unsigned int> _joints;
+        std::vector<double> _weights;
+
+        /** The influences over the palette of the skinner. */
+        simd::SkinInfluences influences(const std::vector<double>& palette) const;
+
+        /** Run the simd kernel over the vertices, in chunks on the gmath::parallel threads. */
+        void skinVertices(void (*kernel)(const simd::SkinInfluences&, const double*, double*, const double*, double*, size_t, size_t),
+                          const std::vector<double>& palette,
+                          const double* inPoints, double* outPoints, const double* inNormals, double* outNormals) const;
+
+    public:
+        /*------ constructors ------*/
+        SkinBinding();
+
+        /** Throws GMathError if the influences don't match, see setInfluences. */
+        SkinBinding(const std::vector<Matrix4>& bindInverses,
+                    const std::vector<size_t>& offsets,
+                    const std::vector<unsigned int>& joints,
+                    const std::vector<double>& weights);
+
+        /*------ setup ------*/
+
+        /** Throws GMathError if offsets doesn't start at 0, decreases, doesn't end at the size of joints and weights,
+            or if a joint has no bind inverse. */
+        void setInfluences(const std::vector<size_t>& offsets,
+                           const std::vector<unsigned int>& joints,
+                           const std::vector<double>& weights);
+
+        /** Scale the weights of every vertex so they sum to 1, a vertex whose weights sum to 0 is left alone. */
+        void normalizeWeights();
+
+        size_t getJointCount() const;
+        size_t getVertexCount() const;
+        size_t getInfluenceCount() const;
+
+        const std::vector<Matrix4>& getBindInverses() const;
+        const std::vector<size_t>& getOffsets() const;
+        const std::vector<unsigned int>& getJoints() const;
+        const std::vector<double>& getWeights() const;
+
+        /** Vertices per chunk of work given to a thread, the meshes smaller than two chunks are skinned serially. */
+        static const size_t PARALLEL_GRAIN = 1024;
+    };
+
+    /**
+    Linear blend skinning of a mesh by a skeleton.
+
+    Every frame, setPose multiplies the bind pose by the global transforms of the joints once
+    (the palette), then skin moves the vertices by the weighted sum of the palette matrices of
+    their influences. The vertices are split in chunks evaluated in parallel on the gmath::parallel
+    threads, each chunk goes through the simd::skinVertices kernel.
+
+    Points and normals are packed x, y, z triplets, the output may be the input.
+    As everywhere in GMath the skinned point is point * bindInverse * global.
+    */
+    class LinearBlendSkinner : public SkinBinding
+    {
+    private:
+        std::vector<double> _palette;
+
+    public:
+        /*------ constructors ------*/
+        LinearBlendSkinner();
+
+        /** Throws GMathError if the influences don't match, see setInfluences. */
+        LinearBlendSkinner(const std::vector<Matrix4>& bindInverses,
+                           const std::vector<size_t>& offsets,
+                           const std::vector<unsigned int>& joints,
+                           const std::vector<double>& weights);
+
+        /*------ setup ------*/
+
+        /** The inverse of the global matrix of every joint in the bind pose, resets the palette to the bind pose.
+            Throws GMathError if an influence uses a joint past the end. */
+        void setBindInverses(const std::vector<Matrix4>& bindInverses);
+
+        /*------ evaluation ------*/
+
+        /** The palette of the frame: bindInverses[j] * globals[j] for every joint.
+            Throws GMathError if count is not getJointCount(). */
+        void setPose(const Matrix4* globals, size_t count);
+        void setPose(const Xfo* globals, size_t count);
+        void setPose(const std::vector<Matrix4>& globals);
+        void setPose(const std::vector<Xfo>& globals);
+
+        /** The palette matrix of the joint, throws out_of_range past the end. */
+        Matrix4 getPaletteMatrix(size_t joint) const;
+
+        /** Skin getVertexCount() points. */
+        void skin(const double* inPoints, double* outPoints) const;
+
+        /** Skin getVertexCount() points and normals, the normals are transformed by the inverse
+            transpose of the rotation and scale part of the blended matrix and normalized. */
+        void skin(const double* inPoints, double* outPoints, const double* inNormals, double* outNormals) const;
+    };
+
+    /**
+    Dual quaternion skinning of a mesh by a skeleton, the same setup as LinearBlendSkinner.
+
+    setPose splits every palette transform (bindInverses[j] * globals[j]) in a DualQuaternion and
+    a scale. skin blends the dual quaternions of the influences of a vertex (see DualQuaternion::blend)
+    and, linearly, their scales: the vertex is scaled then moved by the blended rigid transform.
+    Rotations keep the volume of the mesh where linear blending collapses it (the candy wrapper
+    of a twisted wrist). The shear of the palette transforms is lost.
+    */
+    class DualQuaternionSkinner : public SkinBinding
+    {
+    private:
+        std::vector<double> _palette;
+
+        void setPaletteEntry(size_t joint, const Matrix4& transform);
+
+    public:
+        /*------ constructors ------*/
+        DualQuaternionSkinner();
+
+        /** Throws GMathError if the influences don't match, see setInfluences. */
+        DualQuaternionSkinner(const std::vector<Matrix4>& bindInverses,
+                              const std::vector<size_t>& offsets,
+                              const std::vector<unsigned int>& joints,
+                              const std::vector<double>& weights);
+
+        /*------ setup ------*/
+
+        /** The inverse of the global matrix of every joint in the bind pose, resets the palette to the bind pose.
+            Throws GMathError if an influence uses a joint past the end. */
+        void setBindInverses(const std::vector<Matrix4>& bindInverses);
+
+        /*------ evaluation ------*/
+
+        /** The palette of the frame from bindInverses[j] * globals[j] for every joint.
+            Throws GMathError if count is not getJointCount(). */
+        void setPose(const Matrix4* globals, size_t count);
+        void setPose(const Xfo* globals, size_t count);
+        void setPose(const std::vector<Matrix4>& globals);
+        void setPose(const std::vector<Xfo>& globals);
+
+        /** The rigid part of the palette transform of the joint, throws out_of_range past the end. */
+        DualQuaternion getPaletteDualQuaternion(size_t joint) const;
+        /** The scale of the palette transform of the joint, throws out_of_range past the end. */
+        Vector3 getPaletteScale(size_t joint) const;
+
+        /** Skin getVertexCount() points. */
+        void skin(const double* inPoints, double* outPoints) const;
+
+        /** Skin getVertexCount() points and normals, the normals are normalized. */
+        void skin(const double* inPoints, double* outPoints, const double* inNormals, double* outNormals) const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_SKINNING_END
+    #include "gmInline.h"
+#endif
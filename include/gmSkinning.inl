@@ -0,0 +1,289 @@
+#include <string.h>
+
+namespace gmath
+{
+    /*------ SkinBinding ------*/
+
+    GMATH_INLINE SkinBinding::SkinBinding()
+        : _offsets(1, 0)
+    {
+    }
+
+    GMATH_INLINE SkinBinding::SkinBinding(const std::vector<Matrix4>& bindInverses,
+                                          const std::vector<size_t>& offsets,
+                                          const std::vector<unsigned int>& joints,
+                                          const std::vector<double>& weights)
+        : _bindInverses(bindInverses), _offsets(1, 0)
+    {
+        setInfluences(offsets, joints, weights);
+    }
+
+    GMATH_INLINE void SkinBinding::setInfluences(const std::vector<size_t>& offsets,
+                                                 const std::vector<unsigned int>& joints,
+                                                 const std::vector<double>& weights)
+    {
+        if (offsets.empty() || offsets[0] != 0)
+            throw GMathError("SkinBinding.setInfluences: offsets must start at 0");
+        for (size_t v=1; v<offsets.size(); v++)
+        {
+            if (offsets[v] < offsets[v-1])
+                throw GMathError("SkinBinding.setInfluences: offsets must not decrease");
+        }
+        if (offsets.back() != joints.size() || joints.size() != weights.size())
+            throw GMathError("SkinBinding.setInfluences: offsets must end at the number of joints and weights");
+        for (size_t i=0; i<joints.size(); i++)
+        {
+            if (joints[i] >= _bindInverses.size())
+                throw GMathError("SkinBinding.setInfluences: an influence uses a joint without bind inverse");
+        }
+
+        _offsets = offsets;
+        _joints = joints;
+        _weights = weights;
+    }
+
+    GMATH_INLINE void SkinBinding::normalizeWeights()
+    {
+        for (size_t v=0; v+1<_offsets.size(); v++)
+        {
+            double sum = 0.0;
+            for (size_t i=_offsets[v]; i<_offsets[v+1]; i++)
+                sum += _weights[i];
+            if (sum == 0.0)
+                continue;
+            for (size_t i=_offsets[v]; i<_offsets[v+1]; i++)
+                _weights[i] /= sum;
+        }
+    }
+
+    GMATH_INLINE size_t SkinBinding::getJointCount() const
+    {
+        return _bindInverses.size();
+    }
+
+    GMATH_INLINE size_t SkinBinding::getVertexCount() const
+    {
+        return _offsets.size() - 1;
+    }
+
+    GMATH_INLINE size_t SkinBinding::getInfluenceCount() const
+    {
+        return _joints.size();
+    }
+
+    GMATH_INLINE const std::vector<Matrix4>& SkinBinding::getBindInverses() const
+    {
+        return _bindInverses;
+    }
+
+    GMATH_INLINE const std::vector<size_t>& SkinBinding::getOffsets() const
+    {
+        return _offsets;
+    }
+
+    GMATH_INLINE const std::vector<unsigned int>& SkinBinding::getJoints() const
+    {
+        return _joints;
+    }
+
+    GMATH_INLINE const std::vector<double>& SkinBinding::getWeights() const
+    {
+        return _weights;
+    }
+
+    GMATH_INLINE simd::SkinInfluences SkinBinding::influences(const std::vector<double>& palette) const
+    {
+        simd::SkinInfluences skin;
+        skin.palette = palette.empty() ? NULL : &palette[0];
+        skin.offsets = &_offsets[0];
+        skin.joints = _joints.empty() ? NULL : &_joints[0];
+        skin.weights = _weights.empty() ? NULL : &_weights[0];
+        return skin;
+    }
+
+    GMATH_INLINE void SkinBinding::skinVertices(void (*kernel)(const simd::SkinInfluences&, const double*, double*, const double*, double*, size_t, size_t),
+                                                const std::vector<double>& palette,
+                                                const double* inPoints, double* outPoints, const double* inNormals, double* outNormals) const
+    {
+        simd::SkinInfluences skin = influences(palette);
+        size_t count = getVertexCount();
+        if (count < 2*PARALLEL_GRAIN || parallel::getThreadCount() < 2)
+        {
+            kernel(skin, inPoints, outPoints, inNormals, outNormals, 0, count);
+            return;
+        }
+
+        parallel::parallelFor(count, PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            kernel(skin, inPoints, outPoints, inNormals, outNormals, begin, end);
+        });
+    }
+
+    /*------ LinearBlendSkinner ------*/
+
+    GMATH_INLINE LinearBlendSkinner::LinearBlendSkinner()
+    {
+    }
+
+    GMATH_INLINE LinearBlendSkinner::LinearBlendSkinner(const std::vector<Matrix4>& bindInverses,
+                                                        const std::vector<size_t>& offsets,
+                                                        const std::vector<unsigned int>& joints,
+                                                        const std::vector<double>& weights)
+        : SkinBinding(bindInverses, offsets, joints, weights)
+    {
+        setBindInverses(bindInverses);
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::setBindInverses(const std::vector<Matrix4>& bindInverses)
+    {
+        for (size_t i=0; i<_joints.size(); i++)
+        {
+            if (_joints[i] >= bindInverses.size())
+                throw GMathError("LinearBlendSkinner.setBindInverses: an influence uses a joint without bind inverse");
+        }
+
+        _bindInverses = bindInverses;
+        _palette.resize(_bindInverses.size()*16);
+        for (size_t j=0; j<_bindInverses.size(); j++)
+            memcpy(&_palette[j*16], _bindInverses[j].data(), 16*sizeof(double));
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::setPose(const Matrix4* globals, size_t count)
+    {
+        if (count != _bindInverses.size())
+            throw GMathError("LinearBlendSkinner.setPose: the pose must have one transform per joint");
+        for (size_t j=0; j<count; j++)
+            memcpy(&_palette[j*16], (_bindInverses[j] * globals[j]).data(), 16*sizeof(double));
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::setPose(const Xfo* globals, size_t count)
+    {
+        if (count != _bindInverses.size())
+            throw GMathError("LinearBlendSkinner.setPose: the pose must have one transform per joint");
+        for (size_t j=0; j<count; j++)
+            memcpy(&_palette[j*16], (_bindInverses[j] * globals[j].toMatrix4()).data(), 16*sizeof(double));
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::setPose(const std::vector<Matrix4>& globals)
+    {
+        setPose(globals.empty() ? NULL : &globals[0], globals.size());
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::setPose(const std::vector<Xfo>& globals)
+    {
+        setPose(globals.empty() ? NULL : &globals[0], globals.size());
+    }
+
+    GMATH_INLINE Matrix4 LinearBlendSkinner::getPaletteMatrix(size_t joint) const
+    {
+        if (joint >= _bindInverses.size())
+            throw out_of_range("gmath::LinearBlendSkinner - index out of range");
+        return Matrix4(&_palette[joint*16]);
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::skin(const double* inPoints, double* outPoints) const
+    {
+        skinVertices(simd::skinVertices, _palette, inPoints, outPoints, NULL, NULL);
+    }
+
+    GMATH_INLINE void LinearBlendSkinner::skin(const double* inPoints, double* outPoints,
+                                               const double* inNormals, double* outNormals) const
+    {
+        skinVertices(simd::skinVertices, _palette, inPoints, outPoints, inNormals, outNormals);
+    }
+
+    /*------ DualQuaternionSkinner ------*/
+
+    GMATH_INLINE DualQuaternionSkinner::DualQuaternionSkinner()
+    {
+    }
+
+    GMATH_INLINE DualQuaternionSkinner::DualQuaternionSkinner(const std::vector<Matrix4>& bindInverses,
+                                                              const std::vector<size_t>& offsets,
+                                                              const std::vector<unsigned int>& joints,
+                                                              const std::vector<double>& weights)
+        : SkinBinding(bindInverses, offsets, joints, weights)
+    {
+        setBindInverses(bindInverses);
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::setBindInverses(const std::vector<Matrix4>& bindInverses)
+    {
+        for (size_t i=0; i<_joints.size(); i++)
+        {
+            if (_joints[i] >= bindInverses.size())
+                throw GMathError("DualQuaternionSkinner.setBindInverses: an influence uses a joint without bind inverse");
+        }
+
+        _bindInverses = bindInverses;
+        _palette.resize(_bindInverses.size()*12);
+        for (size_t j=0; j<_bindInverses.size(); j++)
+            setPaletteEntry(j, _bindInverses[j]);
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::setPaletteEntry(size_t joint, const Matrix4& transform)
+    {
+        Quaternion ori;
+        Vector3 tr, sc;
+        detail::decomposeRigid(transform, ori, tr, sc);
+        DualQuaternion dq(ori, tr);
+
+        double* entry = &_palette[joint*12];
+        memcpy(entry, dq.qr.data(), 4*sizeof(double));
+        memcpy(entry+4, dq.qd.data(), 4*sizeof(double));
+        memcpy(entry+8, sc.data(), 3*sizeof(double));
+        entry[11] = 0.0;
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::setPose(const Matrix4* globals, size_t count)
+    {
+        if (count != _bindInverses.size())
+            throw GMathError("DualQuaternionSkinner.setPose: the pose must have one transform per joint");
+        for (size_t j=0; j<count; j++)
+            setPaletteEntry(j, _bindInverses[j] * globals[j]);
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::setPose(const Xfo* globals, size_t count)
+    {
+        if (count != _bindInverses.size())
+            throw GMathError("DualQuaternionSkinner.setPose: the pose must have one transform per joint");
+        for (size_t j=0; j<count; j++)
+            setPaletteEntry(j, _bindInverses[j] * globals[j].toMatrix4());
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::setPose(const std::vector<Matrix4>& globals)
+    {
+        setPose(globals.empty() ? NULL : &globals[0], globals.size());
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::setPose(const std::vector<Xfo>& globals)
+    {
+        setPose(globals.empty() ? NULL : &globals[0], globals.size());
+    }
+
+    GMATH_INLINE DualQuaternion DualQuaternionSkinner::getPaletteDualQuaternion(size_t joint) const
+    {
+        if (joint >= _bindInverses.size())
+            throw out_of_range("gmath::DualQuaternionSkinner - index out of range");
+        const double* entry = &_palette[joint*12];
+        return DualQuaternion(Quaternion(entry), Quaternion(entry+4));
+    }
+
+    GMATH_INLINE Vector3 DualQuaternionSkinner::getPaletteScale(size_t joint) const
+    {
+        if (joint >= _bindInverses.size())
+            throw out_of_range("gmath::DualQuaternionSkinner - index out of range");
+        const double* entry = &_palette[joint*12];
+        return Vector3(entry[8], entry[9], entry[10]);
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::skin(const double* inPoints, double* outPoints) const
+    {
+        skinVertices(simd::skinVerticesDualQuaternion, _palette, inPoints, outPoints, NULL, NULL);
+    }
+
+    GMATH_INLINE void DualQuaternionSkinner::skin(const double* inPoints, double* outPoints,
+                                                  const double* inNormals, double* outNormals) const
+    {
+        skinVertices(simd::skinVerticesDualQuaternion, _palette, inPoints, outPoints, inNormals, outNormals);
+    }
+}
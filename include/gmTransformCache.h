@@ -0,0 +1,106 @@
+#pragma once
+#define GMATH_TRANSFORMCACHE_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmTransformHierarchy.h"
+
+namespace gmath
+{
+    /**
+    The local, global and inverse global transforms of a TransformHierarchy,
+    kept up to date incrementally.
+
+    Changing a local transform only marks it dirty, the next update() (or the next
+    request for a global transform) recomputes the globals and the inverses of the dirty
+    transforms and of their descendants, nothing else.
+    So moving one control of a rig costs the size of the subtree under it, not the size of the rig.
+    The counters tell how many transforms the updates actually recomputed.
+
+    T is Xfo or Matrix4. The cache keeps its own copy of the hierarchy, it has to be rebuilt
+    if transforms are added to the original.
+    */
+    template <typename T>
+    class TransformCache
+    {
+    private:
+        TransformHierarchy _hierarchy;
+        bool _cacheInverses;
+
+        std::vector<T> _locals;
+        std::vector<T> _globals;
+        std::vector<T> _inverses;
+
+        std::vector<unsigned char> _dirty;
+        std::vector<size_t> _dirtyList;     // indices flagged in _dirty, unsorted
+        bool _allDirty;
+
+        size_t _lastCount;
+        unsigned long long _totalCount;
+        unsigned long long _updateCount;
+
+        void recompute(size_t index);
+        void updateAll();
+
+    public:
+        /*------ constructors ------*/
+
+        /** Every local transform is the identity and everything is dirty.
+            With cacheInverses false the inverse globals are not computed (and can't be queried). */
+        explicit TransformCache(const TransformHierarchy& hierarchy, bool cacheInverses=true);
+
+        const TransformHierarchy& getHierarchy() const;
+        size_t size() const;
+        bool cachesInverses() const;
+
+        /*------ local transforms ------*/
+
+        const T& getLocal(size_t index) const;
+        /** Mark the transform dirty even if the value didn't change. */
+        void setLocal(size_t index, const T& local);
+        /** Replace all the locals, throws GMathError if locals doesn't have size() items. */
+        void setLocals(const std::vector<T>& locals);
+        const std::vector<T>& getLocals() const;
+
+        void markDirty(size_t index);
+        void markAllDirty();
+        /** True if some global transform is out of date. */
+        bool isDirty() const;
+
+        /*------ global transforms ------*/
+
+        /** Recompute the dirty transforms and their descendants, returns how many transforms were recomputed.
+            When everything is dirty the whole hierarchy is evaluated with TransformHierarchy::computeGlobals.
+            If a composition throws (Xfo with non-uniform scaling) everything is left dirty. */
+        size_t update();
+
+        /** The following getters call update() first if needed. */
+        const T& getGlobal(size_t index);
+        const T& getInverseGlobal(size_t index);
+        const std::vector<T>& getGlobals();
+        const std::vector<T>& getInverseGlobals();
+
+        /*------ counters ------*/
+
+        /** Transforms recomputed by the last update() that had something to do. */
+        size_t getLastRecomputedCount() const;
+        /** Transforms recomputed since the creation of the cache, or since resetCounters(). */
+        unsigned long long getTotalRecomputedCount() const;
+        /** Calls to update() that had something to do. */
+        unsigned long long getUpdateCount() const;
+        void resetCounters();
+    };
+
+    typedef TransformCache<Xfo> XfoCache;
+    typedef TransformCache<Matrix4> Matrix4Cache;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class TransformCache<Xfo>;
+        extern template class TransformCache<Matrix4>;
+    #endif
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_TRANSFORMCACHE_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,238 @@
+#include <algorithm>
+
+namespace gmath
+{
+    /*------ constructors ------*/
+
+    template <typename T>
+    GMATH_INLINE TransformCache<T>::TransformCache(const TransformHierarchy& hierarchy, bool cacheInverses)
+        : _hierarchy(hierarchy), _cacheInverses(cacheInverses),
+          _locals(hierarchy.size()), _globals(hierarchy.size()), _inverses(cacheInverses ? hierarchy.size() : 0),
+          _dirty(hierarchy.size(), 0), _allDirty(true),
+          _lastCount(0), _totalCount(0), _updateCount(0)
+    {
+    }
+
+    template <typename T>
+    GMATH_INLINE const TransformHierarchy& TransformCache<T>::getHierarchy() const
+    {
+        return _hierarchy;
+    }
+
+    template <typename T>
+    GMATH_INLINE size_t TransformCache<T>::size() const
+    {
+        return _locals.size();
+    }
+
+    template <typename T>
+    GMATH_INLINE bool TransformCache<T>::cachesInverses() const
+    {
+        return _cacheInverses;
+    }
+
+    /*------ local transforms ------*/
+
+    template <typename T>
+    GMATH_INLINE const T& TransformCache<T>::getLocal(size_t index) const
+    {
+        if (index >= _locals.size())
+            throw out_of_range("gmath::TransformCache - index out of range");
+        return _locals[index];
+    }
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::setLocal(size_t index, const T& local)
+    {
+        markDirty(index);
+        _locals[index] = local;
+    }
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::setLocals(const std::vector<T>& locals)
+    {
+        if (locals.size() != _locals.size())
+            throw GMathError("TransformCache.setLocals: locals must have one transform per index");
+        _locals = locals;
+        markAllDirty();
+    }
+
+    template <typename T>
+    GMATH_INLINE const std::vector<T>& TransformCache<T>::getLocals() const
+    {
+        return _locals;
+    }
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::markDirty(size_t index)
+    {
+        if (index >= _dirty.size())
+            throw out_of_range("gmath::TransformCache - index out of range");
+        if (_allDirty || _dirty[index])
+            return;
+        _dirty[index] = 1;
+        _dirtyList.push_back(index);
+    }
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::markAllDirty()
+    {
+        for (size_t i=0; i<_dirtyList.size(); i++)
+            _dirty[_dirtyList[i]] = 0;
+        _dirtyList.clear();
+        _allDirty = true;
+    }
+
+    template <typename T>
+    GMATH_INLINE bool TransformCache<T>::isDirty() const
+    {
+        return _allDirty || !_dirtyList.empty();
+    }
+
+    /*------ global transforms ------*/
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::recompute(size_t index)
+    {
+        int parent = _hierarchy.getParents()[index];
+        _globals[index] = parent < 0 ? _locals[index] : _locals[index] * _globals[parent];
+        if (_cacheInverses)
+            _inverses[index] = _globals[index].inverse();
+    }
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::updateAll()
+    {
+        if (_locals.empty())
+            return;
+
+        _hierarchy.computeGlobals(&_locals[0], &_globals[0]);
+        if (_cacheInverses)
+        {
+            parallel::parallelFor(_globals.size(), TransformHierarchy::PARALLEL_GRAIN, [this](size_t begin, size_t end) {
+                for (size_t i=begin; i<end; i++)
+                    _inverses[i] = _globals[i].inverse();
+            });
+        }
+    }
+
+    template <typename T>
+    GMATH_INLINE size_t TransformCache<T>::update()
+    {
+        if (!isDirty())
+            return 0;
+
+        size_t count = 0;
+        try
+        {
+            if (_allDirty)
+            {
+                updateAll();
+                count = _locals.size();
+            }
+            else
+            {
+                // an ancestor always has a smaller index, so in increasing order every dirty transform
+                // is either reached from the subtree of a previous one (and already clean) or the root of a new subtree
+                std::sort(_dirtyList.begin(), _dirtyList.end());
+                std::vector<size_t> stack;
+                for (size_t d=0; d<_dirtyList.size(); d++)
+                {
+                    size_t root = _dirtyList[d];
+                    if (!_dirty[root])
+                        continue;
+
+                    stack.push_back(root);
+                    while (!stack.empty())
+                    {
+                        size_t index = stack.back();
+                        stack.pop_back();
+                        _dirty[index] = 0;
+                        recompute(index);
+                        count++;
+
+                        const std::vector<size_t>& children = _hierarchy.getChildren(index);
+                        stack.insert(stack.end(), children.rbegin(), children.rend());
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            markAllDirty();
+            throw;
+        }
+
+        _dirtyList.clear();
+        _allDirty = false;
+
+        _lastCount = count;
+        _totalCount += count;
+        _updateCount++;
+        return count;
+    }
+
+    template <typename T>
+    GMATH_INLINE const T& TransformCache<T>::getGlobal(size_t index)
+    {
+        if (index >= _globals.size())
+            throw out_of_range("gmath::TransformCache - index out of range");
+        update();
+        return _globals[index];
+    }
+
+    template <typename T>
+    GMATH_INLINE const T& TransformCache<T>::getInverseGlobal(size_t index)
+    {
+        if (!_cacheInverses)
+            throw GMathError("TransformCache.getInverseGlobal: the cache was created without inverses");
+        if (index >= _inverses.size())
+            throw out_of_range("gmath::TransformCache - index out of range");
+        update();
+        return _inverses[index];
+    }
+
+    template <typename T>
+    GMATH_INLINE const std::vector<T>& TransformCache<T>::getGlobals()
+    {
+        update();
+        return _globals;
+    }
+
+    template <typename T>
+    GMATH_INLINE const std::vector<T>& TransformCache<T>::getInverseGlobals()
+    {
+        if (!_cacheInverses)
+            throw GMathError("TransformCache.getInverseGlobals: the cache was created without inverses");
+        update();
+        return _inverses;
+    }
+
+    /*------ counters ------*/
+
+    template <typename T>
+    GMATH_INLINE size_t TransformCache<T>::getLastRecomputedCount() const
+    {
+        return _lastCount;
+    }
+
+    template <typename T>
+    GMATH_INLINE unsigned long long TransformCache<T>::getTotalRecomputedCount() const
+    {
+        return _totalCount;
+    }
+
+    template <typename T>
+    GMATH_INLINE unsigned long long TransformCache<T>::getUpdateCount() const
+    {
+        return _updateCount;
+    }
+
+    template <typename T>
+    GMATH_INLINE void TransformCache<T>::resetCounters()
+    {
+        _lastCount = 0;
+        _totalCount = 0;
+        _updateCount = 0;
+    }
+}
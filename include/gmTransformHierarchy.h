@@ -0,0 +1,77 @@
+#pragma once
+#define GMATH_TRANSFORMHIERARCHY_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmParallel.h"
+#include "gmMatrix4.h"
+#include "gmXfo.h"
+
+namespace gmath
+{
+    /**
+    The topology of a hierarchy of transforms (a skeleton, a rig, a scene...)
+    stored as flat arrays, and the local to global evaluation on top of it.
+
+    Every transform is an index, its parent is a smaller index or -1 for a root,
+    so the parents array is always topologically sorted.
+    The transforms are also grouped by level (their depth from the root): a level only
+    depends on the ones above it, so the transforms of a level are evaluated in parallel
+    on the gmath::parallel threads, one level after the other.
+
+    As everywhere in GMath the global transform of a child is local * parentGlobal.
+    */
+    class TransformHierarchy
+    {
+    private:
+        std::vector<int> _parents;
+        std::vector<size_t> _depths;
+        std::vector< std::vector<size_t> > _children;
+        std::vector< std::vector<size_t> > _levels;
+
+    public:
+        /*------ constructors ------*/
+        TransformHierarchy();
+
+        /** Throws GMathError if a parent is not -1 or a smaller index. */
+        explicit TransformHierarchy(const std::vector<int>& parents);
+
+        /*------ topology ------*/
+
+        /** Add a transform under parent (-1 for a root) and return its index. */
+        size_t addTransform(int parent=-1);
+
+        size_t size() const;
+        int getParent(size_t index) const;
+        const std::vector<int>& getParents() const;
+
+        /** The direct children of the transform, in increasing order. */
+        const std::vector<size_t>& getChildren(size_t index) const;
+
+        /** Depth of the transform, 0 for the roots. */
+        size_t getDepth(size_t index) const;
+
+        size_t getLevelCount() const;
+        /** The indices of the transforms at depth level, in increasing order. */
+        const std::vector<size_t>& getLevel(size_t level) const;
+
+        /*------ evaluation ------*/
+
+        /** globals[i] = locals[i] * globals[parent(i)], both arrays have size() items.
+            Throws GMathError, like Xfo::operator *, if a local Xfo with a parent has non-uniform scaling. */
+        void computeGlobals(const Xfo* locals, Xfo* globals) const;
+        void computeGlobals(const Matrix4* locals, Matrix4* globals) const;
+
+        /** As above, globals is resized to size(). Throws GMathError if locals doesn't have size() items. */
+        void computeGlobals(const std::vector<Xfo>& locals, std::vector<Xfo>& globals) const;
+        void computeGlobals(const std::vector<Matrix4>& locals, std::vector<Matrix4>& globals) const;
+
+        /** Transforms per chunk of work given to a thread, the levels smaller than two chunks are evaluated serially. */
+        static const size_t PARALLEL_GRAIN = 512;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_TRANSFORMHIERARCHY_END
+    #include "gmInline.h"
+#endif
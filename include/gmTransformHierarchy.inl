@@ -0,0 +1,146 @@
+namespace gmath
+{
+    namespace detail
+    {
+        // Evaluate the whole hierarchy: in index order if it fits one chunk, level by level otherwise.
+        template <typename T>
+        GMATH_INLINE void computeGlobalTransforms(const std::vector<int>& parents,
+                                                  const std::vector< std::vector<size_t> >& levels,
+                                                  const T* locals, T* globals)
+        {
+            size_t count = parents.size();
+            if (count < 2*TransformHierarchy::PARALLEL_GRAIN || parallel::getThreadCount() < 2)
+            {
+                // parents come first, so one pass in index order is enough
+                for (size_t i=0; i<count; i++)
+                {
+                    int parent = parents[i];
+                    globals[i] = parent < 0 ? locals[i] : locals[i] * globals[parent];
+                }
+                return;
+            }
+
+            for (size_t l=0; l<levels.size(); l++)
+            {
+                const std::vector<size_t>& level = levels[l];
+                parallel::parallelFor(level.size(), TransformHierarchy::PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+                    for (size_t j=begin; j<end; j++)
+                    {
+                        size_t i = level[j];
+                        int parent = parents[i];
+                        globals[i] = parent < 0 ? locals[i] : locals[i] * globals[parent];
+                    }
+                });
+            }
+        }
+    }
+
+    /*------ constructors ------*/
+
+    GMATH_INLINE TransformHierarchy::TransformHierarchy()
+    {
+    }
+
+    GMATH_INLINE TransformHierarchy::TransformHierarchy(const std::vector<int>& parents)
+    {
+        _parents.reserve(parents.size());
+        _depths.reserve(parents.size());
+        _children.reserve(parents.size());
+        for (size_t i=0; i<parents.size(); i++)
+            addTransform(parents[i]);
+    }
+
+    /*------ topology ------*/
+
+    GMATH_INLINE size_t TransformHierarchy::addTransform(int parent)
+    {
+        size_t index = _parents.size();
+        if (parent < -1 || (parent >= 0 && size_t(parent) >= index))
+            throw GMathError("TransformHierarchy.addTransform: the parent must be -1 or the index of a transform already in the hierarchy");
+
+        size_t depth = parent < 0 ? 0 : _depths[parent] + 1;
+        if (depth == _levels.size())
+            _levels.push_back(std::vector<size_t>());
+
+        _parents.push_back(parent);
+        _depths.push_back(depth);
+        _children.push_back(std::vector<size_t>());
+        if (parent >= 0)
+            _children[parent].push_back(index);
+        _levels[depth].push_back(index);
+        return index;
+    }
+
+    GMATH_INLINE size_t TransformHierarchy::size() const
+    {
+        return _parents.size();
+    }
+
+    GMATH_INLINE int TransformHierarchy::getParent(size_t index) const
+    {
+        if (index >= _parents.size())
+            throw out_of_range("gmath::TransformHierarchy - index out of range");
+        return _parents[index];
+    }
+
+    GMATH_INLINE const std::vector<int>& TransformHierarchy::getParents() const
+    {
+        return _parents;
+    }
+
+    GMATH_INLINE const std::vector<size_t>& TransformHierarchy::getChildren(size_t index) const
+    {
+        if (index >= _children.size())
+            throw out_of_range("gmath::TransformHierarchy - index out of range");
+        return _children[index];
+    }
+
+    GMATH_INLINE size_t TransformHierarchy::getDepth(size_t index) const
+    {
+        if (index >= _depths.size())
+            throw out_of_range("gmath::TransformHierarchy - index out of range");
+        return _depths[index];
+    }
+
+    GMATH_INLINE size_t TransformHierarchy::getLevelCount() const
+    {
+        return _levels.size();
+    }
+
+    GMATH_INLINE const std::vector<size_t>& TransformHierarchy::getLevel(size_t level) const
+    {
+        if (level >= _levels.size())
+            throw out_of_range("gmath::TransformHierarchy - level out of range");
+        return _levels[level];
+    }
+
+    /*------ evaluation ------*/
+
+    GMATH_INLINE void TransformHierarchy::computeGlobals(const Xfo* locals, Xfo* globals) const
+    {
+        detail::computeGlobalTransforms(_parents, _levels, locals, globals);
+    }
+
+    GMATH_INLINE void TransformHierarchy::computeGlobals(const Matrix4* locals, Matrix4* globals) const
+    {
+        detail::computeGlobalTransforms(_parents, _levels, locals, globals);
+    }
+
+    GMATH_INLINE void TransformHierarchy::computeGlobals(const std::vector<Xfo>& locals, std::vector<Xfo>& globals) const
+    {
+        if (locals.size() != size())
+            throw GMathError("TransformHierarchy.computeGlobals: locals must have one transform per index");
+        globals.resize(size());
+        if (!locals.empty())
+            computeGlobals(&locals[0], &globals[0]);
+    }
+
+    GMATH_INLINE void TransformHierarchy::computeGlobals(const std::vector<Matrix4>& locals, std::vector<Matrix4>& globals) const
+    {
+        if (locals.size() != size())
+            throw GMathError("TransformHierarchy.computeGlobals: locals must have one transform per index");
+        globals.resize(size());
+        if (!locals.empty())
+            computeGlobals(&locals[0], &globals[0]);
+    }
+}
@@ -1,4 +1,5 @@
 #pragma once
+#define GMATH_USEFULFUNCTIONS_BEGIN
 
 #include "gmRoot.h"
 #include "gmEuler.h"
@@ -63,4 +64,9 @@ namespace gmath
     IntersectionType intersectPlanePlane(Vector3& outP1, Vector3& outP2, const Vector3& plane1Point, const Vector3& plane1Normal, const Vector3& plane2Point, const Vector3& plane2Normal);
 
     IntersectionType intersectCirclePlane(Vector3& outP1, Vector3& outP2, const Vector3& circleCenter, const Vector3& circleNormal, const double& circleRadius, const Vector3& planeNormal, const Vector3& planePoint);
-}
\ No newline at end of file
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_USEFULFUNCTIONS_END
+    #include "gmInline.h"
+#endif
@@ -1,4 +1,5 @@
 #pragma once
+#define GMATH_VECTOR3_BEGIN
 
 #include <string>
 #include <stdexcept>
@@ -18,8 +19,8 @@ using namespace std;
 namespace gmath
 {
     // Matrices forward declaration
-    class Matrix3;
-    class Matrix4;
+    template <typename real> class Matrix3T;
+    template <typename real> class Matrix4T;
 
     /**
     Three-dimensional vector.
@@ -27,56 +28,58 @@ namespace gmath
     This class can be used to represent points, vectors, normals
     or even colors. The usual vector operations are available.
     */
-    class Vector3
+    template <typename real>
+    class Vector3T
     {
     public:
         /*------ constructors ------*/
-        Vector3();
-        Vector3(double inX, double inY, double inZ);
-        Vector3(const Vector3& other);
-        Vector3(const double* values);
-        Vector3(const std::vector<double>& values); 
-
-        ~Vector3() {}
+        GMATH_CONSTEXPR Vector3T();
+        GMATH_CONSTEXPR Vector3T(real inX, real inY, real inZ);
+        GMATH_CONSTEXPR Vector3T(const Vector3T& other);
+        /** Conversion from the other precision, for example Vector3f(aVector3). */
+        template <typename otherReal>
+        explicit Vector3T(const Vector3T<otherReal>& other);
+        Vector3T(const real* values);
+        Vector3T(const std::vector<real>& values); 
 
         /*------ properties ------*/
-        double x, y, z;
+        real x, y, z;
 
         /** Pointer access for direct copying. */
-        double* data();
-        const double* data() const;
+        real* data();
+        const real* data() const;
 
         /*------ coordinate access ------*/
-        double operator[] (int i) const;
-        double& operator[] (int i);
+        real operator[] (int i) const;
+        real& operator[] (int i);
 
         /*------ Arithmetic operations ------*/
-        Vector3 operator + (const Vector3& other) const;
-        Vector3 operator - (const Vector3& other) const;
-        Vector3 operator - () const;
-        Vector3 operator * (double scalar) const;
-        Vector3 operator * (const Vector3& other) const;
-        Vector3 operator * (const Matrix3& mat) const;
-        Vector3 operator * (const Matrix4& mat) const;
-        Vector3 operator / (double scalar) const;
-        Vector3 operator / (const Vector3& other) const;
+        GMATH_CONSTEXPR Vector3T operator + (const Vector3T& other) const;
+        GMATH_CONSTEXPR Vector3T operator - (const Vector3T& other) const;
+        GMATH_CONSTEXPR Vector3T operator - () const;
+        GMATH_CONSTEXPR Vector3T operator * (real scalar) const;
+        GMATH_CONSTEXPR Vector3T operator * (const Vector3T& other) const;
+        Vector3T operator * (const Matrix3T<real>& mat) const;
+        Vector3T operator * (const Matrix4T<real>& mat) const;
+        Vector3T operator / (real scalar) const;
+        Vector3T operator / (const Vector3T& other) const;
 
         /*------ Arithmetic updates ------*/
-        Vector3& operator += (const Vector3& other);
-        Vector3& operator -= (const Vector3& other);
-        Vector3& operator *= (double scalar);
-        Vector3& operator *= (const Vector3& other);
-        Vector3& operator *= (const Matrix3& mat);
-        Vector3& operator *= (const Matrix4& mat);
-        Vector3& operator /= (double scalar);
-        Vector3& operator /= (const Vector3& other);
+        Vector3T& operator += (const Vector3T& other);
+        Vector3T& operator -= (const Vector3T& other);
+        Vector3T& operator *= (real scalar);
+        Vector3T& operator *= (const Vector3T& other);
+        Vector3T& operator *= (const Matrix3T<real>& mat);
+        Vector3T& operator *= (const Matrix4T<real>& mat);
+        Vector3T& operator /= (real scalar);
+        Vector3T& operator /= (const Vector3T& other);
 
         /*------ Arithmetic comparisons ------*/
-        bool operator == (const Vector3& other) const;
-        bool operator != (const Vector3& other) const;
+        bool operator == (const Vector3T& other) const;
+        bool operator != (const Vector3T& other) const;
 
         /*------ Arithmetic assignment ------*/
-        void operator = (const Vector3& other);
+        void operator = (const Vector3T& other);
 
         /*------ methods ------*/
 
@@ -84,53 +87,53 @@ namespace gmath
             @param inX The wanted value for x
             @param inY The wanted value for y
             @param inZ The wanted value for z */
-        void set(double inX, double inY, double inZ);
-        void set(const double* values);
-        void set(const std::vector<double>& values);
+        void set(real inX, real inY, real inZ);
+        void set(const real* values);
+        void set(const std::vector<real>& values);
 
         /** Perform the cross product between this vector and the given vector */
-        Vector3 cross(const Vector3& other) const;
-        void crossInPlace(const Vector3& other);
+        GMATH_CONSTEXPR Vector3T cross(const Vector3T& other) const;
+        void crossInPlace(const Vector3T& other);
 
         /** Perform the cross product between this vector and the given vector,
          *  and always return a normalised vector.
          *  This function is useful to reduce lines of code. */
-        Vector3 crossNormalize(const Vector3& other) const;
-        void crossNormalizeInPlace(const Vector3& other);
+        Vector3T crossNormalize(const Vector3T& other) const;
+        void crossNormalizeInPlace(const Vector3T& other);
 
         /** Perform the dot product between this vector and the given vector */
-        double dot(const Vector3& other) const;
+        GMATH_CONSTEXPR real dot(const Vector3T& other) const;
 
         /** Calculate the length of this vector */
-        double length() const;
-        double squaredLength() const;
+        real length() const;
+        GMATH_CONSTEXPR real squaredLength() const;
 
         /** Find the distance between this vector and the given vector */
-        double distance(const Vector3& other) const;
-        double squaredDistance(const Vector3& other) const;
+        real distance(const Vector3T& other) const;
+        real squaredDistance(const Vector3T& other) const;
 
-        Vector3 normalize() const;
-        Vector3& normalizeInPlace();
+        Vector3T normalize() const;
+        Vector3T& normalizeInPlace();
 
-        Vector3 inverse() const;
-        Vector3& inverseInPlace();
+        Vector3T inverse() const;
+        Vector3T& inverseInPlace();
 
-        Vector3 negate() const;
-        Vector3& negateInPlace();
+        GMATH_CONSTEXPR Vector3T negate() const;
+        Vector3T& negateInPlace();
 
         /** Return angle (in radians) between this vector and the given vector.
             @note: Remember to normalize the vectors before to call this method. */
-        double angle(const Vector3& other) const;
+        real angle(const Vector3T& other) const;
 
         /** Return the reflection to a surface.
             @param normal is The Vector3 which represent the surface normal.
                           Note that normal should be normalized */
-        Vector3 reflect(const Vector3& normal) const;
+        Vector3T reflect(const Vector3T& normal) const;
 
         /** Reflect this vector to a surface.
             @param normal is The Vector3 which represent the surface normal.
                           Note that normal should be normalized */
-        void reflectInPlace(const Vector3& normal);
+        void reflectInPlace(const Vector3T& normal);
 
         /** Return the transmitted vector.
             If the returned vector is zero then there is no transmitted light because
@@ -138,7 +141,7 @@ namespace gmath
             @param normal The Vector3 which represent the surface normal.
                           Note that normal should be normalized
             @param eta The relative index of refraction. */
-        Vector3 refract(const Vector3& normal, double eta) const;
+        Vector3T refract(const Vector3T& normal, real eta) const;
 
         /** Transmit this vector.
             If the returned vector is zero then there is no transmitted light because
@@ -146,32 +149,32 @@ namespace gmath
             @param normal The Vector3 which represent the surface normal.
                           Note that normal should be normalized
             @param eta The relative index of refraction. */
-        void refractInPlace(const Vector3& normal, double eta);
+        void refractInPlace(const Vector3T& normal, real eta);
 
-        Vector3 mirror(const Vector3& normal) const;
-        void mirrorInPlace(const Vector3& normal);
-        Vector3 mirror(CartesianPlane plane=CartesianPlane::YZ) const;
+        Vector3T mirror(const Vector3T& normal) const;
+        void mirrorInPlace(const Vector3T& normal);
+        Vector3T mirror(CartesianPlane plane=CartesianPlane::YZ) const;
         void mirrorInPlace(CartesianPlane plane=CartesianPlane::YZ);
 
         /** interpolate between this vector and the given one. return a new vector */
-        Vector3 linearInterpolate(const Vector3& other, double weight) const;
+        Vector3T linearInterpolate(const Vector3T& other, real weight) const;
 
         /** interpolate between this vector and the given one. At the end store the result on this vector */
-        void linearInterpolateInPlace(const Vector3& other, double weight);
+        void linearInterpolateInPlace(const Vector3T& other, real weight);
 
 
         std::string toString() const;
 
         // Special Vectors.
-        static const Vector3 XAXIS;
-        static const Vector3 YAXIS;
-        static const Vector3 ZAXIS;
+        static const Vector3T XAXIS;
+        static const Vector3T YAXIS;
+        static const Vector3T ZAXIS;
 
-        static const Vector3 N_XAXIS;
-        static const Vector3 N_YAXIS;
-        static const Vector3 N_ZAXIS;
+        static const Vector3T N_XAXIS;
+        static const Vector3T N_YAXIS;
+        static const Vector3T N_ZAXIS;
 
-        static const Vector3 ZERO;
+        static const Vector3T ZERO;
 
         #ifdef CMAYA
             void fromMayaVector(const MVector&mvector);
@@ -179,6 +182,19 @@ namespace gmath
         #endif
     };
 
+    typedef Vector3T<double> Vector3;
+    typedef Vector3T<float> Vector3f;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class Vector3T<float>;
+        extern template class Vector3T<double>;
+    #endif
+
     /** from an Axis enumerator gets the correspondent Vector3 */
     Vector3 getVector3FromAxis(Axis axis);
 }
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_VECTOR3_END
+    #include "gmInline.h"
+#endif
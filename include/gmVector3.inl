@@ -0,0 +1,661 @@
+namespace gmath
+{
+    /*------ Constructors ------*/
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real>::Vector3T()
+        : x(0.0), y(0.0), z(0.0)
+    {
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real>::Vector3T(real inX, real inY, real inZ)
+        : x(inX), y(inY), z(inZ)
+    {
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real>::Vector3T(const Vector3T<real> & other)
+        : x(other.x), y(other.y), z(other.z)
+    {
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE Vector3T<real>::Vector3T(const Vector3T<otherReal>& other)
+        : x(real(other.x)), y(real(other.y)), z(real(other.z))
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>::Vector3T(const real* values)
+    {
+        set(values);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>::Vector3T(const vector<real>& values) 
+    {
+        set(values);
+    }
+
+    /*------ Coordinate access ------*/
+
+    template <typename real>
+    GMATH_INLINE real Vector3T<real>::operator[] (int i) const
+    {
+        if (i>2) {
+            throw out_of_range("gmath::Vector3 - index out of range");
+        }
+        return *(&x+i);
+    }
+
+    template <typename real>
+    GMATH_INLINE real& Vector3T<real>::operator[] (int i)
+    {
+        if (i>2) {
+            throw out_of_range("gmath::Vector3 - index out of range");
+        }
+        return *(&x+i);
+    }
+
+    /*------ Data access ------*/
+
+    template <typename real>
+    GMATH_INLINE real* Vector3T<real>::data()
+    {
+        return &x;
+    }
+
+    template <typename real>
+    GMATH_INLINE const real* Vector3T<real>::data() const
+    {
+        return &x;
+    }
+
+    /*------ Arithmetic operations ------*/
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::operator + (const Vector3T<real> & other) const
+    {
+        Vector3T<real> newVector3(x+other.x, y+other.y, z+other.z);
+
+        return newVector3;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::operator - () const
+    {
+        Vector3T<real> newVector3(-x, -y, -z);
+        return newVector3;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::operator - (const Vector3T<real> & other) const
+    {
+        Vector3T<real> newVector3(x-other.x, y-other.y, z-other.z);
+        return newVector3;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::operator * (real scalar) const
+    {
+        Vector3T<real> newVector3(x*scalar, y*scalar, z*scalar);
+
+        return newVector3;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::operator * (const Vector3T<real> & other) const
+    {
+        Vector3T<real> newVector3(x*other.x, y*other.y, z*other.z);
+
+        return newVector3;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::operator * (const Matrix3T<real> &mat) const
+    {
+        Vector3T<real> retVec(
+            mat.data()[0] * this->x + mat.data()[3] * this->y + mat.data()[6] * this->z,
+            mat.data()[1] * this->x + mat.data()[4] * this->y + mat.data()[7] * this->z,
+            mat.data()[2] * this->x + mat.data()[5] * this->y + mat.data()[8] * this->z
+            );
+        return retVec;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::operator * (const Matrix4T<real> &mat) const
+    {
+        Vector3T<real> retVec(
+            mat.data()[0] * this->x + mat.data()[4] * this->y + mat.data()[8]  * this->z + mat.data()[12],
+            mat.data()[1] * this->x + mat.data()[5] * this->y + mat.data()[9]  * this->z + mat.data()[13],
+            mat.data()[2] * this->x + mat.data()[6] * this->y + mat.data()[10] * this->z + mat.data()[14]
+            );
+        return retVec;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::operator / (real scalar) const
+    {
+        Vector3T<real> newVector3;
+        if (scalar == 0.0)
+        {
+            newVector3.x = NAN;
+            newVector3.y = NAN;
+            newVector3.z = NAN;
+        }
+        else
+        {
+            newVector3.x = x/scalar;
+            newVector3.y = y/scalar;
+            newVector3.z = z/scalar;
+        }
+
+        return newVector3;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::operator / (const Vector3T<real> & other) const
+    {
+        Vector3T<real> newVector;
+
+        if (other.x == 0.0)
+            newVector.x = NAN;
+        else
+            newVector.x = x/other.x;
+
+        if (other.y == 0.0)
+            newVector.y = NAN;
+        else
+            newVector.y = y/other.y;
+
+        if (other.z == 0.0)
+            newVector.z = NAN;
+        else
+            newVector.z = z/other.z;
+            
+        return newVector;
+    }
+
+    /*------ Arithmetic updates ------*/
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator += (const Vector3T<real> & other)
+    {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator -= (const Vector3T<real> & other)
+    {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator *= (real scalar)
+    {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator *= (const Vector3T<real> & other)
+    {
+        x*=other.x; 
+        y*=other.y; 
+        z*=other.z;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator *= (const Matrix3T<real> &mat)
+    {
+        this->set(
+            mat.data()[0] * this->x + mat.data()[1] * this->y + mat.data()[2] * this->z,
+            mat.data()[3] * this->x + mat.data()[4] * this->y + mat.data()[5] * this->z,
+            mat.data()[6] * this->x + mat.data()[7] * this->y + mat.data()[8] * this->z
+            );
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator *= (const Matrix4T<real> &mat)
+    {
+        this->set(
+            mat.data()[0] * this->x + mat.data()[1] * this->y + mat.data()[2]  * this->z + mat.data()[12],
+            mat.data()[4] * this->x + mat.data()[5] * this->y + mat.data()[6]  * this->z + mat.data()[13],
+            mat.data()[8] * this->x + mat.data()[9] * this->y + mat.data()[10] * this->z + mat.data()[14]
+            );
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator /= (real scalar)
+    {
+        if (scalar == 0.0)
+        {
+            x = NAN;
+            y = NAN;
+            z = NAN;
+        }
+        else
+        {
+            x /= scalar;
+            y /= scalar;
+            z /= scalar;
+        }
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::operator /= (const Vector3T<real> &other)
+    {
+        if (other.x == 0.0)
+            x = NAN;
+        else
+            x /= other.x;
+
+        if (other.y == 0.0)
+            y = NAN;
+        else
+            y /= other.y;
+
+        if (other.z == 0.0)
+            z = NAN;
+        else
+            z /= other.z;
+        return *this;
+    }
+
+    /*------ Comparisons ------*/
+
+    template <typename real>
+    GMATH_INLINE bool Vector3T<real>::operator == (const Vector3T<real> & other) const
+    {
+        return (fabs(x-other.x) < gmath::EPSILON && 
+                fabs(y-other.y) < gmath::EPSILON && 
+                fabs(z-other.z) < gmath::EPSILON);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool Vector3T<real>::operator != (const Vector3T<real> & other) const
+    {
+        return (fabs(x-other.x) > gmath::EPSILON || 
+                fabs(y-other.y) > gmath::EPSILON || 
+                fabs(z-other.z) > gmath::EPSILON);
+    }
+
+    /*------ Assignments ------*/
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::operator = (const Vector3T<real> & other)
+    {
+        x = other.x;
+        y = other.y;
+        z = other.z;
+    }
+    
+    /*------ Methods ------*/
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::set(real inX, real inY, real inZ)
+    {
+        x = inX;
+        y = inY;
+        z = inZ;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::set(const real* values)
+    {
+        x = values[0];
+        y = values[1];
+        z = values[2];
+    }
+    
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::set(const std::vector<real>& values)
+    {
+        if (values.size()!=3)
+            throw out_of_range("gmath::Matrix3: values must be of 3 elements");
+        
+        this->x = values[0];
+        this->y = values[1];
+        this->z = values[2];
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::cross(const Vector3T<real> & other) const
+    {
+        Vector3T<real> retVec(
+                y*other.z - z*other.y,
+                z*other.x - x*other.z,
+                x*other.y - y*other.x);
+        return retVec;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::crossInPlace(const Vector3T<real> & other)
+    {
+        real newx = y*other.z - z*other.y;
+        real newy = z*other.x - x*other.z;
+        real newz = x*other.y - y*other.x;
+        x = newx;
+        y = newy;
+        z = newz;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::crossNormalize(const Vector3T<real> & other) const
+    {
+        Vector3T<real> retVec(y*other.z - z*other.y,
+                             z*other.x - x*other.z,
+                             x*other.y - y*other.x);
+        retVec.normalizeInPlace();
+        return retVec;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::crossNormalizeInPlace(const Vector3T<real> & other)
+    {
+        crossInPlace(other);
+        normalizeInPlace();
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR real Vector3T<real>::dot(const Vector3T<real> & other) const
+    {
+        return x*other.x + y*other.y + z*other.z;
+    }
+
+    template <typename real>
+    GMATH_INLINE real Vector3T<real>::length() const
+    {
+        real dot = x*x + y*y + z*z;
+        return sqrt( dot );
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR real Vector3T<real>::squaredLength() const
+    {
+        return x*x + y*y + z*z;
+    }
+
+    template <typename real>
+    GMATH_INLINE real Vector3T<real>::squaredDistance(const Vector3T<real> & other) const
+    {
+        Vector3T<real> distVec( (*this)-(other) );
+        return distVec.squaredLength();
+    }
+
+    template <typename real>
+    GMATH_INLINE real Vector3T<real>::distance(const Vector3T<real> & other) const
+    {
+        Vector3T<real> distVec( (*this)-(other) );
+        return distVec.length();
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::normalize() const
+    {
+        real len = length();
+        real nlen;
+        if (len < gmath::EPSILON)
+        {
+            nlen = 1.0;
+        }
+        else
+        {
+            nlen = 1.0/len;
+        }
+
+        return Vector3T<real>(x*nlen, y*nlen, z*nlen);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::normalizeInPlace()
+    {
+        real len = length();
+
+        real nlen;
+        if (len < gmath::EPSILON)
+        {
+            nlen = 1.0;
+        }
+        else
+        {
+            nlen = 1.0/len;
+        }
+
+        x*=nlen;
+        y*=nlen;
+        z*=nlen;
+
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::inverse() const 
+    {
+        return Vector3T<real>(1.0/x, 1.0/y, 1.0/z);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::inverseInPlace()
+    {
+        x = 1.0/x;
+        y = 1.0/y;
+        z = 1.0/z;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector3T<real> Vector3T<real>::negate() const
+    {
+        return Vector3T<real>(-x, -y, -z);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real>& Vector3T<real>::negateInPlace()
+    {
+        x = -x;
+        y = -y;
+        z = -z;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE real Vector3T<real>::angle(const Vector3T<real> & other) const
+    {
+        real ang = gmath::acos((dot(other))); 
+        return ang;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::reflect(const Vector3T<real> & normal) const
+    {
+        real dot = this->dot(normal);
+        return ( normal * (2.0*dot) ) - *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::reflectInPlace(const Vector3T<real> & normal)
+    {
+        real dot = this->dot(normal);
+        *this = ( normal * (2.0*dot) ) - *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::refract(const Vector3T<real> & normal, real eta) const
+    {
+        real dot = this->dot(normal);
+        real k = 1.0 - eta*eta*(1.0 - dot*dot);
+
+        Vector3T<real> retVec;
+        if (k >= gmath::EPSILON)
+        {
+            retVec = *this * eta;
+            retVec -= normal * (eta*dot + sqrt(k));
+        }
+        return retVec;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::refractInPlace(const Vector3T<real> & normal, real eta)
+    {
+        real dot = this->dot(normal);
+        real k = 1.0 - eta*eta*(1.0 - dot*dot);
+
+        if (k >= gmath::EPSILON)
+        {
+            *this *= eta;
+            *this -= normal * (eta*dot + sqrt(k));
+        }
+        else
+        {
+            this->set(real(0.0), real(0.0), real(0.0));
+        }
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::mirror(const Vector3T<real>& normal) const 
+    {
+        Vector3T<real> result(*this);
+        result.mirrorInPlace(normal);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::mirrorInPlace(const Vector3T<real>& normal) 
+    {
+        Vector3T<real> n = normal.normalize();
+        Vector3T<real> u = n*(this->dot(n));
+        *this -= u*2.0;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::mirror(CartesianPlane plane) const 
+    {
+        Vector3T<real> normal;
+        switch(plane) {
+            case CartesianPlane::XY:
+                normal = Vector3T<real>::ZAXIS;
+                break;
+            case CartesianPlane::YZ: 
+                normal = Vector3T<real>::XAXIS;
+                break;
+            case CartesianPlane::ZX: 
+                normal = Vector3T<real>::YAXIS;
+                break; 
+        }
+        return mirror(normal);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::mirrorInPlace(CartesianPlane plane) 
+    {
+        Vector3T<real> normal;
+        switch(plane) {
+            case CartesianPlane::XY: 
+                normal = Vector3T<real>::ZAXIS;
+                break;
+            case CartesianPlane::YZ: 
+                normal = Vector3T<real>::XAXIS;
+                break;
+            case CartesianPlane::ZX: 
+                normal = Vector3T<real>::YAXIS;
+                break; 
+        }
+        return mirrorInPlace(normal);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> Vector3T<real>::linearInterpolate(const Vector3T<real> & other, real weight) const
+    {
+        return Vector3T<real>((other.x - x) * weight + x,
+                             (other.y - y) * weight + y,
+                             (other.z - z) * weight + z);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector3T<real>::linearInterpolateInPlace(const Vector3T<real> & other, real weight)
+    {
+        x = (other.x - x) * weight + x;
+        y = (other.y - y) * weight + y;
+        z = (other.z - z) * weight + z;
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string Vector3T<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Vector3(" << x << ", " << y << ", " << z << ");";
+
+        return oss.str();
+    }
+
+
+    // Special Vectors.
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::XAXIS = Vector3T<real>(1.0, 0.0, 0.0);
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::YAXIS = Vector3T<real>(0.0, 1.0, 0.0);
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::ZAXIS= Vector3T<real>(0.0, 0.0, 1.0);
+
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::N_XAXIS = Vector3T<real>(-1.0, 0.0, 0.0);
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::N_YAXIS = Vector3T<real>(0.0, -1.0, 0.0);
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::N_ZAXIS = Vector3T<real>(0.0, 0.0, -1.0);
+
+    template <typename real>
+    GMATH_INLINE const Vector3T<real> Vector3T<real>::ZERO = Vector3T<real>(0.0, 0.0, 0.0);
+
+
+    #ifdef CMAYA
+        template <typename real>
+        GMATH_INLINE void Vector3T<real>::fromMayaVector(const MVector &mvector)
+        {
+            double dest[3];
+            mvector.get(dest);
+            this->set(real(dest[0]), real(dest[1]), real(dest[2]));
+        }
+
+        template <typename real>
+        GMATH_INLINE MVector Vector3T<real>::toMayaVector() const 
+        {
+            return MVector(x, y, z);
+        }
+    #endif
+
+    GMATH_INLINE Vector3 getVector3FromAxis(Axis axis) 
+    {
+        switch(axis) {
+            case Axis::POSX:
+                return Vector3::XAXIS;
+            case Axis::POSY:
+                return Vector3::YAXIS;
+            case Axis::POSZ:
+                return Vector3::ZAXIS;
+            case Axis::NEGX:
+                return Vector3::N_XAXIS;
+            case Axis::NEGY:
+                return Vector3::N_YAXIS;
+            case Axis::NEGZ:
+                return Vector3::N_ZAXIS;
+            default:
+                return Vector3(NAN, NAN, NAN);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+#define GMATH_VECTOR3ARRAY_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmVector3.h"
+#include "gmSimd.h"
+
+namespace gmath
+{
+    /**
+    Array of Vector3 stored as a structure of arrays.
+
+    The x, y and z components live in three separate arrays aligned to simd::ALIGNMENT bytes,
+    so the bulk methods process several vectors per instruction.
+    It's meant for thousands of vectors going through the same operation,
+    for a few of them a std::vector<Vector3> is simpler.
+    */
+    class Vector3Array
+    {
+    private:
+        /*------ properties ------*/
+        simd::SoaStorage _storage;
+
+    public:
+        /*------ constructors ------*/
+        Vector3Array();
+        explicit Vector3Array(size_t size);
+        Vector3Array(const Vector3* values, size_t count);
+        Vector3Array(const std::vector<Vector3>& values);
+
+        /*------ size ------*/
+        size_t size() const;
+
+        /** Change the number of vectors. The existing vectors are kept, the new ones are (0, 0, 0). */
+        void resize(size_t size);
+
+        /*------ coordinate access ------*/
+
+        /** The component arrays, size() values each. */
+        double* x();
+        double* y();
+        double* z();
+        const double* x() const;
+        const double* y() const;
+        const double* z() const;
+
+        /** The component arrays, for the simd kernels. */
+        simd::Vector3Soa soa() const;
+
+        Vector3 get(size_t i) const;
+        void set(size_t i, const Vector3& vec);
+
+        /*------ conversion ------*/
+        void fromVectors(const Vector3* values, size_t count);
+        void fromVectors(const std::vector<Vector3>& values);
+        void toVectors(Vector3* out) const;
+        std::vector<Vector3> toVectors() const;
+
+        /*------ bulk methods ------*/
+
+        /** Vector3::normalizeInPlace on every vector. */
+        void normalizeInPlace();
+
+        /** out[i] = this[i].dot(other[i]), out must have room for size() values. */
+        void dot(const Vector3Array& other, double* out) const;
+
+        /** out[i] = this[i].cross(other[i]). out is resized to size(), it can be this or other. */
+        void cross(const Vector3Array& other, Vector3Array& out) const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_VECTOR3ARRAY_END
+    #include "gmInline.h"
+#endif
@@ -0,0 +1,135 @@
+namespace gmath
+{
+    /*------ constructors ------*/
+
+    GMATH_INLINE Vector3Array::Vector3Array()
+        : _storage(3)
+    {
+    }
+
+    GMATH_INLINE Vector3Array::Vector3Array(size_t size)
+        : _storage(3, size)
+    {
+    }
+
+    GMATH_INLINE Vector3Array::Vector3Array(const Vector3* values, size_t count)
+        : _storage(3)
+    {
+        fromVectors(values, count);
+    }
+
+    GMATH_INLINE Vector3Array::Vector3Array(const std::vector<Vector3>& values)
+        : _storage(3)
+    {
+        fromVectors(values);
+    }
+
+    /*------ size ------*/
+
+    GMATH_INLINE size_t Vector3Array::size() const
+    {
+        return _storage.size();
+    }
+
+    GMATH_INLINE void Vector3Array::resize(size_t size)
+    {
+        _storage.resize(size);
+    }
+
+    /*------ coordinate access ------*/
+
+    GMATH_INLINE double* Vector3Array::x() { return _storage.component(0); }
+    GMATH_INLINE double* Vector3Array::y() { return _storage.component(1); }
+    GMATH_INLINE double* Vector3Array::z() { return _storage.component(2); }
+    GMATH_INLINE const double* Vector3Array::x() const { return _storage.component(0); }
+    GMATH_INLINE const double* Vector3Array::y() const { return _storage.component(1); }
+    GMATH_INLINE const double* Vector3Array::z() const { return _storage.component(2); }
+
+    GMATH_INLINE simd::Vector3Soa Vector3Array::soa() const
+    {
+        // the kernels take mutable pointers, the const methods only pass them as inputs
+        Vector3Array& self = const_cast<Vector3Array&>(*this);
+        simd::Vector3Soa result = { self.x(), self.y(), self.z() };
+        return result;
+    }
+
+    GMATH_INLINE Vector3 Vector3Array::get(size_t i) const
+    {
+        if (i >= size()) {
+            throw out_of_range("gmath::Vector3Array - index out of range");
+        }
+        return Vector3(x()[i], y()[i], z()[i]);
+    }
+
+    GMATH_INLINE void Vector3Array::set(size_t i, const Vector3& vec)
+    {
+        if (i >= size()) {
+            throw out_of_range("gmath::Vector3Array - index out of range");
+        }
+        x()[i] = vec.x;
+        y()[i] = vec.y;
+        z()[i] = vec.z;
+    }
+
+    /*------ conversion ------*/
+
+    GMATH_INLINE void Vector3Array::fromVectors(const Vector3* values, size_t count)
+    {
+        resize(count);
+        double* px = x();
+        double* py = y();
+        double* pz = z();
+        for (size_t i=0; i<count; i++)
+        {
+            px[i] = values[i].x;
+            py[i] = values[i].y;
+            pz[i] = values[i].z;
+        }
+    }
+
+    GMATH_INLINE void Vector3Array::fromVectors(const std::vector<Vector3>& values)
+    {
+        fromVectors(values.empty() ? NULL : &values[0], values.size());
+    }
+
+    GMATH_INLINE void Vector3Array::toVectors(Vector3* out) const
+    {
+        const double* px = x();
+        const double* py = y();
+        const double* pz = z();
+        for (size_t i=0; i<size(); i++)
+            out[i].set(px[i], py[i], pz[i]);
+    }
+
+    GMATH_INLINE std::vector<Vector3> Vector3Array::toVectors() const
+    {
+        std::vector<Vector3> result(size());
+        if (!result.empty())
+            toVectors(&result[0]);
+        return result;
+    }
+
+    /*------ bulk methods ------*/
+
+    GMATH_INLINE void Vector3Array::normalizeInPlace()
+    {
+        simd::normalizeVectors(soa(), size());
+    }
+
+    GMATH_INLINE void Vector3Array::dot(const Vector3Array& other, double* out) const
+    {
+        if (other.size() != size())
+            throw GMathError("Vector3Array.dot: the two arrays must have the same size");
+
+        simd::dotVectors(soa(), other.soa(), out, size());
+    }
+
+    GMATH_INLINE void Vector3Array::cross(const Vector3Array& other, Vector3Array& out) const
+    {
+        if (other.size() != size())
+            throw GMathError("Vector3Array.cross: the two arrays must have the same size");
+
+        out.resize(size());
+        simd::crossVectors(soa(), other.soa(), out.soa(), size());
+    }
+}
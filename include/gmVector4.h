@@ -1,4 +1,5 @@
 #pragma once
+#define GMATH_VECTOR4_BEGIN
 
 #include <string>
 #include <vector>
@@ -12,46 +13,50 @@
 
 namespace gmath
 {
-    class Vector4
+    template <typename real>
+    class Vector4T
     {
     public:
         /*------ constructors ------*/
-        Vector4();
-        Vector4(double inX, double inY, double inZ, double inW);
-        Vector4(const Vector4& other);
-        Vector4(const double* values);
-        Vector4(const std::vector<double>& values);
+        GMATH_CONSTEXPR Vector4T();
+        GMATH_CONSTEXPR Vector4T(real inX, real inY, real inZ, real inW);
+        GMATH_CONSTEXPR Vector4T(const Vector4T& other);
+        /** Conversion from the other precision, for example Vector4f(aVector4). */
+        template <typename otherReal>
+        explicit Vector4T(const Vector4T<otherReal>& other);
+        Vector4T(const real* values);
+        Vector4T(const std::vector<real>& values);
 
         /*------ properties ------*/
-        double x, y, z, w;
+        real x, y, z, w;
 
         /*------ coordinate access ------*/
-        double operator[] (int i) const;
-        double& operator[] (int i);
+        real operator[] (int i) const;
+        real& operator[] (int i);
 
         /** Pointer access for direct copying. */
-        double* data();
-        const double* data() const;
+        real* data();
+        const real* data() const;
 
         /*------ Arithmetic operations ------*/
-        Vector4 operator + (const Vector4& other) const;
-        Vector4 operator - (const Vector4& other) const;
-        Vector4 operator - () const;
-        Vector4 operator * (double scalar) const;
-        Vector4 operator / (double scalar) const;
+        GMATH_CONSTEXPR Vector4T operator + (const Vector4T& other) const;
+        GMATH_CONSTEXPR Vector4T operator - (const Vector4T& other) const;
+        GMATH_CONSTEXPR Vector4T operator - () const;
+        GMATH_CONSTEXPR Vector4T operator * (real scalar) const;
+        Vector4T operator / (real scalar) const;
 
         /*------ Arithmetic updates ------*/
-        Vector4& operator += (const Vector4& other);
-        Vector4& operator -= (const Vector4& other);
-        Vector4& operator *= (double scalar);
-        Vector4& operator /= (double scalar);
+        Vector4T& operator += (const Vector4T& other);
+        Vector4T& operator -= (const Vector4T& other);
+        Vector4T& operator *= (real scalar);
+        Vector4T& operator /= (real scalar);
 
         /*------ Arithmetic comparisons ------*/
-        bool operator == (const Vector4& other) const;
-        bool operator != (const Vector4& other) const;
+        bool operator == (const Vector4T& other) const;
+        bool operator != (const Vector4T& other) const;
 
         /*------ Arithmetic assignment ------*/
-        void operator = (const Vector4& other);
+        void operator = (const Vector4T& other);
 
         /*------ methods ------*/
 
@@ -60,18 +65,18 @@ namespace gmath
             @param inY The wanted value for y
             @param inZ The wanted value for z
             @param inW The wanted value for w */
-        void set(double inX, double inY, double inZ, double inW);
-        void set(const double* values);
-        void set(const std::vector<double>& values);
+        void set(real inX, real inY, real inZ, real inW);
+        void set(const real* values);
+        void set(const std::vector<real>& values);
 
         /** Perform the dot product between this vector and the given vector */
-        double dot(const Vector4& other) const;
+        GMATH_CONSTEXPR real dot(const Vector4T& other) const;
 
         /** Calculate the length of this vector */
-        double length() const;
-        double squaredLength() const;
+        real length() const;
+        GMATH_CONSTEXPR real squaredLength() const;
 
-        Vector4 normalize() const;
+        Vector4T normalize() const;
         void normalizeInPlace();
 
         std::string toString() const;
@@ -81,4 +86,17 @@ namespace gmath
             MPoint toMayaPoint() const;
         #endif
     };
+
+    typedef Vector4T<double> Vector4;
+    typedef Vector4T<float> Vector4f;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class Vector4T<float>;
+        extern template class Vector4T<double>;
+    #endif
 }
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_VECTOR4_END
+    #include "gmInline.h"
+#endif
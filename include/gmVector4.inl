@@ -0,0 +1,318 @@
+namespace gmath {
+
+    /*------ Constructors ------*/
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real>::Vector4T()
+        : x(0.0), y(0.0), z(0.0), w(0.0)
+    {
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real>::Vector4T(real inX, real inY, real inZ, real inW)
+        : x(inX), y(inY), z(inZ), w(inW)
+    {
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real>::Vector4T(const Vector4T<real> & other)
+        : x(other.x), y(other.y), z(other.z), w(other.w)
+    {
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE Vector4T<real>::Vector4T(const Vector4T<otherReal>& other)
+        : x(real(other.x)), y(real(other.y)), z(real(other.z)), w(real(other.w))
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real>::Vector4T(const real* values)
+    {
+        set(values);
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real>::Vector4T(const std::vector<real>& values)
+    {
+        set(values);
+    }
+
+    /*------ Coordinates access ------*/
+    template <typename real>
+    GMATH_INLINE real Vector4T<real>::operator[] (int i) const
+    {
+        if (i>3){
+            throw out_of_range("gmath::Vector4: index out of range");
+        }
+        return *(&x+i);
+    }
+
+    template <typename real>
+    GMATH_INLINE real& Vector4T<real>::operator[] (int i)
+    {
+        if (i>3){
+            throw out_of_range("gmath::Vector4: index out of range");
+        }
+        return *(&x+i);
+    }
+
+    template <typename real>
+    GMATH_INLINE real* Vector4T<real>::data()
+    {
+    	return &x;
+    }
+
+    template <typename real>
+    GMATH_INLINE const real* Vector4T<real>::data() const
+    {
+    	return &x;
+    }
+
+    /*------ Arithmetic operations ------*/
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real> Vector4T<real>::operator + (const Vector4T<real> & other) const
+    {
+        Vector4T<real> newVector4(x+other.x, y+other.y, z+other.z, w+other.w);
+
+        return newVector4;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real> Vector4T<real>::operator - (const Vector4T<real> & other) const
+    {
+        Vector4T<real> newVector4(x-other.x, y-other.y, z-other.z, w-other.w);
+        return newVector4;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real> Vector4T<real>::operator - () const
+    {
+        Vector4T<real> newVector4(-x, -y, -z, -w);
+        return newVector4;
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR Vector4T<real> Vector4T<real>::operator * (real scalar) const
+    {
+        Vector4T<real> newVector4(x*scalar, y*scalar, z*scalar, w*scalar);
+
+        return newVector4;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real> Vector4T<real>::operator / (real scalar) const
+    {
+        Vector4T<real> newVector4;
+        if (scalar == 0.0)
+        {
+            newVector4.x = NAN;
+            newVector4.y = NAN;
+            newVector4.z = NAN;
+            newVector4.w = NAN;
+        }
+        else
+        {
+            newVector4.x = x/scalar;
+            newVector4.y = y/scalar;
+            newVector4.z = z/scalar;
+            newVector4.w = w/scalar;
+        }
+
+        return newVector4;
+    }
+
+    /*------ Arithmetic updates ------*/
+    template <typename real>
+    GMATH_INLINE Vector4T<real>& Vector4T<real>::operator += (const Vector4T<real> & other)
+    {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        w += other.w;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real>& Vector4T<real>::operator -= (const Vector4T<real> & other)
+    {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        w -= other.w;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real>& Vector4T<real>::operator *= (real scalar)
+    {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        w *= scalar;
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real>& Vector4T<real>::operator /= (real scalar)
+    {
+        if (scalar == 0.0)
+        {
+            x = NAN;
+            y = NAN;
+            z = NAN;
+            w = NAN;
+        }
+        else
+        {
+            x /= scalar;
+            y /= scalar;
+            z /= scalar;
+            w /= scalar;
+        }
+        return *this;
+    }
+
+    /*------ Comparisons ------*/
+    template <typename real>
+    GMATH_INLINE bool Vector4T<real>::operator == (const Vector4T<real> & other) const
+    {
+        return (fabs(x-other.x) < gmath::EPSILON && 
+                fabs(y-other.y) < gmath::EPSILON && 
+                fabs(z-other.z) < gmath::EPSILON &&
+                fabs(w-other.w) < gmath::EPSILON);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool Vector4T<real>::operator != (const Vector4T<real> & other) const
+    {
+        return (fabs(x-other.x) > gmath::EPSILON || 
+                fabs(y-other.y) > gmath::EPSILON || 
+                fabs(z-other.z) > gmath::EPSILON ||
+                fabs(w-other.w) < gmath::EPSILON);
+    }
+
+    /*------ Assignments ------*/
+    template <typename real>
+    GMATH_INLINE void Vector4T<real>::operator = (const Vector4T<real> & other)
+    {
+        x = other.x;
+        y = other.y;
+        z = other.z;
+        w = other.w;
+    }
+    
+    /*------ Methods ------*/
+    template <typename real>
+    GMATH_INLINE void Vector4T<real>::set(real inX, real inY, real inZ, real inW)
+    {
+        x = inX;
+        y = inY;
+        z = inZ;
+        w = inW;
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector4T<real>::set(const real* values)
+	{
+	    x = values[0];
+	    y = values[1];
+	    z = values[2];
+	    w = values[3];
+	}
+    
+    template <typename real>
+    GMATH_INLINE void Vector4T<real>::set(const std::vector<real>& values)
+    {
+        if (values.size()!=4)
+            throw out_of_range("gmath::Matrix4: values must be of 4 elements");
+        
+        this->x = values[0];
+        this->y = values[1];
+        this->z = values[2];
+        this->w = values[3];
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR real Vector4T<real>::dot(const Vector4T<real> & other) const
+    {
+        return x*other.x + y*other.y + z*other.z + w*other.w;
+    }
+
+    template <typename real>
+    GMATH_INLINE real Vector4T<real>::length() const
+    {
+        real dot = x*x + y*y + z*z + w*w;
+        return sqrt( dot );
+    }
+
+    template <typename real>
+    GMATH_CONSTEXPR real Vector4T<real>::squaredLength() const
+    {
+        return x*x + y*y + z*z + w*w;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector4T<real> Vector4T<real>::normalize() const
+    {
+        real len = length();
+
+        real nlen;
+        if (len < gmath::EPSILON)
+        {
+            nlen = 1.0;
+        }
+        else
+        {
+            nlen = 1.0/len;
+        }
+
+        return Vector4T<real>(x*nlen, y*nlen, z*nlen, w*nlen);
+    }
+
+    template <typename real>
+    GMATH_INLINE void Vector4T<real>::normalizeInPlace()
+    {
+        real len = length();
+        
+        real nlen;
+        if (len < gmath::EPSILON)
+        {
+            nlen = 1.0;
+        }
+        else
+        {
+            nlen = 1.0/len;
+        }
+
+        x *= nlen;
+        y *= nlen;
+        z *= nlen;
+        w *= nlen;
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string Vector4T<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Vector4(" << x << ", " << y << ", " << z << ", " << w << ");";
+
+        return oss.str();
+    }
+
+    #ifdef CMAYA
+        template <typename real>
+        GMATH_INLINE void Vector4T<real>::fromMayaPoint(const MPoint &mpoint)
+        {
+            double dest[4];
+            mpoint.get(dest);
+            this->set(real(dest[0]), real(dest[1]), real(dest[2]), real(dest[3]));
+        }
+
+        template <typename real>
+        GMATH_INLINE MPoint Vector4T<real>::toMayaPoint() const 
+        {
+            return MPoint(x, y, z, w);
+        }
+    #endif
+}
\ No newline at end of file
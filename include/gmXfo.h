@@ -1,8 +1,10 @@
 #pragma once
+#define GMATH_XFO_BEGIN
 
 #include "gmVector3.h"
 #include "gmQuaternion.h"
 #include "gmMatrix4.h"
+#include <limits>
 
 #ifdef CMAYA
 #include <maya/MMatrix.h>
@@ -15,58 +17,72 @@ namespace gmath
         It was inspired by FabricEngine's own Xfo type 
 
         @seealso Quat, Vec3, Euler, Mat44, Mat33 */
-    class Xfo
+    template <typename real>
+    class XfoT
     {
     public:
         /*------ properties ------*/
-        Quaternion ori;
-        Vector3 tr;
-        Vector3 sc;
+        QuaternionT<real> ori;
+        Vector3T<real> tr;
+        Vector3T<real> sc;
 
         /*------ constructors ------*/
-        Xfo();
-        Xfo(const Xfo& other);
-        Xfo(const Vector3& tr);
-        Xfo(const Quaternion& ori);
-        Xfo(const Vector3& tr, const Quaternion& ori);
-        Xfo(const Quaternion& ori, const Vector3& tr, const Vector3& sc);
-        Xfo(const Matrix4& mat);
-        Xfo(const double& eulerX, const double& eulerY, const double& eulerZ, 
-            const double& trX, const double& trY, const double& trZ,
-            const double& scX, const double& scY, const double& scZ);
+        XfoT();
+        XfoT(const XfoT& other);
+        /** Conversion from the other precision, for example Xfof(anXfo). */
+        template <typename otherReal>
+        explicit XfoT(const XfoT<otherReal>& other);
+        XfoT(const Vector3T<real>& tr);
+        XfoT(const QuaternionT<real>& ori);
+        XfoT(const Vector3T<real>& tr, const QuaternionT<real>& ori);
+        XfoT(const QuaternionT<real>& ori, const Vector3T<real>& tr, const Vector3T<real>& sc);
+        XfoT(const Matrix4T<real>& mat);
+        XfoT(const real& eulerX, const real& eulerY, const real& eulerZ, 
+            const real& trX, const real& trY, const real& trZ,
+            const real& scX, const real& scY, const real& scZ);
 
         /*------ Arithmetic operations ------*/
-        Xfo operator * (const Xfo& other) const;
+        /** Throws GMathError if this Xfo has non-uniform scaling, see compose. */
+        XfoT operator * (const XfoT& other) const;
+
+        /** out = this * other without the exception, for tight loops. out can be this or other.
+            Returns XfoStatus::NON_UNIFORM_SCALE when this Xfo has non-uniform scaling, out is then
+            computed as if it had not: the shearing the exact result needs is lost. */
+        XfoStatus compose(const XfoT& other, XfoT& out) const noexcept;
 
         /*------ Arithmetic updates ------*/
-        Xfo& operator *= (const Xfo& other);
+        XfoT& operator *= (const XfoT& other);
 
         /*------ Arithmetic comparisons ------*/
-        bool operator == (const Xfo& other) const;
-        bool operator != (const Xfo& other) const;
+        bool operator == (const XfoT& other) const;
+        bool operator != (const XfoT& other) const;
 
         /*------ Arithmetic assignment ------*/
-        void operator = (const Xfo& other);
+        void operator = (const XfoT& other);
 
         /*------ methods ------*/
         void setToIdentity();
-        void fromMatrix4(const Matrix4& mat);
-        Matrix4 toMatrix4() const;
-        Vector3 transformVector(const Vector3& vec) const;
-        Xfo inverse() const;
-        Xfo& inverseInPlace();
-        Vector3 inverseTransformVector(const Vector3& vec) const;
-        Xfo slerp(const Xfo& other, const double& t) const;
-        Xfo& slerpInPlace(const Xfo& other, const double& t);
-        double distanceTo(const Xfo& other) const;
-
-        Xfo mirror(const Vector3& center, const Vector3& normal, 
+        /** True when the three scale factors are equal, see detail::hasUniformScale for the precision. */
+        bool hasUniformScale() const noexcept;
+        void fromMatrix4(const Matrix4T<real>& mat);
+        Matrix4T<real> toMatrix4() const;
+        Vector3T<real> transformVector(const Vector3T<real>& vec) const;
+        XfoT inverse() const;
+        XfoT& inverseInPlace();
+        Vector3T<real> inverseTransformVector(const Vector3T<real>& vec) const;
+        XfoT slerp(const XfoT& other, const real& t) const;
+        XfoT& slerpInPlace(const XfoT& other, const real& t);
+        /** As slerp, with the orientations blended by Quaternion::interpolate. */
+        XfoT interpolate(const XfoT& other, real t, SlerpMethod method) const;
+        real distanceTo(const XfoT& other) const;
+
+        XfoT mirror(const Vector3T<real>& center, const Vector3T<real>& normal, 
                    Axis primary=Axis::POSY, Axis secondary=Axis::POSZ) const;
-        Xfo& mirrorInPlace(const Vector3& center, const Vector3& normal, 
+        XfoT& mirrorInPlace(const Vector3T<real>& center, const Vector3T<real>& normal, 
                            Axis primary=Axis::POSY, Axis secondary=Axis::POSZ);
 
-        Xfo mirror(CartesianPlane plane=CartesianPlane::YZ) const;
-        Xfo& mirrorInPlace(CartesianPlane plane=CartesianPlane::YZ);
+        XfoT mirror(CartesianPlane plane=CartesianPlane::YZ) const;
+        XfoT& mirrorInPlace(CartesianPlane plane=CartesianPlane::YZ);
 
         std::string toString() const;
 
@@ -76,6 +92,33 @@ namespace gmath
         #endif
     };
 
+    typedef XfoT<double> Xfo;
+    typedef XfoT<float> Xfof;
+
+    #if !defined(GMATH_HEADER_ONLY) && !defined(SWIG)
+        extern template class XfoT<float>;
+        extern template class XfoT<double>;
+    #endif
+
+#ifndef SWIG
+    namespace detail
+    {
+        /*  True when the scale factors x, y and z are equal, to a relative precision of 10 * EPSILON
+            for double and 10 ulps for float, whose rounding noise alone is already larger than EPSILON.
+            It is the single definition of a uniform scale, used by Xfo and by the XfoArray loops. */
+        template <typename real>
+        inline bool hasUniformScale(real x, real y, real z) noexcept
+        {
+            if (x == y && x == z)
+                return true;
+
+            const real epsilon = std::numeric_limits<real>::epsilon();
+            const real relativePrecision = abs(x) * real(10.0) * (epsilon > real(EPSILON) ? epsilon : real(EPSILON));
+            return !(abs(x - y) > relativePrecision || abs(x - z) > relativePrecision);
+        }
+    }
+#endif
+
     #ifdef CMAYA
 
         Xfo getGlobalXfo(const MDagPath &path);
@@ -91,4 +134,9 @@ namespace gmath
         void setLocalXfo(const std::string &dagName, const Xfo &xfo);
 
     #endif
-}
\ No newline at end of file
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_XFO_END
+    #include "gmInline.h"
+#endif
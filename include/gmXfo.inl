@@ -0,0 +1,387 @@
+namespace gmath
+{
+    /*------ Constructors ------*/
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT()
+    {
+        ori = QuaternionT<real>();
+        tr = Vector3T<real>();
+        sc = Vector3T<real>(1.0, 1.0, 1.0);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const XfoT<real>& other) 
+    {
+        ori = other.ori;
+        tr = other.tr;
+        sc = other.sc;
+    }
+
+    template <typename real>
+    template <typename otherReal>
+    GMATH_INLINE XfoT<real>::XfoT(const XfoT<otherReal>& other)
+        : ori(other.ori), tr(other.tr), sc(other.sc)
+    {
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const Vector3T<real> & tr)
+    {
+        this->ori = QuaternionT<real>();
+        this->tr = Vector3T<real>(tr);
+        this->sc = Vector3T<real>(1.0, 1.0, 1.0);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const QuaternionT<real> & ori)
+    {
+        this->ori = QuaternionT<real>(ori);
+        this->tr = Vector3T<real>();
+        this->sc = Vector3T<real>(1.0, 1.0, 1.0);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const Vector3T<real> & tr, const QuaternionT<real> & ori)
+    {
+        this->ori = QuaternionT<real>(ori);
+        this->tr  = Vector3T<real>(tr);
+        this->sc  = Vector3T<real>(1.0, 1.0, 1.0);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const QuaternionT<real> & ori, const Vector3T<real> & tr, const Vector3T<real> & sc)
+    {
+        this->ori = QuaternionT<real>(ori);
+        this->tr  = Vector3T<real>(tr);
+        this->sc  = Vector3T<real>(sc);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const Matrix4T<real> & mat)
+    {
+        ori = QuaternionT<real>(mat.toQuaternion());
+        tr = Vector3T<real>(mat.getPosition());
+        sc = Vector3T<real>(mat.getScale());
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>::XfoT(const real & eulerX, const real & eulerY, const real & eulerZ, 
+             const real & trX, const real & trY, const real & trZ,
+             const real & scX, const real & scY, const real & scZ)
+    {
+        ori = QuaternionT<real>(eulerX, eulerY, eulerZ);
+        tr = Vector3T<real>(trX, trY, trZ);
+        sc = Vector3T<real>(scX, scY, scZ);
+    }
+
+    /*------ Arithmetic operations ------*/
+    template <typename real>
+    GMATH_INLINE XfoT<real> XfoT<real>::operator * (const XfoT<real> & other) const
+    {
+        if(!hasUniformScale())
+            throw GMathError("Xfo operator *: Cannot multiply to xfos when having non-uniform scaling without causing shearing. Use Matrix4s instead.");
+
+        XfoT<real> result;
+        compose(other, result);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoStatus XfoT<real>::compose(const XfoT<real> & other, XfoT<real> & out) const noexcept
+    {
+        XfoStatus status = hasUniformScale() ? XfoStatus::OK : XfoStatus::NON_UNIFORM_SCALE;
+
+        // everything is read before out is written, out can be this or other
+        Vector3T<real> resultTr = other.tr + other.ori.rotateVector(this->tr*other.sc);
+        QuaternionT<real> resultOri = this->ori * other.ori;
+        resultOri.normalizeInPlace();
+        Vector3T<real> resultSc = this->sc * other.sc;
+
+        out.tr = resultTr;
+        out.ori = resultOri;
+        out.sc = resultSc;
+        return status;
+    }
+
+    /*------ Arithmetic updates ------*/
+    template <typename real>
+    GMATH_INLINE XfoT<real>& XfoT<real>::operator *= (const XfoT<real> & other)
+    {
+        if(!hasUniformScale())
+            throw GMathError("Xfo operator *: Cannot multiply to xfos when having non-uniform scaling without causing shearing. Use Matrix4s instead.");
+
+        compose(other, *this);
+        return *this;
+    }
+
+    /*------ Arithmetic comparisons ------*/
+    template <typename real>
+    GMATH_INLINE bool XfoT<real>::operator == (const XfoT<real> & other) const
+    {
+        return (ori==other.ori && tr==other.tr && sc==other.sc);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool XfoT<real>::operator != (const XfoT<real> & other) const
+    {
+        return (ori!=other.ori && tr!=other.tr && sc!=other.sc);
+    }
+
+    /*------ Arithmetic assignment ------*/
+    template <typename real>
+    GMATH_INLINE void XfoT<real>::operator = (const XfoT<real> & other) 
+    {
+        ori = other.ori;
+        tr = other.tr;
+        sc = other.sc;
+    }
+
+    /*------ methods ------*/
+    template <typename real>
+    GMATH_INLINE void XfoT<real>::setToIdentity()
+    {
+        ori.set(0.0, 0.0, 0.0, 1.0);
+        tr.set(0.0, 0.0, 0.0);
+        sc.set(1.0, 1.0, 1.0);
+    }
+
+    template <typename real>
+    GMATH_INLINE bool XfoT<real>::hasUniformScale() const noexcept
+    {
+        return detail::hasUniformScale(this->sc.x, this->sc.y, this->sc.z);
+    }
+
+    template <typename real>
+    GMATH_INLINE void XfoT<real>::fromMatrix4(const Matrix4T<real> & mat)
+    {
+        ori = mat.toQuaternion();
+        tr = mat.getPosition();
+        sc = mat.getScale();
+    }
+
+    template <typename real>
+    GMATH_INLINE Matrix4T<real> XfoT<real>::toMatrix4() const
+    {
+        Matrix4T<real> result(ori, tr);
+        result.setScale(sc);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> XfoT<real>::transformVector(const Vector3T<real> & vec) const
+    {
+        return ori.rotateVector(vec*sc) + tr;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real> XfoT<real>::inverse() const
+    {
+        if (!hasUniformScale())
+            throw GMathError("Xfo.inverse: Cannot invert xfo with non-uniform scaling without causing shearing. Try using inverseTransformVector, use Mat44s instead");
+
+        XfoT<real> result;
+        result.ori = ori.inverse();
+        result.sc = sc.inverse();
+        result.tr = result.ori.rotateVector(tr.negate()*result.sc);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>& XfoT<real>::inverseInPlace()
+    {
+        if (!hasUniformScale())
+            throw GMathError("Xfo.inverseInPlace: Cannot multiply to xfos when having non-uniform scaling without causing shearing. Use Matrix4s instead.");
+
+        ori.inverseInPlace();
+        sc.inverseInPlace();
+        tr = ori.rotateVector(tr.negate()*sc);
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE Vector3T<real> XfoT<real>::inverseTransformVector(const Vector3T<real> & vec) const
+    {
+        return this->inverse().transformVector(vec);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real> XfoT<real>::slerp(const XfoT<real> & other, const real & t) const
+    {
+        XfoT<real> result;
+        result.ori = ori.slerp(other.ori, t);
+        result.tr = tr.linearInterpolate(other.tr, t);
+        result.sc = sc.linearInterpolate(other.sc, t);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>& XfoT<real>::slerpInPlace(const XfoT<real> & other, const real & t)
+    {
+        XfoT<real> result;
+        ori.slerpInPlace(ori, other.ori, t);
+        tr.linearInterpolateInPlace(other.tr, t);
+        sc.linearInterpolateInPlace(other.sc, t);
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real> XfoT<real>::interpolate(const XfoT<real> & other, real t, SlerpMethod method) const
+    {
+        XfoT<real> result;
+        result.ori = ori.interpolate(other.ori, t, method);
+        result.tr = tr.linearInterpolate(other.tr, t);
+        result.sc = sc.linearInterpolate(other.sc, t);
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE real XfoT<real>::distanceTo(const XfoT<real> & other) const
+    {
+        return tr.distance(other.tr);
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real> XfoT<real>::mirror(const Vector3T<real>& center, const Vector3T<real>& normal, Axis primary, Axis secondary) const
+    {
+        XfoT<real> result;
+        result.tr = (tr-center).mirror(normal)+center;
+        result.ori = ori.mirror(normal, primary, secondary);
+        result.sc = sc;
+
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>& XfoT<real>::mirrorInPlace(const Vector3T<real>& center, const Vector3T<real>& normal, Axis primary, Axis secondary)
+    {   
+        tr = (tr-center).mirror(normal)+center;
+        ori.mirrorInPlace(normal, primary, secondary);
+
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real> XfoT<real>::mirror(CartesianPlane plane) const
+    {
+        Vector3T<real> normal;
+        Axis primary, secondary;
+        switch(plane) {
+            case CartesianPlane::XY: 
+                normal = Vector3T<real>::ZAXIS;
+                primary = Axis::POSX;
+                secondary = Axis::POSY;
+                break;
+            case CartesianPlane::YZ: 
+                normal = Vector3T<real>::XAXIS;
+                primary = Axis::POSY;
+                secondary = Axis::POSZ;
+                break;
+            case CartesianPlane::ZX: 
+                normal = Vector3T<real>::YAXIS;
+                primary = Axis::POSZ;
+                secondary = Axis::POSX;
+                break; 
+        }
+        XfoT<real> result;
+        result.tr  = tr.mirror(normal);
+        result.ori = ori.mirror(normal, primary, secondary);
+        result.sc  = sc;
+        return result;
+    }
+
+    template <typename real>
+    GMATH_INLINE XfoT<real>& XfoT<real>::mirrorInPlace(CartesianPlane plane)
+    {
+        Vector3T<real> normal;
+        Axis primary, secondary;
+        switch(plane) {
+            case CartesianPlane::XY: 
+                normal = Vector3T<real>::ZAXIS;
+                primary = Axis::POSX;
+                secondary = Axis::POSY;
+                break;
+            case CartesianPlane::YZ: 
+                normal = Vector3T<real>::XAXIS;
+                primary = Axis::POSY;
+                secondary = Axis::POSZ;
+                break;
+            case CartesianPlane::ZX: 
+                normal = Vector3T<real>::YAXIS;
+                primary = Axis::POSZ;
+                secondary = Axis::POSX;
+                break; 
+        }
+        tr.mirrorInPlace(normal);
+        ori.mirrorInPlace(normal, primary, secondary);
+        return *this;
+    }
+
+    template <typename real>
+    GMATH_INLINE std::string XfoT<real>::toString() const
+    {
+        std::stringstream oss;
+        oss << "gmath::Xfo(ori:" << ori.x << ", " << ori.y << ", " << ori.z << ", " << ori.w << std::endl;
+        oss << "           tr :" << tr.x  << ", " << tr.y  << ", " << tr.z  << std::endl;
+        oss << "           sc :" << sc.x  << ", " << sc.y  << ", " << sc.z  << ");";
+
+        return oss.str();
+    }
+
+    #ifdef CMAYA
+        template <typename real>
+        GMATH_INLINE void XfoT<real>::fromMayaMatrix(const MMatrix mmatrix)
+        {
+            Matrix4T<real> matrix;
+            matrix.fromMayaMatrix(mmatrix);
+            this->fromMatrix4(matrix);
+        }
+
+        template <typename real>
+        GMATH_INLINE MMatrix XfoT<real>::toMayaMatrix() const
+        {
+            return this->toMatrix4().toMayaMatrix();
+        }
+
+        /*------------- free functions ---------------*/
+
+        GMATH_INLINE Xfo getGlobalXfo(const MDagPath &path)
+        {
+            return Xfo(getGlobalMatrix(path));
+        }
+
+        GMATH_INLINE Xfo getGlobalXfo(const std::string &dagName)
+        {
+            return Xfo(getGlobalMatrix(dagName));
+        }
+
+        GMATH_INLINE void setGlobalXfo(MDagPath &path, const Xfo &xfo)
+        {
+            setGlobalMatrix(path, xfo.toMatrix4());
+        }
+
+        GMATH_INLINE void setGlobalXfo(const std::string &dagName, const Xfo &xfo)
+        {
+            setGlobalMatrix(dagName, xfo.toMatrix4());
+        }
+
+        GMATH_INLINE Xfo getLocalXfo(const MDagPath &path)
+        {
+            return Xfo(getLocalMatrix(path));   
+        }
+
+        GMATH_INLINE Xfo getLocalXfo(const std::string &dagName)
+        {
+            return Xfo(getLocalMatrix(dagName));
+        }
+        
+        GMATH_INLINE void setLocalXfo(MDagPath &path, const Xfo &xfo)
+        {
+            setLocalMatrix(path, xfo.toMatrix4());
+        }
+
+        GMATH_INLINE void setLocalXfo(const std::string &dagName, const Xfo &xfo)
+        {
+            setLocalMatrix(dagName, xfo.toMatrix4());
+        }
+    #endif
+}
\ No newline at end of file
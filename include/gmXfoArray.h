@@ -0,0 +1,65 @@
+#pragma once
+#define GMATH_XFOARRAY_BEGIN
+
+#include <vector>
+#include "gmRoot.h"
+#include "gmXfo.h"
+#include "gmVector3Array.h"
+#include "gmQuaternionArray.h"
+
+namespace gmath
+{
+    /**
+    Array of Xfo stored as a structure of arrays.
+
+    Like Xfo it is made of an orientation, a translation and a scale,
+    but each of them is an array class (QuaternionArray, Vector3Array).
+    The three arrays must always have the same size, use resize() to change it.
+    */
+    class XfoArray
+    {
+    public:
+        /*------ properties ------*/
+        QuaternionArray ori;
+        Vector3Array tr;
+        Vector3Array sc;
+
+        /*------ constructors ------*/
+        XfoArray();
+        explicit XfoArray(size_t size);
+        XfoArray(const Xfo* values, size_t count);
+        XfoArray(const std::vector<Xfo>& values);
+
+        /*------ size ------*/
+        size_t size() const;
+
+        /** Change the number of transforms. The existing ones are kept, the new ones are identities. */
+        void resize(size_t size);
+
+        /*------ access ------*/
+        Xfo get(size_t i) const;
+        void set(size_t i, const Xfo& xfo);
+
+        /*------ conversion ------*/
+        void fromXfos(const Xfo* values, size_t count);
+        void fromXfos(const std::vector<Xfo>& values);
+        void toXfos(Xfo* out) const;
+        std::vector<Xfo> toXfos() const;
+
+        /*------ bulk methods ------*/
+
+        /** out[i] = this[i] * other[i], see Xfo::operator *.
+            out is resized to size(), it can be this or other.
+            Throws GMathError, before touching out, if one of the Xfos of this array has non-uniform scaling. */
+        void multiply(const XfoArray& other, XfoArray& out) const;
+
+        /** out[i] = this[i].interpolate(other[i], t, method), see Xfo::interpolate.
+            out is resized to size(), it can be this or other. */
+        void slerp(const XfoArray& other, double t, XfoArray& out, SlerpMethod method=SlerpMethod::EXACT) const;
+    };
+}
+
+#ifdef GMATH_HEADER_ONLY
+    #define GMATH_XFOARRAY_END
+    #include "gmInline.h"
+#endif
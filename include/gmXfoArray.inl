@@ -0,0 +1,192 @@
+namespace gmath
+{
+    /*------ constructors ------*/
+
+    GMATH_INLINE XfoArray::XfoArray()
+    {
+    }
+
+    GMATH_INLINE XfoArray::XfoArray(size_t size)
+    {
+        resize(size);
+    }
+
+    GMATH_INLINE XfoArray::XfoArray(const Xfo* values, size_t count)
+    {
+        fromXfos(values, count);
+    }
+
+    GMATH_INLINE XfoArray::XfoArray(const std::vector<Xfo>& values)
+    {
+        fromXfos(values);
+    }
+
+    /*------ size ------*/
+
+    GMATH_INLINE size_t XfoArray::size() const
+    {
+        return ori.size();
+    }
+
+    GMATH_INLINE void XfoArray::resize(size_t size)
+    {
+        size_t oldSize = sc.size();
+        ori.resize(size);
+        tr.resize(size);
+        sc.resize(size);
+
+        for (size_t i=oldSize; i<size; i++)
+        {
+            sc.x()[i] = 1.0;
+            sc.y()[i] = 1.0;
+            sc.z()[i] = 1.0;
+        }
+    }
+
+    /*------ access ------*/
+
+    GMATH_INLINE Xfo XfoArray::get(size_t i) const
+    {
+        return Xfo(ori.get(i), tr.get(i), sc.get(i));
+    }
+
+    GMATH_INLINE void XfoArray::set(size_t i, const Xfo& xfo)
+    {
+        ori.set(i, xfo.ori);
+        tr.set(i, xfo.tr);
+        sc.set(i, xfo.sc);
+    }
+
+    /*------ conversion ------*/
+
+    GMATH_INLINE void XfoArray::fromXfos(const Xfo* values, size_t count)
+    {
+        resize(count);
+        for (size_t i=0; i<count; i++)
+        {
+            ori.x()[i] = values[i].ori.x;
+            ori.y()[i] = values[i].ori.y;
+            ori.z()[i] = values[i].ori.z;
+            ori.w()[i] = values[i].ori.w;
+            tr.x()[i] = values[i].tr.x;
+            tr.y()[i] = values[i].tr.y;
+            tr.z()[i] = values[i].tr.z;
+            sc.x()[i] = values[i].sc.x;
+            sc.y()[i] = values[i].sc.y;
+            sc.z()[i] = values[i].sc.z;
+        }
+    }
+
+    GMATH_INLINE void XfoArray::fromXfos(const std::vector<Xfo>& values)
+    {
+        fromXfos(values.empty() ? NULL : &values[0], values.size());
+    }
+
+    GMATH_INLINE void XfoArray::toXfos(Xfo* out) const
+    {
+        for (size_t i=0; i<size(); i++)
+        {
+            out[i].ori.set(ori.x()[i], ori.y()[i], ori.z()[i], ori.w()[i]);
+            out[i].tr.set(tr.x()[i], tr.y()[i], tr.z()[i]);
+            out[i].sc.set(sc.x()[i], sc.y()[i], sc.z()[i]);
+        }
+    }
+
+    GMATH_INLINE std::vector<Xfo> XfoArray::toXfos() const
+    {
+        std::vector<Xfo> result(size());
+        if (!result.empty())
+            toXfos(&result[0]);
+        return result;
+    }
+
+    /*------ bulk methods ------*/
+
+    GMATH_INLINE void XfoArray::multiply(const XfoArray& other, XfoArray& out) const
+    {
+        const size_t count = size();
+        if (other.size() != count)
+            throw GMathError("XfoArray.multiply: the two arrays must have the same size");
+
+        const double* sx = sc.x();
+        const double* sy = sc.y();
+        const double* sz = sc.z();
+        for (size_t i=0; i<count; i++)
+        {
+            if (!detail::hasUniformScale(sx[i], sy[i], sz[i]))
+                throw GMathError("XfoArray.multiply: Cannot multiply to xfos when having non-uniform scaling without causing shearing. Use Matrix4s instead.");
+        }
+
+        out.resize(count);
+
+        simd::QuaternionSoa thisOri = ori.soa(), otherOri = other.ori.soa(), outOri = out.ori.soa();
+        simd::Vector3Soa thisTr = tr.soa(), otherTr = other.tr.soa(), outTr = out.tr.soa();
+        simd::Vector3Soa thisSc = sc.soa(), otherSc = other.sc.soa(), outSc = out.sc.soa();
+
+        // Work in blocks small enough for the stack, inside a block every input is read
+        // before the matching output is written, so out can be this or other.
+        const size_t BLOCK = 256;
+        double tx[BLOCK], ty[BLOCK], tz[BLOCK];
+        simd::Vector3Soa tmp = { tx, ty, tz };
+
+        for (size_t begin=0; begin<count; begin+=BLOCK)
+        {
+            size_t n = count-begin < BLOCK ? count-begin : BLOCK;
+            size_t end = begin+n;
+
+            // tr = other.tr + other.ori.rotateVector(this.tr * other.sc)
+            for (size_t i=begin; i<end; i++)
+            {
+                tx[i-begin] = thisTr.x[i] * otherSc.x[i];
+                ty[i-begin] = thisTr.y[i] * otherSc.y[i];
+                tz[i-begin] = thisTr.z[i] * otherSc.z[i];
+            }
+            simd::QuaternionSoa blockOri = { otherOri.x+begin, otherOri.y+begin, otherOri.z+begin, otherOri.w+begin };
+            simd::rotateVectors(blockOri, tmp, tmp, n);
+            for (size_t i=begin; i<end; i++)
+            {
+                outTr.x[i] = otherTr.x[i] + tx[i-begin];
+                outTr.y[i] = otherTr.y[i] + ty[i-begin];
+                outTr.z[i] = otherTr.z[i] + tz[i-begin];
+            }
+        }
+
+        // ori = (this.ori * other.ori).normalize()
+        simd::multiplyQuaternions(thisOri, otherOri, outOri, count);
+        simd::normalizeQuaternions(outOri, count);
+
+        // sc = this.sc * other.sc
+        for (size_t i=0; i<count; i++)
+        {
+            outSc.x[i] = thisSc.x[i] * otherSc.x[i];
+            outSc.y[i] = thisSc.y[i] * otherSc.y[i];
+            outSc.z[i] = thisSc.z[i] * otherSc.z[i];
+        }
+    }
+    namespace detail
+    {
+        // out = (b - a) * t + a, like Vector3::linearInterpolate
+        GMATH_INLINE void linearInterpolateVectors(const simd::Vector3Soa& a, const simd::Vector3Soa& b, double t,
+                                                   const simd::Vector3Soa& out, size_t count)
+        {
+            for (size_t i=0; i<count; i++)
+            {
+                out.x[i] = (b.x[i] - a.x[i]) * t + a.x[i];
+                out.y[i] = (b.y[i] - a.y[i]) * t + a.y[i];
+                out.z[i] = (b.z[i] - a.z[i]) * t + a.z[i];
+            }
+        }
+    }
+
+    GMATH_INLINE void XfoArray::slerp(const XfoArray& other, double t, XfoArray& out, SlerpMethod method) const
+    {
+        const size_t count = size();
+        if (other.size() != count)
+            throw GMathError("XfoArray.slerp: the two arrays must have the same size");
+
+        out.resize(count);
+        ori.slerp(other.ori, t, out.ori, method);
+        detail::linearInterpolateVectors(tr.soa(), other.tr.soa(), t, out.tr.soa(), count);
+        detail::linearInterpolateVectors(sc.soa(), other.sc.soa(), t, out.sc.soa(), count);
+    }
+}
@@ -0,0 +1,5 @@
+#include "gmBatch.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmBatch.inl"
+#endif
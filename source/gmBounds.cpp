@@ -0,0 +1,5 @@
+#include "gmBounds.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmBounds.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "gmBvh.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmBvh.inl"
+#endif
@@ -0,0 +1,22 @@
+#include "gmRoot.h"
+#include "gmDualQuaternion.h"
+
+using namespace std;
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmDualQuaternion.inl"
+
+namespace gmath
+{
+    template class DualQuaternionT<float>;
+    template class DualQuaternionT<double>;
+    template DualQuaternionT<float>::DualQuaternionT(const DualQuaternionT<double>&);
+    template DualQuaternionT<double>::DualQuaternionT(const DualQuaternionT<float>&);
+
+    namespace detail
+    {
+        template void decomposeRigid(const Matrix4T<float>&, QuaternionT<float>&, Vector3T<float>&, Vector3T<float>&);
+        template void decomposeRigid(const Matrix4T<double>&, QuaternionT<double>&, Vector3T<double>&, Vector3T<double>&);
+    }
+}
+#endif
@@ -0,0 +1,5 @@
+#include "gmFrustum.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmFrustum.inl"
+#endif
@@ -0,0 +1,11 @@
+#include "gmInverseCachedTransform.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmInverseCachedTransform.inl"
+
+namespace gmath
+{
+    template class InverseCachedTransform<Xfo>;
+    template class InverseCachedTransform<Matrix4>;
+}
+#endif
@@ -0,0 +1,5 @@
+#include "gmParallel.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmParallel.inl"
+#endif
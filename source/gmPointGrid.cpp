@@ -0,0 +1,5 @@
+#include "gmPointGrid.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmPointGrid.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "gmQuaternionArray.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmQuaternionArray.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "gmSimd.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmSimd.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "gmSkinning.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmSkinning.inl"
+#endif
@@ -0,0 +1,11 @@
+#include "gmTransformCache.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmTransformCache.inl"
+
+namespace gmath
+{
+    template class TransformCache<Xfo>;
+    template class TransformCache<Matrix4>;
+}
+#endif
@@ -0,0 +1,5 @@
+#include "gmTransformHierarchy.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmTransformHierarchy.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "gmVector3Array.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmVector3Array.inl"
+#endif
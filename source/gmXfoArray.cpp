@@ -0,0 +1,5 @@
+#include "gmXfoArray.h"
+
+#ifndef GMATH_HEADER_ONLY
+    #include "gmXfoArray.inl"
+#endif